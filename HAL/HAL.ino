@@ -10,12 +10,15 @@
   objects are created and interact with one another. The display is the user interface
   (UI) that is used to set the three different settings (Level of Conciousness - LOC,
   Airway - Air, Circulation - Pulse). The first few states are where Head's state
-  variables are set by the UI. The final "StartSimulationState" is where the head
-  completes the desired test. The "head.LOCTEST()" function runs the LOC test with
-  all the setting in place for all tests (LOC, Airway, and Circulation). Therefore,
-  once the LOC test is complete, HAL will be idleing and the user can perform the
-  Airway and Circulation tests. Due to time constraints and unforeseen circumstances,
-  there is not a built in feature that ends the simulation. Several of the Serial.print
+  variables are set by the UI. Once the simulation starts, the head completes the
+  desired test every loop (see runSimulation()), even while the menus are open, so the
+  settings can be changed while the test is running. The "head.LOCTEST()" function
+  runs the LOC test with all the setting in place for all tests (LOC, Airway, and
+  Circulation). Therefore, once the LOC test is complete, HAL will be idleing and the
+  user can perform the Airway and Circulation tests. The "runScenario()" function runs
+  the LOC test from a scenario file on the SD card instead (see scenario.h), so the
+  script can be changed without uploading the code again. The simulation is ended with
+  "Stop" in the start menu or the "stop" console command (see stopSimulation()). Several of the Serial.print
   messages can be commented out without affecting the code but are very useful
   when debugging.
 
@@ -33,26 +36,35 @@
 #include <SPI.h>
 #include <SD.h>
 #include <SerialFlash.h>
+#include <ADC.h>
 
 //Include Header Files and Necessary Classes
+#include "voiceDetector.h" // audio library object used in pinSetUp.h
+#include "audioBlockMonitor.h" // audio library object used in pinSetUp.h
 #include "pinSetUp.h"
 #include "helperFunctions.h"
 #include "head.h"
 #include "userInterface.h"
+#include "headBehaviors.h" // named movements used by the scenario files and the console
+#include "scenario.h"
+#include "console.h"
 
 //Create Head and UI Objects
 Head head = Head();
 Display LCD = Display();
+Scenario scenario = Scenario(); // LOC test script loaded from the SD card (see scenario.h)
+Console console = Console(); // commands and telemetry over USB serial (see console.h)
 
 // State Vairable for the Overall System (Comment out the state that is not being used)
 // The StartSimulationState is used for skipping past the user input and only uses default values.
 // Case variables are defined as globals (see pinSetUp.h).
 volatile byte state = PreSimulationState; // For Full Code
+int changeState; // state picked in the "Change Settings?" menu
 //volatile byte state = StartSimulationState; // For Skipping to a Test
 
 // Set up - runs once on start up
 void setup() {
-  Serial.begin(9600);
+  Serial.begin(9600);  // the Teensy USB serial always runs at full USB speed, the baud rate is ignored
   Serial.println("Initializing HAL's Brain...");
 
   //Start the PWM servos
@@ -66,10 +78,88 @@ void setup() {
   pwm2.setPWMFreq(60);
   pwm3.setPWMFreq(60);
 
+  //Read the force sensors and pots on ADC1 with the same 0-1023 range as analogRead() (see pinSetUp.h)
+  adc->adc1->setResolution(10);
+
   //Set up and initialize the head and LCD
+  resetServoDegrees();
   head.setUp();
   LCD.setUp();
+  scenario.setUp(head);
+  console.setUp(head, scenario);
+  if (state == StartSimulationState) {  // skipping to a test
+    startSim = 1;
+  }
+
+}
+
+
+/*
+   startScenario - load the scenario file for the LOC that was set from the SD card (see scenario.h).
+                   If there is no file, the built in LOC test is used and its prompts are cached instead.
+*/
+void startScenario() {
+  if (!scenario.loadForLOC()) {
+    Serial.print("Scenario not loaded, using the built in LOC test: "); Serial.println(scenario.getError());
+    head.loadPrompts();
+  }
+}
+
+/*
+   runScenario - run the scenario file for the LOC, or the built in LOC test if there is no file.
+                 The file for the new LOC is loaded if the LOC is changed while the simulation is running.
+*/
+void runScenario() {
+  if (scenario.getLOC() != head.getLOC()) {
+    startScenario();
+  }
+  if (scenario.isReady()) {
+    scenario.update();
+  } else {
+    head.LOCTEST();
+  }
+}
+
+/*
+   stopSimulation - stop everything the simulation started (the pulse, the breathing, the voice and the sound effects)
+                    and go back to the menu. Used by both the LCD menu and the console.
+*/
+void stopSimulation() {
+  head.pulse.stopPulse();   // stop the pulse timer and turn the solenoids off
+  head.breathing.stop();    // turn the breathing sounds off and move the jaw back to neutral
+  head.voice.stop();        // stop the prompt that is playing and the ones waiting
+  head.sound.stopEffect();
+  LCD.resetMenu();
+  startSim = 2;
+  state = PreSimulationState;
+  Serial.println("Simulation stopped");
+}
+
+/*
+   runSimulation - Runs the test every loop once the simulation has started, including while the
+                   instructor is in the menu changing the settings.
+*/
+void runSimulation() {
+  // Run the test - the scenario file from the SD card, or the LOC test in head.h if there is no file
+  runScenario();
+  //      head.LOCTEST();
+
+  // The tests below were used for testing each component of the head before
+  // integrating it with the rest of the system. To run these, use the "StartSimulationState"
+  // as the starting state (see the state variable above). Then uncomment any of the functions below. The
+  // functions below were used often to test various parts of the code.
 
+  //      head.jawTest();
+  //      head.voiceTest();
+  //      head.headLoop();
+  //      head.fsrTest();
+  //      head.fsrCalibrationTest();
+  //      head.pulseTest();
+  //      head.breathingTest();
+  //      head.followHandTest();
+  //      head.latencyTest();
+  //      head.audioBenchmarkTest();
+  //      head.micTest();
 }
 
 
@@ -82,10 +172,27 @@ void loop() {
     int column;
     int row;
 
+    LCD.update();   // read the buttons (see userInterface.h) - none of the menus below wait for the user
+    head.fsrArray.update();   // scan the force sensors every 5 ms no matter which test or menu is running (see fsrArray.h)
+
+    switch (console.update()) {   // commands typed over USB serial (see console.h)
+    case consoleStart:
+      LCD.resetMenu();
+      startSim = 1;
+      startScenario();
+      state = StartSimulationState;
+      break;
+    case consoleStop:
+      stopSimulation();
+      break;
+    }
+
     switch (state) {
     case PreSimulationState:    //************************************** PRE SIMULATION STATE **********************************
       // Check what settings are left and return to the appropriate menu display
-      if (head.isAllSet() && startSim == 2) {
+      if (startSim == 1) {      // a setting was changed while the simulation is running
+        state = StartSimulationState;
+      } else if (head.isAllSet() && startSim == 2) {
         state = CheckStartSimState;
       } else if (head.isAllSet() && startSim == 0) {
         startSim = 2;
@@ -96,14 +203,20 @@ void loop() {
       break;
 
     case StartMenuState:    //************************************** STARTING MAIN MENU**********************************
-      LCD.startScreen();
-      cell = LCD.checkSelection(false); // Enters While loop waiting for user input
+      cell = LCD.startMenu(startSim == 1);
+      if (cell == NULL) {   // still waiting for user input
+        break;
+      }
       column = cell[0];
       row = cell[1];
       printColumnRow(column, row);
 
-      // Cursor was on the wrong row
-      if (row == 0) {
+      // Top row - stop the simulation, go back to it, or the cursor was on the wrong row
+      if (row == 0 && startSim == 1 && column >= stopSimCell) {
+        stopSimulation();
+      } else if (row == 0 && startSim == 1) {
+        state = StartSimulationState;   // go back to the simulation without changing anything
+      } else if (row == 0) {
         Serial.println("Wrong row.");
       }
       // *********If LOC was selected*********
@@ -111,7 +224,7 @@ void loop() {
         state = LOCSettingState;
         Serial.println("Switch to LOC Set");
       } else if (column == LOCCell && head.isLOCSet) {  // do you actually want to make a change to previously set setting?
-        state = LCD.checkIfChangeSettings(LOCSettingState, "LOC");
+        state = ChangeLOCState;
       }
 
       // *********If AIRWAY was selected************
@@ -119,7 +232,7 @@ void loop() {
         state = AirwaySettingState;
         Serial.println("Switch to Airway Set");
       } else if (column == airwayCell && head.isAirSet) {   // do you actually want to make a change to previously set setting?
-        state = LCD.checkIfChangeSettings(AirwaySettingState, "Airway");
+        state = ChangeAirwayState;
       }
 
       // **********If PULSE was selected*********
@@ -127,21 +240,47 @@ void loop() {
         state = PulseSettingState;
         Serial.println("Switch to Pulse Set");
       } else if (column == pulseCell && head.isPulseSet) {// do you actually want to make a change to previously set setting?
-        state = LCD.checkIfChangeSettings(PulseSettingState, "Pulse");
+        state = ChangePulseState;
+      }
+      break;
+
+    case ChangeLOCState:    //******************************** Change a Setting**********************
+      changeState = LCD.checkIfChangeSettings(LOCSettingState, "LOC");
+      if (changeState >= 0) {
+        state = changeState;
+      }
+      break;
+
+    case ChangeAirwayState:
+      changeState = LCD.checkIfChangeSettings(AirwaySettingState, "Airway");
+      if (changeState >= 0) {
+        state = changeState;
+      }
+      break;
+
+    case ChangePulseState:
+      changeState = LCD.checkIfChangeSettings(PulseSettingState, "Pulse");
+      if (changeState >= 0) {
+        state = changeState;
       }
       break;
 
     case LOCSettingState:    //******************************** LOC Setting**********************
       int stateLOC;
       stateLOC = LCD.setLOC();    // get user input
+      if (stateLOC < 0) {
+        break;
+      }
       head.setLOC(stateLOC);      // pass setting into Head Class
       state = PreSimulationState; // return to pre sim state
       break;
 
     case AirwaySettingState:    //************************************** AIRWAY  Setting**********************************
-      Serial.println("Set  Airway");
       boolean *airSettings;
       airSettings = LCD.setAirway();  // get user input
+      if (airSettings == NULL) {
+        break;
+      }
       head.setAir(airSettings);       // pass setting into Head Class
       state = PreSimulationState;     // return to pre sim state
       break;
@@ -149,6 +288,9 @@ void loop() {
     case PulseSettingState:     //************************************** PULSE  Setting**********************************
       int *pulseArray;
       pulseArray = LCD.setPulse();          // get user input
+      if (pulseArray == NULL) {
+        break;
+      }
       if (pulseArray[0] == 0) {
         head.setPulseBPM(pulseArray[1]);    // pass a certain BPM into Head Class
       } else if (pulseArray[0] == 1) {
@@ -158,32 +300,28 @@ void loop() {
       break;
 
     case CheckStartSimState:      //************************************** Check to Start SIM**********************************
-      if (LCD.checkStartSim()) {    // get user input to check if want to start simulation or go back and change settings
+      int startChoice;
+      startChoice = LCD.checkStartSim();  // get user input to check if want to start simulation or go back and change settings
+      if (startChoice == 1) {
         startSim = 1;
+        startScenario();            // load the scenario file and copy its prompts into the prompt cache
         state = StartSimulationState;
-      } else {
+      } else if (startChoice == 0) {
         startSim = 0;
         state = PreSimulationState;
       }
       break;
 
     case StartSimulationState:    //**************************************STARTING SIMULATION**********************************
-      // Run the test
-    //      head.LOCTEST();
-
-      // The tests below were used for testing each component of the head before
-      // integrating it with the rest of the system. To run these, use the "StartSimulationState"
-      // for the state of this switch case. Then uncomment any of the functions below. The
-      // functions below were used often to test various parts of the code.
-
-      //      head.jawTest();
-      //      head.voiceTest();
-      //      head.headLoop();
-      //      head.fsrTest();
-      //      head.pulseTest();
-      //      head.followHand();
-      //      head.micTest();
+      // The simulation runs below. Pressing SELECT opens the menu so the settings can be changed while it runs.
+      if (LCD.checkOpenMenu()) {
+        state = StartMenuState;
+      }
       break;
     }
 
+    if (startSim == 1) {
+      runSimulation();
+    }
+
 }
@@ -0,0 +1,254 @@
+/**********************************************************************************
+  audioBenchmark.h
+
+  This file contains the class definition, attributes, and methods of the AudioBenchmark.
+  It plays every prompt in the library one after another while the rest of HAL is busy
+  (see audioBenchmarkTest() in head.h) and reports for each prompt:
+      - the time to start the player (queue to play(), see voice.h)
+      - the time until the prompt makes sound (queue to the first audio block, measured
+        by the AudioBlockMonitor in pinSetUp.h)
+      - the number of underruns (blocks missing in the middle of the prompt), late audio
+        updates and the longest time between audio updates (see audioBlockMonitor.h)
+      - the most CPU and audio memory the audio library used while it played
+        (AudioProcessorUsageMax() and AudioMemoryUsageMax())
+  The prompts are copied into the prompt cache first, the same way a scenario does it
+  (see promptCache.h), so the benchmark times the path the simulation uses.
+
+  In simulation mode the prompts are still played through the voice queue and the cache,
+  and a slow SD card is added on top for the prompts that play from the SD card (not the
+  cached ones): the block monitor spends the time of opening the file and of each modeled
+  512 byte sector read (with occasional stalls) in the audio interrupt. A read that takes
+  longer than the time left in the block shows up as a late update and an underrun, so the
+  results can be compared with a fast card on the same hardware.
+
+  update() does not wait, so the servos, sensors and pulse keep running the whole time.
+ *********************************************************************************/
+#include <Arduino.h>
+
+class AudioBenchmark {
+  private:
+    Voice *voice = NULL;
+
+    // PROMPT LIBRARY
+    static const int maxPrompts = 24;
+    char names[maxPrompts][13];
+    int numPrompts = 0;
+
+    // RESULTS FOR EACH PROMPT
+    struct PromptResult {
+      boolean isPlayed;
+      unsigned long startLatency;   // queue to play() (us)
+      unsigned long soundLatency;   // queue to the first audio block (us)
+      unsigned long underruns;
+      unsigned long lateUpdates;
+      unsigned long maxInterval;    // longest time between audio updates (us)
+      float cpuMax;                 // percent
+      int memoryMax;                // audio blocks
+    };
+    PromptResult results[maxPrompts];
+
+    // STATE
+    int state = 0;                 // 0 = not started, 1 = playing a prompt, 2 = pause between prompts, 3 = done
+    int promptNum = 0;
+    unsigned long queueTime = 0;   // us
+    unsigned long pauseStart = 0;  // ms
+    const unsigned long pauseTime = 300;   // pause between prompts (ms)
+    volatile boolean isPromptDone = false;
+    boolean isPromptFinished = false;
+    boolean isSimulation = false;
+
+    /*
+       promptDone - called by the voice when the prompt is finished or could not be played
+    */
+    static void promptDone(void *context, const char *filename, boolean isFinished) {
+      AudioBenchmark *benchmark = (AudioBenchmark *)context;
+      benchmark->isPromptFinished = isFinished;
+      benchmark->isPromptDone = true;
+    }
+
+    /*
+       startPrompt - start the next prompt with the monitor armed
+    */
+    void startPrompt() {
+      AudioProcessorUsageMaxReset();
+      AudioMemoryUsageMaxReset();
+      speechMonitor.arm(!voice->isCached(names[promptNum]));
+      isPromptDone = false;
+      queueTime = micros();
+      if (!voice->queuePrompt(names[promptNum], promptNormal, promptDone, this)) {
+        isPromptDone = true;
+        isPromptFinished = false;
+      }
+      state = 1;
+    }
+
+    /*
+       recordPrompt - save the results of the prompt that just finished
+    */
+    void recordPrompt() {
+      speechMonitor.disarm();
+      PromptResult &result = results[promptNum];
+      result.isPlayed = isPromptFinished;
+      result.startLatency = voice->getStartLatency();
+      unsigned long firstBlock = speechMonitor.getFirstBlockTime();
+      result.soundLatency = firstBlock == 0 ? 0 : firstBlock - queueTime;
+      result.underruns = speechMonitor.getNumUnderruns();
+      result.lateUpdates = speechMonitor.getNumLate();
+      result.maxInterval = speechMonitor.getMaxInterval();
+      result.cpuMax = AudioProcessorUsageMax();
+      result.memoryMax = AudioMemoryUsageMax();
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the benchmark
+    AudioBenchmark() {
+    }
+
+    /*
+       setUp - give the benchmark the voice that plays the prompts
+    */
+    void setUp(Voice &headVoice) {
+      voice = &headVoice;
+    }
+
+    /*
+       setSimulation - add a modeled slow SD card to the audio interrupt while the prompts play (see audioBlockMonitor.h)
+    */
+    void setSimulation(boolean isOn) {
+      isSimulation = isOn;
+      speechMonitor.setReadModel(isOn);
+    }
+
+    //************************************************PROMPT LIBRARY********************************
+    /*
+       findPrompts - add every WAV file in the top folder of the SD card to the library
+            return int - number of prompts in the library
+    */
+    int findPrompts() {
+      File root = SD.open("/");
+      if (!root) {
+        return numPrompts;
+      }
+      while (numPrompts < maxPrompts) {
+        File file = root.openNextFile();
+        if (!file) {
+          break;
+        }
+        const char *name = file.name();
+        int length = strlen(name);
+        if (!file.isDirectory() && length > 4 && length < 13 && strcasecmp(name + length - 4, ".WAV") == 0) {
+          addPrompt(name);
+        }
+        file.close();
+      }
+      root.close();
+      return numPrompts;
+    }
+
+    /*
+       addPrompt - add a prompt to the library
+            const char *filename - file name in ALL CAPS with a ".WAV" at the end
+    */
+    void addPrompt(const char *filename) {
+      if (numPrompts == maxPrompts) {
+        return;
+      }
+      strncpy(names[numPrompts], filename, sizeof(names[numPrompts]) - 1);
+      names[numPrompts][sizeof(names[numPrompts]) - 1] = '\0';
+      numPrompts++;
+    }
+
+    //************************************************RUNNING********************************
+    /*
+       start - copy the library into the prompt cache and start playing it from the first prompt
+    */
+    void start() {
+      const char *filenames[maxPrompts];
+      for (int i = 0; i < numPrompts; i++) {
+        filenames[i] = names[i];
+      }
+      voice->loadScenario(filenames, numPrompts);
+      promptNum = 0;
+      state = numPrompts > 0 ? 2 : 3;
+      pauseStart = millis() - pauseTime;
+      Serial.print("Audio benchmark with prompts = "); Serial.println(numPrompts);
+    }
+
+    /*
+       update - play the next prompt or record the one that finished. Call this every loop (it does not wait).
+            return boolean - true once, when the last prompt is done
+    */
+    boolean update() {
+      switch (state) {
+        case 1:   // playing a prompt
+          if (isPromptDone) {
+            recordPrompt();
+            promptNum++;
+            pauseStart = millis();
+            state = 2;
+          }
+          break;
+
+        case 2:   // pause between prompts so the results of one do not run into the next
+          if (promptNum >= numPrompts) {
+            state = 3;
+            return true;
+          }
+          if (millis() - pauseStart >= pauseTime) {
+            startPrompt();
+          }
+          break;
+      }
+      return false;
+    }
+
+    /*
+       isDone - true when every prompt has been played
+    */
+    boolean isDone() {
+      return state == 3;
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       printReport - print the results of every prompt and the worst case
+    */
+    void printReport() {
+      Serial.println(isSimulation ? "AUDIO BENCHMARK (simulated SD card)" : "AUDIO BENCHMARK");
+      Serial.println("Prompt\tStart (ms)\tSound (ms)\tUnderruns\tLate\tGap max (ms)\tCPU max (%)\tBlocks max");
+      unsigned long worstSound = 0;
+      unsigned long totalUnderruns = 0;
+      unsigned long worstGap = 0;
+      float worstCpu = 0;
+      int worstMemory = 0;
+      int numFailed = 0;
+      for (int i = 0; i < numPrompts; i++) {
+        PromptResult &result = results[i];
+        Serial.print(names[i]); Serial.print("\t");
+        if (!result.isPlayed) {
+          Serial.println("could not be played");
+          numFailed++;
+          continue;
+        }
+        Serial.print(result.startLatency / 1000.0, 1); Serial.print("\t\t");
+        Serial.print(result.soundLatency / 1000.0, 1); Serial.print("\t\t");
+        Serial.print(result.underruns); Serial.print("\t\t");
+        Serial.print(result.lateUpdates); Serial.print("\t");
+        Serial.print(result.maxInterval / 1000.0, 1); Serial.print("\t\t");
+        Serial.print(result.cpuMax, 1); Serial.print("\t\t");
+        Serial.print(result.memoryMax); Serial.print(" of "); Serial.println(audioMemoryBlocks);
+        worstSound = max(worstSound, result.soundLatency);
+        worstGap = max(worstGap, result.maxInterval);
+        totalUnderruns += result.underruns;
+        worstCpu = max(worstCpu, result.cpuMax);
+        worstMemory = max(worstMemory, result.memoryMax);
+      }
+      Serial.print("Worst sound latency (ms) = "); Serial.print(worstSound / 1000.0, 1);
+      Serial.print("  Underruns = "); Serial.print(totalUnderruns);
+      Serial.print("  Gap max (ms) = "); Serial.print(worstGap / 1000.0, 1);
+      Serial.print("  CPU max (%) = "); Serial.print(worstCpu, 1);
+      Serial.print("  Blocks max = "); Serial.print(worstMemory); Serial.print(" of "); Serial.print(audioMemoryBlocks);
+      Serial.print("  Failed = "); Serial.println(numFailed);
+    }
+};
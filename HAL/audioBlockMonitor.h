@@ -0,0 +1,223 @@
+/**********************************************************************************
+  audioBlockMonitor.h
+
+  This file contains the class definition, attributes, and methods of the AudioBlockMonitor.
+  The AudioBlockMonitor is an object in the Teensy audio library graph (see pinSetUp.h)
+  that watches the speech before it goes to the speaker. It is used by the audio
+  benchmark (see audioBenchmark.h). Every audio update (2.9 ms) it checks:
+      - when the first block of a prompt arrives (the time the prompt makes sound)
+      - gaps in the middle of a prompt where no block arrived (an underrun - the SD
+        card did not give the player its samples in time)
+      - the time between audio updates, and the updates that came late (the audio
+        interrupt was held off too long, ex. by a slow SD card read in a player)
+  It only reads the blocks, so it does not use any audio memory.
+
+  It can also model a slow SD card (see setReadModel()). The time of each modeled sector
+  read is spent in the audio interrupt, the same place the players read the card, so the
+  prompts still play through the voice queue and the prompt cache and the stalls show up
+  in the results like real ones. The model is only used for prompts that play from the SD
+  card (see arm()). Before the first block of those, the reads that open the file and its
+  header are modeled too, and the first block counts from after them.
+
+  The update() function runs in the audio library interrupt and only writes the
+  results. The loop only reads them, or resets them with arm() between prompts.
+ *********************************************************************************/
+#include <Arduino.h>
+#include <Audio.h>
+
+class AudioBlockMonitor : public AudioStream {
+  private:
+    audio_block_t *inputQueueArray[1];
+
+    const unsigned long blockUs = 2902;   // time of one block of 128 samples at 44.1 kHz (us)
+
+    // RESULTS (written by update())
+    volatile boolean isArmed = false;
+    volatile unsigned long firstBlockTime = 0;  // time the first block arrived after arm() (us), 0 if none yet
+    volatile unsigned long numBlocks = 0;
+    volatile unsigned long numMissing = 0;      // updates with no block since the last block
+    volatile unsigned long numUnderruns = 0;    // missing blocks in the middle of a prompt
+    volatile unsigned long numLate = 0;         // updates that came more than half a block late
+    volatile unsigned long maxInterval = 0;     // longest time between two updates since arm() (us)
+    volatile unsigned long lastUpdateTime = 0;
+
+    // SD CARD MODEL (only while armed with a prompt from the SD card)
+    volatile boolean isModelOn = false;
+    volatile boolean isFromSd = false;  // the armed prompt plays from the SD card
+    const int openSectors = 3;          // sectors read before the first block (directory entry, FAT and WAV header)
+    unsigned long minReadUs = 0;        // time to read one 512 byte sector (us)
+    unsigned long maxReadUs = 0;
+    unsigned long stallPerMillion = 0;  // chance a sector read stalls (out of a million)
+    unsigned long minStallUs = 0;
+    unsigned long maxStallUs = 0;
+    uint32_t seed = 12345;              // own random numbers, random() is used by the loop
+    boolean isSecondBlock = false;      // a 512 byte sector is 2 blocks of mono samples
+
+    /*
+       nextRandom - random number for the SD card model (xorshift, safe to use in the interrupt)
+    */
+    uint32_t nextRandom() {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      return seed;
+    }
+
+    /*
+       modelSector - spend the time of one modeled sector read
+    */
+    void modelSector() {
+      unsigned long read = minReadUs + nextRandom() % (maxReadUs - minReadUs + 1);
+      if (nextRandom() % 1000000 < stallPerMillion) {
+        read += minStallUs + nextRandom() % (maxStallUs - minStallUs + 1);
+      }
+      delayMicroseconds(read);
+    }
+
+    /*
+       modelRead - spend the time of the modeled reads for one block
+    */
+    void modelRead() {
+      isSecondBlock = !isSecondBlock;
+      if (isSecondBlock) {
+        modelSector();
+      }
+    }
+
+    /*
+       modelOpen - spend the time of the modeled reads that open the file before its first block
+    */
+    void modelOpen() {
+      for (int i = 0; i < openSectors; i++) {
+        modelSector();
+      }
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the monitor - one input
+    AudioBlockMonitor() : AudioStream(1, inputQueueArray) {
+    }
+
+    /*
+       arm - reset the results before starting a prompt
+            boolean fromSd - true if the prompt plays from the SD card (the SD card model is only used for it)
+    */
+    void arm(boolean fromSd) {
+      AudioNoInterrupts();
+      isFromSd = fromSd;
+      firstBlockTime = 0;
+      numBlocks = 0;
+      numMissing = 0;
+      numUnderruns = 0;
+      numLate = 0;
+      maxInterval = 0;
+      isSecondBlock = false;
+      isArmed = true;
+      AudioInterrupts();
+    }
+
+    /*
+       disarm - stop counting (ex. after the prompt is done)
+    */
+    void disarm() {
+      isArmed = false;
+    }
+
+    /*
+       setReadModel - model a slow SD card while armed (see the top of this file)
+            boolean isOn - true to add the modeled reads to the audio interrupt
+            unsigned long minRead, maxRead - time to read one sector (us)
+            float stallChance - chance a sector read stalls
+            unsigned long minStall, maxStall - extra time of a stall (us)
+    */
+    void setReadModel(boolean isOn, unsigned long minRead = 200, unsigned long maxRead = 600, float stallChance = 0.0005,
+                      unsigned long minStall = 2000, unsigned long maxStall = 10000) {
+      AudioNoInterrupts();
+      minReadUs = minRead;
+      maxReadUs = max(minRead, maxRead);
+      stallPerMillion = stallChance * 1000000;
+      minStallUs = minStall;
+      maxStallUs = max(minStall, maxStall);
+      isModelOn = isOn;
+      AudioInterrupts();
+    }
+
+    //************************************************AUDIO UPDATE********************************
+    /*
+       update - called by the audio library every block
+    */
+    virtual void update(void) {
+      unsigned long timeNow = micros();
+      if (isArmed && lastUpdateTime != 0) {
+        unsigned long interval = timeNow - lastUpdateTime;
+        if (interval > maxInterval) {
+          maxInterval = interval;
+        }
+        if (interval > blockUs + blockUs / 2) {
+          numLate++;
+        }
+      }
+      lastUpdateTime = timeNow;
+      audio_block_t *block = receiveReadOnly(0);
+      if (block == NULL) {
+        if (isArmed && numBlocks > 0) {
+          numMissing++;
+        }
+        return;
+      }
+      release(block);
+      if (!isArmed) {
+        return;
+      }
+      if (isModelOn && isFromSd) {
+        if (numBlocks == 0) {
+          modelOpen();
+          timeNow = micros();   // the samples could only be played once the file was open
+        }
+        modelRead();
+      }
+      if (numBlocks == 0) {
+        firstBlockTime = timeNow;
+      }
+      numBlocks++;
+      numUnderruns += numMissing;   // the prompt kept going, so the missing blocks were a gap in the middle
+      numMissing = 0;
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getFirstBlockTime - time the first block arrived after arm() (us), 0 if no sound yet
+    */
+    unsigned long getFirstBlockTime() {
+      return firstBlockTime;
+    }
+
+    /*
+       getNumBlocks - number of blocks since arm()
+    */
+    unsigned long getNumBlocks() {
+      return numBlocks;
+    }
+
+    /*
+       getNumUnderruns - number of blocks missing in the middle of the prompt since arm()
+    */
+    unsigned long getNumUnderruns() {
+      return numUnderruns;
+    }
+
+    /*
+       getNumLate - number of audio updates that came late since arm()
+    */
+    unsigned long getNumLate() {
+      return numLate;
+    }
+
+    /*
+       getMaxInterval - longest time between two audio updates since arm() (us), 2902 us when nothing held them up
+    */
+    unsigned long getMaxInterval() {
+      return maxInterval;
+    }
+};
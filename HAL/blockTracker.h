@@ -0,0 +1,273 @@
+/**********************************************************************************
+    blockTracker.h
+
+    This file contains the class definition, attributes, and methods of the BlockTracker.
+    The Pixy2 can see several blocks at once (ex. a few gloves, a penlight, and a lab
+    coat in the same room). Instead of ignoring frames with more than one block, the
+    tracker keeps a table of tracks and matches the blocks in every new frame to them:
+        1. by the Pixy tracking index (m_index) and signature
+        2. otherwise, by the closest track with the same signature
+        3. otherwise, a new track is started
+    A track that is not seen for a few frames is dropped. One track is picked as the
+    attention target (the one HAL looks at) based on the attention mode, and HAL stays
+    on that target until it is lost or another one is clearly better.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// One object followed across camera frames
+struct Track {
+  boolean isActive;
+  int id;             // number given by the tracker (never reused)
+  int pixyIndex;      // tracking index from the Pixy (m_index)
+  int signature;
+  int x;
+  int y;
+  int width;
+  int height;
+  int angle;
+  int age;            // number of frames the track has been seen
+  int missed;         // number of frames in a row the track has not been seen
+};
+
+// ATTENTION MODES
+const int attendLargest = 0;    // the largest block (usually the closest object)
+const int attendSignature = 1;  // the largest block with a given signature (ex. the blue glove)
+const int attendOldest = 2;     // the block that has been seen the longest
+
+class BlockTracker {
+  private:
+    static const int maxTracks = 8;
+    Track tracks[maxTracks];
+    int nextId = 1;
+
+    const int maxMissed = 10;   // frames a track can be missing before it is dropped (about 160 ms)
+    const int matchDist = 40;   // furthest a block can move between frames and still match a track (pixels)
+    const float switchRatio = 1.5; // a new target must be this much bigger than the current one to switch
+
+    // ATTENTION
+    int attentionMode = attendLargest;
+    int attentionSig = 1;
+    int targetId = 0;           // id of the current attention target (0 = none)
+
+    /*
+       findTrack - find the active track with an id
+           return int - index in the track table, or -1 if there is no track with that id
+    */
+    int findTrack(int id) {
+      for (int t = 0; t < maxTracks; t++) {
+        if (tracks[t].isActive && tracks[t].id == id) {
+          return t;
+        }
+      }
+      return -1;
+    }
+
+    /*
+       matchBlock - find the track a block belongs to
+           const CameraBlock &block - block from the newest frame
+           boolean isUsed[] - tracks that already matched a block in this frame
+           return int - index of the track, or -1 if no track matches
+    */
+    int matchBlock(const CameraBlock &block, boolean isUsed[]) {
+      // same Pixy tracking index and signature
+      for (int t = 0; t < maxTracks; t++) {
+        if (tracks[t].isActive && !isUsed[t] && tracks[t].pixyIndex == block.index && tracks[t].signature == block.signature) {
+          return t;
+        }
+      }
+      // otherwise the closest track with the same signature
+      int best = -1;
+      long bestDistSq = (long)matchDist * matchDist;
+      for (int t = 0; t < maxTracks; t++) {
+        if (tracks[t].isActive && !isUsed[t] && tracks[t].signature == block.signature) {
+          long dx = block.x - tracks[t].x;
+          long dy = block.y - tracks[t].y;
+          long distSq = dx * dx + dy * dy;
+          if (distSq <= bestDistSq) {
+            bestDistSq = distSq;
+            best = t;
+          }
+        }
+      }
+      return best;
+    }
+
+    /*
+       newTrack - get an empty spot in the track table (or the spot of the track that has been missing the longest)
+           const boolean isUsed[] - tracks already matched to a block of this frame
+           return int - index of the spot, -1 if every track was seen in the last frame (the block is not tracked)
+    */
+    int newTrack(const boolean isUsed[]) {
+      int best = -1;
+      for (int t = 0; t < maxTracks; t++) {
+        if (!tracks[t].isActive) {
+          return t;
+        }
+        if (!isUsed[t] && tracks[t].missed > 0 && (best < 0 || tracks[t].missed > tracks[best].missed)) {
+          best = t;
+        }
+      }
+      return best;
+    }
+
+    /*
+       score - how good a track is as the attention target for the current mode (higher is better, -1 = not allowed)
+    */
+    long score(const Track &track) {
+      if (!track.isActive || track.missed > 0) {
+        return -1;
+      }
+      switch (attentionMode) {
+        case attendSignature:
+          if (track.signature != attentionSig) {
+            return -1;
+          }
+          return (long)track.width * track.height;
+        case attendOldest:
+          return track.age;
+        default:  // attendLargest
+          return (long)track.width * track.height;
+      }
+    }
+
+    /*
+       pickTarget - choose the attention target. The current target is kept unless it is lost or another track is clearly better.
+    */
+    void pickTarget() {
+      int best = -1;
+      long bestScore = -1;
+      for (int t = 0; t < maxTracks; t++) {
+        long trackScore = score(tracks[t]);
+        if (trackScore > bestScore) {
+          bestScore = trackScore;
+          best = t;
+        }
+      }
+      int current = findTrack(targetId);
+      if (current >= 0 && tracks[current].missed <= maxMissed / 2) {
+        long currentScore = score(tracks[current]);
+        if (best < 0 || currentScore < 0 || bestScore <= currentScore * switchRatio) {
+          return;   // keep the current target (it may only be missing for a frame or two)
+        }
+      }
+      targetId = (best >= 0) ? tracks[best].id : 0;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the tracker
+    BlockTracker() {
+      clear();
+    }
+
+    /*
+       clear - drop every track
+    */
+    void clear() {
+      for (int t = 0; t < maxTracks; t++) {
+        tracks[t].isActive = false;
+      }
+      targetId = 0;
+    }
+
+    /*
+       setAttention - choose which track HAL pays attention to
+           int mode - attendLargest, attendSignature, or attendOldest
+           int signature - signature to follow when the mode is attendSignature (1-7)
+    */
+    void setAttention(int mode, int signature) {
+      attentionMode = mode;
+      attentionSig = signature;
+      targetId = 0;
+    }
+
+    //************************************************TRACKING********************************
+    /*
+       update - match the blocks of a new frame to the tracks. Call this once for every new camera frame.
+           const CameraSnapshot &frame - every block from the newest frame
+    */
+    void update(const CameraSnapshot &frame) {
+      boolean isUsed[maxTracks];
+      for (int t = 0; t < maxTracks; t++) {
+        isUsed[t] = false;
+      }
+
+      for (int b = 0; b < frame.numBlocks; b++) {
+        const CameraBlock &block = frame.blocks[b];
+        int t = matchBlock(block, isUsed);
+        if (t < 0) {
+          t = newTrack(isUsed);
+          if (t < 0) {
+            continue;   // the table is full of tracks that are still in view
+          }
+          tracks[t].isActive = true;
+          tracks[t].id = nextId++;
+          tracks[t].age = 0;
+        }
+        tracks[t].pixyIndex = block.index;
+        tracks[t].signature = block.signature;
+        tracks[t].x = block.x;
+        tracks[t].y = block.y;
+        tracks[t].width = block.width;
+        tracks[t].height = block.height;
+        tracks[t].angle = block.angle;
+        tracks[t].age++;
+        tracks[t].missed = 0;
+        isUsed[t] = true;
+      }
+
+      // tracks that were not seen in this frame
+      for (int t = 0; t < maxTracks; t++) {
+        if (tracks[t].isActive && !isUsed[t]) {
+          tracks[t].missed++;
+          if (tracks[t].missed > maxMissed) {
+            tracks[t].isActive = false;
+          }
+        }
+      }
+      pickTarget();
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getTarget - get the attention target
+           Track &target - resulting track
+           return boolean - false if there is no target
+    */
+    boolean getTarget(Track &target) {
+      int t = findTrack(targetId);
+      if (t < 0) {
+        return false;
+      }
+      target = tracks[t];
+      return true;
+    }
+
+    /*
+       getNumTracks - number of objects being tracked
+    */
+    int getNumTracks() {
+      int num = 0;
+      for (int t = 0; t < maxTracks; t++) {
+        if (tracks[t].isActive) {
+          num++;
+        }
+      }
+      return num;
+    }
+
+    /*
+       getTrack - get a spot in the track table (check isActive)
+           int t - spot in the table (0 to getMaxTracks() - 1)
+    */
+    const Track &getTrack(int t) {
+      return tracks[t];
+    }
+
+    /*
+       getMaxTracks - size of the track table
+    */
+    int getMaxTracks() {
+      return maxTracks;
+    }
+};
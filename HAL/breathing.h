@@ -0,0 +1,355 @@
+/**********************************************************************************
+  breathing.h
+
+  This file contains the class definition, attributes, and methods of the Breathing.
+  It runs HAL's breathing in the background while the LOC tests run, using the airway
+  settings from the user interface (see setAir() in head.h). Every breath is one cycle of
+  an inhale, an exhale and a pause. The patterns are:
+      normal    - about 14 breaths/min with a little variation in the rate and depth
+      irregular - no regular rate or depth (ataxic breathing) with apnea pauses
+      stridor   - high pitched sound on a long inhale, faster breathing, and the head
+                  lifts back on every inhale
+      agonal    - a few slow, sudden gasps a minute with the jaw wide open and the head
+                  jerking back, with long pauses in between
+  Stridor can be on top of normal or irregular breathing. Agonal gasps are on their own.
+
+  Each breath drives:
+      - the jaw (the mouth opens a little on the inhale, see jaw.h)
+      - the neck (optional, only when nothing else is moving it, see neck.h)
+      - the breathing sounds in pinSetUp.h: an airflow layer (filtered noise), a stridor
+        layer (a tone) and a gasp layer (low rumble), mixed together into the breathing
+        layer of the sound mixer so they play along with HAL's voice (see soundMixer.h)
+  Lock jaw is held by the jaw itself (see setMaxOpen() in jaw.h), so the breathing does
+  not limit it.
+
+  update() does not wait. The jaw, neck and sounds are updated 50 times a second and the
+  breath timing comes from the time each breath started, so it does not drift when the
+  loop is slow.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// BREATH PHASES
+const int breathInhale = 0;
+const int breathExhale = 1;
+const int breathPause = 2;
+
+class Breathing {
+  private:
+    Jaw *jaw = NULL;
+    Neck *neck = NULL;
+
+    // AIRWAY SETTINGS
+    boolean isIrregular = false;
+    boolean isStridor = false;
+    boolean isAgonal = false;
+    boolean isSoundOn = true;
+    boolean isSynthOn = false;    // noise and tone are running
+
+    // CONTROL TIMING
+    const unsigned long controlPeriod = 20000;  // time between updates of the jaw, neck and sound (us) - 50 times a second
+    unsigned long nextUpdateTime = 0;
+    boolean isRunning = false;
+
+    // CURRENT BREATH (times in ms)
+    unsigned long breathStart = 0;
+    unsigned long inhaleTime = 1700;
+    unsigned long exhaleTime = 2300;
+    unsigned long pauseTime = 300;
+    float depth = 0.8;              // how deep the breath is (0 to 1)
+    int phase = breathPause;
+    float volume = 0;               // how full the lungs are (0 to 1)
+    float flow = 0;                 // how fast the air is moving (0 to 1)
+    unsigned long numBreaths = 0;
+
+    // NORMAL BREATHING
+    const float normalRate = 14;        // breaths per minute
+    const float normalRateVariation = 1.5;
+    const float inhaleFraction = 0.38;  // fraction of the breath spent breathing in
+    const float pauseFraction = 0.12;   // fraction of the breath spent with no air moving
+
+    // IRREGULAR BREATHING
+    const unsigned long minIrregularBreath = 2500;  // ms
+    const unsigned long maxIrregularBreath = 7000;
+    const float apneaChance = 0.15;                 // chance of an apnea pause after a breath
+    const unsigned long minApnea = 5000;
+    const unsigned long maxApnea = 12000;
+
+    // STRIDOR
+    const float stridorRateScale = 1.4;     // breathing is faster
+    const float stridorInhaleScale = 1.4;   // and the inhale is longer
+    const float stridorMinHz = 550;         // pitch of the stridor tone (rises with the airflow)
+    const float stridorMaxHz = 700;
+
+    // AGONAL GASPS
+    const unsigned long gaspInhale = 350;   // ms - a sudden gasp
+    const unsigned long gaspExhale = 700;
+    const unsigned long minGaspPause = 6000;
+    const unsigned long maxGaspPause = 12000;
+
+    // JAW (percent open, see openJawPercent() in jaw.h)
+    const float restJaw = 10;
+    const float normalJaw = 25;     // jaw at the top of a normal breath
+    const float stridorJaw = 40;
+    const float gaspJaw = 85;
+    int lastJawCmd = -1;
+
+    // NECK (degrees the head nods back at the top of a breath)
+    const float stridorNeckLift = 8;
+    const float gaspNeckLift = 20;
+    boolean isNeckMoved = false;
+
+    // SOUND LAYERS (gains of breathMixer in pinSetUp.h)
+    const float airflowGain = 0.35;
+    const float exhaleGain = 0.6;       // exhale is quieter than the inhale
+    const float stridorGain = 0.5;
+    const float gaspGain = 0.8;
+    const float inhaleFilterHz = 1400;  // center of the airflow noise
+    const float exhaleFilterHz = 900;
+
+    /*
+       randomBetween - random number in a range
+    */
+    float randomBetween(float low, float high) {
+      return low + (high - low) * random(0, 10001) / 10000.0;
+    }
+
+    /*
+       newBreath - choose the timing and the depth of the next breath
+    */
+    void newBreath() {
+      if (isAgonal) {
+        inhaleTime = gaspInhale;
+        exhaleTime = gaspExhale;
+        pauseTime = randomBetween(minGaspPause, maxGaspPause);
+        depth = randomBetween(0.8, 1.0);
+      } else {
+        float breathTime;
+        if (isIrregular) {
+          breathTime = randomBetween(minIrregularBreath, maxIrregularBreath);
+          depth = randomBetween(0.3, 1.0);
+        } else {
+          float rate = normalRate + normalRateVariation * randomBetween(-1, 1);
+          if (isStridor) {
+            rate *= stridorRateScale;
+          }
+          breathTime = 60000.0 / rate;
+          depth = randomBetween(0.7, 0.9);
+        }
+        float inhale = inhaleFraction * (isStridor ? stridorInhaleScale : 1);
+        inhaleTime = breathTime * inhale;
+        pauseTime = breathTime * pauseFraction;
+        exhaleTime = breathTime - inhaleTime - pauseTime;
+        if (isIrregular && randomBetween(0, 1) < apneaChance) {
+          pauseTime += randomBetween(minApnea, maxApnea);
+        }
+      }
+      numBreaths++;
+    }
+
+    /*
+       findPhase - find the phase, volume and flow of the breath at a time
+            unsigned long timeNow - time (ms)
+    */
+    void findPhase(unsigned long timeNow) {
+      // start the next breath at the end of the last one (not at timeNow) so the timing does not drift
+      while (timeNow - breathStart >= inhaleTime + exhaleTime + pauseTime) {
+        breathStart += inhaleTime + exhaleTime + pauseTime;
+        newBreath();
+      }
+      unsigned long t = timeNow - breathStart;
+      if (t < inhaleTime) {
+        float x = (float)t / inhaleTime;
+        phase = breathInhale;
+        volume = (1 - cos(PI * x)) / 2;
+        flow = sin(PI * x);
+      } else if (t < inhaleTime + exhaleTime) {
+        float x = (float)(t - inhaleTime) / exhaleTime;
+        phase = breathExhale;
+        volume = (1 + cos(PI * x)) / 2;
+        flow = sin(PI * x);
+      } else {
+        phase = breathPause;
+        volume = 0;
+        flow = 0;
+      }
+    }
+
+    /*
+       driveJaw - open the jaw with the volume of the breath
+    */
+    void driveJaw() {
+      float topJaw = isAgonal ? gaspJaw : (isStridor ? stridorJaw : normalJaw);
+      float percent = restJaw + (topJaw - restJaw) * depth * volume;
+      int cmd = (int)percent;
+      if (cmd != lastJawCmd) {  // only send the servo commands when the jaw moves
+        jaw->openJawPercent(cmd);
+        lastJawCmd = cmd;
+      }
+    }
+
+    /*
+       driveNeck - nod the head back with the volume of the breath (stridor and agonal gasps only)
+    */
+    void driveNeck() {
+      float lift = isAgonal ? gaspNeckLift : (isStridor ? stridorNeckLift : 0);
+      if (lift == 0 && !isNeckMoved) {
+        return;
+      }
+      neck->streamNod(-lift * depth * volume);
+      boolean isDone = neck->followPoses();
+      isNeckMoved = lift != 0 || !isDone;   // keep going until the head is back to neutral
+    }
+
+    /*
+       silence - turn the breathing sounds off and stop the noise and tone so they do not use audio blocks
+    */
+    void silence() {
+      breathMixer.gain(0, 0);
+      breathMixer.gain(1, 0);
+      breathMixer.gain(2, 0);
+      breathNoise.amplitude(0);
+      stridorTone.amplitude(0);
+      isSynthOn = false;
+    }
+
+    /*
+       driveSound - set the gains of the breathing sound layers from the airflow
+    */
+    void driveSound() {
+      if (!isSoundOn) {
+        return;
+      }
+      if (!isSynthOn) {
+        breathNoise.amplitude(1.0);
+        stridorTone.amplitude(1.0);
+        isSynthOn = true;
+      }
+      boolean isInhale = phase == breathInhale;
+      float air = airflowGain * depth * flow * (isInhale ? 1 : exhaleGain);
+      float stridor = 0;
+      float gasp = 0;
+      if (isStridor && !isAgonal) {
+        stridor = stridorGain * depth * flow * (isInhale ? 1 : 0.2);
+        stridorTone.frequency(stridorMinHz + (stridorMaxHz - stridorMinHz) * flow);
+      }
+      if (isAgonal && isInhale) {
+        gasp = gaspGain * depth * flow;
+      }
+      breathFilter.frequency(isInhale ? inhaleFilterHz : exhaleFilterHz);
+      breathMixer.gain(0, air);
+      breathMixer.gain(1, stridor);
+      breathMixer.gain(2, gasp);
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the breathing
+    Breathing() {
+    }
+
+    /*
+       setUp - give the breathing the jaw and neck to move and set up the breathing sounds
+            Jaw &headJaw - jaw of the head
+            Neck &headNeck - neck of the head
+    */
+    void setUp(Jaw &headJaw, Neck &headNeck) {
+      jaw = &headJaw;
+      neck = &headNeck;
+      breathFilter.resonance(1.5);
+      silence();
+      breathMixer.gain(3, 0);
+      Serial.println("Initializing Breathing");
+    }
+
+    /*
+       setAirway - set the breathing pattern from the airway settings (see setAir() in head.h).
+                   The next breath uses the new pattern.
+            boolean irregular - true for irregular breathing
+            boolean stridor - true for stridor breathing
+            boolean agonal - true for agonal gasps (cannot be with irregular or stridor breathing)
+    */
+    void setAirway(boolean irregular, boolean stridor, boolean agonal) {
+      isIrregular = irregular;
+      isStridor = stridor;
+      isAgonal = agonal && !irregular && !stridor;
+    }
+
+    /*
+       setSound - turn the breathing sounds on or off (off when the breathing layer is not used, see soundMixer.h)
+    */
+    void setSound(boolean isOn) {
+      isSoundOn = isOn;
+      if (!isOn) {
+        silence();
+      }
+    }
+
+    //************************************************BREATHING********************************
+    /*
+       update - breathe. Call this every loop (it does not wait).
+            boolean canMoveJaw - false while the jaw is being used for something else (ex. talking)
+            boolean canMoveNeck - true if nothing else is moving the neck
+            return boolean - true if the jaw, neck and sound were updated
+    */
+    boolean update(boolean canMoveJaw, boolean canMoveNeck) {
+      unsigned long timeNow = micros();
+      if (!isRunning) {
+        isRunning = true;
+        nextUpdateTime = timeNow;
+        breathStart = millis();
+        newBreath();
+      }
+      if ((long)(timeNow - nextUpdateTime) < 0) {
+        return false;
+      }
+      nextUpdateTime += controlPeriod;
+      if ((long)(timeNow - nextUpdateTime) > (long)(4 * controlPeriod)) {  // the loop was blocked for a while, do not try to catch up
+        nextUpdateTime = timeNow + controlPeriod;
+      }
+      findPhase(millis());
+      if (canMoveJaw) {
+        driveJaw();
+      } else {
+        lastJawCmd = -1;  // the jaw was moved by something else
+      }
+      if (canMoveNeck) {
+        driveNeck();
+      }
+      driveSound();
+      return true;
+    }
+
+    /*
+       stop - stop breathing, turn the sounds off and move the jaw back to neutral. update() starts it again.
+    */
+    void stop() {
+      isRunning = false;
+      silence();
+      lastJawCmd = -1;
+      if (jaw != NULL) {
+        jaw->neutralMouth();
+      }
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getPhase - phase of the breath (breathInhale, breathExhale, or breathPause)
+    */
+    int getPhase() {
+      return phase;
+    }
+
+    /*
+       getVolume - how full the lungs are (0 to 1)
+    */
+    float getVolume() {
+      return volume * depth;
+    }
+
+    /*
+       getNumBreaths - number of breaths since the breathing started
+    */
+    unsigned long getNumBreaths() {
+      return numBreaths;
+    }
+};
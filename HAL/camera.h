@@ -8,14 +8,112 @@
     also a free download at the same website. The code is a modified version of the
     "cc_i2c_uart" example given in the Pixy2 library.
 
+    The camera is only read once per camera frame (see update()). All of the blocks
+    and all of their fields are copied into a snapshot with a frame number and a time
+    stamp, so everything that needs camera data in the same loop reads the same frame
+    without another I2C transfer, and old data can be detected with the frame number.
+    Every new frame is also given to the block tracker (see blockTracker.h) so HAL can
+    follow one target when there are several blocks in view.
+
+    The camera can also be simulated (see setSimulation()). A target block moving in a
+    figure eight and a still distractor block are made every frame period instead of
+    reading the Pixy, so the tracking and eye movement code (and the latency monitor in
+    latencyMonitor.h) can be run without the camera plugged in.
+
     Last Edited by Ethan Lauer 3/29/20
  *********************************************************************************/
 #include <Arduino.h>
 #include <Pixy2I2C.h> // include the Pixy iibrary available for download
 
+const int maxCameraBlocks = 8; // most blocks stored from one frame
+
+// All of the information about one detected block (see getBlockInfo() for the ranges)
+struct CameraBlock {
+  int x;
+  int y;
+  int width;
+  int height;
+  int angle;
+  int index;
+  int age;
+  int signature;
+};
+
+// Every block from one camera frame
+struct CameraSnapshot {
+  unsigned long frameNum;   // increases by one for every new frame read from the camera (0 = no frame yet)
+  unsigned long timeStamp;  // time the frame was read (ms)
+  unsigned long timeStampUs; // time the frame arrived (us) - used to measure the latency to the servos
+  int numBlocks;            // number of blocks stored (the camera may have seen more)
+  int numDetected;          // number of blocks the camera detected
+  CameraBlock blocks[maxCameraBlocks];
+};
+
+#include "blockTracker.h" // include the multiple block tracker (uses CameraSnapshot)
+
 class Camera {
   private:
     Pixy2I2C pixy;  // create the pixy camerea object
+
+    // FRAME CACHE
+    CameraSnapshot snapshot;
+    const unsigned long framePeriod = 16; // the camera makes a new frame about every 16 ms (61 frames/sec)
+    unsigned long lastPollTime = 0;
+
+    BlockTracker tracker = BlockTracker();
+
+    // SIMULATED CAMERA
+    boolean isSimulated = false;
+    const float simPeriodX = 4000;  // time for the target to go side to side and back (ms)
+    const float simPeriodY = 2000;  // time for the target to go up and down and back (ms)
+
+    /*
+       copyBlocks - copy every block from the pixy library into the snapshot
+    */
+    void copyBlocks() {
+      snapshot.numDetected = pixy.ccc.numBlocks;
+      snapshot.numBlocks = min((int)pixy.ccc.numBlocks, maxCameraBlocks);
+      for (int i = 0; i < snapshot.numBlocks; i++) {
+        snapshot.blocks[i].x = pixy.ccc.blocks[i].m_x;
+        snapshot.blocks[i].y = pixy.ccc.blocks[i].m_y;
+        snapshot.blocks[i].width = pixy.ccc.blocks[i].m_width;
+        snapshot.blocks[i].height = pixy.ccc.blocks[i].m_height;
+        snapshot.blocks[i].angle = pixy.ccc.blocks[i].m_angle;
+        snapshot.blocks[i].index = pixy.ccc.blocks[i].m_index;
+        snapshot.blocks[i].age = pixy.ccc.blocks[i].m_age;
+        snapshot.blocks[i].signature = pixy.ccc.blocks[i].m_signature;
+      }
+    }
+
+    /*
+       makeSimulatedFrame - put a moving target block and a still distractor block into the snapshot
+    */
+    void makeSimulatedFrame() {
+      float t = lastPollTime;
+      CameraBlock &target = snapshot.blocks[0];
+      target.x = 158 + 120 * sin(TWO_PI * t / simPeriodX);
+      target.y = 104 + 80 * sin(TWO_PI * t / simPeriodY);
+      target.width = 40;
+      target.height = 40;
+      target.angle = 0;
+      target.index = 1;
+      target.age = min(snapshot.frameNum + 1, 255UL);
+      target.signature = 1;
+
+      CameraBlock &distractor = snapshot.blocks[1];
+      distractor.x = 40;
+      distractor.y = 180;
+      distractor.width = 12;
+      distractor.height = 12;
+      distractor.angle = 0;
+      distractor.index = 2;
+      distractor.age = target.age;
+      distractor.signature = 2;
+
+      snapshot.numBlocks = 2;
+      snapshot.numDetected = 2;
+    }
+
   public:
     // Maximum Pixel Values - these are public so they can be called in the
     // followHand() function in head.h.
@@ -41,14 +139,110 @@ class Camera {
     void setUp() {
       Serial.println("Initializing Camera");
       pixy.init();
+      snapshot.frameNum = 0;
+      snapshot.timeStamp = 0;
+      snapshot.timeStampUs = 0;
+      snapshot.numBlocks = 0;
+      snapshot.numDetected = 0;
+    }
+
+    //**************************************** FRAME CACHE ************************************
+    /*
+       update - read the newest frame from the camera into the snapshot. Call this once per loop before
+                using any camera data. The camera is only asked for blocks once per frame period and
+                does not wait for a frame, so calling this more often does not add any I2C transfers.
+           return boolean - true if a new frame was read
+    */
+    boolean update() {
+      if (millis() - lastPollTime < framePeriod) {
+        return false;
+      }
+      lastPollTime = millis();
+      if (isSimulated) {
+        makeSimulatedFrame();
+      } else {
+        if (pixy.ccc.getBlocks(false) < 0) {  // the camera does not have a new frame yet (or there was an error)
+          return false;
+        }
+        copyBlocks();
+      }
+      snapshot.timeStampUs = micros();
+      snapshot.frameNum++;
+      snapshot.timeStamp = lastPollTime;
+      tracker.update(snapshot);
+      return true;
+    }
+
+    /*
+       getSnapshot - get every block from the newest frame (no I2C transfer)
+    */
+    const CameraSnapshot &getSnapshot() {
+      return snapshot;
+    }
+
+    /*
+       getFrameNum - frame number of the newest snapshot. Save it and compare later with isNewFrame().
+    */
+    unsigned long getFrameNum() {
+      return snapshot.frameNum;
+    }
+
+    /*
+       isNewFrame - check if there is a newer frame than the one that was last used
+           unsigned long lastFrameNum - frame number that was last used
+    */
+    boolean isNewFrame(unsigned long lastFrameNum) {
+      return snapshot.frameNum != lastFrameNum;
+    }
+
+    /*
+       getSnapshotAge - time since the newest frame was read (ms). Use this to detect a camera that stopped updating.
+    */
+    unsigned long getSnapshotAge() {
+      return millis() - snapshot.timeStamp;
+    }
+
+    /*
+       setSimulation - make simulated frames instead of reading the camera (see makeSimulatedFrame())
+           boolean simulate - true to simulate the camera
+    */
+    void setSimulation(boolean simulate) {
+      isSimulated = simulate;
+      tracker.clear();
+    }
+
+    //**************************************** TRACKING ************************************
+    /*
+       setAttention - choose which block HAL follows when there are several in view
+           int mode - attendLargest, attendSignature, or attendOldest (see blockTracker.h)
+           int signature - signature to follow when the mode is attendSignature (1-7)
+    */
+    void setAttention(int mode, int signature) {
+      tracker.setAttention(mode, signature);
+    }
+
+    /*
+       getTarget - get the block HAL is paying attention to
+           Track &target - resulting track (see blockTracker.h)
+           return boolean - false if nothing is being tracked
+    */
+    boolean getTarget(Track &target) {
+      return tracker.getTarget(target);
+    }
+
+    /*
+       getTracker - get the tracker to look at every track
+    */
+    BlockTracker &getTracker() {
+      return tracker;
     }
 
     //**************************************** GET INFORMATION ************************************
     /*
-      getBlockInfo - get any information from the detected blocks since (for now) HAL is only following
-                     a single hand or block, only get the information if there was one block detected.
-                     Note: this should be adjusted in the PixyMon software also so the camera is only
-                           detecting one block maximum
+      getBlockInfo - get any information about the block HAL is paying attention to (the attention target
+                     of the tracker, see blockTracker.h). When several blocks are in view, the target is
+                     picked by the attention mode instead of ignoring the frame.
+                     The information comes from the snapshot (see update()), so there is no I2C transfer.
             int state - an integer that corresponds to the requested information which can equal the following
               0 = x (0-316) and y (0-208) coordinates
               1= width (1 to 316)and height (1 to 208)
@@ -70,48 +264,43 @@ class Camera {
       const int Age = 4;
       const int Signature = 5;
 
-      static int result[2]; // result array
-      pixy.ccc.getBlocks();   // get the block information
-      if (pixy.ccc.numBlocks) {   // If there are detected blocks
-        Serial.println("Detected ");
-        if (pixy.ccc.numBlocks > 1) { // check that maximum of 1 block is detected otherwise print an error
-          Serial.println("Too Many Blocks! Adjust Camera Settings or Eliminate Exessive Background");
-        } else {
-          switch (requestedInfo) {    // store the needed info in the result array
-            case Coord:   // format: [x_position, y_position]
-              result[0] = pixy.ccc.blocks[0].m_x;
-              result[1] = pixy.ccc.blocks[0].m_y;
-              break;
-
-            case Size:// not used for this application. included only for future work.
-              // format: [width, height]  Note: can be used to determine how close a standardized object is.
-              result[0] = pixy.ccc.blocks[0].m_width;
-              result[1] = pixy.ccc.blocks[0].m_height;
-              break;
-
-            case Angle: // not used for this application. included only for future work.
-              result[0] = pixy.ccc.blocks[0].m_angle;
-              result[1] = 0;
-              break;
-
-            case Index: // not used for this application. included only for future work.
-              result[0] = pixy.ccc.blocks[0].m_index;
-              result[1] = 0;
-              break;
-
-            case Age: // used to determine if the block is not longer detected - format: [age, 0]
-              result[0] = pixy.ccc.blocks[0].m_age;
-              result[1] = 0;
-              break;
-
-            case Signature: //not used for this application. included only for future work.
-              // format: [signature, 0] - can be used to distinguish between
-              // two different colored object (ex. blue gloved hand or a red
-              // patch on a lab coat)
-              result[0] = pixy.ccc.blocks[0].m_signature;
-              result[1] = 0;
-              break;
-          }
+      static int result[2]; // result array (keeps the last value when nothing is tracked)
+      Track target;
+      if (tracker.getTarget(target)) {   // If there is a block to follow
+        switch (requestedInfo) {    // store the needed info in the result array
+          case Coord:   // format: [x_position, y_position]
+            result[0] = target.x;
+            result[1] = target.y;
+            break;
+
+          case Size:// not used for this application. included only for future work.
+            // format: [width, height]  Note: can be used to determine how close a standardized object is.
+            result[0] = target.width;
+            result[1] = target.height;
+            break;
+
+          case Angle: // not used for this application. included only for future work.
+            result[0] = target.angle;
+            result[1] = 0;
+            break;
+
+          case Index: // not used for this application. included only for future work.
+            result[0] = target.pixyIndex;
+            result[1] = 0;
+            break;
+
+          case Age: // used to determine if the block is not longer detected - format: [age, 0]
+            result[0] = target.age;
+            result[1] = 0;
+            break;
+
+          case Signature: //not used for this application. included only for future work.
+            // format: [signature, 0] - can be used to distinguish between
+            // two different colored object (ex. blue gloved hand or a red
+            // patch on a lab coat)
+            result[0] = target.signature;
+            result[1] = 0;
+            break;
         }
       }
       return result; // return the array
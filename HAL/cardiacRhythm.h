@@ -0,0 +1,199 @@
+/**********************************************************************************
+  cardiacRhythm.h
+
+  This file contains the class definition, attributes, and methods of the CardiacRhythm.
+  It makes the beat to beat intervals and the strength of every beat for the pulse
+  solenoids (see pulseEngine.h) so an irregular pulse feels like a real one instead of a
+  random BPM after every beat. The rhythms are:
+      rhythmSinus     - normal rhythm with heart rate variability (the rate slowly speeds
+                        up and slows down with breathing, plus a little beat to beat noise)
+      rhythmAfib      - atrial fibrillation: irregularly irregular, with no pattern. Beats
+                        that come early are weak (some are too weak to feel)
+      rhythmPVC       - sinus rhythm with premature ventricular contractions: an early weak
+                        beat, then a pause and a stronger beat
+      rhythmBrady     - slow sinus rhythm with sinus pauses of 1.5 to 2.5 beats
+      rhythmAlternans - pulsus alternans: even beats that go strong, weak, strong, weak
+  The strength of a beat (0 to 1) sets how long the solenoids stay on.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// RHYTHMS
+const int rhythmSinus = 0;
+const int rhythmAfib = 1;
+const int rhythmPVC = 2;
+const int rhythmBrady = 3;
+const int rhythmAlternans = 4;
+
+class CardiacRhythm {
+  private:
+    int rhythm = rhythmSinus;
+    int BPM = 60;
+    float elapsed = 0;            // time of the next beat since the rhythm was set (s) - used for the breathing variation
+    int beatNum = 0;              // beats since the rhythm was set
+    int pvcStage = 0;             // 0 = normal beat, 1 = the next beat is a PVC, 2 = the next beat is after the pause
+    float lastInterval = 1.0;     // interval before the next beat (s) - used for the strength in atrial fibrillation
+
+    // STROKE (solenoid on time for a strength of 0 to 1)
+    const unsigned int minStrokeUs = 12000;   // weakest beat that can be felt
+    const unsigned int maxStrokeUs = 45000;   // strongest beat
+    const float minFeltStrength = 0.15;       // beats weaker than this are not felt at all (no stroke)
+
+    // HEART RATE VARIABILITY (sinus rhythm)
+    const float breathHz = 0.25;        // breathing rate (15 breaths/min)
+    const float breathVariation = 0.04; // the interval changes +/- 4% with breathing
+    const float slowHz = 0.1;           // slower blood pressure variation (Mayer waves)
+    const float slowVariation = 0.02;
+    const float beatNoise = 0.015;      // random beat to beat change (1.5%)
+
+    // ARRHYTHMIAS
+    const float afibVariation = 0.22;   // spread of the atrial fibrillation intervals (log normal)
+    const float pvcChance = 0.12;       // chance that a beat is a PVC
+    const float pvcPrematurity = 0.6;   // a PVC comes at 60% of the normal interval
+    const float pauseChance = 0.06;     // chance of a sinus pause in bradycardia
+    const float minPauseBeats = 1.5;   // length of a sinus pause in beats (a pause is a multiple of the normal interval)
+    const float maxPauseBeats = 2.5;
+    const float alternansWeak = 0.55;   // strength of the weak beats in pulsus alternans
+    const float normalStrength = 0.85;  // strength of a normal beat
+    const float pvcStrength = 0.35;     // a PVC is weak (the heart did not have time to fill)
+    const float postPvcStrength = 1.0;  // the beat after the pause is stronger
+
+    /*
+       randomFloat - random number from 0 to 1
+    */
+    float randomFloat() {
+      return random(0, 10001) / 10000.0;
+    }
+
+    /*
+       randomNormal - random number from a normal distribution (mean 0, standard deviation 1)
+    */
+    float randomNormal() {
+      float u1 = max(randomFloat(), 0.0001f);
+      float u2 = randomFloat();
+      return sqrt(-2 * log(u1)) * cos(TWO_PI * u2);
+    }
+
+    /*
+       sinusInterval - interval of a sinus beat with heart rate variability (s)
+    */
+    float sinusInterval() {
+      float meanInterval = 60.0 / max(BPM, 1);
+      float variation = breathVariation * sin(TWO_PI * breathHz * elapsed)
+                        + slowVariation * sin(TWO_PI * slowHz * elapsed)
+                        + beatNoise * randomNormal();
+      return meanInterval * (1 + variation);
+    }
+
+    /*
+       fillingStrength - strength of a beat from the interval before it (a short interval gives the heart less time to fill)
+            float interval - interval before the beat (s)
+    */
+    float fillingStrength(float interval) {
+      float meanInterval = 60.0 / max(BPM, 1);
+      return constrain((interval / meanInterval - 0.35) / 0.65, 0.0f, 1.2f);
+    }
+
+    /*
+       makeBeat - turn an interval and a strength into a beat for the pulse engine
+            float interval - time to the next beat (s)
+            float strength - strength of this beat (0 to 1)
+    */
+    PulseBeat makeBeat(float interval, float strength) {
+      PulseBeat beat;
+      beat.intervalUs = interval * 1000000;
+      if (strength < minFeltStrength) {
+        beat.strokeUs = 0;   // the heart beat but the pulse cannot be felt
+      } else {
+        beat.strokeUs = minStrokeUs + min(strength, 1.0f) * (maxStrokeUs - minStrokeUs);
+      }
+      elapsed += interval;
+      beatNum++;
+      return beat;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the rhythm
+    CardiacRhythm() {
+    }
+
+    /*
+       setRhythm - choose the rhythm and the average heart rate. Nothing changes if they are the same as before.
+            int newRhythm - rhythmSinus, rhythmAfib, rhythmPVC, rhythmBrady or rhythmAlternans
+            int newBPM - average heart rate (beats per minute)
+            return boolean - true if the rhythm or the rate changed
+    */
+    boolean setRhythm(int newRhythm, int newBPM) {
+      if (newRhythm == rhythm && newBPM == BPM) {
+        return false;
+      }
+      if (newRhythm != rhythm) {
+        elapsed = 0;
+        beatNum = 0;
+        pvcStage = 0;
+      }
+      rhythm = newRhythm;
+      BPM = newBPM;
+      lastInterval = 60.0 / max(BPM, 1);
+      return true;
+    }
+
+    /*
+       getRhythm - rhythm that is being made
+    */
+    int getRhythm() {
+      return rhythm;
+    }
+
+    //************************************************BEATS********************************
+    /*
+       nextBeat - make the next beat. The interval is the time from this beat to the next one.
+            return PulseBeat - beat for the pulse engine (see pulseEngine.h)
+    */
+    PulseBeat nextBeat() {
+      float meanInterval = 60.0 / max(BPM, 1);
+      switch (rhythm) {
+        case rhythmAfib: {
+            // every interval is independent, so there is no pattern to the rhythm
+            float interval = meanInterval * exp(afibVariation * randomNormal() - afibVariation * afibVariation / 2);
+            interval = constrain(interval, 0.3f * meanInterval, 2.5f * meanInterval);
+            float strength = fillingStrength(lastInterval) * (0.85 + 0.15 * randomFloat());
+            lastInterval = interval;
+            return makeBeat(interval, strength);
+          }
+
+        case rhythmPVC: {
+            float interval = sinusInterval();
+            if (pvcStage == 1) {   // the PVC, then a compensatory pause (the PVC and the pause add up to two normal beats)
+              pvcStage = 2;
+              return makeBeat(interval * (2 - pvcPrematurity), pvcStrength);
+            }
+            if (pvcStage == 2) {   // the beat after the pause
+              pvcStage = 0;
+              return makeBeat(interval, postPvcStrength);
+            }
+            if (beatNum > 0 && randomFloat() < pvcChance) {
+              pvcStage = 1;   // this beat is normal, the next one comes early
+              return makeBeat(interval * pvcPrematurity, normalStrength);
+            }
+            return makeBeat(interval, normalStrength);
+          }
+
+        case rhythmBrady: {
+            float interval = sinusInterval();
+            if (randomFloat() < pauseChance) {
+              interval = meanInterval * (minPauseBeats + (maxPauseBeats - minPauseBeats) * randomFloat());
+            }
+            return makeBeat(interval, normalStrength);
+          }
+
+        case rhythmAlternans: {
+            float interval = meanInterval * (1 + beatNoise * randomNormal());
+            return makeBeat(interval, (beatNum % 2 == 0) ? 1.0 : alternansWeak);
+          }
+
+        default:  // rhythmSinus
+          return makeBeat(sinusInterval(), normalStrength);
+      }
+    }
+};
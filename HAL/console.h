@@ -0,0 +1,503 @@
+/**********************************************************************************
+  console.h
+
+  This file contains the class definition, attributes, and methods of the Console.
+  The Console lets HAL be set up and run from a computer over the USB serial port, at
+  the same time as the LCD menus (see userInterface.h). Type one command per line:
+
+      help                              list the commands
+      loc a|v|p|u                       set the LOC (alert, verbal, pain, unresponsive)
+      air normal                        set a normal airway
+      air lockjaw irregular stridor agonal
+                                        set any of the airway problems (agonal is ignored with irregular or stridor)
+      pulse <bpm>                       set an exact pulse
+      pulse normal|fast|slow            set a pulse in a range
+      pulse sinus|afib|pvc|brady|alternans <bpm>
+                                        set a heart rhythm (see cardiacRhythm.h)
+      start                             start the simulation (the LOC, airway and pulse have to be set)
+      stop                              stop the simulation (pulse, breathing, voice and scenario) and go back to the menu
+      do <behavior> [ms]                run a behavior of the head until it is done, for at most a while (2 sec if no time is given, see headBehaviors.h)
+      do stop                           stop the behavior
+      scenario <file>                   load a scenario file from the SD card and start it (see scenario.h)
+      scenario restart                  start the scenario again from the first state
+      say <file>                        play a prompt (ex. say HIBUS.WAV)
+      effect <file>                     play a sound on the effects layer
+      get settings|sensors|servos|audio|bus|scenario
+                                        print the state of HAL
+      stream <ms>                       print a line of telemetry every so often
+      stream off                        stop the telemetry
+      cal <sensor> <grams>              add a force sensor calibration point with a known weight on the sensor
+                                        (0 = forehead, 1 = neck, 2 = chin, 3 = right jaw, 4 = left jaw)
+      cal <sensor> 0                    fit and save the curve of the sensor (see fsrCalibration.h)
+
+  Every command is answered with a line that starts with "$OK" or "$ERR". Telemetry
+  lines start with "$T". The rest of HAL prints debugging messages on the same port, so
+  a program talking to the console should only read the lines that start with "$".
+  The characters are read a few at a time in update(), so a slow
+  or half typed command does not hold up the loop, and telemetry is skipped instead of
+  waiting when the computer is not keeping up.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// WHAT update() ASKS HAL.ino TO DO
+const int consoleNone = 0;
+const int consoleStart = 1;   // start the simulation
+const int consoleStop = 2;    // stop the simulation
+
+const char *const consolePrefix = "$";   // starts every line of the console so it can be told apart from the debugging prints
+
+class Console {
+  private:
+    Head *head = NULL;
+    Scenario *scenario = NULL;
+
+    // READING COMMANDS
+    static const int maxLineLength = 80;
+    const int maxCharsPerLoop = 32;    // characters read each loop
+    char line[maxLineLength + 1];
+    int lineLength = 0;
+    boolean isTooLong = false;
+
+    // BEHAVIOR THAT IS RUNNING
+    int behavior = -1;
+    unsigned long behaviorEndTime = 0;
+    const unsigned long defaultBehaviorTime = 2000;   // ms
+
+    // TELEMETRY
+    unsigned long streamPeriod = 0;    // ms, 0 if off
+    unsigned long nextStreamTime = 0;
+    const int telemetryBytes = 160;    // room a telemetry line needs in the USB buffer
+    unsigned long numLoops = 0;        // loops since the last telemetry line
+    unsigned long numSkipped = 0;      // telemetry lines skipped because the computer was not keeping up
+
+    /*
+       findWord - find a word in a list
+            return int - index in the list, -1 if it is not there
+    */
+    int findWord(const char *word, const char *const words[], int count) {
+      if (word == NULL) {
+        return -1;
+      }
+      for (int i = 0; i < count; i++) {
+        if (strcmp(word, words[i]) == 0) {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    /*
+       readNumber - read a whole number
+            const char *word - text of the number
+            long &number - resulting number
+            return boolean - false if it is not a number
+    */
+    boolean readNumber(const char *word, long &number) {
+      if (word == NULL || *word == '\0') {
+        return false;
+      }
+      char *end;
+      number = strtol(word, &end, 10);
+      return *end == '\0';
+    }
+
+    /*
+       startLine - start a line of the console with the prefix (ex. startLine("OK"))
+    */
+    void startLine(const char *kind) {
+      Serial.print(consolePrefix);
+      Serial.print(kind);
+    }
+
+    /*
+       reply - print the answer to a command
+    */
+    void reply(boolean isOk, const char *message) {
+      startLine(isOk ? "OK" : "ERR");
+      if (message != NULL && *message != '\0') {
+        Serial.print(" ");
+        Serial.print(message);
+      }
+      Serial.println();
+    }
+
+    //************************************************COMMANDS********************************
+    /*
+       setLOCCommand - loc a|v|p|u
+    */
+    void setLOCCommand(char *arg) {
+      const char *const names[] = {"a", "v", "p", "u"};
+      int LOC = findWord(arg, names, 4);
+      if (LOC < 0) {
+        reply(false, "loc a|v|p|u");
+        return;
+      }
+      head->setLOC(LOC);
+      reply(true, NULL);
+    }
+
+    /*
+       setAirCommand - air normal | air lockjaw irregular stridor agonal
+    */
+    void setAirCommand(char *arg) {
+      const char *const names[] = {"normal", "lockjaw", "irregular", "stridor", "agonal"};
+      boolean airCondition[5] = {false, false, false, false, false};
+      if (arg == NULL) {
+        reply(false, "air normal | air lockjaw irregular stridor agonal");
+        return;
+      }
+      for (char *word = arg; word != NULL; word = strtok(NULL, " ")) {
+        int i = findWord(word, names, 5);
+        if (i < 0) {
+          reply(false, "unknown airway problem");
+          return;
+        }
+        airCondition[i] = true;
+      }
+      if (!airCondition[1] && !airCondition[2] && !airCondition[3] && !airCondition[4]) {
+        airCondition[0] = true;
+      }
+      if (airCondition[0] && (airCondition[1] || airCondition[2] || airCondition[3] || airCondition[4])) {
+        reply(false, "normal cannot have airway problems");
+        return;
+      }
+      head->setAir(airCondition);
+      reply(true, NULL);
+    }
+
+    /*
+       setPulseCommand - pulse <bpm> | pulse normal|fast|slow | pulse <rhythm> <bpm>
+    */
+    void setPulseCommand(char *arg) {
+      const char *const ranges[] = {"normal", "fast", "slow"};
+      const char *const rhythms[] = {"sinus", "afib", "pvc", "brady", "alternans"};
+      long BPM;
+      int range = findWord(arg, ranges, 3);
+      int rhythm = findWord(arg, rhythms, 5);
+      if (readNumber(arg, BPM) && BPM > 0 && BPM <= 220) {
+        head->setPulseBPM(BPM);
+      } else if (range >= 0) {
+        head->setPulseRange(range);
+      } else if (rhythm >= 0 && readNumber(strtok(NULL, " "), BPM) && BPM > 0 && BPM <= 220) {
+        head->setPulseRhythm(rhythm, BPM);
+      } else {
+        reply(false, "pulse <bpm> | pulse normal|fast|slow | pulse <rhythm> <bpm>");
+        return;
+      }
+      startLine("OK bpm="); Serial.print(head->getPulseBPM());
+      Serial.print(" rhythm="); Serial.println(head->getPulseRhythm());
+    }
+
+    /*
+       doCommand - do <behavior> [ms] | do stop
+    */
+    void doCommand(char *arg) {
+      if (arg != NULL && strcmp(arg, "stop") == 0) {
+        behavior = -1;
+        reply(true, NULL);
+        return;
+      }
+      int i = findHeadBehavior(arg);
+      if (i >= 0) {
+        long runTime = defaultBehaviorTime;
+        char *time = strtok(NULL, " ");
+        if (time != NULL && (!readNumber(time, runTime) || runTime <= 0)) {
+          reply(false, "do <behavior> [ms]");
+          return;
+        }
+        behavior = i;
+        behaviorEndTime = millis() + runTime;
+        reply(true, NULL);
+        return;
+      }
+      startLine("ERR behaviors:");
+      for (int i = 0; i < numHeadBehaviors; i++) {
+        Serial.print(" "); Serial.print(headBehaviors[i].name);
+      }
+      Serial.println();
+    }
+
+    /*
+       scenarioCommand - scenario <file> | scenario restart
+    */
+    void scenarioCommand(char *arg) {
+      if (arg == NULL) {
+        reply(false, "scenario <file> | scenario restart");
+      } else if (strcasecmp(arg, "restart") == 0) {
+        scenario->start();
+        reply(scenario->isReady(), scenario->isReady() ? NULL : "no scenario is loaded");
+      } else if (scenario->load(arg)) {
+        reply(true, NULL);
+      } else {
+        reply(false, scenario->getError());
+      }
+    }
+
+    /*
+       getCommand - get settings|sensors|servos|audio|bus|scenario
+    */
+    void getCommand(char *arg) {
+      const char *const names[] = {"settings", "sensors", "servos", "audio", "bus", "scenario"};
+      switch (findWord(arg, names, 6)) {
+        case 0: {
+            boolean *air = head->getAir();
+            startLine("OK loc="); Serial.print(head->getLOC());
+            Serial.print(" air="); Serial.print(air[0]); Serial.print(air[1]); Serial.print(air[2]); Serial.print(air[3]); Serial.print(air[4]);
+            Serial.print(" bpm="); Serial.print(head->getPulseBPM());
+            Serial.print(" rhythm="); Serial.print(head->getPulseRhythm());
+            Serial.print(" set="); Serial.print(head->isLOCSet); Serial.print(head->isAirSet); Serial.print(head->isPulseSet);
+            Serial.print(" sim="); Serial.println(startSim);
+            break;
+          }
+        case 1:
+          startLine("OK force(N)=");
+          for (int s = 0; s < 5; s++) {
+            Serial.print(head->fsrArray.getForce(s), 2); Serial.print(s < 4 ? "," : "");
+          }
+          Serial.print(" raw=");
+          for (int s = 0; s < 5; s++) {
+            Serial.print(head->fsrArray.getRaw(s)); Serial.print(s < 4 ? "," : "");
+          }
+          Serial.print(" mic="); Serial.print(voiceDetect.getLevel(), 1);
+          Serial.print(" floor="); Serial.print(voiceDetect.getNoiseFloor(), 1);
+          Serial.print(" talking="); Serial.print(voiceDetect.talking());
+          Serial.print(" frame="); Serial.println(head->camera.getFrameNum());
+          break;
+        case 2:
+          startLine("OK");
+          for (int i = 0; i < numServos; i++) {
+            if (servoDegrees[i] >= 0) {
+              Serial.print(" "); Serial.print(i); Serial.print("="); Serial.print(servoDegrees[i]);
+            }
+          }
+          Serial.println();
+          break;
+        case 3:
+          startLine("OK busy="); Serial.print(head->voice.isBusy());
+          Serial.print(" played="); Serial.print(head->voice.getNumPlayed());
+          Serial.print(" failed="); Serial.print(head->voice.getNumFailed());
+          Serial.print(" latency(us)="); Serial.print(head->voice.getStartLatency());
+          Serial.print(" cpu="); Serial.print(AudioProcessorUsageMax());
+          Serial.print(" blocks="); Serial.print(AudioMemoryUsageMax()); Serial.print("/"); Serial.println(audioMemoryBlocks);
+          break;
+        case 4:
+          startLine("OK servos="); Serial.print(busTransfers[busServos]);
+          Serial.print(" servoMs="); Serial.print(busMicros[busServos] / 1000);
+          Serial.print(" lcd="); Serial.print(busTransfers[busLcd]);
+          Serial.print(" lcdMs="); Serial.print(busMicros[busLcd] / 1000);
+          Serial.print(" lcdSaved="); Serial.println(busTransfersSaved[busLcd]);
+          break;
+        case 5:
+          if (scenario->isReady()) {
+            startLine("OK state="); Serial.println(scenario->getStateName());
+          } else {
+            reply(false, scenario->getError());
+          }
+          break;
+        default:
+          reply(false, "get settings|sensors|servos|audio|bus|scenario");
+          break;
+      }
+    }
+
+    /*
+       streamCommand - stream <ms> | stream off
+    */
+    void streamCommand(char *arg) {
+      long period;
+      if (arg != NULL && strcmp(arg, "off") == 0) {
+        streamPeriod = 0;
+      } else if (readNumber(arg, period) && period >= 20) {
+        streamPeriod = period;
+        nextStreamTime = millis() + streamPeriod;
+        numLoops = 0;
+      } else {
+        reply(false, "stream <ms> (20 or more) | stream off");
+        return;
+      }
+      reply(true, NULL);
+    }
+
+    /*
+       calCommand - cal <sensor> <grams> | cal <sensor> 0
+    */
+    void calCommand(char *arg) {
+      long sensor;
+      long grams;
+      if (!readNumber(arg, sensor) || sensor < 0 || sensor >= 5 || !readNumber(strtok(NULL, " "), grams) || grams < 0) {
+        reply(false, "cal <sensor> <grams> | cal <sensor> 0");
+      } else if (grams > 0) {
+        boolean isAdded = head->fsrArray.addCalibrationPoint(sensor, grams * 0.00981);
+        reply(isAdded, isAdded ? NULL : "reading too small");
+      } else {
+        boolean isFit = head->fsrArray.finishCalibration(sensor);
+        reply(isFit, isFit ? NULL : "at least 2 different weights are needed");
+      }
+    }
+
+    /*
+       printHelp - help
+    */
+    void printHelp() {
+      startLine("OK commands:"); Serial.println();
+      startLine("  loc a|v|p|u"); Serial.println();
+      startLine("  air normal | air lockjaw irregular stridor agonal"); Serial.println();
+      startLine("  pulse <bpm> | pulse normal|fast|slow | pulse sinus|afib|pvc|brady|alternans <bpm>"); Serial.println();
+      startLine("  start | stop"); Serial.println();
+      startLine("  do <behavior> [ms] | do stop"); Serial.println();
+      startLine("  scenario <file> | scenario restart"); Serial.println();
+      startLine("  say <file> | effect <file>"); Serial.println();
+      startLine("  get settings|sensors|servos|audio|bus|scenario"); Serial.println();
+      startLine("  stream <ms> | stream off"); Serial.println();
+      startLine("  cal <sensor> <grams> | cal <sensor> 0"); Serial.println();
+    }
+
+    /*
+       runLine - carry out one command
+            return int - consoleNone, consoleStart, or consoleStop
+    */
+    int runLine(char *text) {
+      while (*text == ' ') {
+        text++;
+      }
+      // file names are typed as is, everything else does not care about capitals
+      boolean isFile = strncasecmp(text, "say ", 4) == 0 || strncasecmp(text, "effect ", 7) == 0 || strncasecmp(text, "scenario ", 9) == 0;
+      for (char *c = text; *c != '\0' && !(isFile && *c == ' '); c++) {
+        *c = tolower(*c);
+      }
+      char *command = strtok(text, " ");
+      if (command == NULL) {
+        return consoleNone;   // empty line
+      }
+      char *arg = strtok(NULL, " ");
+
+      if (strcmp(command, "help") == 0) {
+        printHelp();
+      } else if (strcmp(command, "loc") == 0) {
+        setLOCCommand(arg);
+      } else if (strcmp(command, "air") == 0) {
+        setAirCommand(arg);
+      } else if (strcmp(command, "pulse") == 0) {
+        setPulseCommand(arg);
+      } else if (strcmp(command, "start") == 0) {
+        if (!head->isAllSet()) {
+          reply(false, "set the loc, air and pulse first");
+        } else {
+          reply(true, NULL);
+          return consoleStart;
+        }
+      } else if (strcmp(command, "stop") == 0) {
+        behavior = -1;
+        reply(true, NULL);
+        return consoleStop;
+      } else if (strcmp(command, "do") == 0) {
+        doCommand(arg);
+      } else if (strcmp(command, "say") == 0) {
+        reply(arg != NULL && head->voice.queuePrompt(arg, promptNormal), arg == NULL ? "say <file>" : NULL);
+      } else if (strcmp(command, "effect") == 0) {
+        reply(arg != NULL && head->sound.playEffect(arg), arg == NULL ? "effect <file>" : NULL);
+      } else if (strcmp(command, "scenario") == 0) {
+        scenarioCommand(arg);
+      } else if (strcmp(command, "get") == 0) {
+        getCommand(arg);
+      } else if (strcmp(command, "stream") == 0) {
+        streamCommand(arg);
+      } else if (strcmp(command, "cal") == 0) {
+        calCommand(arg);
+      } else {
+        reply(false, "unknown command, type help");
+      }
+      return consoleNone;
+    }
+
+    /*
+       printTelemetry - print one line of telemetry if there is room for it in the USB buffer
+    */
+    void printTelemetry(unsigned long timeNow) {
+      if (Serial.availableForWrite() < telemetryBytes) {
+        numSkipped++;
+        return;
+      }
+      startLine("T t="); Serial.print(timeNow);
+      Serial.print(" sim="); Serial.print(startSim);
+      Serial.print(" loc="); Serial.print(head->getLOC());
+      Serial.print(" bpm="); Serial.print(head->getPulseBPM());
+      Serial.print(" breath="); Serial.print(head->breathing.getPhase());
+      Serial.print(" lung="); Serial.print(head->breathing.getVolume(), 2);
+      Serial.print(" force=");
+      for (int s = 0; s < 5; s++) {
+        Serial.print(head->fsrArray.getForce(s), 1); Serial.print(s < 4 ? "," : "");
+      }
+      Serial.print(" mic="); Serial.print(voiceDetect.getLevel(), 1);
+      Serial.print(" talking="); Serial.print(voiceDetect.talking());
+      Serial.print(" speaking="); Serial.print(head->voice.isBusy());
+      Serial.print(" cpu="); Serial.print(AudioProcessorUsage(), 1);
+      Serial.print(" loops/s="); Serial.print(numLoops * 1000 / streamPeriod);
+      Serial.print(" skipped="); Serial.println(numSkipped);
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the console
+    Console() {
+    }
+
+    /*
+       setUp - give the console the head it controls and the scenario it can load
+    */
+    void setUp(Head &consoleHead, Scenario &consoleScenario) {
+      head = &consoleHead;
+      scenario = &consoleScenario;
+      Serial.println("Console ready, type help for the commands");
+    }
+
+    //************************************************UPDATE********************************
+    /*
+       update - read the characters that came in, carry out a command once its line is done, run the behavior
+                and print the telemetry. Call this every loop (it does not wait).
+            return int - consoleStart or consoleStop if HAL.ino has to start or stop the simulation, otherwise consoleNone
+    */
+    int update() {
+      int action = consoleNone;
+      for (int n = 0; n < maxCharsPerLoop && Serial.available() > 0; n++) {
+        char c = Serial.read();
+        if (c == '\n' || c == '\r') {
+          if (isTooLong) {
+            reply(false, "line too long");
+          } else if (lineLength > 0) {
+            line[lineLength] = '\0';
+            action = runLine(line);
+          }
+          lineLength = 0;
+          isTooLong = false;
+          if (action != consoleNone) {
+            break;   // let HAL.ino act on it before reading more
+          }
+        } else if (lineLength < maxLineLength) {
+          line[lineLength++] = c == '\t' ? ' ' : c;
+        } else {
+          isTooLong = true;
+        }
+      }
+
+      unsigned long timeNow = millis();
+      if (behavior >= 0) {
+        if ((long)(timeNow - behaviorEndTime) >= 0 || headBehaviors[behavior].run(*head)) {
+          behavior = -1;
+        }
+      }
+
+      if (streamPeriod > 0) {
+        numLoops++;
+        if ((long)(timeNow - nextStreamTime) >= 0) {
+          printTelemetry(timeNow);
+          nextStreamTime += streamPeriod;
+          if ((long)(timeNow - nextStreamTime) > (long)(4 * streamPeriod)) {  // the loop was held up, do not try to catch up
+            nextStreamTime = timeNow + streamPeriod;
+          }
+          numLoops = 0;
+        }
+      }
+      return action;
+    }
+};
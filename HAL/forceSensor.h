@@ -42,7 +42,7 @@ class ForceSensor {
              return int sensorReading - the resulting raw data
     */
     int readRawAnalogInput(int forceSensorPin) {
-      sensorReading = analogRead(forceSensorPin);
+      sensorReading = readAnalog(forceSensorPin);
       return sensorReading;
     }
 
@@ -0,0 +1,354 @@
+/**********************************************************************************
+  fsrArray.h
+
+  This file contains the class definition, attributes, and methods of the FsrArray.
+  It scans all of the force sensors together at a fixed rate (200 times a second) instead
+  of each test function reading one sensor at a time with forceRange() in forceSensor.h.
+  For every sensor it:
+      - tracks the baseline reading (the sensors are pressed against the skin, so the
+        reading with no one touching HAL is not 0 and slowly drifts)
+      - sorts the reading above the baseline into the same 5 ranges as forceRange(), with
+        hysteresis so the range does not chatter when the force is near a threshold
+      - puts timestamped touch, press, squeeze, release, and tap events into an event
+        queue (see fsrEventQueue.h) for the behavior code in head.h
+      - converts the reading to a force in Newtons and finds how fast the force is
+        changing (see fsrCalibration.h for the curves and the saved preloads)
+
+  Nothing is printed while scanning. Use printEvent() to print the events that are taken
+  out of the queue. Events are only put in the queue while something is reading them
+  (getEvent() was called in the last readerTimeout), so the queue does not fill up with
+  old events while a test that only uses the ranges is running.
+ *********************************************************************************/
+#include <Arduino.h>
+#include "fsrEventQueue.h" // include the event queue
+#include "fsrCalibration.h" // include the force curves
+
+// SENSOR INDEXES (order of the pins given to setUp() in head.h)
+const int fsrForehead = 0;
+const int fsrNeck = 1;
+const int fsrChin = 2;
+const int fsrJawRight = 3;
+const int fsrJawLeft = 4;
+
+class FsrArray {
+  private:
+    static const int maxSensors = 8;
+    int numSensors = 0;
+    int pins[maxSensors];
+
+    // SCAN TIMING
+    const unsigned long scanPeriod = 5000;  // time between scans (us) - 200 scans/sec
+    unsigned long nextScanTime = 0;
+    unsigned long numScans = 0;
+
+    // RANGES - same thresholds as forceRange() in forceSensor.h, but above the baseline
+    // 0 = no pressure, 1 = very light force, 2 = light force, 3 = medium force, 4 = big force
+    static const int numRanges = 5;
+    const int rangeStart[numRanges] = {0, 100, 300, 500, 800};
+    const int hysteresis = 40;      // the reading has to drop this far below a threshold to go down a range
+    const int pressRange = 3;       // range that sends a press event
+    const int squeezeRange = 4;     // range that sends a squeeze event
+    const unsigned long tapTime = 250;  // longest touch that can be a tap (ms)
+    const unsigned long readerTimeout = 200;  // events are only queued if getEvent() was called within this time (ms)
+    unsigned long lastReadTime = 0;
+    boolean isReading = false;          // something is taking the events out of the queue
+
+    // BASELINE TRACKING
+    const float baselineRise = 1.0 / 256;  // how fast the baseline follows a rising reading when no one is touching (about 1.3 sec)
+    const float baselineFall = 1.0 / 16;   // how fast the baseline follows a falling reading (about 80 ms)
+    const int numBaselineReads = 16;       // readings averaged for the starting baseline
+
+    // FORCE
+    const float rateFilter = 0.2;          // how much of each new force rate is kept (smooths the rate over about 25 ms)
+
+    // STATE OF EACH SENSOR
+    struct SensorState {
+      int raw;                  // newest analog reading
+      float baseline;           // reading with no force applied
+      int value;                // reading above the baseline
+      int range;                // force range with hysteresis (0-4)
+      int peakValue;            // largest value since the touch
+      int peakRange;            // largest range since the touch
+      unsigned long touchTime;  // time of the touch (ms)
+      float force;              // force above the preload (N)
+      float forceRate;          // how fast the force is changing (N/s)
+    };
+    SensorState sensors[maxSensors];
+
+    FsrEventQueue queue = FsrEventQueue();
+    FsrCalibration calibration = FsrCalibration();
+
+    /*
+       sendEvent - put an event into the queue
+    */
+    void sendEvent(int s, int type, int value, unsigned long duration, unsigned long timeNow) {
+      if (!isReading || (long)(timeNow - lastReadTime) > (long)readerTimeout) {   // no one is reading the events
+        isReading = false;
+        return;
+      }
+      FsrEvent event;
+      event.sensor = s;
+      event.type = type;
+      event.value = value;
+      event.duration = min(duration, 65535UL);
+      event.timeStamp = timeNow;
+      queue.push(event);
+    }
+
+    /*
+       findRange - move the range of a sensor up or down with hysteresis
+            int range - current range
+            int value - reading above the baseline
+            return int - new range
+    */
+    int findRange(int range, int value) {
+      while (range < numRanges - 1 && value >= rangeStart[range + 1]) {
+        range++;
+      }
+      while (range > 0 && value < rangeStart[range] - hysteresis) {
+        range--;
+      }
+      return range;
+    }
+
+    /*
+       scanSensor - read one sensor, update its baseline and range, and send any events
+    */
+    void scanSensor(int s, unsigned long timeNow) {
+      SensorState &sensor = sensors[s];
+      sensor.raw = readAnalog(pins[s]);  // on ADC1 so the microphone is not disturbed
+
+      // only follow the baseline when no one is touching the sensor
+      float diff = sensor.raw - sensor.baseline;
+      if (diff < 0) {
+        sensor.baseline += diff * baselineFall;
+      } else if (sensor.range == 0 && diff < rangeStart[1] - hysteresis) {
+        sensor.baseline += diff * baselineRise;
+      }
+      sensor.value = max(0, (int)(sensor.raw - sensor.baseline));
+
+      // the curve is not a straight line, so the preload force is taken away instead of the preload reading
+      float lastForce = sensor.force;
+      sensor.force = max(0.0f, calibration.toForce(s, sensor.raw) - calibration.toForce(s, sensor.baseline));
+      float rate = (sensor.force - lastForce) * (1000000.0 / scanPeriod);
+      sensor.forceRate += (rate - sensor.forceRate) * rateFilter;
+
+      int lastRange = sensor.range;
+      sensor.range = findRange(lastRange, sensor.value);
+      if (sensor.range == lastRange) {
+        if (sensor.range > 0) {
+          sensor.peakValue = max(sensor.peakValue, sensor.value);
+        }
+        return;
+      }
+
+      if (lastRange == 0) {   // touch
+        sensor.touchTime = timeNow;
+        sensor.peakValue = sensor.value;
+        sensor.peakRange = 0;
+        sendEvent(s, fsrTouch, sensor.value, 0, timeNow);
+      }
+      sensor.peakValue = max(sensor.peakValue, sensor.value);
+      if (sensor.range > sensor.peakRange) {
+        if (sensor.peakRange < pressRange && sensor.range >= pressRange) {
+          sendEvent(s, fsrPress, sensor.value, 0, timeNow);
+        }
+        if (sensor.peakRange < squeezeRange && sensor.range >= squeezeRange) {
+          sendEvent(s, fsrSqueeze, sensor.value, 0, timeNow);
+        }
+        sensor.peakRange = sensor.range;
+      }
+      if (sensor.range == 0) {  // release
+        unsigned long duration = timeNow - sensor.touchTime;
+        sendEvent(s, fsrRelease, sensor.peakValue, duration, timeNow);
+        if (duration <= tapTime && sensor.peakRange < pressRange) {
+          sendEvent(s, fsrTap, sensor.peakValue, duration, timeNow);
+        }
+      }
+    }
+
+    /*
+       readAverage - average a few readings of a sensor
+    */
+    float readAverage(int s) {
+      long total = 0;
+      for (int i = 0; i < numBaselineReads; i++) {
+        total += readAnalog(pins[s]);
+      }
+      return (float)total / numBaselineReads;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the sensor array
+    FsrArray() {
+    }
+
+    /*
+       setUp - set the pins of the sensors, load the force curves and learn the preload of each one. Nothing should be touching HAL.
+            const int sensorPins[] - analog pins in the order of the sensor indexes (fsrForehead, fsrNeck, ...)
+            int count - number of sensors
+    */
+    void setUp(const int sensorPins[], int count) {
+      Serial.println("Initializing Force Sensor Array");
+      numSensors = min(count, maxSensors);
+      calibration.setUp(numSensors);
+      for (int s = 0; s < numSensors; s++) {
+        pins[s] = sensorPins[s];
+        checkAnalogPin(pins[s], "force sensor");
+        sensors[s].baseline = calibration.learnPreload(s, readAverage(s));
+        sensors[s].raw = sensors[s].baseline;
+        sensors[s].value = 0;
+        sensors[s].range = 0;
+        sensors[s].peakValue = 0;
+        sensors[s].peakRange = 0;
+        sensors[s].touchTime = 0;
+        sensors[s].force = 0;
+        sensors[s].forceRate = 0;
+      }
+      calibration.saveIfChanged();   // the EEPROM is only written if a preload moved
+      nextScanTime = micros();
+    }
+
+    //************************************************SCANNING********************************
+    /*
+       update - scan every sensor if it is time for the next scan. Call this every loop (it does not wait).
+            return boolean - true if the sensors were scanned
+    */
+    boolean update() {
+      unsigned long timeNow = micros();
+      if ((long)(timeNow - nextScanTime) < 0) {
+        return false;
+      }
+      nextScanTime += scanPeriod;
+      if ((long)(timeNow - nextScanTime) > (long)(4 * scanPeriod)) {  // the loop was blocked for a while, do not try to catch up
+        nextScanTime = timeNow + scanPeriod;
+      }
+      unsigned long timeMs = millis();
+      for (int s = 0; s < numSensors; s++) {
+        scanSensor(s, timeMs);
+      }
+      numScans++;
+      return true;
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getEvent - take the oldest event out of the queue
+            FsrEvent &event - resulting event
+            return boolean - false if there are no events
+    */
+    boolean getEvent(FsrEvent &event) {
+      unsigned long timeNow = millis();
+      if (!isReading || timeNow - lastReadTime > readerTimeout) {   // a new reader only gets the events from now on
+        queue.clear();
+        isReading = true;
+      }
+      lastReadTime = timeNow;
+      return queue.pop(event);
+    }
+
+    /*
+       getRange - force range of a sensor from the newest scan (same ranges as forceRange() in forceSensor.h)
+            int s - sensor index (ex. fsrNeck)
+            return int = 0-no pressure, 1 - very light force, 2- light force, 3- med force, 4- big force
+    */
+    int getRange(int s) {
+      return sensors[s].range;
+    }
+
+    /*
+       getValue - reading of a sensor above its baseline from the newest scan
+    */
+    int getValue(int s) {
+      return sensors[s].value;
+    }
+
+    /*
+       getRaw - newest analog reading of a sensor
+    */
+    int getRaw(int s) {
+      return sensors[s].raw;
+    }
+
+    /*
+       getBaseline - reading of a sensor with no force applied
+    */
+    float getBaseline(int s) {
+      return sensors[s].baseline;
+    }
+
+    /*
+       getForce - force on a sensor above its preload from the newest scan (N)
+    */
+    float getForce(int s) {
+      return sensors[s].force;
+    }
+
+    /*
+       getForceRate - how fast the force on a sensor is changing (N/s, negative when it is being let go)
+    */
+    float getForceRate(int s) {
+      return sensors[s].forceRate;
+    }
+
+    //************************************************CALIBRATION********************************
+    /*
+       addCalibrationPoint - add a calibration point for a sensor with a known weight on it (see fsrCalibration.h)
+            int s - sensor index
+            float forceN - force of the weight (N)
+            return boolean - false if the reading was too small to use
+    */
+    boolean addCalibrationPoint(int s, float forceN) {
+      float reading = readAverage(s);
+      Serial.print("Force sensor "); Serial.print(s);
+      Serial.print(" reading = "); Serial.print(reading);
+      Serial.print(" force (N) = "); Serial.println(forceN);
+      return calibration.addPoint(s, reading, forceN);
+    }
+
+    /*
+       finishCalibration - fit and save the curve of a sensor from its calibration points
+            int s - sensor index
+            return boolean - false if there were not enough points
+    */
+    boolean finishCalibration(int s) {
+      boolean isFit = calibration.fitCurve(s);
+      calibration.clearPoints(s);
+      return isFit;
+    }
+
+    /*
+       getNumScans - number of scans since setUp()
+    */
+    unsigned long getNumScans() {
+      return numScans;
+    }
+
+    /*
+       getNumDropped - number of events lost because the behavior code did not take them out of the queue in time
+    */
+    unsigned long getNumDropped() {
+      return queue.getNumDropped();
+    }
+
+    /*
+       printEvent - print an event to the serial monitor (for debugging)
+    */
+    void printEvent(const FsrEvent &event) {
+      const char *sensorNames[] = {"Forehead", "Neck", "Chin", "Jaw Right", "Jaw Left"};
+      const char *typeNames[] = {"Touch", "Press", "Squeeze", "Release", "Tap"};
+      Serial.print(event.timeStamp); Serial.print(" ms  ");
+      if (event.sensor < 5) {
+        Serial.print(sensorNames[event.sensor]);
+      } else {
+        Serial.print("Sensor "); Serial.print(event.sensor);
+      }
+      Serial.print(" "); Serial.print(typeNames[event.type]);
+      Serial.print("  value = "); Serial.print(event.value);
+      if (event.type == fsrRelease || event.type == fsrTap) {
+        Serial.print("  duration (ms) = "); Serial.print(event.duration);
+      }
+      Serial.println();
+    }
+};
@@ -0,0 +1,254 @@
+/**********************************************************************************
+  fsrCalibration.h
+
+  This file contains the class definition, attributes, and methods of the FsrCalibration.
+  It converts the force sensor readings into Newtons using a curve for each sensor.
+  Each FSR is in a voltage divider with a 10K resistor (see the Adafruit FSR guide linked
+  in forceSensor.h), so the analog reading gives the conductance of the FSR:
+      G (uS) = 1000000 * reading / (10000 * (1023 - reading))
+  and the force follows a power curve of the conductance:
+      F (N) = a * G^b
+  The Adafruit guide gives a = 1/80 and b = 1 for light forces, which is used until a
+  sensor is calibrated. To calibrate a sensor, put known weights on it, add a point for
+  each weight with addPoint(), then call fitCurve() (a straight line fit of log(F) vs
+  log(G)). Calibrate the sensors on the bench before they are put in the head so there
+  is no preload on them. The curves are turned into a small lookup table so the force
+  can be found at the scan rate with one multiply and add.
+
+  The preload (reading with no one touching the sensor, since the sensors are pressed
+  against the skin) is learned when HAL starts. The curves and preloads are saved in the
+  EEPROM so they are kept when the power is turned off. If HAL is touched while it starts,
+  the saved preload is used instead of the new one.
+ *********************************************************************************/
+#include <Arduino.h>
+#include <EEPROM.h>
+
+class FsrCalibration {
+  private:
+    static const int maxSensors = 8;
+    static const int tableSize = 65;          // one entry every 16 readings (0 to 1024)
+    static const int tableShift = 4;          // reading >> 4 = table index
+    const float dividerOhms = 10000;          // resistor in the voltage divider
+    const float defaultA = 1.0 / 80;          // Adafruit curve (N per uS)
+    const float defaultB = 1.0;
+
+    // SAVED IN THE EEPROM
+    static const int eepromAddress = 0;
+    static const uint16_t eepromMagic = 0x4653; // "FS"
+    static const uint8_t eepromVersion = 1;
+    struct SavedData {
+      uint16_t magic;
+      uint8_t version;
+      uint8_t numSensors;
+      float curveA[maxSensors];
+      float curveB[maxSensors];
+      float preload[maxSensors];    // reading with no force applied (-1 = not learned yet)
+      uint16_t checksum;
+    };
+    SavedData data;
+
+    // LOOKUP TABLE (Newtons at every 16th reading)
+    float table[maxSensors][tableSize];
+
+    // CALIBRATION POINTS (sums for the log-log line fit)
+    struct FitSums {
+      int count;
+      float sumX;
+      float sumY;
+      float sumXX;
+      float sumXY;
+    };
+    FitSums fits[maxSensors];
+
+    const float preloadTouch = 100;  // a starting reading this much above the saved preload means someone is touching HAL
+    const float preloadChange = 8;   // the preload is only saved again if it changed by more than this (saves EEPROM writes)
+    boolean isChanged = false;       // a preload changed and was not saved yet
+
+    /*
+       findChecksum - add up the bytes of the saved data (except the checksum)
+    */
+    uint16_t findChecksum() {
+      const uint8_t *bytes = (const uint8_t *)&data;
+      uint16_t sum = 0;
+      for (unsigned int i = 0; i < sizeof(SavedData) - sizeof(uint16_t); i++) {
+        sum = (sum << 1 | sum >> 15) + bytes[i];
+      }
+      return sum;
+    }
+
+    /*
+       findConductance - conductance of the FSR from an analog reading
+            float reading - analog reading (0-1023)
+            return float - conductance (uS)
+    */
+    float findConductance(float reading) {
+      reading = constrain(reading, 0.0f, 1022.0f);
+      return 1000000.0 * reading / (dividerOhms * (1023 - reading));
+    }
+
+    /*
+       makeTable - fill in the lookup table of a sensor from its curve
+    */
+    void makeTable(int s) {
+      for (int i = 0; i < tableSize; i++) {
+        float conductance = findConductance(i << tableShift);
+        table[s][i] = conductance > 0 ? data.curveA[s] * pow(conductance, data.curveB[s]) : 0;
+      }
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the calibration
+    FsrCalibration() {
+    }
+
+    /*
+       setUp - load the curves from the EEPROM (or use the Adafruit curve if nothing was saved)
+            int numSensors - number of sensors
+            return boolean - true if saved curves were loaded
+    */
+    boolean setUp(int numSensors) {
+      numSensors = min(numSensors, maxSensors);
+      EEPROM.get(eepromAddress, data);
+      boolean isLoaded = data.magic == eepromMagic && data.version == eepromVersion && data.checksum == findChecksum();
+      if (!isLoaded) {
+        Serial.println("No saved force sensor calibration, using default curves");
+        data.magic = eepromMagic;
+        data.version = eepromVersion;
+        for (int s = 0; s < maxSensors; s++) {
+          data.curveA[s] = defaultA;
+          data.curveB[s] = defaultB;
+          data.preload[s] = -1;
+        }
+      }
+      data.numSensors = numSensors;
+      for (int s = 0; s < maxSensors; s++) {
+        makeTable(s);
+        clearPoints(s);
+      }
+      return isLoaded;
+    }
+
+    /*
+       save - write the curves and preloads to the EEPROM. Nothing is written if the saved data is the same.
+    */
+    void save() {
+      data.checksum = findChecksum();
+      SavedData saved;
+      EEPROM.get(eepromAddress, saved);
+      if (memcmp(&saved, &data, sizeof(SavedData)) != 0) {
+        EEPROM.put(eepromAddress, data);
+      }
+      isChanged = false;
+    }
+
+    /*
+       saveIfChanged - save the preloads if any of them changed since the last save (call this once every preload is learned)
+    */
+    void saveIfChanged() {
+      if (isChanged) {
+        save();
+      }
+    }
+
+    //************************************************PRELOAD********************************
+    /*
+       learnPreload - set the preload of a sensor from the reading when HAL starts
+            int s - sensor index
+            float reading - starting reading with no one touching HAL
+            return float - preload to use (the saved one if the new reading looks like a touch)
+    */
+    float learnPreload(int s, float reading) {
+      float saved = data.preload[s];
+      if (saved >= 0 && reading > saved + preloadTouch) {
+        Serial.print("Force sensor "); Serial.print(s); Serial.println(" is being touched, using the saved preload");
+        return saved;
+      }
+      if (saved < 0 || abs(reading - saved) > preloadChange) {
+        data.preload[s] = reading;
+        isChanged = true;   // saved by saveIfChanged() once every sensor is learned
+      }
+      return reading;
+    }
+
+    /*
+       getPreload - saved preload reading of a sensor (-1 if it was never learned)
+    */
+    float getPreload(int s) {
+      return data.preload[s];
+    }
+
+    //************************************************CALIBRATION********************************
+    /*
+       clearPoints - remove the calibration points of a sensor
+    */
+    void clearPoints(int s) {
+      fits[s].count = 0;
+      fits[s].sumX = 0;
+      fits[s].sumY = 0;
+      fits[s].sumXX = 0;
+      fits[s].sumXY = 0;
+    }
+
+    /*
+       addPoint - add a calibration point (a known weight on the sensor)
+            int s - sensor index
+            float reading - analog reading with the weight on the sensor
+            float forceN - force of the weight (N) - ex. 100 g = 0.981 N
+            return boolean - false if the reading is too small to use
+    */
+    boolean addPoint(int s, float reading, float forceN) {
+      float conductance = findConductance(reading);
+      if (conductance <= 0 || forceN <= 0) {
+        return false;
+      }
+      float x = log(conductance);
+      float y = log(forceN);
+      fits[s].count++;
+      fits[s].sumX += x;
+      fits[s].sumY += y;
+      fits[s].sumXX += x * x;
+      fits[s].sumXY += x * y;
+      return true;
+    }
+
+    /*
+       fitCurve - fit the curve of a sensor to its calibration points, remake its table and save it
+            int s - sensor index
+            return boolean - false if there are not enough different points (at least 2 are needed)
+    */
+    boolean fitCurve(int s) {
+      FitSums &fit = fits[s];
+      float denom = fit.count * fit.sumXX - fit.sumX * fit.sumX;
+      if (fit.count < 2 || abs(denom) < 1e-6) {
+        return false;
+      }
+      float b = (fit.count * fit.sumXY - fit.sumX * fit.sumY) / denom;
+      float a = exp((fit.sumY - b * fit.sumX) / fit.count);
+      data.curveA[s] = a;
+      data.curveB[s] = b;
+      makeTable(s);
+      save();
+      Serial.print("Force sensor "); Serial.print(s);
+      Serial.print(" curve: F = "); Serial.print(a, 6);
+      Serial.print(" * G^"); Serial.println(b, 4);
+      return true;
+    }
+
+    //************************************************FORCE********************************
+    /*
+       toForce - force on a sensor from a reading (lookup table, no curve math)
+            int s - sensor index
+            float reading - analog reading (0-1023)
+            return float - force (N)
+    */
+    float toForce(int s, float reading) {
+      if (reading <= 0) {
+        return 0;
+      }
+      float index = min(reading, 1023.0f) / (1 << tableShift);
+      int i = min((int)index, tableSize - 2);
+      float fraction = index - i;
+      return table[s][i] + (table[s][i + 1] - table[s][i]) * fraction;
+    }
+};
@@ -0,0 +1,100 @@
+/**********************************************************************************
+  fsrEventQueue.h
+
+  This file contains the FsrEvent structure and the class definition, attributes, and
+  methods of the FsrEventQueue. The force sensor array (see fsrArray.h) puts an event in
+  the queue whenever a sensor is touched, pressed, squeezed, released, or tapped, and the
+  behavior code (see head.h) takes the events out when it is ready for them.
+
+  The queue is a ring buffer with one writer (the sensor scan) and one reader (the
+  behavior code). Each side only changes its own index, so no interrupts have to be
+  turned off and the scan could be moved into a timer interrupt without changing the
+  queue. When the queue is full the newest event is dropped and counted.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// EVENT TYPES
+const int fsrTouch = 0;    // the sensor went from no force to some force
+const int fsrPress = 1;    // the force went up to a medium force
+const int fsrSqueeze = 2;  // the force went up to a big force
+const int fsrRelease = 3;  // the force went back to no force
+const int fsrTap = 4;      // a short, light touch (sent after its release)
+
+// One change on one force sensor
+struct FsrEvent {
+  uint8_t sensor;           // index of the sensor in the array (see fsrArray.h)
+  uint8_t type;             // fsrTouch, fsrPress, fsrSqueeze, fsrRelease or fsrTap
+  int16_t value;            // reading above the baseline when the event happened (peak reading for release and tap)
+  uint16_t duration;        // time since the touch (ms) for release and tap, otherwise 0
+  unsigned long timeStamp;  // time of the scan that found the event (ms)
+};
+
+class FsrEventQueue {
+  private:
+    static const int queueSize = 32;   // must be a power of 2
+    FsrEvent events[queueSize];
+    volatile uint8_t head = 0;  // next spot to write (only changed by push())
+    volatile uint8_t tail = 0;  // next spot to read (only changed by pop())
+    volatile unsigned long numDropped = 0;
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the queue
+    FsrEventQueue() {
+    }
+
+    //************************************************WRITER********************************
+    /*
+       push - add an event to the end of the queue (only call this from the sensor scan)
+            const FsrEvent &event - event to add
+            return boolean - false if the queue was full and the event was dropped
+    */
+    boolean push(const FsrEvent &event) {
+      uint8_t next = (head + 1) & (queueSize - 1);
+      if (next == tail) {
+        numDropped++;
+        return false;
+      }
+      events[head] = event;
+      asm volatile("" ::: "memory");  // the event must be written before the reader can see the new head
+      head = next;
+      return true;
+    }
+
+    //************************************************READER********************************
+    /*
+       pop - take the oldest event out of the queue (only call this from the behavior code)
+            FsrEvent &event - resulting event
+            return boolean - false if the queue is empty
+    */
+    boolean pop(FsrEvent &event) {
+      if (tail == head) {
+        return false;
+      }
+      event = events[tail];
+      asm volatile("" ::: "memory");  // the event must be read before the writer can reuse its spot
+      tail = (tail + 1) & (queueSize - 1);
+      return true;
+    }
+
+    /*
+       clear - throw away every event that is waiting (only call this from the behavior code)
+    */
+    void clear() {
+      tail = head;
+    }
+
+    /*
+       isEmpty - check if there are no events waiting
+    */
+    boolean isEmpty() {
+      return tail == head;
+    }
+
+    /*
+       getNumDropped - number of events lost because the queue was full
+    */
+    unsigned long getNumDropped() {
+      return numDropped;
+    }
+};
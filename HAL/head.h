@@ -19,13 +19,18 @@
 #include "Lids.h"
 #include "jaw.h"
 #include "neck.h"
+#include "breathing.h"
 
 // Sensors and Electronics Header Files
 #include "forceSensor.h"
+#include "fsrArray.h"
 #include "microphone.h"
 #include "camera.h"
+#include "latencyMonitor.h"
 #include "pulse.h"
+#include "soundMixer.h"
 #include "voice.h"
+#include "audioBenchmark.h"
 
 class Head {
   private:
@@ -43,24 +48,29 @@ class Head {
 
     // Circulation Variable
     int pulseNum = 120; //used for exact pulse BPM - initialize to default 120 BPM
+    int pulseRhythm = rhythmSinus; // heart rhythm of the pulse (see cardiacRhythm.h)
 
     // Listening Variables
     int micState = 0; // state variale if listening or responding or checking till done talking
-    const int micRange = 20; //any value outside the range of -micRange to micRange is means the person is talking
-    const int micOffset = 560;  // offest used to filter out the unneccessary data from the mic - Note: Mic Potentiometer may need to be adjusted before each use
+    unsigned long lastMicPrint = 0; // time the voice detector values were last printed in the micTest
     int timesResponded = 0; // the number of times the head responded to the person - keeps track of script and when to execute certain actions.
     boolean finishedDialogue = false; // track if the person is done talking
 
     // Camera Hand Tracking Variables
     int lastTime; // store the number of frames hand was tracked
     int count; // count how long the hand has been at the same location
+    unsigned long lastFrameNum = 0; // camera frame number that was last checked for the age of the block
+    unsigned long lastTimedFrameNum = 0; // camera frame number that was last timed by the latency monitor
 
     //Airway Variables for UI interaction
     boolean isNormAir; //true if normal airway
     boolean isLockJaw; //true if have lock jaw problem
+    const float lockJawOpen = 5; // percent the jaw can open with lock jaw (the mouth stays almost closed)
     boolean isIrrBreath; //true if have irregular breathing
     boolean isStriBreath; // true if have stridor breathing
     boolean isAgGasp; // true if have agonal gasps
+    unsigned long lastBreathNum = 0; // breath that was last printed in the breathingTest
+    boolean isBenchmarkStarted = false; // true once the audioBenchmarkTest has found the prompts
 
 
     // Sensor pins
@@ -74,6 +84,23 @@ class Head {
     // General state variable for testing functions
     int headState = 0;
 
+    // Pain grading for the painLOCTest (force on the neck sensor, see fsrArray.h)
+    const float touchForce = 0.5;    // N - anything less is no pressure
+    const float lightForce = 2;      // N
+    const float mediumForce = 5;     // N
+    const float painForce = 10;      // N - a hard squeeze or pinch
+    const float painRate = 40;       // N/s - a quick jab hurts even before the force gets to painForce
+
+    // Prompts of the built in LOC tests, in the order they are said (alert, verbal, pain). loadPrompts() caches the
+    // prompts of the LOC that is set from this table, so a new prompt only has to be added here.
+    static const int numDialogues = 2;
+    const char *const locDialogue[3][numDialogues] = {
+      {"HIBUS.WAV", "YESFOLOW.WAV"},    // alert: greeting and a brief description of the medical problem, then agree to follow the hand
+      {"AHHH.WAV", "YESFOLOW.WAV"},     // verbal: dazed greeting, then agree to follow the hand
+      {"SDTEST1.WAV", "AHHH.WAV"},      // pain: default sample .wav file from Teensy website, then a placeholder pain yell
+    };
+    const char *const painYell = "AHHH.WAV";   // played by painActions()
+
   public:
     // ********************************************PUBLIC**************************************
     // Having all of the features public will let you access certain facial
@@ -98,6 +125,7 @@ class Head {
     Eyelids eyeLids = Eyelids();
     Neck neck = Neck();
     Jaw jaw = Jaw();
+    Breathing breathing = Breathing(); // moves the jaw and neck and plays the breathing sounds (see breathing.h)
 
     // SENSORS
     ForceSensor foreheadSensor = ForceSensor(foreheadSensorPin); // Large FSR
@@ -105,12 +133,16 @@ class Head {
     ForceSensor chinSensor = ForceSensor(chinSensorPin); // Small FSR
     ForceSensor jawRightSensor = ForceSensor(jawRightSensorPin); // Small FSR
     ForceSensor jawLeftSensor = ForceSensor(jawLeftSensorPin); // Small FSR
+    FsrArray fsrArray = FsrArray(); // scans all five force sensors together (see fsrArray.h)
     Microphone mic = Microphone(micPin);
     Camera camera = Camera();
+    LatencyMonitor latency = LatencyMonitor(); // camera to servo latency (off unless latencyTest() is run)
 
     // OTHER ELECTRONICS
     Pulse pulse = Pulse();
     Voice voice = Voice();
+    SoundMixer sound = SoundMixer(); // volume of the speech, breathing and effects layers (see soundMixer.h)
+    AudioBenchmark benchmark = AudioBenchmark(); // prompt latency and underruns (off unless audioBenchmarkTest() is run)
 
     //**************************************************************************************************INITIALIZE*********************************************************
     // Define Head
@@ -128,6 +160,7 @@ class Head {
       eyeBrows.setUp();
       neck.setUp();
       jaw.setUp();
+      breathing.setUp(jaw, neck);
 
       // Sensors and Electronics
       foreheadSensor.setUp(foreheadSensorPin);
@@ -135,9 +168,14 @@ class Head {
       chinSensor.setUp(chinSensorPin);
       jawRightSensor.setUp(jawRightSensorPin);
       jawLeftSensor.setUp(jawLeftSensorPin);
+      const int fsrPins[] = {foreheadSensorPin, neckSensorPin, chinSensorPin, jawRightSensorPin, jawLeftSensorPin}; // same order as fsrForehead, fsrNeck, ...
+      fsrArray.setUp(fsrPins, 5);
       camera.setUp(); // uncomment once you are testing with camera
+      camera.setAttention(attendLargest, 1); // follow the closest (largest) block. Use attendSignature to only follow one glove color
       mic.setUp(micPin);
       pulse.setUp();
+      sound.setUp(); // audio memory for the sound layers in use
+      breathing.setSound(sound.isUsed(layerBreathing));
       voice.setUp(); // uncomment once you are testing with voice
     }
 
@@ -149,8 +187,19 @@ class Head {
                Set the respective boolean indicating the LOC is now set.
           int LOCSetting - integer indicating the level  where
                            0 = Alert, 1 = Verbal Response, 2 = Painful Response, 3 = Unresponsive
+          A different LOC restarts the LOC test, so it can be changed while the simulation is running.
     */
     void setLOC(int LOCSetting) {
+      if (isLOCSet && LOCSetting != stateLOC) {   // changed during the simulation, start the new LOC test from the beginning
+        alertLOCState = 0;
+        verbalLOCState = 0;
+        painLOCState = 0;
+        micState = 0;
+        timesResponded = 0;
+        finishedDialogue = false;
+        count = 0;
+        voice.cancel();
+      }
       stateLOC = LOCSetting;
       isLOCSet = true;
     }
@@ -168,6 +217,10 @@ class Head {
     */
     void setAir(boolean *airCondition) {
       isNormAir = airCondition[0];
+      isLockJaw = false;
+      isIrrBreath = false;
+      isStriBreath = false;
+      isAgGasp = false;
       if (!isNormAir) {
         isLockJaw = airCondition[1];
         isIrrBreath = airCondition[2];
@@ -176,6 +229,8 @@ class Head {
           isAgGasp = airCondition[4];
         }
       }
+      breathing.setAirway(isIrrBreath, isStriBreath, isAgGasp);
+      jaw.setMaxOpen(isLockJaw ? lockJawOpen : 100);  // every jaw movement is held to it (talking, breathing, behaviors)
       isAirSet = true;  // indicate airway is set now
       Serial.print("Normal airway condition"); Serial.println(isNormAir); // for debuggin
     }
@@ -187,6 +242,7 @@ class Head {
     */
     void setPulseBPM(int pulseBPM) {
       pulseNum = pulseBPM;
+      pulseRhythm = rhythmSinus;
       Serial.print("SET PULSE TO = "); Serial.println(pulseNum);
       isPulseSet = true;
     }
@@ -197,21 +253,69 @@ class Head {
           int pulseRange - integer from 0-2 where:
                           0 = normal pulse range
                           1 = fast pulse range
-                          2 = slow pulse range
+                          2 = slow pulse range (bradycardia with sinus pauses)
     */
     void setPulseRange(int pulseRange) {
+      pulseRhythm = rhythmSinus;
       if (pulseRange == 0) {        // obtain a pulse value withing the normal, fast, or slow ranges (see pulse.h for details)
         pulseNum = pulse.normalPulse();
       } else if (pulseRange == 1) {
         pulseNum = pulse.fastPulse();
       } else if (pulseRange == 2) {
         pulseNum = pulse.slowPulse();
+        pulseRhythm = rhythmBrady;
       } else {
         Serial.println("ERROR SETTING PULSE FROM RANGE");
       }
       isPulseSet = true;  //indicate the pulse is now set
     }
 
+    /*
+      setPulseRhythm - Set the pulse to a heart rhythm at an average BPM (see cardiacRhythm.h)
+                       Set the respective boolean indicating the pulse/circulation is now set
+          int rhythm - rhythmSinus, rhythmAfib, rhythmPVC, rhythmBrady or rhythmAlternans
+          int pulseBPM - average BPM of the rhythm
+    */
+    void setPulseRhythm(int rhythm, int pulseBPM) {
+      pulseRhythm = rhythm;
+      pulseNum = pulseBPM;
+      isPulseSet = true;
+    }
+
+    /*
+       getLOC - the LOC that was set (0 = Alert, 1 = Verbal Response, 2 = Painful Response, 3 = Unresponsive)
+    */
+    int getLOC() {
+      return stateLOC;
+    }
+
+    /*
+       getAir - the airway conditions that were set, in the same order as setAir()
+    */
+    boolean *getAir() {
+      static boolean result[5];
+      result[0] = isNormAir;
+      result[1] = isLockJaw;
+      result[2] = isIrrBreath;
+      result[3] = isStriBreath;
+      result[4] = isAgGasp;
+      return result;
+    }
+
+    /*
+       getPulseBPM - the average BPM of the pulse that was set
+    */
+    int getPulseBPM() {
+      return pulseNum;
+    }
+
+    /*
+       getPulseRhythm - the heart rhythm of the pulse that was set (see cardiacRhythm.h)
+    */
+    int getPulseRhythm() {
+      return pulseRhythm;
+    }
+
     /*
        isAllSet - checks to see if all of the settings for the head are set
             return boolean - true if all the different settings have been assigned a value, false otherwise
@@ -221,12 +325,47 @@ class Head {
     }
 
 
+    /*
+       loadPrompts - copy the prompts for the LOC test that was set into the prompt cache so they start right away (see promptCache.h).
+                     Run this once when the simulation starts.
+    */
+    void loadPrompts() {
+      stopSdPlayers();
+      const char *prompts[numDialogues + 1];
+      int numPrompts = 0;
+      if (stateLOC >= 0 && stateLOC < 3) {   // the unresponsive test does not talk
+        for (int i = 0; i < numDialogues; i++) {
+          prompts[numPrompts++] = locDialogue[stateLOC][i];
+        }
+      }
+      if (stateLOC == 2) {
+        prompts[numPrompts++] = painYell;
+      }
+      if (numPrompts > 0) {
+        voice.loadScenario(prompts, numPrompts);
+      }
+    }
+
+    /*
+       stopSdPlayers - stop the prompt and the sound effect so nothing reads the SD card in the audio interrupt.
+                       Run this before the loop reads the SD card (loading a scenario or caching prompts), the
+                       SD library cannot be used from both at once.
+    */
+    void stopSdPlayers() {
+      voice.cancel();
+      sound.stopEffect();
+    }
+
     //************************************************************************************** LOC TESTS **********************************************************************
     /*
          LOCTEST - Switch case that calls the different LOC tests depending on the state
                    that was set from the user. See each LOCTest() for details.
     */
     void LOCTEST() {
+      // breathe in the background - the jaw is used for talking while HAL responds and the neck is only free when unresponsive
+      breathing.update(micState < 2, stateLOC == 3);
+      voice.update();   // start and hand off the queued prompts
+      sound.update(voice.isBusy());   // ramp the layer volumes and turn the breathing down while HAL talks
       switch (stateLOC) {
         case 0: // alert
           alertLOCTest();
@@ -262,7 +401,7 @@ class Head {
     */
     void alertLOCTest() {
       //      Serial.print("ALERT LOC STATE = "); Serial.println(alertLOCState); // for debugging
-      pulse.pulseByBPM(pulseNum);     // run the pulse constantly
+      pulse.pulseByRhythm(pulseRhythm, pulseNum);     // run the pulse constantly
       //***************** State is equal to 0****************
       if (alertLOCState == 0) {
         if (finishedDialogue) { // if the person is done speaking back and forth, switch states
@@ -273,21 +412,25 @@ class Head {
       }
       //***************** State is equal to 1****************
       if (alertLOCState == 1) {
-        int *blockAge = camera.getBlockInfo(4); // use the camera to detect objects
-        int framesTracked = blockAge[0];    // how long has the object been tracked
-        Serial.print("AGE OF BLOCK = "); Serial.println(framesTracked);
+        camera.update();  // read the camera once for this loop so the age and coordinates come from the same frame
         followHand();     // move the eyeballs to follow the detected hand
-        if (framesTracked > 0 && framesTracked == lastTime) {  // if the object is no longer detected or being tracked
-          if (count > 40) {     // if it doesnt comeback into the frame within the given time, switch states
-            alertLOCState = 2;
-            Serial.println ("Set to second state");
-            delay(2000);
-          } else {  //increment the count
-            count++;
-            Serial.print(" count = "); Serial.println(count);
+        if (camera.isNewFrame(lastFrameNum)) {  // only check the age once per camera frame
+          lastFrameNum = camera.getFrameNum();
+          int *blockAge = camera.getBlockInfo(4); // use the camera to detect objects
+          int framesTracked = blockAge[0];    // how long has the object been tracked
+          Serial.print("AGE OF BLOCK = "); Serial.println(framesTracked);
+          if (framesTracked > 0 && framesTracked == lastTime) {  // if the object is no longer detected or being tracked
+            if (count > 40) {     // if it doesnt comeback into the frame within the given time, switch states
+              alertLOCState = 2;
+              Serial.println ("Set to second state");
+              delay(2000);
+            } else {  //increment the count
+              count++;
+              Serial.print(" count = "); Serial.println(count);
+            }
+          } else {
+            lastTime = framesTracked;   // update the variable that stores the previous value of how long it is tracked
           }
-        } else {
-          lastTime = framesTracked;   // update the variable that stores the previous value of how long it is tracked
         }
       }
       //***************** State is equal to 2****************
@@ -321,7 +464,7 @@ class Head {
     */
     void verbalLOCTest() {
       //      Serial.print("VERBAL LOC STATE = "); Serial.println(verbalLOCState); // for debugging
-      pulse.pulseByBPM(pulseNum); // pulse runs continuously
+      pulse.pulseByRhythm(pulseRhythm, pulseNum); // pulse runs continuously
       //***************** State is equal to 0****************
       if (verbalLOCState == 0) { // first speak with the person. after 2 responses then change state
         if (finishedDialogue) {// if the person is done speaking back and forth, switch states
@@ -332,21 +475,25 @@ class Head {
       }
       //***************** State is equal to 1****************
       if (verbalLOCState == 1) { // next follow the persons finger with eyes.
-        int *blockAge = camera.getBlockInfo(4);// use the camera to detect objects
-        int framesTracked = blockAge[0];   // how long has the object been tracked
-        Serial.print("AGE OF BLOCK = "); Serial.println(framesTracked);
+        camera.update();  // read the camera once for this loop so the age and coordinates come from the same frame
         followHand(); // move the eyeballs to follow the detected hand
-        if (framesTracked > 0 && framesTracked == lastTime) { // if the object is no longer detected or being tracked
-          if (count > 40) {// if it doesnt comeback into the frame within the given time, switch states
-            verbalLOCState = 2;
-            Serial.println("Set to second state");
-            delay(1000);
+        if (camera.isNewFrame(lastFrameNum)) { // only check the age once per camera frame
+          lastFrameNum = camera.getFrameNum();
+          int *blockAge = camera.getBlockInfo(4);// use the camera to detect objects
+          int framesTracked = blockAge[0];   // how long has the object been tracked
+          Serial.print("AGE OF BLOCK = "); Serial.println(framesTracked);
+          if (framesTracked > 0 && framesTracked == lastTime) { // if the object is no longer detected or being tracked
+            if (count > 40) {// if it doesnt comeback into the frame within the given time, switch states
+              verbalLOCState = 2;
+              Serial.println("Set to second state");
+              delay(1000);
+            } else {
+              Serial.print("count = "); Serial.println(count);
+              count++;  // increment the count
+            }
           } else {
-            Serial.print("count = "); Serial.println(count);
-            count++;  // increment the count
+            lastTime = framesTracked; // update the variable that stores the previous value of how long it is tracked
           }
-        } else {
-          lastTime = framesTracked; // update the variable that stores the previous value of how long it is tracked
         }
       }
       //***************** State is equal to 2****************
@@ -365,12 +512,13 @@ class Head {
                       should only respond to physical stimuli and does not listen to the user at all. The movements
                       should be more dazed. This function soley relies on the neck sensor to change reactions
                       but the other 4 FSRs can be incorporated into this test in future iterations.
-                      The switch cases changes states based on the level of force applied to the neck sesnor.
+                      The switch cases changes states based on the force (N) applied to the neck sensor and how fast it is applied (see gradePain()).
                       Uncomment/comment different lines to have different reactions based on the degree of force applied.
     */
     void painLOCTest() {
       pulse.randPulse();    // random/irregular pulse
-      headState = neckSensor.forceRange(neckSensorPin); // read force sensor and divide into a specific range
+      fsrArray.update();    // scan the force sensors if it is time
+      headState = gradePain(fsrNeck); // grade the force on the neck sensor
       switch (headState) {
         case 0:     // act dazed or tired while no force is applied
           //          alertActions();
@@ -409,14 +557,14 @@ class Head {
        listenAndRespond - The system listens to the user and responds twice with mechanical and audio feedback. This is a modified verstion of micTest().
                           State 0 = The microphone is read, filtered, and if it is outside of the normal range,
                           State 1 = the person is talking so the microphone waits to see if the audio goes back to normal at which point
-                          State 2 = The system responds with an audio response and a mechanical responds that lasts until the audio is complete.
+                          State 2 = The system starts an audio response (the prompt is queued, see voice.h),
+                          State 3 = the mechanical response runs every loop until the audio is complete. HAL keeps listening while he responds.
                           This process is repeated twice (ie. user speaks, Hal responds, user speaks, Hal Responds).
                           The timesResponded limit can be changed based on the script that is followed. The 3.5 second wait after the person has finished
                           talking can be adjusted to a different time if it proves to be too slow.
     */
     void listenAndRespond() {
-      int anVal;  // store raw analog value
-      int trimmedVal; // store filtered value
+      VoiceEvent event; // start or end of talking from the voice detector (see voiceDetector.h)
       switch (micState) {
         case 0:       // The head is listening
           // if the head has responded two times already, then stop and say that the dialogue is finished
@@ -426,45 +574,74 @@ class Head {
 //            return finishedDialogue;  // this line can be removed since finishedDialogue is global. Just have not tested at this point
             break;
           }
-          // check the microphone to see if its has heard anything out of the ordinary range
-          anVal = analogRead(micPin);
-          trimmedVal = anVal - micOffset;
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);
-          // if the mic heard anything out of the ordinary range, then switch to next case
-          if (trimmedVal > micRange || trimmedVal < -micRange) {
+          // if the voice detector heard someone start talking, then switch to next case
+          if (mic.getVoiceEvent(event) && event.type == voiceStart) {
+            mic.printVoiceEvent(event);
             micState = 1;
             timeNow = millis(); // reset timer for next case
           }
           break;
 
         case 1:       // The head is waiting for user to finish speaking
-          anVal = analogRead(micPin);
-          trimmedVal = anVal - micOffset;
-          Serial.println("You are talking ");
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);
-          // if the mic has picked up values back in the normal range and has waits for 3.5 seconds of "no talking", then move to the next state
-          if ((trimmedVal < micRange || trimmedVal > -micRange) && (millis() > timeNow + 3500)) {
+          // the voice detector only ends the talking after a pause that is longer than the pauses between words
+          if (mic.getVoiceEvent(event) && event.type == voiceEnd) {
+            mic.printVoiceEvent(event);
             micState = 2;
             timeNow = millis(); // reset timer for next case
           }
           break;
 
-        case 2:   // Head is responding to dialogue
-          stateVoiceLOCResponses(); // completes certain responses depending on LOC state
-          anVal = analogRead(micPin);
-          trimmedVal = anVal - micOffset; // NOTE: future work could include having HAL continue to listen as he responds and stop/change his reaction if the user interrupts him
+        case 2:   // Head starts responding to dialogue
+          stateVoiceLOCResponses(); // queues certain responses depending on LOC state
           Serial.println("responding ");
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);
-          while (voice.stillPlaying()) {  // if the audio is still playing
-            stateMechLOCResponses(); // completes the corresponding responses that match the audio
+          micState = 3;
+          break;
+
+        case 3:   // Head is responding to dialogue (checked every loop so nothing waits for the audio)
+          stateMechLOCResponses(); // completes the corresponding responses that match the audio
+          // If the person talks over him, the voice detector turns the prompt down right away (see voiceDetector.h),
+          // then the prompt is stopped and HAL waits for them to finish.
+          if (mic.getVoiceEvent(event) && event.type == voiceBargeIn) {
+            mic.printVoiceEvent(event);
+            voice.stop();
+          }
+          if (!voice.stillPlaying()) {
+            timesResponded++;          // increment the times responded
+            if (mic.isTalking()) {     // interrupted - listen to the rest of what the person is saying
+              micState = 1;
+            } else {                   // go back to listening
+              mic.clearVoiceEvents();
+              micState = 0;
+            }
           }
-          timesResponded++;          // increment the times responded and go back to listening
-          micState = 0;
           break;
       }
     }
 
 
+    /*
+          gradePain - grade the force on a sensor for the pain response using the calibrated force in Newtons
+                      and the force rate (see fsrArray.h). A force that is applied quickly is graded as painful
+                      even before it reaches the pain force.
+                int sensor - sensor index (ex. fsrNeck)
+           return int = 0-no pressure, 1 - very light force, 2- light force, 3- med force, 4- painful force
+    */
+    int gradePain(int sensor) {
+      float force = fsrArray.getForce(sensor);
+      float rate = fsrArray.getForceRate(sensor);
+      if (force >= painForce || (force >= lightForce && rate >= painRate)) {
+        return 4;
+      } else if (force >= mediumForce) {
+        return 3;
+      } else if (force >= lightForce) {
+        return 2;
+      } else if (force >= touchForce) {
+        return 1;
+      }
+      return 0;
+    }
+
+
     /*
           followHand - This function obtains camera info and the pixel coordinates, converts these values to servo values for both the
                        left and right eyeballs, and drives servos to these positions. If the LOC is a verbal response, the neck should
@@ -475,7 +652,7 @@ class Head {
     void followHand() {
       eyeLids.openBoth(); // keep eyelids open the entire time - can be replaced with an idle blink or different blink functions based on LOC
       int *pixCoords;
-      pixCoords = camera.getBlockInfo(0); // get the x and y coordinates of the detected block
+      pixCoords = camera.getBlockInfo(0); // get the x and y coordinates of the detected block (from the snapshot read by camera.update())
       //      Serial.print("Pix X = "); Serial.println(pixCoords[0]);
       //      Serial.print("Pix Y = "); Serial.println(pixCoords[1]);
       int xPix = pixCoords[0];
@@ -506,6 +683,13 @@ class Head {
       //      Serial.print("Head Right X = "); Serial.println(horRightEyeCoord);
       //      Serial.print("Head  Right Y = "); Serial.println(vertRightEyeCoord);
 
+      // time the first gaze calculated from each new frame (see latencyMonitor.h)
+      boolean isTimedFrame = latency.isEnabled() && camera.isNewFrame(lastTimedFrameNum);
+      if (isTimedFrame) {
+        lastTimedFrameNum = camera.getFrameNum();
+        latency.markGaze(camera.getSnapshot().timeStampUs);
+      }
+
       //Move eyes or neck to appropriate positions
       if (stateLOC == 0) {
         eyeBalls.moveHorEyesTo(horLeftEyeCoord, horRightEyeCoord);
@@ -514,7 +698,11 @@ class Head {
         eyeBalls.moveHorEyesTo(horLeftEyeCoord + 5, horRightEyeCoord + 5);  // add an arbitrary offset (5) of the eyeball positions since the LOC is lower than alert
         eyeBalls.moveVertEyesTo(vertLeftEyeCoord + 5, vertRightEyeCoord + 5);
         int neckRotCoord = map(xPix, pixMaxLeft, pixMaxRight, neck.rotLeftMax, neck.rotRightMin); // convert pixels to neck rotation position
-        neck.rotToDeg(neckRotCoord, 3); // rotate the neck to follow the hand
+        neck.streamRot(neckRotCoord); // give the planner the newest goal so the neck blends between hand positions
+        neck.followPoses(); // rotate the neck to follow the hand
+      }
+      if (isTimedFrame) {
+        latency.markFlush(); // every servo command for this frame has been sent
       }
     }
 
@@ -578,13 +766,13 @@ class Head {
         case 0:
           if (voice.stillPlaying()) {     //first dialogue: respond with a greeting and a brief description of medical problem
           } else {
-            voice.playFile("HIBUS.WAV");
+            voice.playFile(locDialogue[0][0]);
           }
           break;
         case 1:
           if (voice.stillPlaying()) { //second dialogue: agree to follow the hand
           } else {
-            voice.playFile("YESFOLOW.WAV");
+            voice.playFile(locDialogue[0][1]);
           }
           break;
       }
@@ -633,13 +821,13 @@ class Head {
         case 0:
           if (voice.stillPlaying()) {  //first dialogue: respond with a dazed greeting and a poor description of medical problem
           } else {
-            voice.playFile("AHHH.WAV");
+            voice.playFile(locDialogue[1][0]);
           }
           break;
         case 1:
           if (voice.stillPlaying()) { //second dialogue: agree to follow the hand but delayed
           } else {
-            voice.playFile("YESFOLOW.WAV");
+            voice.playFile(locDialogue[1][1]);
           }
           break;
       }
@@ -690,13 +878,13 @@ class Head {
         case 0:
           if (voice.stillPlaying()) {
           } else {
-            voice.playFile("SDTEST1.WAV");  // default sample .wav file from Teensy website
+            voice.playFile(locDialogue[2][0]);  // default sample .wav file from Teensy website
           }
           break;
         case 1:
           if (voice.stillPlaying()) {
           } else {
-            voice.playFile("AHHH.WAV"); // placeholder pain yell
+            voice.playFile(locDialogue[2][1]); // placeholder pain yell
           }
           break;
       }
@@ -793,7 +981,7 @@ class Head {
     void painActions() {
       if (voice.stillPlaying()) {
       } else {
-        voice.playFile("AHHH.WAV");
+        voice.playFile(painYell);
       }
       eyeBrows.raiseRightFurrowLeft();
       eyeLids.winceLeft();
@@ -814,41 +1002,41 @@ class Head {
     //************************************************************** TESTING FUNCTIONS **********************************************************************
     //****** These functions are used for testing different features and capabilities on their own and slowly integrating it with the rest of the code*******
     /*
-       micTest - Tests the microphone and if the head can respond to an input that is louder than other parts.
-                 State 0: The microphone waits to get input that is out of the normal range (listening),
-                 State 1: waits until the value goes back into the normal range (waits until the person is done speaking),
+       micTest - Tests the voice detector (see voiceDetector.h) and if the head can respond when someone talks.
+                 State 0: waits for the voice detector to hear someone start talking (listening),
+                 State 1: waits until the voice detector hears them stop talking (waits until the person is done speaking),
                  State 2: then performs the arbitrary actions for arbitrary amount of time (responding).
+                 The level, noise floor, zero crossing rate and spectral flux are printed every half second for tuning.
     */
     void micTest() {
-      int anVal; // stores raw analog input value
-      int trimmedVal; // stores the value after the offset is subtracted
+      VoiceEvent event;
+      if (millis() > lastMicPrint + 500) {  // for debugging
+        Serial.print(" Level = "); Serial.print(voiceDetect.getLevel(), 1);
+        Serial.print(" Floor = "); Serial.print(voiceDetect.getNoiseFloor(), 1);
+        Serial.print(" ZCR = "); Serial.print(voiceDetect.getZeroCrossRate(), 3);
+        Serial.print(" Flux = "); Serial.println(voiceDetect.getFlux(), 3);
+        lastMicPrint = millis();
+      }
       switch (micState) {
         case 0:
-          anVal = analogRead(micPin);   // get raw input
-          trimmedVal = anVal - micOffset;   // subtract the excess data
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);  // for debugging
-          if (trimmedVal > micRange || trimmedVal < -micRange) {  // switch states if the mic picked up a value outside of the normal range
+          if (mic.getVoiceEvent(event) && event.type == voiceStart) {  // switch states when someone starts talking
+            mic.printVoiceEvent(event);
             micState = 1;
             timeNow = millis(); // reset timer for next state
           }
           break;
         case 1:
-          anVal = analogRead(micPin);   // continue to read input
-          trimmedVal = anVal - micOffset; // subtract excess data
-          Serial.println("You are talking ");   // for debugging
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);
-          if ((trimmedVal < micRange || trimmedVal > -micRange) && (millis() > timeNow + 3500)) { // when the input goes back to the normal range and at least 3.5 seconds have passed within this range
+          if (mic.getVoiceEvent(event) && event.type == voiceEnd) { // when they stop talking (after the hangover time)
+            mic.printVoiceEvent(event);
             micState = 2;   // switch states
             timeNow = millis(); // reset timere
           }
           break;
         case 2:
           alertActions(); // complete generic reactions
-          anVal = analogRead(micPin); // continue to read input and filter in case other actions need to be taken
-          trimmedVal = anVal - micOffset; // NOTE: future work could include having HAL continue to listen as he responds and stop/change his reaction if the user interrupts him
           Serial.println("responding ");  // for debugging
-          Serial.print(" Analog Value = "); Serial.println(trimmedVal, DEC);
           if (millis() > timeNow + 10000) {   //respond for 10 seconds until returning to listening.
+            mic.clearVoiceEvents();
             micState = 0;
           }
           break;
@@ -857,25 +1045,30 @@ class Head {
 
     /*
        fsrTest - This function tests to see if all 5 force sensors can actuate differnt parts
-                 of the head at the same time.
+                 of the head at the same time. Every event from the force sensor array is printed.
     */
 
     void fsrTest() {
-      if (neckSensor.forceRange(neckSensorPin) == 0) {
+      fsrArray.update();  // scan all of the sensors if it is time
+      FsrEvent event;
+      while (fsrArray.getEvent(event)) {  // print every touch, press, squeeze, release and tap
+        fsrArray.printEvent(event);
+      }
+      if (fsrArray.getRange(fsrNeck) == 0) {
         eyeLids.blinkEyes();
       }
-      if (foreheadSensor.forceRange(foreheadSensorPin) == 4) {
+      if (fsrArray.getRange(fsrForehead) == 4) {
         eyeBalls.glanceLeft();
       }
-      if (chinSensor.forceRange(chinSensorPin) == 4) {
+      if (fsrArray.getRange(fsrChin) == 4) {
         eyeBrows.raiseAndFurrow();
       }
-      if (jawRightSensor.forceRange(jawRightSensorPin) == 4) {
+      if (fsrArray.getRange(fsrJawRight) == 4) {
         jaw.regOpenAndClose();
       }else{
         jaw.neutralMouth();
       }
-      if (jawLeftSensor.forceRange(jawLeftSensorPin) == 4) {
+      if (fsrArray.getRange(fsrJawLeft) == 4) {
          jaw.thrustJawPercent(100);
 
       }else{
@@ -886,6 +1079,23 @@ class Head {
 
 
 
+    /*
+       fsrCalibrationTest - Prints the force of each sensor every half second while the force sensors are calibrated with
+                            known weights (see fsrCalibration.h). Type "cal <sensor> <grams>" in the serial monitor for
+                            every weight (ex. "cal 1 500", see console.h), then "cal <sensor> 0" to fit and save the curve.
+    */
+    void fsrCalibrationTest() {
+      fsrArray.update();
+      if (millis() > timeNow + 500) {
+        for (int s = 0; s < 5; s++) {
+          Serial.print(fsrArray.getForce(s), 2); Serial.print(" N   ");
+        }
+        Serial.println();
+        timeNow = millis();
+      }
+    }
+
+
     /*
       neckTest - General function for testing different neck movements and setpoints.
                  The commented code can be commented/uncommented in order to test different parts.
@@ -959,6 +1169,31 @@ class Head {
     }
 
 
+    /*
+       followHandTest - Follows the hand with the eyes. The camera is read every loop first so followHand() uses a new frame.
+    */
+    void followHandTest() {
+      camera.update();
+      followHand();
+    }
+
+    /*
+       latencyTest - Measures the time from a camera frame arriving to the eye servos moving. The camera is simulated
+                     (a moving target and a distractor, see camera.h) so this can run without the Pixy. Remove the
+                     setSimulation() line to time the real camera. The latency spread is printed every 5 seconds.
+    */
+    void latencyTest() {
+      if (!latency.isEnabled()) {
+        camera.setSimulation(true);
+        latency.reset();
+        latency.setEnabled(true);
+      }
+      camera.update();
+      followHand();
+      latency.printEvery(5000);
+    }
+
+
     /*
        pulseTest - General function used to test the regular and irregular pulse
                    to ensure the BPM calaculation is accurate and the randomizer is indeed random.
@@ -967,6 +1202,24 @@ class Head {
     void pulseTest() {
       pulse.pulseByBPM(60);
       //      pulse.randPulse();
+      //      pulse.pulseByRhythm(rhythmPVC, 70);
+      //      pulse.pulseByRhythm(rhythmAlternans, 90);
+    }
+
+    /*
+       breathingTest - General function to test the breathing patterns with the jaw, neck and breathing sounds.
+                       Prints the timing of every new breath. See breathing.h for details.
+    */
+    void breathingTest() {
+      breathing.setAirway(false, true, false); // stridor
+      //      breathing.setAirway(true, false, false); // irregular
+      //      breathing.setAirway(false, false, true); // agonal gasps
+      //      jaw.setMaxOpen(lockJawOpen); // lock jaw
+      breathing.update(true, true);
+      if (breathing.getNumBreaths() != lastBreathNum) {
+        lastBreathNum = breathing.getNumBreaths();
+        Serial.print(millis()); Serial.print(" ms  Breath "); Serial.println(lastBreathNum);
+      }
     }
 
 
@@ -975,12 +1228,53 @@ class Head {
     */
     void voiceTest() {
       voice.playFile("HELLO.WAV");
+      voice.playFile("HIBUS.WAV");    // queued right behind the first prompt so there is no gap
       Serial.print("Bool   === "); Serial.println(voice.stillPlaying());
+      Serial.print("Start latency (us) = "); Serial.println(voice.getStartLatency());
       while (voice.stillPlaying()) {
         Serial.println("Still Playing file");
-        delay(500);
+        delay(5);
+      }
+      Serial.print("Played = "); Serial.print(voice.getNumPlayed());
+      Serial.print(" Failed = "); Serial.println(voice.getNumFailed());
+      voice.printCacheReport();
+      sound.printMemory();
+    }
+    /*
+       audioBenchmarkTest - Plays every prompt on the SD card one after another while the eyes, lids, neck, breathing,
+                            pulse, camera and force sensors all run, then prints the start latency, underruns, CPU and
+                            audio memory of each prompt. Uncomment the setSimulation() line to add a modeled slow SD card
+                            to the audio interrupt. See audioBenchmark.h for details.
+    */
+    void audioBenchmarkTest() {
+      if (!isBenchmarkStarted) {
+        isBenchmarkStarted = true;
+        stopSdPlayers();    // the benchmark lists the SD card and caches the prompts from the loop
+        benchmark.setUp(voice);
+        //        benchmark.setSimulation(true);
+        if (benchmark.findPrompts() == 0) {   // the SD card could not be listed, use the LOC test prompts
+          benchmark.addPrompt("HIBUS.WAV");
+          benchmark.addPrompt("YESFOLOW.WAV");
+          benchmark.addPrompt("AHHH.WAV");
+          benchmark.addPrompt("SDTEST1.WAV");
+        }
+        benchmark.start();
+      }
+      // the same load as the LOC tests
+      pulse.pulseByRhythm(pulseRhythm, pulseNum);
+      breathing.update(false, true);
+      fsrArray.update();
+      camera.update();
+      followHand();
+      eyeLids.blinkEyes();
+      voice.update();
+      sound.update(voice.isBusy());
+      if (benchmark.update()) {
+        benchmark.printReport();
+        sound.printMemory();
       }
     }
+
     /*
        jawTest - General function to test the capabilities of the jaw movements. See jaw.h for details.
     */
@@ -1017,7 +1311,8 @@ class Head {
     */
     void headLoop() {
       //      pulse.pulseByBPM(pulseNum);
-      headState = neckSensor.forceRange(neckSensorPin);
+      fsrArray.update();
+      headState = fsrArray.getRange(fsrNeck);
       switch (headState) {
         case 0:
           //          alertActions();
@@ -0,0 +1,92 @@
+/**********************************************************************************
+  headBehaviors.h
+
+  This file contains the table of named behaviors of the Head. Each behavior is one
+  movement or expression that can be run by name instead of calling the function in
+  the code. It is used by the console ("do <behavior>", see console.h) and by the
+  scenario files ("do" and "loop", see scenario.h). Most of the movements take several
+  steps, so they are called every loop while the behavior runs. Each call returns true
+  once the movement is done: right away for the ones that only move the servos to a
+  position (ex. look and neutral), after the last step for the ones that end (ex. nodyes),
+  and never for the ones that go on until they are stopped (ex. blink and follow).
+
+  Add a line to the table to make a new movement available to both.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// A behavior that can be run by name
+struct HeadBehavior {
+  const char *name;
+  boolean (*run)(Head &head);   // called every loop while the behavior runs, returns true once it is done
+};
+
+const HeadBehavior headBehaviors[] = {
+  // LOC ACTIONS
+  {"alert", [](Head & head) { head.alertActions(); return false; }},
+  {"verbal", [](Head & head) { head.verbalActions(); return false; }},
+  {"pain", [](Head & head) { head.painActions(); return false; }},
+  {"unresponsive", [](Head & head) { head.unresponsive(); return false; }},
+  {"respond", [](Head & head) { head.stateMechLOCResponses(); return false; }},
+  // GAZE
+  {"follow", [](Head & head) { head.camera.update(); head.followHand(); return false; }},
+  {"lookleft", [](Head & head) { head.eyeBalls.leftBoth(); return true; }},
+  {"lookright", [](Head & head) { head.eyeBalls.rightBoth(); return true; }},
+  {"lookup", [](Head & head) { head.eyeBalls.upBoth(); return true; }},
+  {"lookdown", [](Head & head) { head.eyeBalls.downBoth(); return true; }},
+  {"eyesneutral", [](Head & head) { head.eyeBalls.neutralBoth(); return true; }},
+  {"glance", [](Head & head) { head.eyeBalls.glanceLeft(); return false; }},
+  {"lookaround", [](Head & head) { head.eyeBalls.lookLeftandRight(); return false; }},
+  {"dazed", [](Head & head) { head.eyeBalls.stepEyesUpandDownVerySlow(); return false; }},
+  {"searching", [](Head & head) { head.eyeBalls.stepEyesUpandDownSlow(); return false; }},
+  {"roll", [](Head & head) { head.eyeBalls.rollEyes(); return false; }},
+  // EYELIDS
+  {"blink", [](Head & head) { head.eyeLids.blinkEyes(); return false; }},
+  {"lazyblink", [](Head & head) { head.eyeLids.lazyBlinkEyes(); return false; }},
+  {"sleepy", [](Head & head) { head.eyeLids.stepLidsSleepy(); return false; }},
+  {"winkleft", [](Head & head) { head.eyeLids.winkLeft(); return false; }},
+  {"winkright", [](Head & head) { head.eyeLids.winkRight(); return false; }},
+  {"winceleft", [](Head & head) { head.eyeLids.winceLeft(); return true; }},
+  {"winceright", [](Head & head) { head.eyeLids.winceRight(); return true; }},
+  {"longclose", [](Head & head) { head.eyeLids.longClose(); return false; }},
+  {"closeeyes", [](Head & head) { head.eyeLids.closeBoth(); return true; }},
+  {"openeyes", [](Head & head) { head.eyeLids.openBoth(); return true; }},
+  // EYEBROWS
+  {"raise", [](Head & head) { head.eyeBrows.regRaiseBoth(); return true; }},
+  {"slightraise", [](Head & head) { head.eyeBrows.slightRaiseBoth(); return true; }},
+  {"furrow", [](Head & head) { head.eyeBrows.furrowBoth(); return true; }},
+  {"puzzled", [](Head & head) { head.eyeBrows.raiseLeftFurrowRight(); return true; }},
+  {"hurt", [](Head & head) { head.eyeBrows.raiseRightFurrowLeft(); return true; }},
+  {"worried", [](Head & head) { head.eyeBrows.raiseAndFurrow(); return false; }},
+  {"browsneutral", [](Head & head) { head.eyeBrows.neutralBoth(); return true; }},
+  // JAW
+  {"openjaw", [](Head & head) { head.jaw.openMouth(); return true; }},
+  {"closejaw", [](Head & head) { head.jaw.closeMouth(); return true; }},
+  {"talk", [](Head & head) { head.jaw.regOpenAndClose(); return false; }},
+  {"hello", [](Head & head) { return head.jaw.helloJaw(); }},
+  {"helloslow", [](Head & head) { return head.jaw.helloJawSlow(); }},
+  // NECK
+  {"nod", [](Head & head) { head.neck.nod(); return false; }},
+  {"nodyes", [](Head & head) { return head.neck.nodTimes(3, 250); }},
+  {"tilt", [](Head & head) { head.neck.tilt(); return false; }},
+  {"wince", [](Head & head) { return head.neck.wince(true); }},
+  {"neckneutral", [](Head & head) { return head.neck.neutral(); }},
+  {"breathe", [](Head & head) { head.breathing.update(true, true); return false; }},
+};
+const int numHeadBehaviors = sizeof(headBehaviors) / sizeof(headBehaviors[0]);
+
+/*
+   findHeadBehavior - find a behavior by name (capitals do not matter)
+        const char *name - name of the behavior
+        return int - index in headBehaviors, -1 if there is no behavior with that name
+*/
+int findHeadBehavior(const char *name) {
+  if (name == NULL) {
+    return -1;
+  }
+  for (int i = 0; i < numHeadBehaviors; i++) {
+    if (strcasecmp(name, headBehaviors[i].name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
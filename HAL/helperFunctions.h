@@ -7,6 +7,80 @@
    Last Edited by Ethan Lauer on 4/8/20
  *********************************************************************************/
 
+//*******************************************ANALOG READINGS**************************
+/*
+   readAnalog - read an analog pin on ADC1, since the microphone keeps ADC0 busy (see pinSetUp.h).
+                The pin has to be connected to ADC1 (see checkAnalogPin()).
+        int pin - analog pin
+        return int - reading (0-1023)
+*/
+int readAnalog(int pin) {
+  return adc->adc1->analogRead(pin);
+}
+
+/*
+   checkAnalogPin - check that a pin can be read with readAnalog(). Run this at startup for every pin it reads.
+                    There is no fallback to ADC0 (a read there would stop the microphone), so a pin that is not
+                    connected to ADC1 has to be moved to one that is.
+        int pin - analog pin
+        const char *name - what is connected to the pin (for the error message)
+        return boolean - false if the pin cannot be read on ADC1
+*/
+boolean checkAnalogPin(int pin, const char *name) {
+  if (adc->adc1->checkPin(pin)) {
+    return true;
+  }
+  Serial.print("ERROR: unable to read the "); Serial.print(name);
+  Serial.print(" on ADC1, move it to an ADC1 pin. Pin = "); Serial.println(pin);
+  return false;
+}
+
+//*******************************************I2C BUS ACCOUNTING**************************
+// The servo drivers and the LCD shield share the I2C bus. Every transfer sent to them (a
+// servo position, an LCD character or command, the backlight, or a read of the buttons) is
+// counted here with the time it held up the loop, measured with micros(). The console
+// prints them with "get bus" (see console.h).
+const int busServos = 0;
+const int busLcd = 1;
+const int numBusDevices = 2;
+
+unsigned long busTransfers[numBusDevices] = {0, 0};
+unsigned long busTransfersSaved[numBusDevices] = {0, 0};
+unsigned long busMicros[numBusDevices] = {0, 0};
+
+/*
+   countBusTransfer - add a transfer that was sent over the I2C bus and the time it took
+       int device - busServos or busLcd
+       unsigned long startTime - micros() right before the transfer
+*/
+void countBusTransfer(int device, unsigned long startTime) {
+  busTransfers[device]++;
+  busMicros[device] += micros() - startTime;
+}
+
+/*
+   countBusTransfersSaved - add transfers that did not have to be sent (ex. LCD characters that did not change)
+       int device - busServos or busLcd
+       unsigned long transfers - number of transfers
+*/
+void countBusTransfersSaved(int device, unsigned long transfers) {
+  busTransfersSaved[device] += transfers;
+}
+
+//*******************************************SERVO STATE**************************
+// Last degree sent to each servo by driveServo(), -1 if it has not been moved yet
+const int numServos = 64;
+int servoDegrees[numServos];
+
+/*
+   resetServoDegrees - mark every servo as not moved yet. Run this once in setup().
+*/
+void resetServoDegrees() {
+  for (int i = 0; i < numServos; i++) {
+    servoDegrees[i] = -1;
+  }
+}
+
 /* you can use this function if you'd like to set the pulse length in seconds
   e.g. setServoPulse(0, 0.001) is a ~1 millisecond pulse width. its not precise!
 
@@ -87,6 +161,7 @@ void servoTest(int servo) {
 */
 void driveServo(int servoNum, int deg, int type) {
   int servoNumAdjusted = servoNum % 16;       //why do you need to use modulo?
+  unsigned long busStart = micros();
   switch (servoNum) {
     case 0 ... 15:
       pwm0.setPWM(servoNumAdjusted, 0, deg2Pulse(deg, type));
@@ -101,6 +176,10 @@ void driveServo(int servoNum, int deg, int type) {
       pwm3.setPWM(servoNumAdjusted, 0, deg2Pulse(deg, type));
       break;
   }
+  if (servoNum >= 0 && servoNum < numServos) {
+    servoDegrees[servoNum] = deg;
+  }
+  countBusTransfer(busServos, busStart);
   delay(motorCommandPause);
 }
 
@@ -112,7 +191,7 @@ void driveServo(int servoNum, int deg, int type) {
          Potentiometer is used to manually adjust the servo position
 */
 void manualAdjustServo(int servoid, int servotype) {
-  int potReading = analogRead(potpin);
+  int potReading = readAnalog(potpin);
   int angle;
 
     angle = map(potReading, 0, 1023, 0, 180);
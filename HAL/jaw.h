@@ -47,6 +47,8 @@ class Jaw {
     int hingeCycleCount = 0;
     int thrustCycleCount = 0;
 
+    float maxOpenPercent = 100; // the jaw never opens past this, for every movement (ex. lock jaw, see setMaxOpen())
+
 
   public:
     //**************************************************************INITIALIZE AND SETUP*********************************************************
@@ -64,6 +66,15 @@ class Jaw {
       Serial.println("Initializing Jaw");
     }
 
+    /*
+       setMaxOpen - limit how far the jaw can open. Every movement below is held to it (the vertical servos are
+                    limited in moveLeftVert() and moveRightVert()).
+            float percent - most the jaw can open (ex. 5 for lock jaw, 100 for no limit)
+    */
+    void setMaxOpen(float percent) {
+      maxOpenPercent = constrain(percent, 0, 100);
+    }
+
     //*************************************************************************FUNCTIONS*********************************************************
 
     //***************************************************Basics**************************************
@@ -73,7 +84,9 @@ class Jaw {
               int deg - degree you want to move to
     */
     void moveLeftVert(int deg) {
-      driveServo(jawLVertPin, deg, servoType);
+      //when left jaw servo opens, servo pos is decreasing (the num)
+      int maxOpen = jawLVertClose - (int) ((jawLVertClose - jawLVertOpen) * (maxOpenPercent / 100));
+      driveServo(jawLVertPin, max(deg, maxOpen), servoType);
     }
 
     /*
@@ -81,7 +94,9 @@ class Jaw {
            int deg - degree you want to move to
     */
     void moveRightVert(int deg) {
-      driveServo(jawRVertPin, deg, servoType);
+      //when right jaw servo opens, servo pos is increasing (the num)
+      int maxOpen = jawRVertClose + (int) ((jawRVertOpen - jawRVertClose) * (maxOpenPercent / 100));
+      driveServo(jawRVertPin, min(deg, maxOpen), servoType);
     }
 
 
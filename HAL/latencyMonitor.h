@@ -0,0 +1,179 @@
+/**********************************************************************************
+    latencyMonitor.h
+
+    This file contains the class definition, attributes, and methods of the LatencyMonitor.
+    It measures how long it takes from a camera frame arriving to HAL's eyes moving.
+    Each camera frame that is used is timed at three points:
+        frame - the frame was read from the Pixy (see Camera::update())
+        gaze  - followHand() finished calculating the eye positions from the frame
+        flush - the last servo command for that frame was sent to the PCA9685 drivers
+    The time of each stage (frame to gaze, gaze to flush, and the total) is added to a
+    histogram with 1 ms bins so the spread of the latency can be printed, not just the
+    average. The monitor is off unless it is turned on (see Head::latencyTest()).
+ *********************************************************************************/
+#include <Arduino.h>
+
+class LatencyMonitor {
+  private:
+    static const int numStages = 3;
+    static const int numBins = 64;              // 1 ms bins, the last bin holds everything longer
+    const unsigned long binWidthUs = 1000;
+
+    // HISTOGRAM OF ONE STAGE
+    struct StageStats {
+      unsigned long count;
+      unsigned long minUs;
+      unsigned long maxUs;
+      unsigned long long sumUs;
+      uint16_t bins[numBins];
+    };
+    StageStats stages[numStages];
+
+    boolean isOn = false;
+    unsigned long frameTimeUs = 0;  // time the frame being timed arrived
+    unsigned long gazeTimeUs = 0;   // time the gaze was calculated
+    boolean isGazeMarked = false;
+    unsigned long lastPrintTime = 0;
+
+    /*
+       addSample - add one time to the histogram of a stage
+    */
+    void addSample(int stage, unsigned long timeUs) {
+      StageStats &stats = stages[stage];
+      int bin = min(timeUs / binWidthUs, (unsigned long)(numBins - 1));
+      if (stats.bins[bin] < 65535) {
+        stats.bins[bin]++;
+      }
+      stats.count++;
+      stats.sumUs += timeUs;
+      stats.minUs = min(stats.minUs, timeUs);
+      stats.maxUs = max(stats.maxUs, timeUs);
+    }
+
+    /*
+       percentile - find the time (ms) that a percent of the samples are shorter than, using the histogram
+            int stage - stage to check
+            int percent - percent of samples (ex. 95)
+            return int - upper edge of the bin in ms
+    */
+    int percentile(int stage, int percent) {
+      StageStats &stats = stages[stage];
+      unsigned long goal = (stats.count * percent + 99) / 100;
+      unsigned long total = 0;
+      for (int bin = 0; bin < numBins; bin++) {
+        total += stats.bins[bin];
+        if (total >= goal) {
+          return bin + 1;
+        }
+      }
+      return numBins;
+    }
+
+    /*
+       printStage - print the spread of one stage
+    */
+    void printStage(const char *name, int stage) {
+      StageStats &stats = stages[stage];
+      Serial.print(name);
+      if (stats.count == 0) {
+        Serial.println(" no samples");
+        return;
+      }
+      Serial.print(" n = "); Serial.print(stats.count);
+      Serial.print("  min = "); Serial.print(stats.minUs / 1000.0, 2);
+      Serial.print("  mean = "); Serial.print((float)(stats.sumUs / stats.count) / 1000.0, 2);
+      Serial.print("  p50 <= "); Serial.print(percentile(stage, 50));
+      Serial.print("  p95 <= "); Serial.print(percentile(stage, 95));
+      Serial.print("  p99 <= "); Serial.print(percentile(stage, 99));
+      Serial.print("  max = "); Serial.print(stats.maxUs / 1000.0, 2);
+      Serial.println(" (ms)");
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the latency monitor
+    LatencyMonitor() {
+      reset();
+    }
+
+    /*
+       reset - clear all of the histograms
+    */
+    void reset() {
+      for (int s = 0; s < numStages; s++) {
+        stages[s].count = 0;
+        stages[s].minUs = 0xFFFFFFFF;
+        stages[s].maxUs = 0;
+        stages[s].sumUs = 0;
+        for (int bin = 0; bin < numBins; bin++) {
+          stages[s].bins[bin] = 0;
+        }
+      }
+      isGazeMarked = false;
+    }
+
+    /*
+       setEnabled - turn the latency measurements on or off
+    */
+    void setEnabled(boolean enabled) {
+      isOn = enabled;
+      isGazeMarked = false;
+    }
+
+    /*
+       isEnabled - check if the latency is being measured
+    */
+    boolean isEnabled() {
+      return isOn;
+    }
+
+    //************************************************TIME STAMPS********************************
+    /*
+       markGaze - the eye positions were calculated from a frame
+            unsigned long frameArrivalUs - time the frame was read from the camera (CameraSnapshot.timeStampUs)
+    */
+    void markGaze(unsigned long frameArrivalUs) {
+      if (!isOn) {
+        return;
+      }
+      frameTimeUs = frameArrivalUs;
+      gazeTimeUs = micros();
+      isGazeMarked = true;
+    }
+
+    /*
+       markFlush - the servo commands for the frame were sent. Adds the times of every stage.
+    */
+    void markFlush() {
+      if (!isOn || !isGazeMarked) {
+        return;
+      }
+      unsigned long flushTimeUs = micros();
+      addSample(0, gazeTimeUs - frameTimeUs);
+      addSample(1, flushTimeUs - gazeTimeUs);
+      addSample(2, flushTimeUs - frameTimeUs);
+      isGazeMarked = false;
+    }
+
+    //************************************************REPORT********************************
+    /*
+       printReport - print the latency spread of every stage
+    */
+    void printReport() {
+      Serial.println("Camera to servo latency");
+      printStage("  Frame to gaze:", 0);
+      printStage("  Gaze to flush:", 1);
+      printStage("  Frame to flush:", 2);
+    }
+
+    /*
+       printEvery - print the report every so often. Call this every loop.
+            unsigned long period - time between reports (ms)
+    */
+    void printEvery(unsigned long period) {
+      if (isOn && millis() - lastPrintTime >= period) {
+        printReport();
+        lastPrintTime = millis();
+      }
+    }
+};
@@ -0,0 +1,208 @@
+/**********************************************************************************
+  lcdBuffer.h
+
+  This file contains the class definition, attributes, and methods of the LcdBuffer.
+  The LCD shield is driven through a port expander (MCP23017) on the same I2C bus as the
+  servo drivers, and every character, cursor move and clear takes several slow bus
+  transfers. The LcdBuffer keeps a copy of the 16x2 screen in memory. The screens are
+  drawn into it (clear(), setCursor(), print(), setBacklight() work like the shield's),
+  then update() compares it with what is on the LCD and only sends the characters,
+  cursor and backlight that changed. It sends at most 20 times a second, so screens
+  that are redrawn quickly only go over the bus once.
+
+  The transfers sent, the time they took, and the transfers saved compared to sending
+  every call are added to the bus accounting (see helperFunctions.h).
+ *********************************************************************************/
+#include <Arduino.h>
+
+class LcdBuffer {
+  private:
+    Adafruit_RGBLCDShield lcd = Adafruit_RGBLCDShield();
+
+    static const int numColumns = 16;
+    static const int numRows = 2;
+
+    // SCREEN IN MEMORY
+    char frame[numRows][numColumns];
+    int cursorColumn = 0;
+    int cursorRow = 0;
+    uint8_t backlight = WHITE;
+    boolean isBlink = false;
+
+    // WHAT IS ON THE LCD
+    char shown[numRows][numColumns];
+    int shownColumn = 0;
+    int shownRow = 0;
+    uint8_t shownBacklight = WHITE;
+    boolean shownBlink = false;
+
+    // SENDING
+    const unsigned long framePeriod = 50;   // ms between updates of the LCD
+    unsigned long nextFrameTime = 0;
+    unsigned long callTransfers = 0;        // transfers sending every call straight to the LCD would have taken since the last update
+
+    /*
+       sendCursor - move the LCD cursor
+    */
+    void sendCursor(int column, int row) {
+      unsigned long busStart = micros();
+      lcd.setCursor(column, row);
+      countBusTransfer(busLcd, busStart);
+      shownColumn = column;
+      shownRow = row;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the LCD buffer
+    LcdBuffer() {
+    }
+
+    /*
+       begin - start the LCD and clear it
+    */
+    void begin(uint8_t columns, uint8_t rows) {
+      lcd.begin(columns, rows);
+      lcd.setBacklight(WHITE);
+      memset(frame, ' ', sizeof(frame));
+      memset(shown, ' ', sizeof(shown));
+      cursorColumn = cursorRow = 0;
+      shownColumn = shownRow = 0;
+      backlight = shownBacklight = WHITE;
+      isBlink = shownBlink = false;
+      nextFrameTime = millis();
+    }
+
+    //************************************************DRAWING********************************
+    /*
+       clear - clear the screen in memory and put the cursor at the start
+    */
+    void clear() {
+      memset(frame, ' ', sizeof(frame));
+      cursorColumn = 0;
+      cursorRow = 0;
+      callTransfers++;
+    }
+
+    /*
+       home - put the cursor at the start
+    */
+    void home() {
+      setCursor(0, 0);
+    }
+
+    /*
+       setCursor - move the cursor (the next print starts here, and it is where the cursor blinks)
+    */
+    void setCursor(uint8_t column, uint8_t row) {
+      cursorColumn = min((int)column, numColumns);
+      cursorRow = min((int)row, numRows - 1);   // the shield does the same with rows that do not exist
+      callTransfers++;
+    }
+
+    /*
+       print - write text at the cursor. Anything past the end of the row is dropped.
+    */
+    void print(const char *text) {
+      for (const char *c = text; *c != '\0'; c++) {
+        if (cursorColumn < numColumns) {
+          frame[cursorRow][cursorColumn] = *c;
+        }
+        cursorColumn++;
+        callTransfers++;
+      }
+    }
+
+    /*
+       print - write a number at the cursor
+    */
+    void print(int number) {
+      char text[12];
+      sprintf(text, "%d", number);
+      print(text);
+    }
+
+    /*
+       setBacklight - color of the backlight (ex. WHITE, see pinSetUp.h)
+    */
+    void setBacklight(uint8_t color) {
+      backlight = color;
+      callTransfers++;
+    }
+
+    void blink() {
+      isBlink = true;
+      callTransfers++;
+    }
+
+    void noBlink() {
+      isBlink = false;
+      callTransfers++;
+    }
+
+    /*
+       readButtons - read the buttons on the shield (not buffered)
+    */
+    uint8_t readButtons() {
+      unsigned long busStart = micros();
+      uint8_t buttons = lcd.readButtons();
+      countBusTransfer(busLcd, busStart);
+      return buttons;
+    }
+
+    //************************************************SENDING********************************
+    /*
+       update - send what changed to the LCD if it is time. Call this every loop (it does not wait).
+            boolean isNow - true to send it right away (ex. before a delay)
+    */
+    void update(boolean isNow = false) {
+      unsigned long timeNow = millis();
+      if (!isNow && (long)(timeNow - nextFrameTime) < 0) {
+        return;
+      }
+      nextFrameTime = timeNow + framePeriod;
+      unsigned long sentBefore = busTransfers[busLcd];
+
+      // only the characters that changed, one cursor move for each run of them
+      for (int row = 0; row < numRows; row++) {
+        for (int column = 0; column < numColumns; column++) {
+          if (frame[row][column] == shown[row][column]) {
+            continue;
+          }
+          if (shownRow != row || shownColumn != column) {
+            sendCursor(column, row);
+          }
+          unsigned long busStart = micros();
+          lcd.write(frame[row][column]);
+          countBusTransfer(busLcd, busStart);
+          shown[row][column] = frame[row][column];
+          shownColumn++;   // the LCD moves its cursor after each character
+        }
+      }
+      if (isBlink && (shownRow != cursorRow || shownColumn != cursorColumn)) {   // the cursor is only seen when it blinks
+        sendCursor(cursorColumn, cursorRow);
+      }
+      if (isBlink != shownBlink) {
+        unsigned long busStart = micros();
+        if (isBlink) {
+          lcd.blink();
+        } else {
+          lcd.noBlink();
+        }
+        countBusTransfer(busLcd, busStart);
+        shownBlink = isBlink;
+      }
+      if (backlight != shownBacklight) {
+        unsigned long busStart = micros();
+        lcd.setBacklight(backlight);
+        countBusTransfer(busLcd, busStart);
+        shownBacklight = backlight;
+      }
+
+      unsigned long sent = busTransfers[busLcd] - sentBefore;
+      if (callTransfers > sent) {
+        countBusTransfersSaved(busLcd, callTransfers - sent);
+      }
+      callTransfers = 0;
+    }
+};
@@ -36,5 +36,42 @@ class Microphone {
       return sensorReading;
     }
 
+    /*
+       getVoiceEvent - get the next start or end of talking from the voice detector (see voiceDetector.h)
+            VoiceEvent &event - resulting event
+            return boolean - false if there are no events
+    */
+    boolean getVoiceEvent(VoiceEvent &event) {
+      return voiceDetect.getEvent(event);
+    }
+
+    /*
+       clearVoiceEvents - forget any starts or ends of talking that have not been used (ex. HAL hearing himself talk)
+    */
+    void clearVoiceEvents() {
+      voiceDetect.clearEvents();
+    }
+
+    /*
+       isTalking - check if someone is talking right now
+    */
+    boolean isTalking() {
+      return voiceDetect.talking();
+    }
+
+    /*
+       printVoiceEvent - print a start or end of talking (for debugging)
+    */
+    void printVoiceEvent(const VoiceEvent &event) {
+      if (event.type == voiceStart) {
+        Serial.print("Started talking at "); Serial.print(event.timeStamp); Serial.println(" ms");
+      } else if (event.type == voiceBargeIn) {
+        Serial.print("Talked over HAL at "); Serial.print(event.timeStamp); Serial.println(" ms");
+      } else {
+        Serial.print("Stopped talking at "); Serial.print(event.timeStamp);
+        Serial.print(" ms after "); Serial.print(event.duration); Serial.println(" ms");
+      }
+    }
+
 
 };
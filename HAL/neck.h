@@ -8,6 +8,8 @@
 
  *********************************************************************************/
 #include<Arduino.h>
+#include "neckPlanner.h" // include the coordinated motion planner
+#include "neckGuard.h" // include the limit guard for every neck command
 
 class Neck {
 
@@ -38,6 +40,17 @@ class Neck {
     const int tol = 2; // tolerance for feedback and movements
     int nodCount = 0; // keeps track of the number of times nodded
     int tiltCount = 0; // keeps track of the number of times tilted
+    unsigned long pauseEndTime = 0; // time the pause between nods or tilts is over (ms)
+    boolean isPausing = false;
+
+    // PLANNED MOVEMENT VARIABLES (see neckPlanner.h)
+    NeckPlanner planner = NeckPlanner();
+    int lastCmdR = -1;   // last command sent to each servo by the planner so unchanged servos are not re-sent
+    int lastCmdL = -1;
+    int lastCmdRot = -1;
+
+    // LIMIT GUARD (see neckGuard.h)
+    NeckGuard guard = NeckGuard();
 
 
     // TIMING VARIABLES
@@ -57,6 +70,9 @@ class Neck {
     const int tiltLeftMax = 160;// servo position for tilting to the left
     const int neutralPos = 100; // neutral position for left and right servos.
 
+    const int sideServoMin = 50;  // range of the left and right servos when nodding and tilting together
+    const int sideServoMax = 160;
+
     // Calibration values
     const int minDeg = 0;
     const int midDeg = 135;
@@ -85,8 +101,16 @@ class Neck {
       pinMode(neckPotPinR, INPUT);
       pinMode(neckPotPinL, INPUT);
       pinMode(neckPotPinRot, INPUT);
+      checkAnalogPin(neckPotPinR, "right neck pot");
+      checkAnalogPin(neckPotPinL, "left neck pot");
+      checkAnalogPin(neckPotPinRot, "rotation neck pot");
+
+      // limits for every command sent to the neck servos
+      guard.setLimits(rotRightMin, rotLeftMax, nodBackMax, nodFwdMax, tiltRightMax, tiltLeftMax,
+                      sideServoMin, sideServoMax, neutralPos, maxDeg - 60);
 
       neutral();
+      syncPlanner();
       Serial.println("Initializing Neck");
     }
 
@@ -124,7 +148,7 @@ class Neck {
                integer Deg - the goal degree you want to move to.
     */
     void moveRightServo(int deg) {
-      driveServo(rightServoPin, deg, datan);
+      driveServo(rightServoPin, guard.limitSide(deg), datan);
     }
 
     /*
@@ -132,7 +156,7 @@ class Neck {
                integer Deg - the goal degree you want to move to.
     */
     void moveLeftServo(int deg) {
-      driveServo(leftServoPin, deg, datan);
+      driveServo(leftServoPin, guard.limitSide(deg), datan);
     }
 
     /*
@@ -140,7 +164,7 @@ class Neck {
               integer Deg - the goal degree you want the head to turn to.
     */
     void moveRotServo(int deg) {
-      driveServo(rotServoPin, deg, datan);
+      driveServo(rotServoPin, guard.limitRot(deg), datan);
     }
 
 
@@ -159,7 +183,7 @@ class Neck {
       int currPosRot;
       int errRot;
       if (initRunRot) {
-        currPosRot = (int)feedbackToDeg(analogRead(neckPotPinRot));
+        currPosRot = (int)feedbackToDeg(readAnalog(neckPotPinRot));
         Serial.print("Rotational Reading = ");  Serial.println(currPosRot);
         cmdServoRot = currPosRot;
         initRunRot = false;
@@ -213,8 +237,8 @@ class Neck {
       int errL;
       // if it is the initial run , find out where the servos are currently and set that to the current cmd
       if (initRunSide) {
-        currPosR = (int)feedbackToDeg(analogRead(neckPotPinR));
-        currPosL = (int)feedbackToDeg(analogRead(neckPotPinL));
+        currPosR = (int)feedbackToDeg(readAnalog(neckPotPinR));
+        currPosL = (int)feedbackToDeg(readAnalog(neckPotPinL));
         Serial.print("Right Reading = ");  Serial.println(currPosR);
         Serial.print("LEft Reading = ");  Serial.println(currPosL);
         cmdServoR = currPosR;
@@ -312,6 +336,131 @@ class Neck {
 
 
 
+    //******************************************************************************Planned***************************************
+    // These functions use the NeckPlanner (see neckPlanner.h) so the rotation, nod and tilt
+    // all arrive at the goal at the same time and consecutive goals blend without stopping.
+
+    /*
+       syncPlanner - read the feedback from the servos and start the planner from the current neck pose.
+                     Call this after using the older moving functions so the planner does not jump.
+    */
+    void syncPlanner() {
+      NeckPose startPose;
+      int currPosR = (int)feedbackToDeg(readAnalog(neckPotPinR));
+      int currPosL = (int)feedbackToDeg(readAnalog(neckPotPinL));
+      startPose.rot = feedbackToDeg(readAnalog(neckPotPinRot));
+      // undo the conversion in drivePose() - the nod is the average of the right servo and the converted left servo
+      startPose.nod = (currPosR + (maxDeg - 60 - currPosL)) / 2.0;
+      startPose.tilt = neutralPos + (currPosR - startPose.nod);
+      planner.setUp(startPose);
+      guard.reset();
+      lastCmdR = -1;
+      lastCmdL = -1;
+      lastCmdRot = -1;
+    }
+
+    /*
+       drivePose - convert a neck pose into servo commands and drive the servos that changed.
+                   The pose is first passed through the guard so it is reachable and not too fast.
+                   The tilt is added as an offset from the nod position so the neutral pose
+                   matches the neutral() setpoint.
+            NeckPose pose - pose to move to in servo degrees
+    */
+    void drivePose(NeckPose pose) {
+      pose = guard.limitPose(pose);
+      int tiltOffset = (int)(pose.tilt - neutralPos);
+      int cmdR = (int)pose.nod + tiltOffset;
+      int cmdL = rDegToLDeg((int)pose.nod) + tiltOffset;
+      int cmdRot = (int)pose.rot;
+      // the pose was already checked and counted by the guard, so only clamp the rounded commands
+      if (cmdR != lastCmdR) {
+        driveServo(rightServoPin, guard.clampSide(cmdR), datan);
+        lastCmdR = cmdR;
+      }
+      if (cmdL != lastCmdL) {
+        driveServo(leftServoPin, guard.clampSide(cmdL), datan);
+        lastCmdL = cmdL;
+      }
+      if (cmdRot != lastCmdRot) {
+        driveServo(rotServoPin, guard.clampRot(cmdRot), datan);
+        lastCmdRot = cmdRot;
+      }
+    }
+
+    /*
+       queuePose - add a goal pose to the end of the planner queue (ex. the points of a scripted nod)
+            float rot - goal rotational servo position
+            float nod - goal nod position (right servo)
+            float tilt - goal tilt position (right servo)
+            return boolean - true if the pose was added, false if the queue is full
+    */
+    boolean queuePose(float rot, float nod, float tilt) {
+      NeckPose pose = {rot, nod, tilt};
+      return planner.addPose(pose);
+    }
+
+    /*
+       streamPose - replace the newest goal pose with a new one (ex. a target that changes every loop)
+            float rot - goal rotational servo position
+            float nod - goal nod position (right servo)
+            float tilt - goal tilt position (right servo)
+    */
+    void streamPose(float rot, float nod, float tilt) {
+      NeckPose pose = {rot, nod, tilt};
+      planner.streamPose(pose);
+    }
+
+    /*
+       streamRot - stream a rotation goal while keeping the nod and tilt at neutral
+            float rot - goal rotational servo position
+    */
+    void streamRot(float rot) {
+      streamPose(rot, neutralPos, neutralPos);
+    }
+
+    /*
+       streamNod - stream a nod goal from the neutral pose while keeping the rotation centered (ex. lifting the head to breathe)
+            float nodOffset - degrees from the neutral nod position (negative nods back)
+    */
+    void streamNod(float nodOffset) {
+      streamPose(rotCenterPos, neutralPos + nodOffset, neutralPos);
+    }
+
+    /*
+       followPoses - move the servos to the planned pose. Run this every loop.
+            return boolean - true if the neck has reached the final goal pose
+    */
+    boolean followPoses() {
+      drivePose(planner.update());
+      return planner.isDone();
+    }
+
+    /*
+       rotAndTiltTo - rotate and tilt (or nod) the head to a set point where both finish at the same time.
+                      This is the non-blocking version of rotAndTilt().
+            int goalRotDeg - goal degree position for the rotational servo
+            int goalSidePos - goal position of the right servo (left servo is calculated)
+            boolean moveTogether - true if the left and right servos should move together(nod), false if they are opposite (tilt)
+            return boolean - true if the neck has reached the goal
+    */
+    boolean rotAndTiltTo(int goalRotDeg, int goalSidePos, boolean moveTogether) {
+      if (moveTogether) {
+        streamPose(goalRotDeg, goalSidePos, neutralPos);
+      } else {
+        streamPose(goalRotDeg, neutralPos, goalSidePos);
+      }
+      return followPoses();
+    }
+
+
+    /*
+       printGuardTelemetry - print how many neck commands were clamped or slowed down by the guard
+    */
+    void printGuardTelemetry() {
+      guard.printTelemetry();
+    }
+
+
     //******************************************************************************Complex***************************************
 
     /*
@@ -364,22 +513,23 @@ class Neck {
        moving to the maximum locations
           int numNods - the number of times the neck should be nodding
           int timeBtwnNod - how long between the fwd and back
-          return boolean - true if finished nodding
+          return boolean - true if finished nodding (it does not wait, call it every loop until then)
     */
     boolean nodTimes(int numNods, int timeBtwnNod) {
       boolean result = false;
+      if (isPaused()) {
+        return false;
+      }
       if (nodCount < numNods) {
         boolean oneCycle = moveBtwnPts(nodFwdMax, nodBackMax, true);
         if (oneCycle) {
           nodCount++;
-          delay(timeBtwnNod);
+          startPause(timeBtwnNod);
         }
       } else {
         nodCount = 0;
         Serial.print("FINISHED NODDING ");  Serial.print(numNods);  Serial.println(" Times");
         result = true;
-        delay(2000); /// remove eventually
-
       }
       return result;
     }
@@ -390,26 +540,48 @@ class Neck {
                   moving to the maximum locations
               int numTilts - the number of times the neck should be tilting
               int timeBtwnTilt - how long between the left and right
-              return boolean - true if finished nodding
+              return boolean - true if finished tilting (it does not wait, call it every loop until then)
     */
     boolean tiltTimes(int numTilts, int timeBtwnTilt) {
       boolean result = false;
+      if (isPaused()) {
+        return false;
+      }
       if (tiltCount < numTilts) {
         boolean oneCycle = moveBtwnPts(tiltRightMax, tiltLeftMax, false);
         if (oneCycle) {
           tiltCount++;
-          delay(timeBtwnTilt);
+          startPause(timeBtwnTilt);
         }
       } else {
         tiltCount = 0;
         Serial.print("FINISHED TILTING ");  Serial.print(numTilts);  Serial.println(" Times");
         result = true;
-        delay(2000); /// remove eventually
       }
       return result;
 
     }
 
+    /*
+       startPause - hold the neck still between nods or tilts (see isPaused())
+          unsigned long pauseTime - how long to hold still (ms)
+    */
+    void startPause(unsigned long pauseTime) {
+      pauseEndTime = millis() + pauseTime;
+      isPausing = true;
+    }
+
+    /*
+       isPaused - true until the pause between nods or tilts is over
+    */
+    boolean isPaused() {
+      if (isPausing && (long)(millis() - pauseEndTime) < 0) {
+        return true;
+      }
+      isPausing = false;
+      return false;
+    }
+
 
     /*
           neckTest - have neck nod back, forward, tilt right, left
@@ -506,6 +678,8 @@ class Neck {
             int startSidePos - starting servo position for the right servo left servo is calculated afterwards)
             int goalSidePos - end servo position for the right servo left servo is calculated afterwards)
             boolean moveTogether - true if the left and right servos shoudl move together(nod), false if they are opposite (tilt)
+            NOTE: each axis steps one degree at a time so the rotation and tilt finish at different times.
+                  Use rotAndTiltTo() for a move where both arrive together.
     */
     void rotAndTilt(int startRotPos, int goalRotDeg, int startSidePos, int goalSidePos, boolean moveTogether) {
       int currPosRot = startRotPos;
@@ -747,13 +921,13 @@ class Neck {
     */
     void stepToMax() {
       for (int currPos = minDeg; currPos < maxDeg; currPos += 2) {
-        moveRightServo(currPos);
-        moveLeftServo(currPos);  // drive the servo
+        driveServo(rightServoPin, currPos, datan); // calibration uses the full servo range, so it skips the guard
+        driveServo(leftServoPin, currPos, datan);  // drive the servo
 //        moveRotServo(currPos);
 
         Serial.print("Rotating to "); Serial.println(currPos);
         delay(neckMotorCmdPause);
-        uint16_t val = analogRead(neckPotPinR);
+        uint16_t val = readAnalog(neckPotPinR);
         Serial.print("Pos = ");  Serial.print(val); Serial.println("Deg");
       }
 
@@ -764,13 +938,13 @@ class Neck {
     */
     void stepToMin() {
       for (int currPos = maxDeg; currPos >= minDeg; currPos -= 2) {
-        moveRightServo(currPos);              // tell servo to go to position in variable 'pos'
-        moveLeftServo(currPos);  // drive the servo
+        driveServo(rightServoPin, currPos, datan);  // tell servo to go to position in variable 'pos' (skips the guard)
+        driveServo(leftServoPin, currPos, datan);  // drive the servo
 //        moveRotServo(currPos);
 
         Serial.print("Rotating to "); Serial.println(currPos);
         delay(neckMotorCmdPause);
-        uint16_t val = analogRead(neckPotPinR);
+        uint16_t val = readAnalog(neckPotPinR);
         Serial.print("Pos = "); Serial.print(val); Serial.println("Deg");
       }
     }
@@ -789,7 +963,7 @@ class Neck {
         // Move to the minimum position and record the feedback value
         stepToMin();
         delay(2000); // make sure it has time to get there and settle
-        minFeedback = analogRead(analogPin);
+        minFeedback = readAnalog(analogPin);
         Serial.println("Cal Min");
         Serial.print("Min Reading = "); Serial.println(minFeedback);
         delay(1000);
@@ -797,7 +971,7 @@ class Neck {
         // Move to the maximum position and record the feedback value
         stepToMax();
         delay(2000); // make sure it has time to get there and settle
-        maxFeedback = analogRead(analogPin);
+        maxFeedback = readAnalog(analogPin);
         Serial.println("Cal Max");
         Serial.print("Max Reading = "); Serial.println(maxFeedback);
         delay(1000);
@@ -0,0 +1,263 @@
+/**********************************************************************************
+  neckGuard.h
+
+  This file contains the class definition, attributes, and methods of the NeckGuard.
+  The guard checks every neck command before it is sent to the servos so a pose
+  stream (ex. following a hand) or a scripted move can never drive the 3 servo linkage
+  past its limits. It does three things every control tick:
+      1. Projects a goal that is out of range onto the nearest reachable pose. Each axis
+         is limited to its own range and the right and left servo positions (which
+         depend on both the nod and the tilt) are limited to the side servo range.
+      2. Limits the speed of the neck. The whole move is scaled down together so the
+         neck still moves in a straight line towards the goal. Close to the servo limits
+         the linkage is near its end of travel, so the speed is lowered the closer the
+         neck gets to a limit.
+      3. Counts the number of commands that were clamped or slowed down (telemetry).
+
+  All poses are in servo degrees (see neckPlanner.h). The limits are set by the Neck
+  class (see neck.h).
+ *********************************************************************************/
+#include<Arduino.h>
+
+class NeckGuard {
+  private:
+    // LIMITS (servo degrees)
+    float rotMin = 0;
+    float rotMax = 180;
+    float nodMin = 0;
+    float nodMax = 180;
+    float tiltMin = 0;
+    float tiltMax = 180;
+    float sideMin = 0;      // range of the right and left servos
+    float sideMax = 180;
+    float neutral = 90;     // neutral position of the left and right servos
+    float leftOffset = 210; // left servo = leftOffset - nod when nodding (see rDegToLDeg() in neck.h)
+
+    // SPEED LIMITS
+    float maxSpeed = 150;         // fastest any axis can move (degrees per second)
+    const float slowMargin = 10;  // start slowing down within this many degrees of a limit
+    const float minSpeedScale = 0.25; // fraction of the max speed used right at a limit
+
+    // LAST POSE SENT
+    NeckPose lastPose;
+    unsigned long lastTime = 0;
+    boolean hasLastPose = false;
+
+    // TELEMETRY
+    unsigned long numCommands = 0;     // poses and single servo commands checked
+    unsigned long numClamped = 0;      // commands that were out of range
+    unsigned long numRateLimited = 0;  // commands that were slowed down
+
+    /*
+       rightServo - right servo position for a pose (same as drivePose() in neck.h)
+    */
+    float rightServo(NeckPose pose) {
+      return pose.nod + (pose.tilt - neutral);
+    }
+
+    /*
+       leftServo - left servo position for a pose (same as drivePose() in neck.h)
+    */
+    float leftServo(NeckPose pose) {
+      return leftOffset - pose.nod + (pose.tilt - neutral);
+    }
+
+    /*
+       clampServo - clamp a single servo command to a range
+    */
+    int clampServo(int deg, float low, float high) {
+      return constrain(deg, (int)ceil(low), (int)floor(high));
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the guard
+    NeckGuard() {
+    }
+
+    /*
+       setLimits - set the range of each axis and of the side servos
+            float rotLow, rotHigh - rotational servo range
+            float nodLow, nodHigh - nod range (right servo)
+            float tiltLow, tiltHigh - tilt range (right servo)
+            float sideLow, sideHigh - range of the right and left servos when nodding and tilting at the same time
+            float neutralPos - neutral position of the side servos
+            float leftServoOffset - left servo = leftServoOffset - nod
+    */
+    void setLimits(float rotLow, float rotHigh, float nodLow, float nodHigh, float tiltLow, float tiltHigh,
+                   float sideLow, float sideHigh, float neutralPos, float leftServoOffset) {
+      rotMin = rotLow;
+      rotMax = rotHigh;
+      nodMin = nodLow;
+      nodMax = nodHigh;
+      tiltMin = tiltLow;
+      tiltMax = tiltHigh;
+      sideMin = sideLow;
+      sideMax = sideHigh;
+      neutral = neutralPos;
+      leftOffset = leftServoOffset;
+    }
+
+    /*
+       setMaxSpeed - set the fastest speed of any axis in degrees per second
+    */
+    void setMaxSpeed(float speed) {
+      maxSpeed = speed;
+    }
+
+    /*
+       reset - forget the last pose so the next command is not rate limited (ex. after syncing with the feedback)
+    */
+    void reset() {
+      hasLastPose = false;
+    }
+
+    //************************************************LIMITING********************************
+    /*
+       projectPose - move a pose onto the nearest reachable pose. Each axis is clamped to its range and then
+                     the nod and tilt are moved together (perpendicular to the limit) until both side
+                     servos are in range. A few passes are enough because the limits are straight lines.
+            NeckPose pose - goal pose
+            return NeckPose - reachable pose
+    */
+    NeckPose projectPose(NeckPose pose) {
+      pose.rot = constrain(pose.rot, rotMin, rotMax);
+      for (int pass = 0; pass < 3; pass++) {
+        pose.nod = constrain(pose.nod, nodMin, nodMax);
+        pose.tilt = constrain(pose.tilt, tiltMin, tiltMax);
+
+        float right = rightServo(pose);   // right = nod + tilt, so move both down (or up) by half the excess
+        float excess = max(right - sideMax, 0.0f) + min(right - sideMin, 0.0f);
+        pose.nod -= excess / 2;
+        pose.tilt -= excess / 2;
+
+        float left = leftServo(pose);     // left = tilt - nod, so move them in opposite directions
+        excess = max(left - sideMax, 0.0f) + min(left - sideMin, 0.0f);
+        pose.nod += excess / 2;
+        pose.tilt -= excess / 2;
+      }
+      pose.nod = constrain(pose.nod, nodMin, nodMax);
+      pose.tilt = constrain(pose.tilt, tiltMin, tiltMax);
+      return pose;
+    }
+
+    /*
+       limitMargin - how far (degrees) the pose is from the closest servo limit
+    */
+    float limitMargin(NeckPose pose) {
+      float right = rightServo(pose);
+      float left = leftServo(pose);
+      float margin = min(pose.rot - rotMin, rotMax - pose.rot);
+      margin = min(margin, min(right - sideMin, sideMax - right));
+      margin = min(margin, min(left - sideMin, sideMax - left));
+      return margin;
+    }
+
+    /*
+       limitPose - guard a neck command. Run this on every pose before it is sent to the servos.
+            NeckPose goal - commanded pose
+            return NeckPose - pose that is safe to send this tick
+    */
+    NeckPose limitPose(NeckPose goal) {
+      numCommands++;
+      NeckPose result = projectPose(goal);
+      if (abs(result.rot - goal.rot) > 0.01 || abs(result.nod - goal.nod) > 0.01 || abs(result.tilt - goal.tilt) > 0.01) {
+        numClamped++;
+      }
+
+      unsigned long timeNow = millis();
+      if (hasLastPose) {
+        // slow down close to the limits
+        float scale = constrain(limitMargin(lastPose) / slowMargin, minSpeedScale, 1.0f);
+        float maxStep = maxSpeed * scale * (timeNow - lastTime) / 1000.0;
+        float dRot = result.rot - lastPose.rot;
+        float dNod = result.nod - lastPose.nod;
+        float dTilt = result.tilt - lastPose.tilt;
+        float largest = max(abs(dRot), max(abs(dNod), abs(dTilt)));
+        if (largest > maxStep) {
+          // scale the whole move by the same amount so every axis arrives at the same time
+          float fraction = maxStep / largest;
+          NeckPose limited;
+          limited.rot = lastPose.rot + dRot * fraction;
+          limited.nod = lastPose.nod + dNod * fraction;
+          limited.tilt = lastPose.tilt + dTilt * fraction;
+          numRateLimited++;
+          result = projectPose(limited);
+        }
+      }
+      lastPose = result;
+      lastTime = timeNow;
+      hasLastPose = true;
+      return result;
+    }
+
+    /*
+       limitSide - clamp a single right or left servo command (used by the older moving functions in neck.h)
+            int deg - commanded servo position
+            return int - servo position within the side servo range
+    */
+    int limitSide(int deg) {
+      return limitServo(deg, sideMin, sideMax);
+    }
+
+    /*
+       limitRot - clamp a single rotational servo command
+            int deg - commanded servo position
+            return int - servo position within the rotation range
+    */
+    int limitRot(int deg) {
+      return limitServo(deg, rotMin, rotMax);
+    }
+
+    /*
+       clampSide - clamp a right or left servo command from a pose that already went through limitPose()
+                   (it was counted there, so it is not counted again)
+    */
+    int clampSide(int deg) {
+      return clampServo(deg, sideMin, sideMax);
+    }
+
+    /*
+       clampRot - clamp a rotational servo command from a pose that already went through limitPose()
+    */
+    int clampRot(int deg) {
+      return clampServo(deg, rotMin, rotMax);
+    }
+
+    /*
+       limitServo - clamp a single servo command and count it if it was out of range. Every servo command
+                    that is not part of a pose goes through here.
+    */
+    int limitServo(int deg, float low, float high) {
+      numCommands++;
+      int result = clampServo(deg, low, high);
+      if (result != deg) {
+        numClamped++;
+      }
+      return result;
+    }
+
+    //************************************************TELEMETRY********************************
+    /*
+       getNumClamped - number of commands that were out of range
+    */
+    unsigned long getNumClamped() {
+      return numClamped;
+    }
+
+    /*
+       getNumRateLimited - number of commands that were slowed down
+    */
+    unsigned long getNumRateLimited() {
+      return numRateLimited;
+    }
+
+    /*
+       printTelemetry - print the guard counters
+    */
+    void printTelemetry() {
+      Serial.print("Neck servo commands = "); Serial.print(numCommands);
+      Serial.print("  clamped = "); Serial.print(numClamped);
+      Serial.print("  rate limited = "); Serial.println(numRateLimited);
+    }
+};
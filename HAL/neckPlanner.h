@@ -0,0 +1,262 @@
+/**********************************************************************************
+  neckPlanner.h
+
+  This file contains the class definition, attributes, and methods of the NeckPlanner.
+  The planner coordinates the three neck axes (rotate, nod, and tilt) so that they
+  all arrive at a goal pose at the same time. For every move, the time needed by the
+  slowest axis is found and the other axes are slowed down to match it. Poses can be
+  queued one after another (ex. a scripted nod) or streamed every loop (ex. following
+  a hand with the camera). When the next pose is already waiting, the planner blends
+  the two moves together around the corner with a parabola, so the speed of every axis
+  changes smoothly from one move to the next and the neck never comes to a stop between
+  consecutive targets. The planner only calculates the commands. The Neck class (see
+  neck.h) converts the planned pose into servo commands and drives the servos.
+
+  All poses are in servo degrees so they line up with the setpoints in neck.h:
+      rot  - rotational servo position
+      nod  - right servo position when nodding (left servo is calculated in neck.h)
+      tilt - right servo position when tilting
+ *********************************************************************************/
+#include<Arduino.h>
+
+// Pose of the neck in servo degrees for each axis
+struct NeckPose {
+  float rot;
+  float nod;
+  float tilt;
+};
+
+class NeckPlanner {
+  private:
+    // QUEUE OF GOAL POSES
+    static const int poseQueueSize = 8; // maximum number of poses that can be waiting
+    NeckPose poseQueue[poseQueueSize];
+    int queueHead = 0;    // index of the oldest pose in the queue
+    int queueCount = 0;   // number of poses waiting in the queue
+
+    // CURRENT MOVE (SEGMENT)
+    NeckPose segStart;    // pose the current move started from
+    NeckPose segGoal;     // pose the current move is heading to
+    NeckPose current;     // latest planned pose
+    float segDuration = 0;  // time the current move takes (ms), always a whole number of ms
+    unsigned long segStartTime = 0; // time the current move started (ms)
+    boolean isMoving = false;
+
+    // BLEND INTO THE NEXT MOVE
+    NeckPose nextGoal;      // pose the next move is heading to
+    float nextDuration = 0; // time the next move takes (ms)
+    float blendHalf = 0;    // half of the blend time (ms), the blend is centered on segGoal
+    boolean isBlending = false;
+
+    // SPEED LIMITS (degrees per second for each axis)
+    float rotMaxSpeed = 100;
+    float nodMaxSpeed = 100;
+    float tiltMaxSpeed = 100;
+
+    // time (ms) spent blending from one move into the next, half before the corner and half after
+    float blendTime = 60;
+
+    /*
+       findDuration - find the time for a move. It is set by the axis that needs the most time at
+                      its maximum speed so all axes arrive together.
+            NeckPose from - pose to start the move from
+            NeckPose to - goal pose of the move
+            return float - time of the move (ms), rounded up so moves can be chained without drift
+    */
+    float findDuration(NeckPose from, NeckPose to) {
+      float rotTime = abs(to.rot - from.rot) / rotMaxSpeed;
+      float nodTime = abs(to.nod - from.nod) / nodMaxSpeed;
+      float tiltTime = abs(to.tilt - from.tilt) / tiltMaxSpeed;
+      float longestTime = max(rotTime, max(nodTime, tiltTime));
+      return ceil(longestTime * 1000); // convert seconds to ms
+    }
+
+    /*
+       startSegment - plan a move from one pose to another
+            NeckPose from - pose to start the move from
+            NeckPose to - goal pose of the move
+    */
+    void startSegment(NeckPose from, NeckPose to) {
+      segStart = from;
+      segGoal = to;
+      segDuration = findDuration(from, to);
+      segStartTime = millis();
+      isMoving = true;
+    }
+
+    /*
+       blendAxis - position of one axis during the blend. The speed changes at a constant rate from
+                   the speed of the current move to the speed of the next move, so the blend starts
+                   on the current move and ends on the next move.
+            float start - start of the current move
+            float goal - end of the current move (the corner)
+            float next - end of the next move
+            float t - time since the blend started (ms)
+            return float - position of the axis
+    */
+    float blendAxis(float start, float goal, float next, float t) {
+      float speed1 = (goal - start) / segDuration;
+      float speed2 = (next - goal) / nextDuration;
+      return goal + speed1 * (t - blendHalf) + (speed2 - speed1) * t * t / (4 * blendHalf);
+    }
+
+    /*
+       popPose - remove the oldest pose from the queue
+            return NeckPose - the oldest pose that was waiting
+    */
+    NeckPose popPose() {
+      NeckPose result = poseQueue[queueHead];
+      queueHead = (queueHead + 1) % poseQueueSize;
+      queueCount--;
+      return result;
+    }
+
+    /*
+       isSamePose - check if two poses are within a tenth of a degree on every axis
+    */
+    boolean isSamePose(NeckPose a, NeckPose b) {
+      return (abs(a.rot - b.rot) < 0.1 && abs(a.nod - b.nod) < 0.1 && abs(a.tilt - b.tilt) < 0.1);
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the planner
+    NeckPlanner() {
+    }
+
+    /*
+       setUp - set the pose the planner starts from and clear any waiting poses
+            NeckPose startPose - the current pose of the neck
+    */
+    void setUp(NeckPose startPose) {
+      current = startPose;
+      segStart = startPose;
+      segGoal = startPose;
+      segDuration = 0;
+      isMoving = false;
+      isBlending = false;
+      clear();
+    }
+
+    /*
+       setMaxSpeeds - change the maximum speed of each axis
+            float rotSpeed - maximum rotation speed in degrees per second
+            float nodSpeed - maximum nod speed in degrees per second
+            float tiltSpeed - maximum tilt speed in degrees per second
+    */
+    void setMaxSpeeds(float rotSpeed, float nodSpeed, float tiltSpeed) {
+      rotMaxSpeed = rotSpeed;
+      nodMaxSpeed = nodSpeed;
+      tiltMaxSpeed = tiltSpeed;
+    }
+
+    //************************************************ADDING POSES********************************
+    /*
+       addPose - add a pose to the end of the queue (used for scripted moves like a nod)
+            NeckPose pose - the goal pose
+            return boolean - true if the pose was added, false if the queue is full
+    */
+    boolean addPose(NeckPose pose) {
+      if (queueCount >= poseQueueSize) {
+        return false;
+      }
+      poseQueue[(queueHead + queueCount) % poseQueueSize] = pose;
+      queueCount++;
+      return true;
+    }
+
+    /*
+       streamPose - update the newest goal pose (used when a new target is given every loop,
+                    ex. following a hand). If a pose is already waiting it is replaced so the
+                    neck always heads to the latest target instead of building up a backlog.
+            NeckPose pose - the latest goal pose
+    */
+    void streamPose(NeckPose pose) {
+      if (queueCount > 0) {
+        poseQueue[(queueHead + queueCount - 1) % poseQueueSize] = pose;
+      } else if (!isSamePose(pose, segGoal)) {
+        addPose(pose);
+      }
+    }
+
+    /*
+       clear - remove all waiting poses. The current move (and the move it is blending into) is still completed.
+    */
+    void clear() {
+      queueHead = 0;
+      queueCount = 0;
+    }
+
+    //************************************************PLANNING********************************
+    /*
+       update - calculate the pose the neck should be at right now. Run this every loop.
+                When the current move is close to finishing and another pose is waiting, the
+                neck blends from the current move into the next one without stopping.
+            return NeckPose - the pose that should be commanded to the servos
+    */
+    NeckPose update() {
+      if (!isMoving && queueCount > 0) {
+        startSegment(current, popPose());
+      }
+      unsigned long elapsed = millis() - segStartTime;
+
+      // start the blend into the next pose once the current move is almost done
+      if (isMoving && !isBlending && queueCount > 0) {
+        NeckPose next = poseQueue[queueHead];
+        float duration = findDuration(segGoal, next);
+        float half = min(blendTime / 2, min(segDuration, duration) / 2);  // never past the middle of a move
+        if (elapsed + half >= segDuration) {
+          popPose();
+          nextGoal = next;
+          nextDuration = duration;
+          blendHalf = half;
+          isBlending = true;
+        }
+      }
+
+      if (isBlending) {
+        float t = elapsed - (segDuration - blendHalf);  // time since the blend started
+        if (t < 2 * blendHalf) {
+          current.rot = blendAxis(segStart.rot, segGoal.rot, nextGoal.rot, t);
+          current.nod = blendAxis(segStart.nod, segGoal.nod, nextGoal.nod, t);
+          current.tilt = blendAxis(segStart.tilt, segGoal.tilt, nextGoal.tilt, t);
+          return current;
+        }
+        // the blend is over, carry on along the next move as if it started at the corner
+        segStart = segGoal;
+        segGoal = nextGoal;
+        segStartTime += (unsigned long)segDuration;
+        segDuration = nextDuration;
+        isBlending = false;
+        elapsed = millis() - segStartTime;
+      }
+
+      if (isMoving) {
+        if (elapsed >= segDuration) {   // arrived at the goal
+          current = segGoal;
+          isMoving = false;
+        } else {    // every axis covers the same fraction of its move so they arrive together
+          float fraction = elapsed / segDuration;
+          current.rot = segStart.rot + (segGoal.rot - segStart.rot) * fraction;
+          current.nod = segStart.nod + (segGoal.nod - segStart.nod) * fraction;
+          current.tilt = segStart.tilt + (segGoal.tilt - segStart.tilt) * fraction;
+        }
+      }
+      return current;
+    }
+
+    /*
+       isDone - check if the planner has reached the final pose
+            return boolean - true if nothing is moving and no poses are waiting
+    */
+    boolean isDone() {
+      return (!isMoving && queueCount == 0);
+    }
+
+    /*
+       getPose - get the latest planned pose
+    */
+    NeckPose getPose() {
+      return current;
+    }
+};
@@ -80,15 +80,77 @@ int datan = 2;
 //// SOLENIOD PULSE
 const int leftPulsePin = 24;
 const int rightPulsePin = 25;
+
+//SERIAL FLASH (optional, see promptCache.h)
+// A serial flash chip (ex. W25Q128) on the SPI pins (11, 12, 13) with its chip select on this pin.
+// Without the chip the prompts are only cached in RAM.
+const int flashCSPin = 6;
 unsigned long timeNow = 0;
 
 //SPEAKER
 //NEED TO SWAP AUDIO IN AND OUTPUT PINS AND HAVE IT ANALOG STEREO CONNECTION *** REMEMBER TO FIX CIRCUIT DIAGRAM
-AudioPlaySdWav    playWav;
+// Two players so the next prompt can start just before the last one ends (see voice.h)
+AudioPlaySdWav    playWavA;
+AudioPlaySdWav    playWavB;
+AudioMixer4       promptMix;
+AudioAmplifier    promptAmp;      // volume of the prompts (turned down when someone talks over HAL, see voiceDetector.h)
+AudioMixer4       mainMix;        // one layer for each kind of sound (see soundMixer.h)
 AudioOutputAnalogStereo   dacs1;
-AudioConnection   patchCord1(playWav, dacs1);
+AudioConnection   patchCord1(playWavA, 0, promptMix, 0);
+AudioConnection   patchCord10(playWavB, 0, promptMix, 1);
+AudioConnection   patchCord11(promptMix, promptAmp);
+// Players for the prompts that are cached in the serial flash or RAM (see promptCache.h)
+AudioPlaySerialflashRaw   playFlashA;
+AudioPlaySerialflashRaw   playFlashB;
+AudioPlayMemory   playMemA;
+AudioPlayMemory   playMemB;
+AudioMixer4       cacheMix;
+AudioConnection   patchCord12(playFlashA, 0, cacheMix, 0);
+AudioConnection   patchCord13(playFlashB, 0, cacheMix, 1);
+AudioConnection   patchCord14(playMemA, 0, cacheMix, 2);
+AudioConnection   patchCord15(playMemB, 0, cacheMix, 3);
+AudioConnection   patchCord16(cacheMix, 0, promptMix, 2);
+AudioConnection   patchCord3(promptAmp, 0, mainMix, 0);
 #define SDCARD_CS_PIN BUILTIN_SDCARD
 
+//SECOND ADC
+// The microphone DMA below keeps ADC0 busy all the time, so an analogRead() on ADC0 would switch the channel in the
+// middle of the audio samples. The force sensors and pots are read on ADC1 instead (see readAnalog() in helperFunctions.h).
+// This is made before micInput so the audio library sets up ADC0 after it.
+ADC *adc = new ADC();
+
+//MICROPHONE
+// The microphone goes through the audio library so it is sampled at the audio rate on ADC0 (see voiceDetector.h)
+AudioInputAnalog  micInput(A20);   // same pin as micPin in head.h
+VoiceDetector     voiceDetect;
+AudioConnection   patchCord2(micInput, 0, voiceDetect, 0);
+AudioConnection   patchCord4(promptMix, 0, voiceDetect, 1);   // what HAL is saying, so he does not hear himself
+AudioBlockMonitor speechMonitor;  // times the prompts and counts underruns (see audioBenchmark.h)
+AudioConnection   patchCord20(promptMix, 0, speechMonitor, 0);
+
+//BREATHING SOUNDS (see breathing.h)
+// The breathing sounds are mixed together into the breathing layer of mainMix so HAL can breathe while he talks
+AudioSynthNoisePink       breathNoise;
+AudioFilterStateVariable  breathFilter;   // band pass for the airflow, low pass for the gasps
+AudioSynthWaveformSine    stridorTone;
+AudioMixer4               breathMixer;    // 0 = airflow, 1 = stridor, 2 = gasp
+AudioConnection   patchCord5(breathNoise, 0, breathFilter, 0);
+AudioConnection   patchCord6(breathFilter, 1, breathMixer, 0);
+AudioConnection   patchCord7(stridorTone, 0, breathMixer, 1);
+AudioConnection   patchCord8(breathFilter, 0, breathMixer, 2);
+AudioConnection   patchCord9(breathMixer, 0, mainMix, 1);
+
+//SOUND EFFECTS AND OUTPUT (see soundMixer.h)
+AudioPlaySdWav    playEffectWav;
+AudioConnection   patchCord17(playEffectWav, 0, mainMix, 2);
+// The breathing and the effects at the same volume as mainMix, so neither counts as someone talking (see voiceDetector.h)
+AudioMixer4       backgroundMix;  // same channels as mainMix, 0 and 3 are not used
+AudioConnection   patchCord21(breathMixer, 0, backgroundMix, 1);
+AudioConnection   patchCord22(playEffectWav, 0, backgroundMix, 2);
+AudioConnection   patchCord23(backgroundMix, 0, voiceDetect, 2);
+AudioConnection   patchCord18(mainMix, 0, dacs1, 0);
+AudioConnection   patchCord19(mainMix, 0, dacs1, 1);
+
 // LCD DEFINITIONS
 #define RED 0x1
 #define YELLOW 0x3
@@ -106,6 +168,9 @@ const int AirwaySettingState = 3;
 const int PulseSettingState = 4;
 const int CheckStartSimState = 5;
 const int StartSimulationState = 6;
+const int ChangeLOCState = 7;
+const int ChangeAirwayState = 8;
+const int ChangePulseState = 9;
 
 //*********************************************UI CONSTS***************************
 //Setting Changes
@@ -116,6 +181,7 @@ int changeSetNoCell = 5;
 int LOCCell = 0;
 int airwayCell = 4;
 int pulseCell = 8;
+int stopSimCell = 12;   // "Stop" on the top row of the start menu while the simulation is running
 int startSim = 2;   // 2 if you are still changing settings, 0 if want to not do simulation, 1 if you want to start simulation
 
 
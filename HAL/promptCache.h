@@ -0,0 +1,333 @@
+/**********************************************************************************
+  promptCache.h
+
+  This file contains the class definition, attributes, and methods of the PromptCache.
+  Starting a prompt from the SD card takes a different amount of time every time (the
+  file has to be found and the card can be busy), which throws off the timing of the
+  jaw and the reactions. When a scenario starts, its prompts are copied from the SD card
+  into the serial flash chip, or into RAM if they are short, so they start right away.
+  The prompts are found by the file name (a hash of it is checked first).
+
+  Only 16 bit, mono, 44.1 kHz WAV files can be cached (the flash and RAM players play
+  raw samples). Other files and files that do not fit are still played from the SD card.
+  The flash files stay between power cycles, so the copy only happens the first time.
+  Each flash file is named by a hash of the file name and its samples, so a prompt that
+  was changed on the SD card is copied again instead of playing the old one. A flash file
+  cannot be written over, so use eraseFlash() to get the space of the old copies back.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// WHERE A PROMPT IS PLAYED FROM
+const int promptFromSd = 0;
+const int promptFromFlash = 1;
+const int promptFromRam = 2;
+
+// One cached prompt
+struct PromptCacheEntry {
+  char filename[13];             // SD file name (8.3)
+  uint32_t hash;                 // hash of the SD file name
+  int location;                  // promptFromFlash or promptFromRam
+  char flashName[13];            // name of the raw file in the serial flash
+  const unsigned int *ramClip;   // clip for AudioPlayMemory
+};
+
+class PromptCache {
+  private:
+    static const int maxEntries = 32;
+    PromptCacheEntry entries[maxEntries];
+    int numEntries = 0;
+    boolean isFlashReady = false;
+
+    // RAM CLIPS (AudioPlayMemory format: a header word, then 2 samples per word)
+    static const uint32_t ramPoolWords = 24576;  // 96 KB (the Teensy 3.6 has 256 KB)
+    const uint32_t maxRamClipBytes = 48000;       // clips shorter than about 0.5 sec go in RAM (ex. a yell or a short answer)
+    uint32_t ramPool[ramPoolWords];
+    uint32_t ramUsed = 0;
+
+    // RESULTS (for each location)
+    unsigned long numStarts[3] = {0, 0, 0};
+    unsigned long totalLatency[3] = {0, 0, 0};
+    unsigned long maxLatency[3] = {0, 0, 0};
+
+    /*
+       hashData - add the samples of a WAV file to a hash (FNV-1a). The file is left at the end of the samples.
+            uint32_t hash - hash so far
+            File &file - WAV file at the start of the samples
+            uint32_t dataSize - number of bytes of samples
+            return uint32_t - new hash
+    */
+    uint32_t hashData(uint32_t hash, File &file, uint32_t dataSize) {
+      uint8_t buffer[256];
+      uint32_t left = dataSize;
+      while (left > 0) {
+        uint32_t n = file.read(buffer, min(left, (uint32_t)sizeof(buffer)));
+        if (n == 0) {
+          break;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+          hash ^= buffer[i];
+          hash *= 16777619UL;
+        }
+        left -= n;
+      }
+      return hash;
+    }
+
+    /*
+       hashName - FNV-1a hash of a file name (upper case so "hello.wav" and "HELLO.WAV" match)
+    */
+    uint32_t hashName(const char *filename) {
+      uint32_t hash = 2166136261UL;
+      for (const char *c = filename; *c != '\0'; c++) {
+        hash ^= (uint8_t)toupper(*c);
+        hash *= 16777619UL;
+      }
+      return hash;
+    }
+
+    /*
+       readLong - read a little endian number from a WAV header
+    */
+    uint32_t readLong(const uint8_t *bytes) {
+      return bytes[0] | (bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+    }
+
+    /*
+       findData - read the WAV header and leave the file at the start of the samples
+            File &file - open WAV file
+            uint32_t &dataSize - resulting number of bytes of samples
+            return boolean - false if it is not a 16 bit, mono, 44.1 kHz WAV file
+    */
+    boolean findData(File &file, uint32_t &dataSize) {
+      uint8_t header[16];
+      if (file.read(header, 12) != 12 || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        return false;
+      }
+      boolean isFormatOk = false;
+      while (file.read(header, 8) == 8) {
+        uint32_t chunkSize = readLong(header + 4);
+        if (memcmp(header, "fmt ", 4) == 0) {
+          if (chunkSize < 16 || file.read(header, 16) != 16) {
+            return false;
+          }
+          uint16_t format = header[0] | (header[1] << 8);
+          uint16_t channels = header[2] | (header[3] << 8);
+          uint32_t sampleRate = readLong(header + 4);
+          uint16_t bits = header[14] | (header[15] << 8);
+          isFormatOk = format == 1 && channels == 1 && sampleRate == 44100 && bits == 16;
+          file.seek(file.position() + chunkSize - 16 + (chunkSize & 1));
+        } else if (memcmp(header, "data", 4) == 0) {
+          dataSize = chunkSize;
+          return isFormatOk;
+        } else {
+          file.seek(file.position() + chunkSize + (chunkSize & 1));  // chunks are padded to an even size
+        }
+      }
+      return false;
+    }
+
+    /*
+       copyToFlash - copy the samples of a WAV file into a raw file in the serial flash
+            File &file - WAV file at the start of the samples
+            const char *flashName - name of the flash file (made from the hash of the name and the samples)
+            uint32_t dataSize - number of bytes of samples
+            return boolean - false if there was no room
+    */
+    boolean copyToFlash(File &file, const char *flashName, uint32_t dataSize) {
+      if (SerialFlash.exists(flashName)) {   // the same samples were copied before
+        return true;
+      }
+      if (!SerialFlash.create(flashName, dataSize)) {
+        return false;
+      }
+      SerialFlashFile flashFile = SerialFlash.open(flashName);
+      uint8_t buffer[256];
+      uint32_t left = dataSize;
+      while (left > 0) {
+        uint32_t n = file.read(buffer, min(left, (uint32_t)sizeof(buffer)));
+        if (n == 0) {
+          break;
+        }
+        flashFile.write(buffer, n);
+        left -= n;
+      }
+      flashFile.close();
+      return left == 0;
+    }
+
+    /*
+       copyToRam - copy the samples of a WAV file into the RAM pool
+            return const unsigned int * - clip for AudioPlayMemory, NULL if there was no room
+    */
+    const unsigned int *copyToRam(File &file, uint32_t dataSize) {
+      uint32_t numSamples = dataSize / 2;
+      uint32_t words = 1 + (numSamples + 1) / 2;
+      if (ramUsed + words > ramPoolWords) {
+        return NULL;
+      }
+      uint32_t *clip = &ramPool[ramUsed];
+      clip[words - 1] = 0;   // last word may only be half full
+      if (file.read((uint8_t *)&clip[1], numSamples * 2) != (int)(numSamples * 2)) {
+        return NULL;
+      }
+      clip[0] = 0x81000000UL | numSamples;   // 16 bit PCM at 44.1 kHz
+      ramUsed += words;
+      return (const unsigned int *)clip;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the prompt cache
+    PromptCache() {
+    }
+
+    /*
+       setUp - start the serial flash chip. Prompts are only cached in RAM if there is no flash chip.
+            int flashPin - chip select pin of the flash chip
+    */
+    void setUp(int flashPin) {
+      isFlashReady = SerialFlash.begin(flashPin);
+      if (!isFlashReady) {
+        Serial.println("Unable to access the serial flash, only short prompts will be cached");
+      }
+    }
+
+    //************************************************CACHING********************************
+    /*
+       cachePrompt - copy a prompt from the SD card into the cache (nothing happens if it is already cached).
+                     The SD players must be stopped first (see Head::stopSdPlayers()).
+            const char *filename - WAV file on the SD card
+            return boolean - true if the prompt is cached
+    */
+    boolean cachePrompt(const char *filename) {
+      uint32_t hash = hashName(filename);
+      if (find(filename) != NULL) {
+        return true;
+      }
+      if (numEntries == maxEntries) {
+        return false;
+      }
+      File file = SD.open(filename);
+      if (!file) {
+        Serial.print("Unable to open prompt: "); Serial.println(filename);
+        return false;
+      }
+      uint32_t dataSize = 0;
+      PromptCacheEntry &entry = entries[numEntries];
+      strncpy(entry.filename, filename, sizeof(entry.filename) - 1);
+      entry.filename[sizeof(entry.filename) - 1] = '\0';
+      entry.hash = hash;
+      entry.ramClip = NULL;
+      entry.flashName[0] = '\0';
+      boolean isCached = false;
+      if (findData(file, dataSize)) {
+        uint32_t dataStart = file.position();
+        if (dataSize <= maxRamClipBytes) {
+          entry.ramClip = copyToRam(file, dataSize);
+          entry.location = promptFromRam;
+          isCached = entry.ramClip != NULL;
+        }
+        if (!isCached && isFlashReady) {
+          file.seek(dataStart);
+          sprintf(entry.flashName, "%08lX.RAW", (unsigned long)hashData(hash, file, dataSize));
+          file.seek(dataStart);
+          entry.location = promptFromFlash;
+          isCached = copyToFlash(file, entry.flashName, dataSize);
+        }
+      }
+      file.close();
+      if (isCached) {
+        numEntries++;
+      }
+      return isCached;
+    }
+
+    /*
+       loadScenario - cache all of the prompts a scenario uses. Run this when the scenario starts (it waits for the copies).
+            const char *filenames[] - WAV files on the SD card
+            int count - number of files
+            return int - number of prompts that are cached
+    */
+    int loadScenario(const char *filenames[], int count) {
+      int numCached = 0;
+      unsigned long startTime = millis();
+      for (int i = 0; i < count; i++) {
+        if (cachePrompt(filenames[i])) {
+          numCached++;
+        } else {
+          Serial.print("Prompt will play from the SD card: "); Serial.println(filenames[i]);
+        }
+      }
+      Serial.print("Cached "); Serial.print(numCached); Serial.print(" of "); Serial.print(count);
+      Serial.print(" prompts in (ms) "); Serial.println(millis() - startTime);
+      return numCached;
+    }
+
+    /*
+       find - find a prompt in the cache
+            const char *filename - WAV file on the SD card
+            return PromptCacheEntry * - cached prompt, NULL if it has to be played from the SD card
+    */
+    const PromptCacheEntry *find(const char *filename) {
+      uint32_t hash = hashName(filename);
+      for (int i = 0; i < numEntries; i++) {
+        if (entries[i].hash == hash && strcasecmp(entries[i].filename, filename) == 0) {
+          return &entries[i];
+        }
+      }
+      return NULL;
+    }
+
+    /*
+       clear - forget the cached prompts (ex. before loading a different scenario). The flash files are kept.
+    */
+    void clear() {
+      numEntries = 0;
+      ramUsed = 0;
+    }
+
+    /*
+       eraseFlash - erase the whole flash chip (takes up to a minute). Use this after changing the prompts on the SD card.
+    */
+    void eraseFlash() {
+      if (!isFlashReady) {
+        return;
+      }
+      clear();
+      SerialFlash.eraseAll();
+      while (!SerialFlash.ready()) {
+        delay(100);
+      }
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       recordStart - record where a prompt was started from and how long it took to start
+            int location - promptFromSd (a miss), promptFromFlash, or promptFromRam
+            unsigned long latency - time from queueing the prompt to it starting (us)
+    */
+    void recordStart(int location, unsigned long latency) {
+      numStarts[location]++;
+      totalLatency[location] += latency;
+      maxLatency[location] = max(maxLatency[location], latency);
+    }
+
+    /*
+       printReport - print the cache hits and misses and the start latency from each location
+    */
+    void printReport() {
+      const char *names[] = {"SD (miss)", "Flash", "RAM"};
+      unsigned long hits = numStarts[promptFromFlash] + numStarts[promptFromRam];
+      Serial.print("Prompt cache: hits = "); Serial.print(hits);
+      Serial.print(" misses = "); Serial.print(numStarts[promptFromSd]);
+      Serial.print(" RAM used (bytes) = "); Serial.println(ramUsed * 4);
+      for (int i = 0; i < 3; i++) {
+        if (numStarts[i] == 0) {
+          continue;
+        }
+        Serial.print("  "); Serial.print(names[i]);
+        Serial.print(" start latency (us) avg = "); Serial.print(totalLatency[i] / numStarts[i]);
+        Serial.print(" max = "); Serial.println(maxLatency[i]);
+      }
+    }
+};
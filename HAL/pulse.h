@@ -1,11 +1,15 @@
 /**********************************************************************************
    Pulse file
       Has overall class definition and private and public functions
+      The solenoids are driven by a hardware timer (see pulseEngine.h). The functions in
+      this class only choose the beats and keep the timer's schedule filled.
 
    Edited by Ethan Lauer on 1/29/20
 
  *********************************************************************************/
 #include<Arduino.h>
+#include "pulseEngine.h" // include the timer driven solenoid engine
+#include "cardiacRhythm.h" // include the rhythm generator
 
 class Pulse {
 
@@ -13,10 +17,25 @@ class Pulse {
     int leftSolPin;
     int rightSolPin;
 
-    unsigned long timeNow = 0;
-    int state = 0;
     boolean isFirstRun = true;
-    float milliseconds;
+    PulseEngine engine = PulseEngine();
+
+    // RHYTHM
+    CardiacRhythm rhythm = CardiacRhythm();
+    const int randPulseBPM = 110;         // average rate of the irregular pulse (atrial fibrillation)
+
+    /*
+      fillSchedule - give the engine the next few beats and start it the first time
+    */
+    void fillSchedule() {
+      while (engine.needsBeat()) {
+        engine.addBeat(rhythm.nextBeat());
+      }
+      if (isFirstRun) {
+        engine.start();
+        isFirstRun = false;
+      }
+    }
 
   public:
     //**********************INITIALIZE*******************************************
@@ -32,6 +51,7 @@ class Pulse {
       isFirstRun = true;
       pinMode(leftSolPin, OUTPUT);
       pinMode(rightSolPin, OUTPUT);
+      engine.setUp(leftSolPin, rightSolPin);
       randomSeed(analogRead(A0)); //analog read an unused pin
       Serial.println("Initializing Pulse");
       off();
@@ -54,59 +74,49 @@ class Pulse {
     //**********************SET PULSES*******************************************
 
     /*
-      pulseByBPM - actuate solenoid at acertain BPM
+      pulseByBPM - actuate solenoid at acertain BPM. The timer keeps the beats even no matter how busy the loop is.
+                   Call this in the loop to keep the schedule filled (it does not wait).
           int BPM- the heart rate in BPM and it the solenoid will actuate at the desired rate evenly!
     */
     void pulseByBPM(int BPM) {
-      milliseconds = (60000 / (BPM + 10)); // 60 seconds per minute, 60000 ms per minute  *add 10 to BPM because many delays in movements make the pulse change
-      float actuationDelay = 30;
-      switch (state) {
-        case 0:
-          on();
-          if (millis() > timeNow + milliseconds) {
-            timeNow = millis();
-            state = 1;
-          }
-          break;
-        case 1:
-          off();
-          if (millis() > timeNow + actuationDelay) {
-            timeNow = millis();
-            state = 0;
-          }
-          break;
+      pulseByRhythm(rhythmSinus, BPM);
+    }
+
+    /*
+      pulseByRhythm - actuate the solenoids with a heart rhythm (see cardiacRhythm.h). Call this in the loop to keep the schedule filled.
+          int rhythmType - rhythmSinus, rhythmAfib, rhythmPVC, rhythmBrady or rhythmAlternans
+          int BPM - average heart rate in BPM
+    */
+    void pulseByRhythm(int rhythmType, int BPM) {
+      if (rhythm.setRhythm(rhythmType, BPM)) {
+        engine.clearSchedule();   // the new rate starts at the next beat instead of after the beats already in the schedule
       }
+      fillSchedule();
     }
 
 
     /*
       randPulse
-            the solenoid will actuate random rates
+            the solenoid will actuate with an irregularly irregular rhythm (atrial fibrillation).
+            Call this in the loop to keep the schedule filled (it does not wait).
     */
     void randPulse() {
-      if (isFirstRun) {
-        milliseconds = irregularPulse();
-        isFirstRun = false;
-      }
-      float msDelay = 30;
-      switch (state) {
-        case 0:
-          on();
-          if (millis() > timeNow + milliseconds) {
-            milliseconds = 60000 / (irregularPulse() + 10);
-            timeNow = millis();
-            state = 1;
-          }
-          break;
-
-        case 1:
-          off();
-          if (millis() > timeNow + msDelay) {
-            timeNow = millis();
-            state = 0;
-          }
-          break;
-      }
+      pulseByRhythm(rhythmAfib, randPulseBPM);
+    }
+
+    /*
+      stopPulse - stop the timer and turn the solenoids off
+    */
+    void stopPulse() {
+      engine.stop();
+      isFirstRun = true;
+    }
+
+    /*
+      getEngine - get the solenoid engine (ex. to check the number of beats)
+    */
+    PulseEngine &getEngine() {
+      return engine;
     }
 
     //**********************CALCULATING PUSLES*******************************************
@@ -0,0 +1,194 @@
+/**********************************************************************************
+  pulseEngine.h
+
+  This file contains the class definition, attributes, and methods of the PulseEngine.
+  The PulseEngine drives the two pulse solenoids from a hardware timer (IntervalTimer)
+  instead of the loop, so the pulse the trainee feels does not slow down when the
+  servos and the audio keep the loop busy. The timer runs every 100 us and the beats
+  are taken from a short schedule of upcoming beats. Each beat has:
+      - the time until the next beat (the beat to beat interval)
+      - how long the solenoids stay on (a longer stroke feels like a stronger beat)
+  The Pulse class (see pulse.h) decides the beats and keeps the schedule filled a few
+  beats ahead. If the loop is blocked for a long time and the schedule runs out, the
+  last beat is repeated so the pulse never stops. When the rate or the rhythm changes,
+  the beats that were not played yet are thrown away (see clearSchedule()) so the change
+  is felt at the next beat. The timer only runs between start() and stop().
+
+  The schedule has one writer (the loop) and one reader (the timer interrupt), so the
+  interrupts only have to be turned off to clear it.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// One heart beat
+struct PulseBeat {
+  unsigned long intervalUs;  // time from this beat to the next one (us)
+  unsigned int strokeUs;     // time the solenoids stay on (us) - 0 for a beat that cannot be felt
+};
+
+class PulseEngine {
+  private:
+    static const unsigned long tickUs = 100;  // timer period (us) - the timing of every beat is within this
+    static const int scheduleSize = 8;         // must be a power of 2
+    static const int leadBeats = 3;            // beats kept in the schedule (cleared when the BPM changes)
+    static PulseEngine *running;               // engine the timer interrupt drives
+
+    IntervalTimer timer;
+    boolean isRunning = false;
+    int leftPin;
+    int rightPin;
+
+    // SCHEDULE (written by addBeat(), read by the timer interrupt)
+    PulseBeat schedule[scheduleSize];
+    volatile uint8_t head = 0;
+    volatile uint8_t tail = 0;
+
+    // TIMER INTERRUPT STATE
+    PulseBeat current = {500000, 30000};     // beat that is playing (repeated if the schedule runs out)
+    volatile unsigned long ticksToBeat = 1;   // ticks until the next beat starts
+    volatile unsigned long strokeTicks = 0;   // ticks until the solenoids turn off
+    volatile unsigned long numBeats = 0;
+    volatile unsigned long numRepeats = 0;    // beats repeated because the schedule was empty
+    volatile unsigned long lastBeatTime = 0;  // time the last beat started (us)
+
+    /*
+       timerTick - called by the timer interrupt every tickUs
+    */
+    static void timerTick() {
+      if (running != NULL) {
+        running->tick();
+      }
+    }
+
+    /*
+       tick - turn the solenoids off at the end of a stroke and start the next beat on time
+    */
+    void tick() {
+      if (strokeTicks > 0) {
+        strokeTicks--;
+        if (strokeTicks == 0) {
+          digitalWriteFast(leftPin, LOW);
+          digitalWriteFast(rightPin, LOW);
+        }
+      }
+      ticksToBeat--;
+      if (ticksToBeat > 0) {
+        return;
+      }
+      if (tail != head) {   // next beat from the schedule
+        current = schedule[tail];
+        asm volatile("" ::: "memory");
+        tail = (tail + 1) & (scheduleSize - 1);
+      } else {
+        numRepeats++;
+      }
+      strokeTicks = current.strokeUs / tickUs;
+      if (strokeTicks > 0) {   // a beat with no stroke cannot be felt (ex. a weak beat in atrial fibrillation)
+        digitalWriteFast(leftPin, HIGH);
+        digitalWriteFast(rightPin, HIGH);
+      }
+      ticksToBeat = max(current.intervalUs / tickUs, strokeTicks + 1);
+      lastBeatTime = micros();
+      numBeats++;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the pulse engine
+    PulseEngine() {
+    }
+
+    /*
+       setUp - set the solenoid pins
+            int leftSolPin - left solenoid pin
+            int rightSolPin - right solenoid pin
+    */
+    void setUp(int leftSolPin, int rightSolPin) {
+      leftPin = leftSolPin;
+      rightPin = rightSolPin;
+    }
+
+    /*
+       start - start the timer. The first beat is the first one in the schedule.
+    */
+    void start() {
+      if (isRunning) {
+        return;
+      }
+      running = this;
+      ticksToBeat = 1;
+      timer.begin(timerTick, tickUs);
+      timer.priority(64);   // higher than the audio library so the beats stay on time
+      isRunning = true;
+    }
+
+    /*
+       stop - stop the timer and turn the solenoids off
+    */
+    void stop() {
+      timer.end();
+      isRunning = false;
+      running = NULL;
+      strokeTicks = 0;
+      head = tail;   // the timer is stopped, so the schedule can be cleared without turning the interrupts off
+      digitalWriteFast(leftPin, LOW);
+      digitalWriteFast(rightPin, LOW);
+    }
+
+    //************************************************SCHEDULE********************************
+    /*
+       needsBeat - check if the schedule needs another beat (call addBeat() until this is false)
+    */
+    boolean needsBeat() {
+      return ((head - tail) & (scheduleSize - 1)) < leadBeats;
+    }
+
+    /*
+       addBeat - add a beat to the end of the schedule
+            const PulseBeat &beat - beat to add
+            return boolean - false if the schedule is full
+    */
+    boolean addBeat(const PulseBeat &beat) {
+      uint8_t next = (head + 1) & (scheduleSize - 1);
+      if (next == tail) {
+        return false;
+      }
+      schedule[head] = beat;
+      asm volatile("" ::: "memory");
+      head = next;
+      return true;
+    }
+
+    /*
+       clearSchedule - throw away the beats that were not played yet (ex. the BPM changed) so the next beat is a new one.
+                       The beat that is playing finishes first.
+    */
+    void clearSchedule() {
+      noInterrupts();   // the timer interrupt moves the tail
+      head = tail;
+      interrupts();
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getNumBeats - number of beats since the engine started
+    */
+    unsigned long getNumBeats() {
+      return numBeats;
+    }
+
+    /*
+       getNumRepeats - number of beats that were repeated because the loop did not fill the schedule in time
+    */
+    unsigned long getNumRepeats() {
+      return numRepeats;
+    }
+
+    /*
+       getLastBeatTime - time the last beat started (us)
+    */
+    unsigned long getLastBeatTime() {
+      return lastBeatTime;
+    }
+};
+
+PulseEngine *PulseEngine::running = NULL;
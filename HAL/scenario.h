@@ -0,0 +1,677 @@
+/**********************************************************************************
+  scenario.h
+
+  This file contains the class definition, attributes, and methods of the Scenario.
+  A scenario is the script HAL follows during the LOC test, written in a text file on
+  the SD card so a new training scenario does not need the code to be uploaded again.
+  The scenario is a list of states. Each state has actions that are done when HAL
+  goes into it, behaviors that run every loop while HAL is in it, and triggers that
+  move HAL to another state. The first state in the file is where the scenario starts.
+  One line per command, anything after a # is a comment, and capitals do not matter
+  except in file names:
+
+      state <name>                      start a new state (names are up to 15 characters)
+      say <file> [urgent|low]           play a prompt (see voice.h)
+      effect <file>                     play a sound on the effects layer (see soundMixer.h)
+      stop                              stop the prompt that is playing and empty the queue
+      do <behavior>                     run a behavior until it is done or HAL leaves the state (see headBehaviors.h)
+      loop <behavior>                   run a behavior every loop while in the state
+      pulse <bpm>                       change the pulse
+      pulse sinus|afib|pvc|brady|alternans <bpm>
+                                        change the heart rhythm (see cardiacRhythm.h)
+      air normal                        change to a normal airway
+      air lockjaw irregular stridor agonal
+                                        change to any of the airway problems (see setAir() in head.h)
+      on voiceStart goto <state>        the trainee started talking
+      on voiceEnd goto <state>          the trainee stopped talking
+      on bargeIn goto <state>           the trainee talked over HAL (see voiceDetector.h)
+      on promptEnd goto <state>         HAL is done talking (nothing playing or queued)
+      on fsr <sensor|any> <event|any> goto <state>
+                                        a force sensor event (forehead, neck, chin, jawright, jawleft and
+                                        touch, press, squeeze, release, tap - see fsrEventQueue.h)
+      on targetLost <ms> goto <state>   the camera target was seen in this state and has been gone this long
+      on timer <ms> goto <state>        this long after going into the state
+
+  The actions are done in the order they are written. The triggers are checked in the
+  order they are written and the first one that happens is used. Events that do not
+  match a trigger in the state HAL is in are thrown away.
+
+  The whole file is compiled into small tables of states, actions and triggers when
+  it is loaded (see load()): the prompts and behaviors are looked up by name and the
+  states are numbered, so update() only reads the tables and never looks at the text.
+  The prompts are copied into the prompt cache when the file is loaded (see promptCache.h).
+  The files for each LOC are ALERT.TXT, VERBAL.TXT, PAIN.TXT and UNRESP.TXT in the top
+  folder of the SD card (see the Scenarios folder for examples).
+ *********************************************************************************/
+#include <Arduino.h>
+
+// SCENARIO TRIGGERS
+const int triggerVoiceStart = 0;   // the trainee started talking
+const int triggerVoiceEnd = 1;     // the trainee stopped talking
+const int triggerBargeIn = 2;      // the trainee talked over HAL
+const int triggerPromptEnd = 3;    // HAL is done talking
+const int triggerFsr = 4;          // a force sensor event
+const int triggerTargetLost = 5;   // the camera target has been gone for a while
+const int triggerTimer = 6;        // time since going into the state
+
+// SCENARIO ACTIONS
+const int actionSay = 0;      // play a prompt
+const int actionEffect = 1;   // play a sound effect
+const int actionStop = 2;     // stop talking
+const int actionDo = 3;       // run a behavior until it is done
+const int actionLoop = 4;     // run a behavior every loop
+const int actionPulse = 5;    // change the pulse
+const int actionAir = 6;      // change the airway
+
+const int scenarioAny = 255;  // any force sensor or any force sensor event
+
+// One action of a state
+struct ScenarioAction {
+  uint8_t type;     // actionSay, actionEffect, ...
+  uint8_t arg;      // file, behavior, heart rhythm, or airway conditions (one bit for each, in the order of setAir())
+  int16_t value;    // priority of a prompt or BPM of a pulse
+};
+
+// One trigger of a state and the state it goes to
+struct ScenarioTrigger {
+  uint8_t type;         // triggerVoiceStart, triggerVoiceEnd, ...
+  uint8_t sensor;       // force sensor (ex. fsrNeck) or scenarioAny
+  uint8_t event;        // force sensor event (ex. fsrPress) or scenarioAny
+  uint8_t next;         // state to go to
+  unsigned long time;   // ms for triggerTargetLost and triggerTimer
+};
+
+// One state - its actions and triggers are next to each other in the tables
+struct ScenarioState {
+  char name[16];
+  uint8_t firstAction;
+  uint8_t numActions;
+  uint8_t firstTrigger;
+  uint8_t numTriggers;
+  boolean isDefined;    // false if it was only named in a goto so far
+  boolean usesCamera;   // true if it has a targetLost trigger
+};
+
+class Scenario {
+  private:
+    Head *head = NULL;
+
+    // COMPILED TABLES
+    static const int maxStates = 16;
+    static const int maxActions = 64;
+    static const int maxTriggers = 32;
+    static const int maxFiles = 12;
+    ScenarioState states[maxStates];
+    ScenarioAction actions[maxActions];
+    ScenarioTrigger triggers[maxTriggers];
+    char files[maxFiles][13];         // 8.3 names of the prompts and effects
+    boolean isPromptFile[maxFiles];   // true if the file is played by the voice (cached when loaded)
+    int numStates = 0;
+    int numActions = 0;
+    int numTriggers = 0;
+    int numFiles = 0;
+
+    // LOADING
+    static const int maxLineLength = 80;
+    char filename[13];
+    int lineNum = 0;
+    int stateNum = -1;             // state the lines are added to
+    char error[64] = "";
+    boolean isLoaded = false;
+    int LOC = -1;                  // LOC of the head when the file was loaded (-1 if nothing was loaded yet)
+
+    // RUNNING
+    int currentState = 0;
+    unsigned long stateStartTime = 0;   // ms
+    boolean isTargetSeen = false;       // true once the camera target was seen in this state
+    unsigned long lastTargetTime = 0;   // time the camera target was last seen (ms)
+    boolean isActionDone[maxActions];   // true once the behavior of a do action is done
+
+    //************************************************COMPILING********************************
+    /*
+       fail - save the error for the line that is being compiled
+            return boolean - always false
+    */
+    boolean fail(const char *message) {
+      snprintf(error, sizeof(error), "%s line %d: %s", filename, lineNum, message);
+      return false;
+    }
+
+    /*
+       findWord - find a word in a list (capitals do not matter)
+            return int - index in the list, -1 if it is not there
+    */
+    int findWord(const char *word, const char *const words[], int count) {
+      if (word == NULL) {
+        return -1;
+      }
+      for (int i = 0; i < count; i++) {
+        if (strcasecmp(word, words[i]) == 0) {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    /*
+       readNumber - read a whole number
+            return boolean - false if it is not a number
+    */
+    boolean readNumber(const char *word, long &number) {
+      if (word == NULL || *word == '\0') {
+        return false;
+      }
+      char *end;
+      number = strtol(word, &end, 10);
+      return *end == '\0';
+    }
+
+    /*
+       findState - find a state by name, or add it if it was not named before
+            return int - state number, -1 if there are too many states
+    */
+    int findState(const char *name) {
+      for (int s = 0; s < numStates; s++) {
+        if (strcasecmp(name, states[s].name) == 0) {
+          return s;
+        }
+      }
+      if (numStates == maxStates || strlen(name) >= sizeof(states[0].name)) {
+        return -1;
+      }
+      ScenarioState &state = states[numStates];
+      strcpy(state.name, name);
+      state.isDefined = false;
+      state.usesCamera = false;
+      state.numActions = 0;
+      state.numTriggers = 0;
+      return numStates++;
+    }
+
+    /*
+       findFile - find a prompt or effect, or add it if it was not used before
+            return int - file number, -1 if there are too many files or the name is not 8.3
+    */
+    int findFile(const char *name, boolean isPrompt) {
+      for (int f = 0; f < numFiles; f++) {
+        if (strcasecmp(name, files[f]) == 0) {
+          isPromptFile[f] = isPromptFile[f] || isPrompt;
+          return f;
+        }
+      }
+      if (numFiles == maxFiles || strlen(name) >= sizeof(files[0])) {
+        return -1;
+      }
+      strcpy(files[numFiles], name);
+      isPromptFile[numFiles] = isPrompt;
+      return numFiles++;
+    }
+
+    /*
+       addAction - add an action to the state the lines are added to
+    */
+    boolean addAction(int type, int arg, int value) {
+      if (numActions == maxActions) {
+        return fail("too many actions");
+      }
+      actions[numActions].type = type;
+      actions[numActions].arg = arg;
+      actions[numActions].value = value;
+      numActions++;
+      states[stateNum].numActions++;
+      return true;
+    }
+
+    /*
+       compileState - state <name>
+    */
+    boolean compileState(char *name) {
+      if (name == NULL) {
+        return fail("state <name>");
+      }
+      int s = findState(name);
+      if (s < 0) {
+        return fail("too many states or the name is too long");
+      }
+      if (states[s].isDefined) {
+        return fail("state is already defined");
+      }
+      states[s].isDefined = true;
+      states[s].firstAction = numActions;
+      states[s].firstTrigger = numTriggers;
+      stateNum = s;
+      return true;
+    }
+
+    /*
+       compileTrigger - on <trigger> ... goto <state>
+    */
+    boolean compileTrigger(char *name) {
+      const char *const names[] = {"voicestart", "voiceend", "bargein", "promptend", "fsr", "targetlost", "timer"};
+      const char *const sensors[] = {"forehead", "neck", "chin", "jawright", "jawleft"};  // same order as fsrForehead, fsrNeck, ...
+      const char *const events[] = {"touch", "press", "squeeze", "release", "tap"};       // same order as fsrTouch, fsrPress, ...
+      if (numTriggers == maxTriggers) {
+        return fail("too many triggers");
+      }
+      ScenarioTrigger &trigger = triggers[numTriggers];
+      int type = findWord(name, names, 7);
+      if (type < 0) {
+        return fail("unknown trigger");
+      }
+      trigger.type = type;
+      trigger.sensor = scenarioAny;
+      trigger.event = scenarioAny;
+      trigger.time = 0;
+      if (type == triggerFsr) {
+        char *sensor = strtok(NULL, " ");
+        char *event = strtok(NULL, " ");
+        int s = findWord(sensor, sensors, 5);
+        int e = findWord(event, events, 5);
+        if ((s < 0 && (sensor == NULL || strcasecmp(sensor, "any") != 0)) || (e < 0 && (event == NULL || strcasecmp(event, "any") != 0))) {
+          return fail("on fsr <sensor|any> <event|any> goto <state>");
+        }
+        trigger.sensor = s < 0 ? scenarioAny : s;
+        trigger.event = e < 0 ? scenarioAny : e;
+      } else if (type == triggerTargetLost || type == triggerTimer) {
+        long time;
+        if (!readNumber(strtok(NULL, " "), time) || time < 0) {
+          return fail("on targetLost|timer <ms> goto <state>");
+        }
+        trigger.time = time;
+        states[stateNum].usesCamera = states[stateNum].usesCamera || type == triggerTargetLost;
+      }
+      char *word = strtok(NULL, " ");
+      char *next = strtok(NULL, " ");
+      if (word == NULL || strcasecmp(word, "goto") != 0 || next == NULL) {
+        return fail("on <trigger> goto <state>");
+      }
+      int s = findState(next);
+      if (s < 0) {
+        return fail("too many states or the name is too long");
+      }
+      trigger.next = s;
+      numTriggers++;
+      states[stateNum].numTriggers++;
+      return true;
+    }
+
+    /*
+       compilePulse - pulse <bpm> | pulse <rhythm> <bpm>
+    */
+    boolean compilePulse(char *arg) {
+      const char *const rhythms[] = {"sinus", "afib", "pvc", "brady", "alternans"};  // same order as rhythmSinus, rhythmAfib, ...
+      long BPM;
+      int rhythm = findWord(arg, rhythms, 5);
+      if (rhythm >= 0) {
+        arg = strtok(NULL, " ");
+      } else {
+        rhythm = rhythmSinus;
+      }
+      if (!readNumber(arg, BPM) || BPM <= 0 || BPM > 220) {
+        return fail("pulse <bpm> | pulse <rhythm> <bpm>");
+      }
+      return addAction(actionPulse, rhythm, BPM);
+    }
+
+    /*
+       compileAir - air normal | air lockjaw irregular stridor agonal
+    */
+    boolean compileAir(char *arg) {
+      const char *const names[] = {"normal", "lockjaw", "irregular", "stridor", "agonal"};
+      int conditions = 0;
+      for (char *word = arg; word != NULL; word = strtok(NULL, " ")) {
+        int i = findWord(word, names, 5);
+        if (i < 0) {
+          return fail("air normal | air lockjaw irregular stridor agonal");
+        }
+        conditions |= 1 << i;
+      }
+      if (conditions == 0 || (conditions & 1 && conditions != 1)) {
+        return fail("air normal | air lockjaw irregular stridor agonal");
+      }
+      return addAction(actionAir, conditions, 0);
+    }
+
+    /*
+       compileLine - compile one line of the file into the tables
+            char *text - the line (it is changed while it is read)
+            return boolean - false if there is a mistake in the line (see getError())
+    */
+    boolean compileLine(char *text) {
+      char *command = strtok(text, " ");
+      if (command == NULL) {
+        return true;   // empty line
+      }
+      char *arg = strtok(NULL, " ");
+      if (strcasecmp(command, "state") == 0) {
+        return compileState(arg);
+      }
+      if (stateNum < 0) {
+        return fail("the first command has to be a state");
+      }
+      if (strcasecmp(command, "on") == 0) {
+        return compileTrigger(arg);
+      } else if (strcasecmp(command, "say") == 0 || strcasecmp(command, "effect") == 0) {
+        boolean isPrompt = strcasecmp(command, "say") == 0;
+        const char *const priorities[] = {"low", "normal", "urgent"};  // same order as promptLow, promptNormal, promptUrgent
+        char *option = strtok(NULL, " ");
+        int priority = option == NULL ? promptNormal : findWord(option, priorities, 3);
+        if (arg == NULL || priority < 0 || (!isPrompt && option != NULL)) {
+          return fail("say <file> [urgent|low] | effect <file>");
+        }
+        int f = findFile(arg, isPrompt);
+        if (f < 0) {
+          return fail("too many files or the name is not 8.3");
+        }
+        return addAction(isPrompt ? actionSay : actionEffect, f, priority);
+      } else if (strcasecmp(command, "stop") == 0) {
+        return addAction(actionStop, 0, 0);
+      } else if (strcasecmp(command, "do") == 0 || strcasecmp(command, "loop") == 0) {
+        int behavior = findHeadBehavior(arg);
+        if (behavior < 0) {
+          return fail("unknown behavior (see headBehaviors.h)");
+        }
+        return addAction(strcasecmp(command, "do") == 0 ? actionDo : actionLoop, behavior, 0);
+      } else if (strcasecmp(command, "pulse") == 0) {
+        return compilePulse(arg);
+      } else if (strcasecmp(command, "air") == 0) {
+        return compileAir(arg);
+      }
+      return fail("unknown command");
+    }
+
+    /*
+       compileFile - read the file one line at a time and compile each line
+            return boolean - false if there is a mistake in the file (see getError())
+    */
+    boolean compileFile(File &file) {
+      char line[maxLineLength + 1];
+      int lineLength = 0;
+      boolean isTooLong = false;
+      boolean isComment = false;   // the rest of the line is a comment and is not kept
+      lineNum = 1;
+      while (true) {
+        int c = file.read();
+        if (c < 0 || c == '\n') {
+          line[lineLength] = '\0';
+          if (isTooLong) {
+            return fail("line is too long");
+          }
+          if (!compileLine(line)) {
+            return false;
+          }
+          if (c < 0) {
+            break;
+          }
+          lineLength = 0;
+          isTooLong = false;
+          isComment = false;
+          lineNum++;
+        } else if (isComment || c == '#') {
+          isComment = true;
+        } else if (lineLength == maxLineLength) {
+          isTooLong = true;
+        } else if (c != '\r') {
+          line[lineLength++] = c == '\t' ? ' ' : c;
+        }
+      }
+      if (numStates == 0) {
+        return fail("there are no states");
+      }
+      for (int s = 0; s < numStates; s++) {
+        if (!states[s].isDefined) {
+          snprintf(error, sizeof(error), "%s: state %s is not defined", filename, states[s].name);
+          return false;
+        }
+      }
+      return true;
+    }
+
+    //************************************************RUNNING********************************
+    /*
+       enterState - go into a state and do its actions
+    */
+    void enterState(int s) {
+      currentState = s;
+      stateStartTime = millis();
+      isTargetSeen = false;
+      Serial.print("Scenario state = "); Serial.println(states[s].name);
+      const ScenarioState &state = states[s];
+      for (int a = state.firstAction; a < state.firstAction + state.numActions; a++) {
+        const ScenarioAction &action = actions[a];
+        switch (action.type) {
+          case actionSay:
+            head->voice.queuePrompt(files[action.arg], action.value);
+            break;
+          case actionEffect:
+            head->sound.playEffect(files[action.arg]);
+            break;
+          case actionStop:
+            head->voice.cancel();
+            break;
+          case actionDo:
+            isActionDone[a] = headBehaviors[action.arg].run(*head);
+            break;
+          case actionPulse:
+            head->setPulseRhythm(action.arg, action.value);
+            break;
+          case actionAir: {
+              boolean airCondition[5];
+              for (int i = 0; i < 5; i++) {
+                airCondition[i] = (action.arg >> i) & 1;
+              }
+              head->setAir(airCondition);
+              break;
+            }
+        }
+      }
+    }
+
+    /*
+       findEventTrigger - find the first trigger of the state that matches an event
+            int type - triggerVoiceStart, triggerVoiceEnd, triggerBargeIn or triggerFsr
+            int sensor, int event - force sensor and event for triggerFsr
+            return int - state to go to, -1 if no trigger matches
+    */
+    int findEventTrigger(int type, int sensor, int event) {
+      const ScenarioState &state = states[currentState];
+      for (int t = state.firstTrigger; t < state.firstTrigger + state.numTriggers; t++) {
+        const ScenarioTrigger &trigger = triggers[t];
+        if (trigger.type == type && (trigger.sensor == scenarioAny || trigger.sensor == sensor)
+            && (trigger.event == scenarioAny || trigger.event == event)) {
+          return trigger.next;
+        }
+      }
+      return -1;
+    }
+
+    /*
+       findTimeTrigger - find the first promptEnd, targetLost or timer trigger of the state that happened
+            return int - state to go to, -1 if none happened
+    */
+    int findTimeTrigger(unsigned long timeNow) {
+      const ScenarioState &state = states[currentState];
+      for (int t = state.firstTrigger; t < state.firstTrigger + state.numTriggers; t++) {
+        const ScenarioTrigger &trigger = triggers[t];
+        if ((trigger.type == triggerPromptEnd && !head->voice.isBusy())
+            || (trigger.type == triggerTargetLost && isTargetSeen && timeNow - lastTargetTime >= trigger.time)
+            || (trigger.type == triggerTimer && timeNow - stateStartTime >= trigger.time)) {
+          return trigger.next;
+        }
+      }
+      return -1;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the scenario
+    Scenario() {
+    }
+
+    /*
+       setUp - give the scenario the head it controls
+    */
+    void setUp(Head &scenarioHead) {
+      head = &scenarioHead;
+    }
+
+    //************************************************LOADING********************************
+    /*
+       load - read a scenario file from the SD card, compile it, cache its prompts and start it from the first state.
+              Run this when the simulation starts (it waits for the SD card). Any prompt or sound effect that
+              is playing is stopped first.
+            const char *name - 8.3 file name in the top folder of the SD card
+            return boolean - false if the file is not there or has a mistake in it (see getError())
+    */
+    boolean load(const char *name) {
+      isLoaded = false;
+      LOC = head->getLOC();
+      numStates = numActions = numTriggers = numFiles = 0;
+      error[0] = '\0';
+      stateNum = -1;
+      lineNum = 0;
+      strncpy(filename, name, sizeof(filename) - 1);
+      filename[sizeof(filename) - 1] = '\0';
+      head->stopSdPlayers();    // the file and the prompts are read from the loop
+      File file = SD.open(filename);
+      if (!file) {
+        snprintf(error, sizeof(error), "%s is not on the SD card", filename);
+        return false;
+      }
+      boolean isCompiled = compileFile(file);
+      file.close();
+      if (!isCompiled) {
+        return false;
+      }
+
+      const char *prompts[maxFiles];
+      int numPrompts = 0;
+      for (int f = 0; f < numFiles; f++) {
+        if (isPromptFile[f]) {
+          prompts[numPrompts++] = files[f];
+        }
+      }
+      head->voice.loadScenario(prompts, numPrompts);
+
+      Serial.print("Loaded scenario "); Serial.print(filename);
+      Serial.print(" states = "); Serial.print(numStates);
+      Serial.print(" actions = "); Serial.print(numActions);
+      Serial.print(" triggers = "); Serial.println(numTriggers);
+      isLoaded = true;
+      start();
+      return true;
+    }
+
+    /*
+       loadForLOC - load the scenario file for the LOC that the head is set to (ALERT.TXT, VERBAL.TXT, PAIN.TXT or UNRESP.TXT)
+            return boolean - false if the file is not there or has a mistake in it (see getError())
+    */
+    boolean loadForLOC() {
+      const char *const locFiles[] = {"ALERT.TXT", "VERBAL.TXT", "PAIN.TXT", "UNRESP.TXT"};
+      int headLOC = head->getLOC();
+      if (headLOC < 0 || headLOC > 3) {
+        LOC = headLOC;
+        snprintf(error, sizeof(error), "no scenario for LOC %d", headLOC);
+        isLoaded = false;
+        return false;
+      }
+      return load(locFiles[headLOC]);
+    }
+
+    /*
+       start - start the scenario from the first state
+    */
+    void start() {
+      if (!isLoaded) {
+        return;
+      }
+      head->voice.cancel();
+      head->mic.clearVoiceEvents();
+      enterState(0);
+    }
+
+    /*
+       isReady - true if a scenario was loaded without mistakes
+    */
+    boolean isReady() {
+      return isLoaded;
+    }
+
+    /*
+       getLOC - LOC of the head when the scenario was last loaded (-1 if nothing was loaded yet)
+    */
+    int getLOC() {
+      return LOC;
+    }
+
+    /*
+       getError - why the last load() did not work
+    */
+    const char *getError() {
+      return error;
+    }
+
+    /*
+       getStateName - name of the state HAL is in
+    */
+    const char *getStateName() {
+      return isLoaded ? states[currentState].name : "";
+    }
+
+    //************************************************UPDATE********************************
+    /*
+       update - run the scenario: the pulse, breathing and voice in the background, the behaviors of the state,
+                then the triggers. Call this every loop (it does not wait).
+    */
+    void update() {
+      if (!isLoaded) {
+        return;
+      }
+      // breathe in the background - the jaw is used for talking while HAL responds and the neck is only free when unresponsive
+      head->pulse.pulseByRhythm(head->getPulseRhythm(), head->getPulseBPM());
+      head->breathing.update(!head->voice.isBusy(), head->getLOC() == 3);
+      head->voice.update();
+      head->sound.update(head->voice.isBusy());
+
+      const ScenarioState &state = states[currentState];
+      for (int a = state.firstAction; a < state.firstAction + state.numActions; a++) {
+        if (actions[a].type == actionLoop) {
+          headBehaviors[actions[a].arg].run(*head);
+        } else if (actions[a].type == actionDo && !isActionDone[a]) {   // keep going until the movement is done
+          isActionDone[a] = headBehaviors[actions[a].arg].run(*head);
+        }
+      }
+
+      // every event is read so old ones are not left for the next state
+      int next = -1;
+      VoiceEvent voiceEvent;
+      while (head->mic.getVoiceEvent(voiceEvent)) {
+        if (next < 0) {
+          int type = voiceEvent.type == voiceStart ? triggerVoiceStart : voiceEvent.type == voiceEnd ? triggerVoiceEnd : triggerBargeIn;
+          next = findEventTrigger(type, scenarioAny, scenarioAny);
+        }
+      }
+      head->fsrArray.update();
+      FsrEvent fsrEvent;
+      while (head->fsrArray.getEvent(fsrEvent)) {
+        if (next < 0) {
+          next = findEventTrigger(triggerFsr, fsrEvent.sensor, fsrEvent.type);
+        }
+      }
+      unsigned long timeNow = millis();
+      if (state.usesCamera) {
+        head->camera.update();
+        Track target;
+        if (head->camera.getTarget(target) && target.missed == 0) {
+          isTargetSeen = true;
+          lastTargetTime = timeNow;
+        }
+      }
+      if (next < 0) {
+        next = findTimeTrigger(timeNow);
+      }
+      if (next >= 0) {
+        enterState(next);
+      }
+    }
+};
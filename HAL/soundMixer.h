@@ -0,0 +1,259 @@
+/**********************************************************************************
+  soundMixer.h
+
+  This file contains the class definition, attributes, and methods of the SoundMixer.
+  All of HAL's sounds go through one mixer (mainMix in pinSetUp.h) with a layer for each
+  kind of sound so they can all play at the same time:
+      layerSpeech    - the voice prompts (see voice.h)
+      layerBreathing - the breathing sounds: airflow, stridor, and gasps (see breathing.h)
+      layerEffects   - other sounds played from the SD card (ex. a cough or a groan)
+  Each layer has its own volume. Changes in volume are ramped so they do not click, and a
+  ramp can be scheduled to start later. The breathing is turned down while HAL talks by a
+  separate duck gain, so it does not cancel a ramp that was set on the breathing layer.
+
+  The breathing and effects layers are also sent to backgroundMix at the same volume, so the
+  voice detector knows what HAL is playing besides his voice (see voiceDetector.h).
+
+  The number of audio blocks for AudioMemory() is added up from the audio objects of the
+  layers in use (see isLayerUsed below), so it has to be changed here when objects are added
+  to pinSetUp.h. A layer that is not used stays muted and its objects are never started.
+ *********************************************************************************/
+#include <Arduino.h>
+
+// LAYERS (channels of mainMix)
+const int layerSpeech = 0;
+const int layerBreathing = 1;
+const int layerEffects = 2;
+const int numSoundLayers = 3;
+
+// LAYERS IN USE (a layer that is not used is left out of the audio memory budget)
+constexpr boolean isLayerUsed[numSoundLayers] = {true, true, true};   // speech, breathing, effects
+
+// AUDIO MEMORY BUDGET (most blocks each object can hold at once)
+constexpr int sdPlayerBlocks = 2;       // AudioPlaySdWav (left and right)
+constexpr int rawPlayerBlocks = 1;      // AudioPlaySerialflashRaw and AudioPlayMemory
+constexpr int mixerBlocks = 1;
+constexpr int amplifierBlocks = 1;
+constexpr int filterBlocks = 3;         // AudioFilterStateVariable (all three outputs)
+constexpr int synthBlocks = 1;          // noise and sine
+constexpr int speechBlocks = 2 * sdPlayerBlocks + 4 * rawPlayerBlocks + 2 * mixerBlocks + amplifierBlocks;  // playWavA/B, playFlashA/B, playMemA/B, promptMix, cacheMix, promptAmp
+constexpr int breathingBlocks = 2 * synthBlocks + filterBlocks + mixerBlocks;  // breathNoise, stridorTone, breathFilter, breathMixer
+constexpr int effectBlocks = sdPlayerBlocks;                                   // playEffect
+constexpr int layerBlocks[numSoundLayers] = {speechBlocks, breathingBlocks, effectBlocks};
+constexpr int micBlocks = 2;                                                   // micInput (one filling, one sent)
+constexpr int outputBlocks = mixerBlocks + 4;                                  // mainMix, dacs1 (two queued per channel)
+constexpr int backgroundBlocks = mixerBlocks;                                  // backgroundMix
+constexpr int spareBlocks = 4;
+
+/*
+   usedLayerBlocks - blocks needed by the layers in use from layer 0 up to a layer
+*/
+constexpr int usedLayerBlocks(int layer) {
+  return layer < 0 ? 0 : (isLayerUsed[layer] ? layerBlocks[layer] : 0) + usedLayerBlocks(layer - 1);
+}
+constexpr int audioMemoryBlocks = usedLayerBlocks(numSoundLayers - 1) + micBlocks + outputBlocks + backgroundBlocks + spareBlocks;
+
+class SoundMixer {
+  private:
+    static const int numLayers = numSoundLayers;
+
+    // GAIN RAMPS
+    struct GainRamp {
+      float startGain;
+      float endGain;
+      unsigned long startTime;  // ms
+      unsigned long rampTime;   // ms
+    };
+    static const int maxScheduled = 4;   // ramps waiting for each layer
+    GainRamp ramps[numLayers];           // ramp that is running
+    GainRamp scheduled[numLayers][maxScheduled];
+    int numScheduled[numLayers] = {0, 0, 0};
+    float gains[numLayers] = {1.0, 1.0, 1.0};
+    float lastSent[numLayers] = {-1, -1, -1};
+
+    // DUCKING THE BREATHING UNDER THE SPEECH (multiplies the layer gain)
+    GainRamp duckRamp;
+    float duckGain = 1.0;
+    const float breathDuckGain = 0.35;
+    const unsigned long duckTime = 150;     // ms
+    const unsigned long unduckTime = 400;   // ms
+    boolean wasSpeaking = false;
+
+    /*
+       startRamp - start a ramp from a gain
+    */
+    void startRamp(GainRamp &ramp, float fromGain, float toGain, unsigned long rampTime, unsigned long startTime) {
+      ramp.startGain = fromGain;
+      ramp.endGain = toGain;
+      ramp.startTime = startTime;
+      ramp.rampTime = rampTime;
+    }
+
+    /*
+       rampGain - gain of a ramp at a time
+    */
+    float rampGain(const GainRamp &ramp, unsigned long timeNow) {
+      unsigned long elapsed = timeNow - ramp.startTime;
+      if (elapsed >= ramp.rampTime) {
+        return ramp.endGain;
+      }
+      return ramp.startGain + (ramp.endGain - ramp.startGain) * elapsed / ramp.rampTime;
+    }
+
+    /*
+       sendGain - set the volume of a layer in mainMix, and in backgroundMix for every layer except the speech
+    */
+    void sendGain(int layer, float gain) {
+      mainMix.gain(layer, gain);
+      if (layer != layerSpeech) {
+        backgroundMix.gain(layer, gain);
+      }
+      lastSent[layer] = gain;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the mixer
+    SoundMixer() {
+    }
+
+    /*
+       setUp - give the audio library the blocks it needs for the layers in use and set every layer in use to full volume
+    */
+    void setUp() {
+      AudioMemory(audioMemoryBlocks);
+      unsigned long timeNow = millis();
+      for (int layer = 0; layer < numLayers; layer++) {
+        gains[layer] = isLayerUsed[layer] ? 1.0 : 0;
+        startRamp(ramps[layer], gains[layer], gains[layer], 0, timeNow);
+        sendGain(layer, gains[layer]);
+      }
+      duckGain = 1.0;
+      startRamp(duckRamp, 1.0, 1.0, 0, timeNow);
+      mainMix.gain(3, 0);
+      backgroundMix.gain(layerSpeech, 0);
+      backgroundMix.gain(3, 0);
+      Serial.print("Initializing Sound Mixer with audio blocks = "); Serial.println(audioMemoryBlocks);
+    }
+
+    /*
+       isUsed - true if a layer is in use (see isLayerUsed above)
+    */
+    boolean isUsed(int layer) {
+      return isLayerUsed[layer];
+    }
+
+    //************************************************VOLUME********************************
+    /*
+       setGain - ramp the volume of a layer (replaces any ramp that is running or waiting)
+            int layer - layerSpeech, layerBreathing, or layerEffects
+            float gain - volume (0 to 1)
+            unsigned long rampTime - time to get to the new volume (ms)
+    */
+    void setGain(int layer, float gain, unsigned long rampTime) {
+      numScheduled[layer] = 0;
+      startRamp(ramps[layer], gains[layer], gain, rampTime, millis());
+    }
+
+    /*
+       scheduleGain - ramp the volume of a layer later (ex. fade the breathing out when a prompt ends)
+            int layer - layerSpeech, layerBreathing, or layerEffects
+            float gain - volume (0 to 1)
+            unsigned long rampTime - time to get to the new volume (ms)
+            unsigned long delayTime - time from now to start the ramp (ms)
+            return boolean - false if too many ramps are waiting
+    */
+    boolean scheduleGain(int layer, float gain, unsigned long rampTime, unsigned long delayTime) {
+      if (numScheduled[layer] == maxScheduled) {
+        return false;
+      }
+      GainRamp &ramp = scheduled[layer][numScheduled[layer]];
+      ramp.endGain = gain;
+      ramp.rampTime = rampTime;
+      ramp.startTime = millis() + delayTime;
+      numScheduled[layer]++;
+      return true;
+    }
+
+    /*
+       getGain - current volume of a layer (before the breathing is ducked)
+    */
+    float getGain(int layer) {
+      return gains[layer];
+    }
+
+    //************************************************EFFECTS********************************
+    /*
+       playEffect - play a sound on the effects layer (it does not wait)
+            const char *filename - file name in ALL CAPS with a ".WAV" at the end
+            return boolean - false if the file could not be opened
+    */
+    boolean playEffect(const char *filename) {
+      if (!isLayerUsed[layerEffects]) {
+        return false;
+      }
+      return playEffectWav.play(filename);
+    }
+
+    /*
+       stopEffect - stop the sound on the effects layer
+    */
+    void stopEffect() {
+      playEffectWav.stop();
+    }
+
+    /*
+       effectPlaying - true if a sound is playing on the effects layer
+    */
+    boolean effectPlaying() {
+      return playEffectWav.isPlaying();
+    }
+
+    //************************************************UPDATE********************************
+    /*
+       update - move the volume ramps along and duck the breathing while HAL talks. Call this every loop (it does not wait).
+            boolean isSpeaking - true while a prompt is playing
+    */
+    void update(boolean isSpeaking) {
+      unsigned long timeNow = millis();
+      if (isSpeaking != wasSpeaking) {
+        wasSpeaking = isSpeaking;
+        startRamp(duckRamp, duckGain, isSpeaking ? breathDuckGain : 1.0, isSpeaking ? duckTime : unduckTime, timeNow);
+      }
+      duckGain = rampGain(duckRamp, timeNow);
+      for (int layer = 0; layer < numLayers; layer++) {
+        // start the next scheduled ramp when it is time
+        for (int i = 0; i < numScheduled[layer]; i++) {
+          GainRamp &ramp = scheduled[layer][i];
+          if ((long)(timeNow - ramp.startTime) >= 0) {
+            startRamp(ramps[layer], gains[layer], ramp.endGain, ramp.rampTime, ramp.startTime);
+            for (int j = i + 1; j < numScheduled[layer]; j++) {
+              scheduled[layer][j - 1] = scheduled[layer][j];
+            }
+            numScheduled[layer]--;
+            break;
+          }
+        }
+        gains[layer] = rampGain(ramps[layer], timeNow);
+        float gain = gains[layer];
+        if (!isLayerUsed[layer]) {
+          gain = 0;
+        } else if (layer == layerBreathing) {
+          gain *= duckGain;
+        }
+        if (gain != lastSent[layer]) {   // only change the mixer when the volume changes
+          sendGain(layer, gain);
+        }
+      }
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       printMemory - print how many audio blocks were used compared to the budget
+    */
+    void printMemory() {
+      Serial.print("Audio blocks used (max) = "); Serial.print(AudioMemoryUsageMax());
+      Serial.print(" of "); Serial.print(audioMemoryBlocks);
+      Serial.print("  CPU (max %) = "); Serial.println(AudioProcessorUsageMax());
+    }
+};
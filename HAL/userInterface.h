@@ -2,10 +2,19 @@
    User interface
       Has overall class definition and private and public functions
 
+      The buttons are read in update() every 20 ms (call it every loop), which also
+      sends the changes on the screen (see lcdBuffer.h). A press only counts once it
+      reads the same twice in a row, and holding an arrow repeats it. The presses go
+      into a small queue. None of the menu functions wait for the user:
+      each one is called every loop and returns "not done" (-1 or NULL) until a choice
+      is made, so HAL keeps moving while the instructor is in a menu and the settings
+      can be changed while the simulation is running.
+
    Edited by Ethan Lauer on 4/8/19
 
  *********************************************************************************/
 #include<Arduino.h>
+#include "lcdBuffer.h"
 
 class Display {
 
@@ -14,7 +23,7 @@ class Display {
     // this is Analog 4 and 5 so you can't use those for analogRead() anymore
     // However, you can connect other I2C sensors to the I2C bus and share
     // the I2C bus.
-    Adafruit_RGBLCDShield lcd = Adafruit_RGBLCDShield();
+    LcdBuffer lcd = LcdBuffer(); // screens are drawn in memory and only the changes are sent (see lcdBuffer.h)
 
     int column;
     int row;
@@ -22,6 +31,76 @@ class Display {
     boolean initRun = true;
     boolean initPulseRun = true;
 
+    // BUTTONS
+    const unsigned long buttonPeriod = 20;   // ms between reads of the buttons
+    const int debounceReads = 2;             // a change has to be read this many times in a row
+    const unsigned long repeatDelay = 500;   // ms an arrow is held before it repeats
+    const unsigned long repeatPeriod = 250;  // ms between repeats
+    const uint8_t arrowButtons = BUTTON_UP | BUTTON_DOWN | BUTTON_LEFT | BUTTON_RIGHT;
+    unsigned long nextButtonTime = 0;
+    unsigned long nextRepeatTime = 0;
+    uint8_t stableButtons = 0;   // buttons that are held down (debounced)
+    uint8_t lastRead = 0;
+    int numSameReads = 0;
+
+    // BUTTON PRESS QUEUE
+    static const int queueSize = 8;  // must be a power of 2
+    uint8_t presses[queueSize];
+    uint8_t pressHead = 0;
+    uint8_t pressTail = 0;
+
+    // MENU STATE
+    boolean isSelecting = false;      // true while the cursor is waiting for a selection
+    int selectColumn;
+    int selectRow;
+    // step of each menu (draw, wait for a choice, show the result) - each menu keeps its own
+    int startSimStep = 0;             // checkStartSim()
+    boolean isSimScreenUp = false;    // checkOpenMenu()
+    int locStep = 0;                  // setLOC()
+    int airState = 0;                 // normAirState to airSetState (see pinSetUp.h)
+    int pulseState = 0;               // certOrRangeState to pulseSetState (see pinSetUp.h)
+    int pulseBPM = 60;
+    int result = 0;
+    unsigned long messageEndTime = 0; // time the "... is Set" message is done (ms)
+
+    /*
+       addPress - put a button press in the queue (the oldest press is dropped if it is full)
+    */
+    void addPress(uint8_t buttons) {
+      if ((uint8_t)(pressHead - pressTail) == queueSize) {
+        pressTail++;
+      }
+      presses[pressHead & (queueSize - 1)] = buttons;
+      pressHead++;
+    }
+
+    /*
+       getPress - take the oldest button press out of the queue
+            return uint8_t - buttons that were pressed, 0 if there are no presses
+    */
+    uint8_t getPress() {
+      if (pressTail == pressHead) {
+        return 0;
+      }
+      uint8_t buttons = presses[pressTail & (queueSize - 1)];
+      pressTail++;
+      return buttons;
+    }
+
+    /*
+       showMessage - keep the current screen up for a moment (it does not wait, see isMessageDone())
+    */
+    void showMessage(unsigned long duration) {
+      messageEndTime = millis() + duration;
+    }
+
+    /*
+       isMessageDone - true once the message has been up long enough
+    */
+    boolean isMessageDone() {
+      return (long)(millis() - messageEndTime) >= 0;
+    }
+
   public:
     Display() {
 
@@ -32,11 +111,67 @@ class Display {
       lcd.setBacklight(WHITE);
       int time = millis();
       lcd.print("Initializing...");
+      lcd.update(true);
       time = millis() - time;
       Serial.println("Initialize Display and Keypad");
       Serial.print("Took "); Serial.print(time); Serial.println(" ms");
       delay(2000);
       reset();
+      nextButtonTime = millis();
+    }
+
+    /*
+       resetMenu - forget where the user was in the menus (ex. when the simulation is started from the console)
+    */
+    void resetMenu() {
+      isSelecting = false;
+      startSimStep = 0;
+      isSimScreenUp = false;
+      locStep = 0;
+      airState = normAirState;
+      pulseState = certOrRangeState;
+    }
+
+    // ************************************************ BUTTONS ******************************************
+
+    /*
+       update - read the buttons if it is time and queue the presses. Call this every loop (it does not wait).
+    */
+    void update() {
+      lcd.update();   // send what changed on the screen if it is time
+      unsigned long timeNow = millis();
+      if ((long)(timeNow - nextButtonTime) < 0) {
+        return;
+      }
+      nextButtonTime += buttonPeriod;
+      if ((long)(timeNow - nextButtonTime) > (long)(4 * buttonPeriod)) {  // the loop was held up, do not try to catch up
+        nextButtonTime = timeNow + buttonPeriod;
+      }
+
+      uint8_t buttons = lcd.readButtons();
+      if (buttons != lastRead) {
+        lastRead = buttons;
+        numSameReads = 1;
+        return;
+      }
+      if (numSameReads < debounceReads) {
+        numSameReads++;
+        if (numSameReads < debounceReads) {
+          return;
+        }
+        uint8_t pressed = buttons & ~stableButtons;
+        stableButtons = buttons;
+        if (pressed) {
+          addPress(pressed);
+          nextRepeatTime = timeNow + repeatDelay;
+        }
+        return;
+      }
+      // holding an arrow repeats it (ex. to scroll the BPM)
+      if ((stableButtons & arrowButtons) && (long)(timeNow - nextRepeatTime) >= 0) {
+        addPress(stableButtons & arrowButtons);
+        nextRepeatTime = timeNow + repeatPeriod;
+      }
     }
 
     // ************************************************ BASIC SCREEN FUNCITONS******************************************
@@ -66,10 +201,16 @@ class Display {
        LOC =  Level of Conciousness
        Air = Airway
        Pulse = Set a pulse
+       boolean isSimRunning - true if the simulation is running, then the top row goes back to it
     */
-    void startScreen() {
+    void startScreen(boolean isSimRunning) {
       reset();
-      lcd.print("Set Med Settings");
+      if (isSimRunning) {
+        lcd.print("Back to Sim Stop");
+        lcd.setBacklight(TEAL);
+      } else {
+        lcd.print("Set Med Settings");
+      }
       lcd.setCursor(0, 1);
       lcd.print("LOC Air Pulse");
       lcd.setCursor(0, 1);
@@ -98,107 +239,164 @@ class Display {
       lcd.setCursor(0, 1);
       lcd.print("Simulation...");
       lcd.setBacklight(GREEN);
-      delay(2000);
+      showMessage(2000);
     }
 
     void dispSimInProgress() {
       reset();
       lcd.noBlink();
       lcd.print("Sim In Progress");
+      lcd.setCursor(0, 1);
+      lcd.print("SELECT=Settings");
       lcd.setBacklight(GREEN);
 
     }
 
     /*
-       checkStartSim - display and check if the user selected to start the simulation or not
-            return true if correct cell was selected
+       startMenu - display the starting screen and check which setting the user selected (it does not wait)
+            boolean isSimRunning - true if the simulation is running
+            return integer array that holds the column and row that was selected, NULL if nothing was selected yet
     */
-    boolean checkStartSim() {
-      boolean result;
-      dispCheckStartSim();
-      cell = checkSelection(false);
-      column = cell[0];
-      row = cell[1];
-      printColumnRow(column, row);
-      if (row == 1 && column == yesCol) {
-        result = true;
-        dispStartSim();
-        dispSimInProgress();
-      } else if (row == 1 && column == noCol) {
-        result = false;
+    int *startMenu(boolean isSimRunning) {
+      if (!isSelecting) {
+        startScreen(isSimRunning);
+        startSelection(false);
+      }
+      return checkSelection();
+    }
+
+    /*
+       checkStartSim - display and check if the user selected to start the simulation or not (it does not wait)
+            return 1 if yes was selected, 0 if no was selected, -1 if nothing was selected yet
+    */
+    int checkStartSim() {
+      switch (startSimStep) {
+        case 0:
+          dispCheckStartSim();
+          startSelection(false);
+          startSimStep = 1;
+          break;
+
+        case 1:
+          cell = checkSelection();
+          if (cell == NULL) {
+            break;
+          }
+          column = cell[0];
+          row = cell[1];
+          printColumnRow(column, row);
+          if (row == 1 && column == yesCol) {
+            dispStartSim();
+            startSimStep = 2;
+          } else if (row == 1 && column == noCol) {
+            startSimStep = 0;
+            return 0;
+          } else {
+            startSelection(false);  // not a choice, keep waiting
+          }
+          break;
+
+        case 2:   // "Starting Simulation..." is up
+          if (isMessageDone()) {
+            dispSimInProgress();
+            startSimStep = 0;
+            return 1;
+          }
+          break;
       }
-      return result;
+      return -1;
     }
 
+    /*
+       checkOpenMenu - display that the simulation is in progress and check if the user wants to change the settings (it does not wait)
+            return boolean - true if SELECT was pressed
+    */
+    boolean checkOpenMenu() {
+      if (!isSimScreenUp) {
+        dispSimInProgress();
+        isSimScreenUp = true;
+      }
+      uint8_t buttons = getPress();
+      if (buttons & BUTTON_SELECT) {
+        isSimScreenUp = false;
+        return true;
+      }
+      return false;
+    }
 
 
     /*
-       checkSelection - determine which cell the user selected return an array [column,row]
+       startSelection - put the blinking cursor at the first cell. checkSelection() then moves it with the arrows.
             boolean isPulseSelection - true if this is the pulse selection in which case the starting cursor is in at a differnt location
-            return integer array that holds the column and row that was selected
     */
-    int *checkSelection(boolean isPulseSelection) {
-      int column;
-      int row;
+    void startSelection(boolean isPulseSelection) {
       if (isPulseSelection) {
-        column = 12;
-        row = 0;
+        selectColumn = 12;
+        selectRow = 0;
       } else {
-        column = 0;
-        row = 1;
+        selectColumn = 0;
+        selectRow = 1;
       }
+      while (getPress() != 0) {  // forget presses from the last screen
+      }
+      if (initRun) {
+        Serial.println("waiting for selection");
+        initRun = false;
+      }
+      lcd.setCursor(selectColumn, selectRow);
+      lcd.blink();
+      isSelecting = true;
+    }
 
-      lcd.setCursor(column, row);
-      uint8_t buttons = lcd.readButtons();
-
-      // while the user has not pressed the SELECT button
-      //if they press left or right button, move the cursor to a specific column
-
-      //      unsigned long timeNow = millis();
-      int milliseconds = 250;
-
-      while ( !(buttons & BUTTON_SELECT)) {
-        if (initRun) {
-          Serial.println("waiting for selection");
-          initRun = false;
-        }
-        buttons = lcd.readButtons();
-        if ((buttons & BUTTON_RIGHT) && column < 16) {
-          delay(milliseconds);
-          column++;
+    /*
+       checkSelection - move the cursor with the arrow buttons and check if the user selected a cell (it does not wait)
+            return integer array that holds the column and row that was selected, NULL if SELECT was not pressed yet
+    */
+    int *checkSelection() {
+      uint8_t buttons;
+      while ((buttons = getPress()) != 0) {
+        //if they press left or right button, move the cursor to a specific column
+        if ((buttons & BUTTON_RIGHT) && selectColumn < 16) {
+          selectColumn++;
         }
-        if ((buttons & BUTTON_LEFT) && column > 0) {
-          delay(milliseconds);
-          column--;
+        if ((buttons & BUTTON_LEFT) && selectColumn > 0) {
+          selectColumn--;
         }
         if ((buttons & BUTTON_DOWN) || (buttons & BUTTON_UP)) {
-          delay(milliseconds);
-          row = !row;
+          selectRow = !selectRow;
+        }
+        lcd.setCursor(selectColumn, selectRow);
+
+        if (buttons & BUTTON_SELECT) {
+          initRun = true;
+          isSelecting = false;
+          static int result[2];
+          result[0] = selectColumn;
+          result[1] = selectRow;
+          return result;
         }
-
-        lcd.setCursor(column, row);
-        lcd.blink();
       }
-      initRun = true;
-      static int result[2];
-      result[0] = column;
-      result[1] = row;
-
-      return result;
+      return NULL;
     }
 
 
 
     /*
-      checkIfChangeSettings  checks if you want to actually change the previously set settings
+      checkIfChangeSettings  checks if you want to actually change the previously set settings (it does not wait)
             int medState  =is the state to that you want to adjust or switch to
             String medSetting = this is used for printing to the serial monitor ********CAN REMOVE LATER ON ONCE TESTING WITH
-            return integer that coorespons with the medical state or with the start menue
+            return integer that coorespons with the medical state or with the start menue, -1 if nothing was selected yet
     */
     int checkIfChangeSettings(int medState, String medSetting) {
-      int state = 12; // setting arbitrary value since arduino was giving an error
-      dispChangeSet();
-      cell = checkSelection(false);
+      if (!isSelecting) {
+        dispChangeSet();
+        startSelection(false);
+      }
+      cell = checkSelection();
+      if (cell == NULL) {
+        return -1;
+      }
+      int state = -1;
       column = cell[0];
       row = cell[1];
       printColumnRow(column, row);
@@ -228,44 +426,67 @@ class Display {
       lcd.home();
       lcd.print("LOC is Set");
       lcd.setBacklight(GREEN);
-      delay(1500);
+      showMessage(1500);
     }
 
 
     /*
-      setLOC - set the level of conciousness
-          return integer -the level of conciousness that will be passed to the head as a parameter
+      setLOC - set the level of conciousness (it does not wait)
+          return integer -the level of conciousness that will be passed to the head as a parameter, -1 if it is not set yet
     */
     int setLOC() {
-      Serial.println("Set  LOC");
-      dispLOCOptions();
-      cell = checkSelection(false);
-      column = cell[0];
-      row = cell[1];
-      printColumnRow(column, row);
-      int result;
-
-      if (row == 0) {
-        Serial.println("Wrong row.");
-      } else if (column == alertCell) {
-        Serial.println("Set as Alert");
-        result = 0;
-      } else if (column == verbalCell) {
-        Serial.println("Set as Verbal");
-        result = 1;
-
-      } else if (column == painCell) {
-        Serial.println("Set as Pain");
-        result = 2;
-
-      } else if (column == unrespCell) {
-        Serial.println("Set as Unresponsive");
-        result = 3;
+      switch (locStep) {
+        case 0:
+          Serial.println("Set  LOC");
+          dispLOCOptions();
+          startSelection(false);
+          locStep = 1;
+          break;
+
+        case 1:
+          cell = checkSelection();
+          if (cell == NULL) {
+            break;
+          }
+          column = cell[0];
+          row = cell[1];
+          printColumnRow(column, row);
+          if (row == 0) {
+            Serial.println("Wrong row.");
+            startSelection(false);
+            break;
+          } else if (column == alertCell) {
+            Serial.println("Set as Alert");
+            result = 0;
+          } else if (column == verbalCell) {
+            Serial.println("Set as Verbal");
+            result = 1;
+
+          } else if (column == painCell) {
+            Serial.println("Set as Pain");
+            result = 2;
+
+          } else if (column == unrespCell) {
+            Serial.println("Set as Unresponsive");
+            result = 3;
+
+          } else {
+            startSelection(false);  // not a choice, keep waiting
+            break;
+          }
+          dispLOCSet();
+          locStep = 2;
+          break;
 
+        case 2:   // "LOC is Set" is up
+          if (isMessageDone()) {
+            Serial.println("Back to Main Menu");
+            locStep = 0;
+            return result;
+          }
+          break;
       }
-      dispLOCSet();
-      Serial.println("Back to Main Menu");
-      return result;
+      return -1;
     }
 
     //****************************************************************** AIRWAY SETTING *********************************
@@ -312,18 +533,38 @@ class Display {
       lcd.home();
       lcd.print("Air is Set");
       lcd.setBacklight(GREEN);
-      delay(1500);
+      showMessage(1500);
 
     }
 
 
+    /*
+       selectYesNo - show a yes or no question and check the answer (it does not wait)
+            return 1 if yes was selected, 0 if no was selected, -1 if nothing was selected yet
+    */
+    int selectYesNo() {
+      cell = checkSelection();
+      if (cell == NULL) {
+        return -1;
+      }
+      column = cell[0];
+      row = cell[1];
+      printColumnRow(column, row);
+      if (row == 1 && column == yesCol) {
+        return 1;
+      } else if (row == 1 && column == noCol) {
+        return 0;
+      }
+      startSelection(false);  // not a choice, keep waiting
+      return -1;
+    }
 
 
 
     /*
 
-      setAirway - sets the airway fnctions
-         return the array of booleans for the head
+      setAirway - sets the airway fnctions (it does not wait)
+         return the array of booleans for the head, NULL if it is not set yet
                 int normAirState=0;
                 int lockJawState=1;
                 int irrBreathState=2;
@@ -333,106 +574,110 @@ class Display {
     */
     boolean *setAirway() {
       static boolean result[5];
-      Serial.println("Set  Airway");
+      int answer;
 
-      int state = normAirState;
-      while (state != 6) {
-        switch (state) {
-          case 0:           //normAirState:
+      if (!isSelecting && airState < airSetState) {   // show the question for this state
+        switch (airState) {
+          case 0:
+            Serial.println("Set  Airway");
             dispAirNorm();
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-            if (row == 1 && column == yesCol) {
-              result[0] = true;
-              state = airSetState;
-            } else if (row == 1 && column == noCol) {
-              result[0] = false;
-              state = lockJawState;
-            }
             break;
-
-          case 1:           //lockJawState:
+          case 1:
             dispLockJaw();
             Serial.println("In Lock Jaw");
-
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-            if (row == 1 && column == yesCol) {
-              Serial.println("Selected Yes");
-
-              result[1] = true;
-              state = irrBreathState;
-            } else if (row == 1 && column == noCol) {
-              result[1] = false;
-              state = irrBreathState;
-            }
             break;
-
-          case 2:         //irrBreathState:
+          case 2:
             dispIrrBreath();
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-            if (row == 1 && column == yesCol) {
-              result[2] = true;
-              state = stridBreathState;
-            } else if (row == 1 && column == noCol) {
-              result[2] = false;
-              state = stridBreathState;
-            }
             break;
-
-          case 3:       //stridBreathState:
+          case 3:
             dispStridBreath();
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-            if (row == 1 && column == yesCol) {
-              result[3] = true;
-              state = airSetState;
-            } else if (row == 1 && column == noCol) {
-              result[3] = false;
-              if (result[2] == true) {
-                state = airSetState;
-              } else {
-                state = agonGaspState;
-              }
-            }
             break;
-
-          case 4:             //agonGaspState:
+          case 4:
             dispAgonGasp();
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-            if (row == 1 && column == yesCol) {
-              result[4] = true;
-              state = airSetState;
-            } else if (row == 1 && column == noCol) {
-              result[4] = false;
-              if (result[0] == false && result[1] == false && result[2] == false && result[3] == false) {
-//                boolean newResult[] = {true};
-                result[0] = true;
-              }
-              state = airSetState;
-            }
-            break;
-          case 5:             //airSetState:
-            dispAirSet();
-            state = 6;
-            Serial.println("State is 6: break out of airway selection");
             break;
-
         }
+        startSelection(false);
       }
-      return result;
+
+      switch (airState) {
+        case 0:           //normAirState:
+          answer = selectYesNo();
+          if (answer == 1) {
+            result[0] = true;
+            airState = airSetState;
+          } else if (answer == 0) {
+            result[0] = false;
+            airState = lockJawState;
+          }
+          break;
+
+        case 1:           //lockJawState:
+          answer = selectYesNo();
+          if (answer == 1) {
+            Serial.println("Selected Yes");
+
+            result[1] = true;
+            airState = irrBreathState;
+          } else if (answer == 0) {
+            result[1] = false;
+            airState = irrBreathState;
+          }
+          break;
+
+        case 2:         //irrBreathState:
+          answer = selectYesNo();
+          if (answer == 1) {
+            result[2] = true;
+            airState = stridBreathState;
+          } else if (answer == 0) {
+            result[2] = false;
+            airState = stridBreathState;
+          }
+          break;
+
+        case 3:       //stridBreathState:
+          answer = selectYesNo();
+          if (answer == 1) {
+            result[3] = true;
+            airState = airSetState;
+          } else if (answer == 0) {
+            result[3] = false;
+            if (result[2] == true) {
+              airState = airSetState;
+            } else {
+              airState = agonGaspState;
+            }
+          }
+          break;
+
+        case 4:             //agonGaspState:
+          answer = selectYesNo();
+          if (answer == 1) {
+            result[4] = true;
+            airState = airSetState;
+          } else if (answer == 0) {
+            result[4] = false;
+            if (result[0] == false && result[1] == false && result[2] == false && result[3] == false) {
+              result[0] = true;
+            }
+            airState = airSetState;
+          }
+          break;
+
+        case 5:             //airSetState:
+          dispAirSet();
+          airState = 6;
+          break;
+
+        case 6:             // "Air is Set" is up
+          if (isMessageDone()) {
+            Serial.println("State is 6: break out of airway selection");
+            airState = normAirState;
+            return result;
+          }
+          break;
+      }
+      return NULL;
     }
 
 
@@ -472,8 +717,8 @@ class Display {
         reset();
         initPulseRun = false;
       } else {
-        lcd.setCursor(0, 0);
-        lcd.print("     ");
+        lcd.setCursor(0, 1);
+        lcd.print("   ");
       }
       lcd.home();
       lcd.print("Input BPM");
@@ -488,38 +733,37 @@ class Display {
       lcd.noBlink();
       lcd.print("Pulse is Set");
       lcd.setBacklight(GREEN);
-      delay(1500);
+      showMessage(1500);
 
     }
 
     /*
-       manually adjust the pulse using the up and down arrow keys
+       manually adjust the pulse using the up and down arrow keys (it does not wait)
+            return boolean - true once SELECT is pressed, the pulse is in pulseBPM
     */
-    int manualAdjustPulse() {
-      int pulse = 60;
-      uint8_t buttons = lcd.readButtons();
-
-      while (!(buttons & BUTTON_SELECT)) {
-        buttons = lcd.readButtons();
-
-        if ((buttons & BUTTON_UP) && (pulse < 220)) {
-          delay(250);
-          pulse++;
+    boolean manualAdjustPulse() {
+      uint8_t buttons;
+      while ((buttons = getPress()) != 0) {
+        if ((buttons & BUTTON_UP) && (pulseBPM < 220)) {
+          pulseBPM++;
+          dispPulseNum(pulseBPM);
         }
-        if ((buttons & BUTTON_DOWN) && (pulse > 0)) {
-          delay(250);
-          pulse--;
+        if ((buttons & BUTTON_DOWN) && (pulseBPM > 0)) {
+          pulseBPM--;
+          dispPulseNum(pulseBPM);
+        }
+        if (buttons & BUTTON_SELECT) {
+          return true;
         }
-        dispPulseNum(pulse);
       }
-      return pulse;
+      return false;
     }
 
 
 
     /*
-      setPulse- set the pulse
-          return an array that will tell the head what settings/pulse to have
+      setPulse- set the pulse (it does not wait)
+          return an array that will tell the head what settings/pulse to have, NULL if it is not set yet
             first index is if it was set by certain bumber or by range
             second index is the actual number produced
 
@@ -529,81 +773,100 @@ class Display {
             int pulseSetState=3;
     */
     int *setPulse() {
-      Serial.println("Set Pulse");
-      int state = certOrRangeState;
       static int result[2];
 
-      while (state != 4) {
-
-        switch (state) {
-          case 0:       //certain or range state
+      switch (pulseState) {
+        case 0:       //certain or range state
+          if (!isSelecting) {
+            Serial.println("Set Pulse");
             dispPulseOptions();
             Serial.println("Checking for pulse options");
-            cell = checkSelection(true); // contains a while loop
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-
-            if (row == certainBPMYes[0] && column == certainBPMYes[1] ) {   // set a specific BPM
-              Serial.println("Change state to seting a certain BPM");
-
-              state = certState;
-            } else if (row == rangeBPMYes[0] && column == rangeBPMYes[1] ) { //set a range bpm
-              Serial.println("Change state to seting a range BPM");
-
-              state = rangeState;
-            }
+            startSelection(true);
+          }
+          cell = checkSelection();
+          if (cell == NULL) {
             break;
-
-          case 1:     //certain bpm state
-            result[0] = 0;
+          }
+          column = cell[0];
+          row = cell[1];
+          printColumnRow(column, row);
+
+          if (row == certainBPMYes[0] && column == certainBPMYes[1] ) {   // set a specific BPM
+            Serial.println("Change state to seting a certain BPM");
+            initPulseRun = true;
+            pulseBPM = 60;
+            dispPulseNum(pulseBPM);
+            while (getPress() != 0) {  // forget presses from the last screen
+            }
+            pulseState = certState;
+          } else if (row == rangeBPMYes[0] && column == rangeBPMYes[1] ) { //set a range bpm
+            Serial.println("Change state to seting a range BPM");
+
+            pulseState = rangeState;
+          } else {
+            startSelection(true);  // not a choice, keep waiting
+          }
+          break;
+
+        case 1:     //certain bpm state
+          if (manualAdjustPulse()) {
             Serial.println("Setting a certain BPM");
-            dispPulseNum(60);
-            int desiredPulseBPM;
-            desiredPulseBPM = manualAdjustPulse();
-            result[1] = desiredPulseBPM;
-            state =  pulseSetState;
-            break;
+            result[0] = 0;
+            result[1] = pulseBPM;
+            pulseState = pulseSetState;
+          }
+          break;
 
-          case 2:     ///range bpm
-            result[0] = 1;
+        case 2:     ///range bpm
+          if (!isSelecting) {
             Serial.println("Setting a BPM Range");
             dispPulseRanges();
-            cell = checkSelection(false);
-            column = cell[0];
-            row = cell[1];
-            printColumnRow(column, row);
-
-            if (row == 0) {
-              //              delay(250);
-              Serial.println("Wrong row.");
-            } else if (column == normRangeCell) {
-              //              delay(250);
-              result[1] = 0;
-              Serial.println("Set Pulse as Normal.");
-            } else if (column == fastRangeCell) {
-              //              delay(250);
-              result[1] = 1;
-              Serial.println("Set Pulse as Fast.");
-            } else if (column == slowRangeCell) {
-              //              delay(250);
-              result[1] = 2;
-              Serial.println("Set Pulse as Slow.");
-            }
-            //            delay(250);
-            Serial.println("Back to Main Menu");
-            state = pulseSetState;
+            startSelection(false);
+          }
+          cell = checkSelection();
+          if (cell == NULL) {
             break;
-
-          case 3:       //bpm is set
-            Serial.println("Pulse Set");
-            dispPulseSet();
-            state = 4;
+          }
+          column = cell[0];
+          row = cell[1];
+          printColumnRow(column, row);
+          result[0] = 1;
+
+          if (row == 0) {
+            Serial.println("Wrong row.");
+            startSelection(false);
             break;
-
-        }
+          } else if (column == normRangeCell) {
+            result[1] = 0;
+            Serial.println("Set Pulse as Normal.");
+          } else if (column == fastRangeCell) {
+            result[1] = 1;
+            Serial.println("Set Pulse as Fast.");
+          } else if (column == slowRangeCell) {
+            result[1] = 2;
+            Serial.println("Set Pulse as Slow.");
+          } else {
+            startSelection(false);  // not a choice, keep waiting
+            break;
+          }
+          Serial.println("Back to Main Menu");
+          pulseState = pulseSetState;
+          break;
+
+        case 3:       //bpm is set
+          Serial.println("Pulse Set");
+          dispPulseSet();
+          pulseState = 4;
+          break;
+
+        case 4:       // "Pulse is Set" is up
+          if (isMessageDone()) {
+            pulseState = certOrRangeState;
+            return result;
+          }
+          break;
       }
-      return result;
+      return NULL;
     }
 
 };
@@ -4,10 +4,204 @@
    Modified from "WaveFilePlayer.ino" Example from Teensy Audio Library
    Edited by Ethan Lauer on 2/8/20
 
+      The prompts are played from a queue so the loop never waits for the audio. Call
+      update() every loop (stillPlaying() also calls it). Each prompt has a priority:
+          promptLow    - idle sounds, dropped if something else is waiting
+          promptNormal - dialogue, played in the order it was queued
+          promptUrgent - pain yells, cuts off the prompt that is playing
+      There are two SD players (see pinSetUp.h). While one plays, the next prompt in the
+      queue is started on the other player just before the current one ends so there is no
+      gap. The SD players read the card in the audio interrupt, so they are stopped before the
+      loop reads it (loading a scenario or caching prompts, see Head::stopSdPlayers()).
+      A callback can be given with a prompt to find out when it finished or was cancelled.
+      Prompts that were cached with loadScenario() start from the serial flash or RAM
+      instead of the SD card (see promptCache.h).
+
  *********************************************************************************/
+#include "promptCache.h" // include the serial flash and RAM prompt cache
+
+// PROMPT PRIORITIES
+const int promptLow = 0;
+const int promptNormal = 1;
+const int promptUrgent = 2;
 
+// Called when a prompt finishes (isFinished = true) or is cancelled or cannot be played (isFinished = false)
+typedef void (*PromptCallback)(void *context, const char *filename, boolean isFinished);
 
 class Voice {
+  private:
+    const float bargeInGain = 0.1; // volume of a prompt after someone talks over HAL (see voiceDetector.h)
+
+    // PROMPTS
+    struct Prompt {
+      char filename[13];          // 8.3 file name
+      int priority;
+      PromptCallback callback;
+      void *context;
+      unsigned long queueTime;    // time the prompt was queued (us)
+    };
+    static const int queueSize = 8;
+    Prompt queue[queueSize];
+    int numQueued = 0;
+
+    // PLAYERS (see pinSetUp.h) - each of the two slots has an SD, a flash, and a RAM player
+    AudioPlaySdWav *players[2] = {&playWavA, &playWavB};
+    AudioPlaySerialflashRaw *flashPlayers[2] = {&playFlashA, &playFlashB};
+    AudioPlayMemory *ramPlayers[2] = {&playMemA, &playMemB};
+    int source[2] = {promptFromSd, promptFromSd};   // player that is being used in each slot
+    PromptCache cache = PromptCache();
+    Prompt playing[2];            // prompt on each player
+    boolean isActive[2] = {false, false};
+    int current = 0;              // player of the prompt that is playing now
+    const unsigned long handoffTime = 6;         // start the next prompt this long before the current one ends (ms) - about 2 audio blocks for the header
+
+    // RESULTS
+    unsigned long lastStartLatency = 0;  // time from queueing the last prompt to it playing (us)
+    unsigned long numPlayed = 0;
+    unsigned long numFailed = 0;
+    boolean isUpdating = false;          // true inside update() so a callback that queues a prompt does not start it twice
+
+    /*
+       finish - tell the callback that a prompt is done
+    */
+    void finish(Prompt &prompt, boolean isFinished) {
+      if (!isFinished) {
+        numFailed++;
+      }
+      if (prompt.callback != NULL) {
+        prompt.callback(prompt.context, prompt.filename, isFinished);
+      }
+    }
+
+    /*
+       popPrompt - take the first prompt out of the queue
+    */
+    Prompt popPrompt() {
+      Prompt prompt = queue[0];
+      for (int i = 1; i < numQueued; i++) {
+        queue[i - 1] = queue[i];
+      }
+      numQueued--;
+      return prompt;
+    }
+
+    /*
+       slotPlay - start a file on the player of a slot that matches where it is cached
+            return boolean - false if the file could not be opened
+    */
+    boolean slotPlay(int p, const char *filename) {
+      const PromptCacheEntry *entry = cache.find(filename);
+      source[p] = entry == NULL ? promptFromSd : entry->location;
+      if (source[p] == promptFromRam) {
+        ramPlayers[p]->play(entry->ramClip);
+        return true;
+      } else if (source[p] == promptFromFlash) {
+        return flashPlayers[p]->play(entry->flashName);
+      }
+      return players[p]->play(filename);
+    }
+
+    /*
+       slotIsPlaying - check if the player of a slot is playing
+    */
+    boolean slotIsPlaying(int p) {
+      if (source[p] == promptFromRam) {
+        return ramPlayers[p]->isPlaying();
+      } else if (source[p] == promptFromFlash) {
+        return flashPlayers[p]->isPlaying();
+      }
+      return players[p]->isPlaying();
+    }
+
+    /*
+       slotStop - stop the player of a slot
+    */
+    void slotStop(int p) {
+      if (source[p] == promptFromRam) {
+        ramPlayers[p]->stop();
+      } else if (source[p] == promptFromFlash) {
+        flashPlayers[p]->stop();
+      } else {
+        players[p]->stop();
+      }
+    }
+
+    /*
+       slotTimeLeft - time until the player of a slot finishes (ms), 0 if it is not known yet
+    */
+    unsigned long slotTimeLeft(int p) {
+      unsigned long length;
+      unsigned long position;
+      if (source[p] == promptFromRam) {
+        length = ramPlayers[p]->lengthMillis();
+        position = ramPlayers[p]->positionMillis();
+      } else if (source[p] == promptFromFlash) {
+        length = flashPlayers[p]->lengthMillis();
+        position = flashPlayers[p]->positionMillis();
+      } else {
+        length = players[p]->lengthMillis();
+        position = players[p]->positionMillis();
+      }
+      return length > position ? length - position : 0;
+    }
+
+    /*
+       startNext - start the first prompt in the queue on a player
+            int p - player index
+    */
+    void startNext(int p) {
+      playing[p] = popPrompt();
+      isActive[p] = slotPlay(p, playing[p].filename);
+      if (isActive[p]) {
+        unduck();   // a new prompt starts at full volume even if the last one was turned down by a barge-in
+        lastStartLatency = micros() - playing[p].queueTime;
+        cache.recordStart(source[p], lastStartLatency);
+      } else {
+        Serial.print("Unable to open prompt: "); Serial.println(playing[p].filename);
+        finish(playing[p], false);   // the file could not be opened
+      }
+    }
+
+    /*
+       stopPlayer - stop a player and cancel its prompt
+    */
+    void stopPlayer(int p) {
+      if (isActive[p]) {
+        slotStop(p);
+        isActive[p] = false;
+        finish(playing[p], false);
+      }
+      unduck();
+    }
+
+    /*
+       step - start and hand off the prompts
+    */
+    void step() {
+      int other = 1 - current;
+      // the current prompt ended
+      if (isActive[current] && !slotIsPlaying(current)) {
+        isActive[current] = false;
+        numPlayed++;
+        finish(playing[current], true);
+      }
+      // the next prompt was handed off to the other player
+      if (!isActive[current] && isActive[other]) {
+        current = other;
+        other = 1 - current;
+      }
+      if (numQueued == 0) {
+        return;
+      }
+      if (!isActive[current]) {   // nothing is playing, start right away
+        startNext(current);
+      } else if (!isActive[other]) {   // start the next prompt just before the current one ends so there is no gap
+        unsigned long timeLeft = slotTimeLeft(current);
+        if (timeLeft > 0 && timeLeft <= handoffTime) {
+          startNext(other);
+        }
+      }
+    }
 
   public:
     //************************************************************INITIALIZE AND SET UP********************************
@@ -17,62 +211,194 @@ class Voice {
     }
 
     void setUp() {
-      AudioMemory(8);
+      voiceDetect.setPromptAmp(promptAmp, bargeInGain); // turn the prompt down if someone talks over HAL
+      promptMix.gain(0, 1.0);
+      promptMix.gain(1, 1.0);
+      promptMix.gain(2, 1.0);   // cached prompts
       while (!SD.begin(SDCARD_CS_PIN)) {
         Serial.println("Unable to access the SD card");
         delay(500);
       }
+      cache.setUp(flashCSPin);
       // insert a "play file loop ( "setupNoise");
     }
 
+    //************************************************************PROMPT QUEUE********************************
+
+    /*
+       queuePrompt - add a prompt to the queue. It starts in update() when it is its turn.
+            const char *filename - file name in ALL CAPS with a ".WAV" at the end
+            int priority - promptLow, promptNormal, or promptUrgent
+            PromptCallback callback - function called when the prompt is done (can be NULL)
+            void *context - passed to the callback
+            return boolean - false if the queue is full or a low priority prompt was dropped
+    */
+    boolean queuePrompt(const char *filename, int priority, PromptCallback callback = NULL, void *context = NULL) {
+      if (priority == promptLow && (numQueued > 0 || isBusy())) {
+        return false;   // idle sounds only play when nothing else is
+      }
+      if (priority == promptUrgent) {
+        stopPlayer(0);
+        stopPlayer(1);
+      }
+      if (numQueued == queueSize) {
+        return false;
+      }
+      // keep the queue sorted by priority (first in, first out for the same priority)
+      int i = numQueued;
+      while (i > 0 && queue[i - 1].priority < priority) {
+        queue[i] = queue[i - 1];
+        i--;
+      }
+      strncpy(queue[i].filename, filename, sizeof(queue[i].filename) - 1);
+      queue[i].filename[sizeof(queue[i].filename) - 1] = '\0';
+      queue[i].priority = priority;
+      queue[i].callback = callback;
+      queue[i].context = context;
+      queue[i].queueTime = micros();
+      numQueued++;
+      update();
+      return true;
+    }
+
+    /*
+       update - start and hand off the prompts. Call this every loop (it does not wait).
+    */
+    void update() {
+      if (isUpdating) {
+        return;
+      }
+      isUpdating = true;
+      step();
+      isUpdating = false;
+    }
+
+    /*
+       cancel - stop the prompt that is playing and empty the queue
+    */
+    void cancel() {
+      while (numQueued > 0) {
+        Prompt prompt = popPrompt();
+        finish(prompt, false);
+      }
+      stopPlayer(0);
+      stopPlayer(1);
+    }
+
+    /*
+       cancelCurrent - stop the prompt that is playing. The next one in the queue starts in update().
+    */
+    void cancelCurrent() {
+      stopPlayer(current);
+    }
+
+    /*
+       duck - turn the prompts down (ex. while someone else is talking). The volume goes back up when the next prompt starts
+              or the prompt is stopped.
+            float gain - volume from 0 to 1
+    */
+    void duck(float gain) {
+      voiceDetect.setOutputGain(gain);
+    }
+
+    /*
+       unduck - turn the prompts back to full volume
+    */
+    void unduck() {
+      voiceDetect.setOutputGain(1.0);
+    }
+
+    /*
+       isBusy - true if a prompt is playing or waiting in the queue
+    */
+    boolean isBusy() {
+      return isActive[0] || isActive[1] || numQueued > 0;
+    }
+
+    /*
+       getStartLatency - time from queueing the last prompt to it starting (us)
+    */
+    unsigned long getStartLatency() {
+      return lastStartLatency;
+    }
+
+    /*
+       loadScenario - copy the prompts a scenario uses into the cache so they start without waiting for the SD card.
+                      Run this when the scenario starts (it waits for the copies). See promptCache.h.
+            const char *filenames[] - WAV files on the SD card
+            int count - number of files
+    */
+    void loadScenario(const char *filenames[], int count) {
+      cache.loadScenario(filenames, count);
+    }
+
+    /*
+       isCached - true if a prompt starts from the serial flash or RAM instead of the SD card
+    */
+    boolean isCached(const char *filename) {
+      return cache.find(filename) != NULL;
+    }
+
+    /*
+       printCacheReport - print the cache hits and misses and the start latency of the prompts
+    */
+    void printCacheReport() {
+      cache.printReport();
+    }
+
+    /*
+       getNumPlayed - number of prompts that played to the end
+    */
+    unsigned long getNumPlayed() {
+      return numPlayed;
+    }
+
+    /*
+       getNumFailed - number of prompts that were cancelled or could not be opened
+    */
+    unsigned long getNumFailed() {
+      return numFailed;
+    }
+
     //************************************************************OTHER FUNCTIONS********************************
 
     /*
        playFileLoop - given a file name in ALL CAPS with a ".WAV" at the end, play the file until it is completely finished
-                      note: this uses a while loop until the piece is done playing
+                      note: this waits until the piece is done playing
                 const char *filename - input of the file name
     */
     void playFileLoop(const char *filename) {
-      Serial.print("Playing file: ");
-      Serial.println(filename);
-
-      // Start playing the file.  This sketch continues to
-      // run while the file plays.
-      playWav.play(filename);
-
-      // A brief delay for the library read WAV info
-      delay(5);
-
-      // Simply wait for the file to finish playing.
-      while (playWav.isPlaying()) {
-        Serial.print("STILL Playing file: ");
-//        Serial.println(filename);
-//        delay(500);
+      playFile(filename);
+      while (isBusy()) {
+        update();
       }
     }
 
     /*
-       playFile - given a file name ALL CAPS with a ".WAV" at the end, play the file
-                  check to see if the file is playing at the beginning of the function
-                  if it is still playing, then do nothing.
+       playFile - given a file name ALL CAPS with a ".WAV" at the end, play the file at full volume.
+                  The file is queued after anything that is already playing (it does not wait).
               INPUT: const char *filename - input of the file name
     */
     void playFile(const char *filename) {
       Serial.print("Playing file: ");
       Serial.println(filename);
-      // Start playing the file.  This sketch continues to
-      // run while the file plays.
-      playWav.play(filename);
-      // A brief delay for the library read WAV info
-      delay(5);
+      queuePrompt(filename, promptNormal);
+    }
+
+    /*
+        stop - stop the prompt that is playing and the ones waiting (ex. when someone talks over HAL)
+    */
+    void stop() {
+      cancel();
     }
 
 
     /*
-        stillPlaying - return true if the audio is still playing, return false if it is not playing
+        stillPlaying - return true if the audio is still playing or waiting to play, return false if it is done
     */
     boolean stillPlaying() {
-      return playWav.isPlaying();
+      update();
+      return isBusy();
     }
 
 };
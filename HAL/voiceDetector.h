@@ -0,0 +1,502 @@
+/**********************************************************************************
+  voiceDetector.h
+
+  This file contains the class definition, attributes, and methods of the VoiceDetector.
+  The VoiceDetector is an object in the Teensy audio library graph (see pinSetUp.h), so
+  the microphone is sampled by the audio library at 44.1 kHz instead of one analogRead()
+  per loop. Every block of 128 samples (2.9 ms) it finds:
+      - the RMS level of the block
+      - the zero crossing rate (speech is low, hiss and clicks are high)
+      - the spectral flux (how much the sound changed since the last block) using the
+        energy in 8 speech bands from 250 Hz to 3.4 kHz (Goertzel filters)
+  A block is speech if it does not look like hiss and it is well above the noise floor
+  (or a little above the noise floor and the spectrum suddenly changed). The noise
+  floor follows quiet sounds quickly and loud sounds slowly, so a fan or the room does
+  not count as talking. Talking has to last a few blocks before it starts, and it only
+  ends after a hangover time with no speech (the pauses between words).
+
+  The detector keeps listening while HAL is talking. The second input is the prompt that
+  is being played (see pinSetUp.h), so the detector knows how loud HAL's own voice is.
+  The level of HAL's voice at the microphone (the echo) is learned at the start of the
+  first prompt and kept up to date during every prompt after it, and it is added to the
+  noise floor so HAL does not hear himself. If someone talks over HAL anyway (barge-in),
+  the prompt is turned down right away in the audio interrupt (about 20 ms) and a
+  barge-in event is sent so the loop can stop the prompt.
+
+  The breathing sounds (see breathing.h) are low and tonal like a voice, so they would
+  count as speech, and so would a sound effect (ex. a groan). The third input is the
+  breathing and the effects at the volume they are played (backgroundMix in pinSetUp.h),
+  and its level at the microphone is learned the same way as the echo of the prompts and
+  added to the noise floor. The detector does not listen while the breathing is first
+  being learned.
+
+  A timestamped start and end event is put in a small queue every time someone starts
+  and stops talking (see getEvent()). The update() function runs in the audio library
+  interrupt, so the queue only has one writer (update()) and one reader (the loop).
+
+  NOTE: AudioInputAnalog keeps ADC0 busy, so the force sensors and pots are read on
+  ADC1 with readAnalog() (see helperFunctions.h) instead of analogRead(). Their pins are
+  checked at startup and an error is printed for any pin that is not on ADC1.
+ *********************************************************************************/
+#include <Arduino.h>
+#include <Audio.h>
+
+// VOICE EVENT TYPES
+const int voiceStart = 0;  // someone started talking
+const int voiceEnd = 1;    // someone stopped talking
+const int voiceBargeIn = 2; // someone started talking while HAL was talking (the prompt was turned down)
+
+// One start or end of talking
+struct VoiceEvent {
+  uint8_t type;             // voiceStart, voiceEnd or voiceBargeIn
+  unsigned long timeStamp;  // time of the first (start and barge-in) or last (end) speech block (ms)
+  unsigned long duration;   // how long they talked (ms) for voiceEnd, otherwise 0
+};
+
+class VoiceDetector : public AudioStream {
+  private:
+    audio_block_t *inputQueueArray[3];
+
+    // SPEECH BANDS
+    static const int numBands = 8;
+    const float bandFreqs[numBands] = {250, 400, 600, 900, 1300, 1800, 2500, 3400}; // Hz
+    float bandCoeffs[numBands];  // 2*cos(2*pi*f/fs) for the Goertzel filter
+    float lastBandMag[numBands];
+
+    // SETTINGS
+    float speechRatio = 3.0;        // level / noise floor for a speech block (about 10 dB)
+    float onsetRatio = 2.0;         // level / noise floor for a speech block when the spectrum changes (about 6 dB)
+    float fluxThreshold = 0.25;     // spectral flux that counts as a sudden change (0 to 1)
+    float maxZeroCrossRate = 0.25;  // a block with more zero crossings than this (per sample) is hiss
+    const float minNoiseFloor = 8;  // lowest noise floor (RMS of a 16 bit sample)
+    const float floorFall = 0.1;    // how fast the noise floor follows a quieter sound
+    const float floorRise = 0.002;  // how fast the noise floor follows a louder sound (about 1.5 sec)
+    const float floorRiseTalking = 0.0002;  // how fast the noise floor rises while someone is talking (about 15 sec)
+    int onsetBlocks = 6;            // speech blocks in a row before talking starts (about 17 ms)
+    int hangoverBlocks = 276;       // blocks without speech before talking ends (about 800 ms)
+
+    // ECHO OF THE PROMPT
+    AudioAmplifier *promptAmp = NULL;     // volume of the prompts (see pinSetUp.h)
+    float duckGain = 0.1;                 // volume of the prompt after a barge-in
+    volatile float outputGain = 1.0;      // current volume of the prompt
+    const int promptHoldBlocks = 35;      // blocks after the prompt ends that its echo can still be heard (about 100 ms)
+    float bargeInRatio = 1.5;             // level / (noise floor + echo) for a speech block while HAL is talking (about 3.5 dB)
+    const float promptDecay = 0.7;        // how fast the prompt level falls after each block (covers the room echo)
+    const float maxEchoGain = 4.0;
+    const float echoLearnFast = 0.1;      // how fast the echo gain goes up at the start of a prompt
+    const float echoLearnSlow = 0.01;     // how fast the echo gain goes up later in the prompt
+    const float echoForget = 0.1;         // the echo gain comes down this much slower than it goes up (so it follows the loud blocks)
+    const int echoTrainBlocks = 100;      // blocks used to learn the echo the first time (about 290 ms)
+    const float minPromptLevel = 100;     // quietest prompt (RMS of the played 16 bit samples) that the echo is learned from
+    int echoBlocks = 0;                   // blocks the echo was learned from (it is known after echoTrainBlocks)
+    volatile float promptLevel = 0;       // RMS of the prompt (after the volume and with the decay)
+    volatile float echoGain = 1.0;        // microphone level / prompt level when only HAL is talking
+    int playingBlocks = 0;                // blocks since the prompt started
+    volatile int promptHold = 0;          // blocks left until the prompt counts as finished
+
+    // ECHO OF THE BREATHING SOUNDS AND EFFECTS
+    volatile float breathLevel = 0;       // RMS of the breathing sounds and effects (with the decay)
+    volatile float breathGain = 1.0;      // microphone level / breathing level when only the breathing can be heard
+    int breathBlocks = 0;                 // blocks the breathing echo was learned from (it is known after echoTrainBlocks)
+
+    // DETECTOR STATE (changed in the audio interrupt)
+    volatile float level = 0;         // RMS of the newest block
+    volatile float noiseFloor = 100;  // RMS of the background noise
+    volatile float zeroCrossRate = 0;
+    volatile float flux = 0;
+    volatile boolean isSpeechBlock = false;
+    volatile boolean isTalking = false;
+    int speechCount = 0;            // speech blocks in a row
+    int silenceCount = 0;           // blocks without speech in a row
+    unsigned long speechStartTime = 0;
+    unsigned long lastSpeechTime = 0;
+
+    // EVENT QUEUE (written by update(), read by getEvent())
+    static const int queueSize = 8;  // must be a power of 2
+    VoiceEvent events[queueSize];
+    volatile uint8_t head = 0;
+    volatile uint8_t tail = 0;
+
+    /*
+       sendEvent - put an event into the queue (dropped if the queue is full)
+    */
+    void sendEvent(int type, unsigned long timeStamp, unsigned long duration) {
+      uint8_t next = (head + 1) & (queueSize - 1);
+      if (next == tail) {
+        return;
+      }
+      events[head].type = type;
+      events[head].timeStamp = timeStamp;
+      events[head].duration = duration;
+      asm volatile("" ::: "memory");
+      head = next;
+    }
+
+    /*
+       findFlux - spectral flux of a block: how much the band energies went up since the last block, divided by the total
+            const int16_t *data - samples of the block
+            float mean - DC offset of the block
+            return float - flux (0 = no change, 1 = all of the sound is new)
+    */
+    float findFlux(const int16_t *data, float mean) {
+      float rise = 0;
+      float total = 0;
+      for (int b = 0; b < numBands; b++) {
+        float coeff = bandCoeffs[b];
+        float s1 = 0, s2 = 0;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+          float s0 = (data[i] - mean) + coeff * s1 - s2;
+          s2 = s1;
+          s1 = s0;
+        }
+        float power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+        float mag = sqrtf(max(power, 0.0f));
+        rise += max(mag - lastBandMag[b], 0.0f);
+        total += mag;
+        lastBandMag[b] = mag;
+      }
+      return total > 0 ? rise / total : 0;
+    }
+
+    /*
+       findRms - RMS of a block with the DC offset taken out
+    */
+    float findRms(const int16_t *data, float mean) {
+      float sumSq = 0;
+      for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        float sample = data[i] - mean;
+        sumSq += sample * sample;
+      }
+      return sqrtf(sumSq / AUDIO_BLOCK_SAMPLES);
+    }
+
+    /*
+       findMean - average of a block (DC offset)
+    */
+    float findMean(const int16_t *data) {
+      int32_t sum = 0;
+      for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        sum += data[i];
+      }
+      return (float)sum / AUDIO_BLOCK_SAMPLES;
+    }
+
+    /*
+       learnGain - move an echo gain towards the microphone level / played level of this block. It goes up quickly and
+                   comes down slowly so it follows the loud blocks.
+            float gain - echo gain so far
+            float micLevel - level at the microphone that comes from the played sound
+            float playedLevel - level of the played sound
+            boolean isTraining - the gain is not known yet, so learn quickly
+            return float - new echo gain
+    */
+    float learnGain(float gain, float micLevel, float playedLevel, boolean isTraining) {
+      float newGain = min(micLevel / playedLevel, maxEchoGain);
+      float rate = isTraining ? echoLearnFast : echoLearnSlow;
+      return gain + (newGain - gain) * (newGain > gain ? rate : rate * echoForget);
+    }
+
+    /*
+       isLearningEcho - check if the echo is still being learned for the first time (the detector does not listen until it is known)
+    */
+    boolean isLearningEcho() {
+      return echoBlocks < echoTrainBlocks;
+    }
+
+    /*
+       updateEcho - learn how loud the prompt is at the microphone while only HAL is talking. The echo that was learned
+                    is kept from one prompt to the next, so only the first prompt has to be learned from scratch.
+            float breathEcho - expected level of the breathing at the microphone (taken out of the level before learning)
+            return float - expected level of HAL's voice at the microphone
+    */
+    float updateEcho(float breathEcho) {
+      if (promptHold <= 0) {
+        playingBlocks = 0;
+        return 0;
+      }
+      float echo = echoGain * promptLevel;
+      boolean isTraining = isLearningEcho() && !isTalking;
+      // the prompt level is in played sample units, so it is checked against a playback threshold (not the microphone noise floor)
+      if (promptLevel > minPromptLevel && (isTraining || (!isTalking && level < (noiseFloor + echo + breathEcho) * bargeInRatio))) {  // only HAL is talking
+        echoGain = learnGain(echoGain, max(level - breathEcho, 0.0f), promptLevel, isTraining);
+        if (isTraining) {
+          echoBlocks++;
+        }
+      }
+      playingBlocks++;
+      return echo;
+    }
+
+    /*
+       isLearningBreath - check if the breathing echo is still being learned for the first time
+    */
+    boolean isLearningBreath() {
+      return breathBlocks < echoTrainBlocks;
+    }
+
+    /*
+       updateBreathEcho - learn how loud the breathing sounds are at the microphone while no one is talking.
+                          It is only learned while no prompt is playing so the two echoes are not mixed up.
+            boolean isPlaying - a prompt is playing
+            return float - expected level of the breathing at the microphone
+    */
+    float updateBreathEcho(boolean isPlaying) {
+      if (breathLevel <= minPromptLevel) {
+        return 0;
+      }
+      float echo = breathGain * breathLevel;
+      boolean isTraining = isLearningBreath() && !isTalking;
+      if (!isPlaying && (isTraining || (!isTalking && level < (noiseFloor + echo) * onsetRatio))) {  // only the breathing can be heard
+        breathGain = learnGain(breathGain, level, breathLevel, isTraining);
+        if (isTraining) {
+          breathBlocks++;
+        }
+      }
+      return echo;
+    }
+
+    /*
+       updateTalking - decide if the block is speech, update the noise floor, and start or end talking
+    */
+    void updateTalking() {
+      unsigned long timeNow = millis();
+      boolean isPlaying = promptHold > 0;
+      float breathEcho = updateBreathEcho(isPlaying);
+      float echo = updateEcho(breathEcho);
+      if (breathEcho > 0 && isLearningBreath() && !isTalking) {  // still learning the breathing the first time
+        isSpeechBlock = false;
+        speechCount = 0;
+        return;
+      }
+      if (isPlaying && isLearningEcho() && playingBlocks <= echoTrainBlocks && !isTalking) {  // still learning the echo the first time
+        isSpeechBlock = false;
+        speechCount = 0;
+        return;
+      }
+      float ratio = level / (noiseFloor + echo + breathEcho);
+      boolean isVoiced = zeroCrossRate <= maxZeroCrossRate;  // noise changes the bands a lot too, so the flux only counts for voiced blocks
+      if (isPlaying) {  // the echo is already taken out, so a smaller rise over it counts (the flux is mostly HAL's voice)
+        isSpeechBlock = isVoiced && ratio >= bargeInRatio;
+      } else {
+        isSpeechBlock = isVoiced && (ratio >= speechRatio || (ratio >= onsetRatio && flux >= fluxThreshold));
+      }
+
+      // noise floor (not while HAL is talking, the echo is added to it instead). The breathing is taken out first.
+      float backgroundLevel = max(level - breathEcho, 0.0f);
+      if (isPlaying) {
+        // keep the noise floor
+      } else if (backgroundLevel < noiseFloor) {
+        noiseFloor += (backgroundLevel - noiseFloor) * floorFall;
+      } else if (!isSpeechBlock) {
+        noiseFloor += (backgroundLevel - noiseFloor) * floorRise;
+      } else {
+        noiseFloor += (backgroundLevel - noiseFloor) * floorRiseTalking;
+      }
+      noiseFloor = max(noiseFloor, minNoiseFloor);
+
+      if (isSpeechBlock) {
+        if (speechCount == 0) {
+          speechStartTime = timeNow;
+        }
+        speechCount++;
+        silenceCount = 0;
+        lastSpeechTime = timeNow;
+        if (!isTalking && speechCount >= onsetBlocks) {
+          isTalking = true;
+          if (isPlaying) {   // talking over HAL - turn the prompt down now instead of waiting for the loop
+            setOutputGain(duckGain);
+            sendEvent(voiceBargeIn, speechStartTime, 0);
+          } else {
+            sendEvent(voiceStart, speechStartTime, 0);
+          }
+        }
+      } else {
+        silenceCount++;
+        if (!isTalking) {
+          speechCount = 0;
+        } else if (silenceCount >= hangoverBlocks) {
+          isTalking = false;
+          speechCount = 0;
+          sendEvent(voiceEnd, lastSpeechTime, lastSpeechTime - speechStartTime);
+        }
+      }
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the voice detector (audio input 0: the microphone, audio input 1: the prompt HAL is playing, audio input 2: the breathing sounds and effects)
+    VoiceDetector() : AudioStream(3, inputQueueArray) {
+      for (int b = 0; b < numBands; b++) {
+        bandCoeffs[b] = 2 * cos(TWO_PI * bandFreqs[b] / AUDIO_SAMPLE_RATE_EXACT);
+        lastBandMag[b] = 0;
+      }
+    }
+
+    /*
+       setHangover - set how long it has to be quiet before talking ends
+            unsigned long hangoverMs - quiet time (ms)
+    */
+    void setHangover(unsigned long hangoverMs) {
+      hangoverBlocks = hangoverMs * AUDIO_SAMPLE_RATE_EXACT / (1000.0 * AUDIO_BLOCK_SAMPLES);
+    }
+
+    /*
+       setSensitivity - set how loud speech has to be compared to the noise floor
+            float ratio - level / noise floor for speech (ex. 3 = about 10 dB)
+    */
+    void setSensitivity(float ratio) {
+      speechRatio = ratio;
+      onsetRatio = ratio * 2 / 3;
+    }
+
+    /*
+       setPromptAmp - set the amplifier that controls the prompt volume so it can be turned down after a barge-in
+            AudioAmplifier &amp - amplifier between the prompt player and the speaker (see pinSetUp.h)
+            float gain - volume after a barge-in (0 = mute, 1 = no change)
+    */
+    void setPromptAmp(AudioAmplifier &amp, float gain) {
+      promptAmp = &amp;
+      duckGain = gain;
+      setOutputGain(1.0);
+    }
+
+    /*
+       setOutputGain - set the volume of the prompts (also used to scale the echo of the prompt)
+            float gain - volume (1 = full volume)
+    */
+    void setOutputGain(float gain) {
+      outputGain = gain;
+      if (promptAmp != NULL) {
+        promptAmp->gain(gain);
+      }
+    }
+
+    //************************************************AUDIO LIBRARY********************************
+    /*
+       update - called by the audio library for every block of 128 samples (do not call this)
+    */
+    virtual void update(void) {
+      // prompt that is playing (there is no block when nothing is playing)
+      audio_block_t *promptBlock = receiveReadOnly(1);
+      float newPromptLevel = 0;
+      if (promptBlock != NULL) {
+        newPromptLevel = findRms(promptBlock->data, 0) * outputGain;
+        release(promptBlock);
+        promptHold = promptHoldBlocks;
+      } else if (promptHold > 0) {
+        promptHold--;
+      }
+      promptLevel = max(newPromptLevel, promptLevel * promptDecay);
+
+      // breathing sounds (see breathing.h)
+      audio_block_t *breathBlock = receiveReadOnly(2);
+      float newBreathLevel = 0;
+      if (breathBlock != NULL) {
+        newBreathLevel = findRms(breathBlock->data, 0);
+        release(breathBlock);
+      }
+      breathLevel = max(newBreathLevel, breathLevel * promptDecay);
+
+      audio_block_t *block = receiveReadOnly(0);
+      if (block == NULL) {
+        return;
+      }
+      const int16_t *data = block->data;
+      float mean = findMean(data);   // remove any DC offset from the microphone
+
+      int crossings = 0;
+      boolean isPositive = data[0] >= mean;
+      for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        boolean isNowPositive = data[i] >= mean;
+        if (isNowPositive != isPositive) {
+          crossings++;
+          isPositive = isNowPositive;
+        }
+      }
+      level = findRms(data, mean);
+      zeroCrossRate = (float)crossings / AUDIO_BLOCK_SAMPLES;
+      flux = findFlux(data, mean);
+      release(block);
+
+      updateTalking();
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       getEvent - take the oldest start or end of talking out of the queue
+            VoiceEvent &event - resulting event
+            return boolean - false if there are no events
+    */
+    boolean getEvent(VoiceEvent &event) {
+      if (tail == head) {
+        return false;
+      }
+      event = events[tail];
+      asm volatile("" ::: "memory");
+      tail = (tail + 1) & (queueSize - 1);
+      return true;
+    }
+
+    /*
+       clearEvents - remove every event from the queue
+    */
+    void clearEvents() {
+      tail = head;
+    }
+
+    /*
+       talking - check if someone is talking right now (includes the pauses between words)
+    */
+    boolean talking() {
+      return isTalking;
+    }
+
+    /*
+       getLevel - RMS level of the newest block (16 bit sample units)
+    */
+    float getLevel() {
+      return level;
+    }
+
+    /*
+       getNoiseFloor - RMS level of the background noise
+    */
+    float getNoiseFloor() {
+      return noiseFloor;
+    }
+
+    /*
+       isPromptPlaying - check if the detector can hear a prompt playing
+    */
+    boolean isPromptPlaying() {
+      return promptHold > 0;
+    }
+
+    /*
+       getEchoGain - learned microphone level / prompt level (how loud HAL's voice is at the microphone)
+    */
+    float getEchoGain() {
+      return echoGain;
+    }
+
+    /*
+       getBreathGain - learned microphone level / breathing level (how loud the breathing sounds are at the microphone)
+    */
+    float getBreathGain() {
+      return breathGain;
+    }
+
+    /*
+       getZeroCrossRate - zero crossings per sample of the newest block
+    */
+    float getZeroCrossRate() {
+      return zeroCrossRate;
+    }
+
+    /*
+       getFlux - spectral flux of the newest block (0 to 1)
+    */
+    float getFlux() {
+      return flux;
+    }
+};
@@ -0,0 +1,71 @@
+%% RBE 598 HAL Stewart Platform Golden Data
+% Exports the reference servo angles to NewNeckTest/stewartGoldenData.h so
+% the Arduino code can be checked against this model (see
+% stewartBenchmark.h). stewartPlatformCalcs.m is run first to get the
+% refined pose sweeps. The servo angles themselves are read from the .xls
+% files so the C++ code is checked against the same tables that are used
+% for the servos:
+%   thetaZ/WX/WY/WZ.xls   - exact servo angles (deg) for every refined pose.
+%                           The first row is left over from an older run
+%                           and is skipped.
+%   degZ/WX/WY/WZNew.xls  - rounded servo commands after refineDegs(). The
+%                           last row is a repeat of the one before it and is
+%                           skipped.
+% Run this file from the MATLAB folder whenever the model changes.
+% stewartGoldenData.py writes the same header when MATLAB is not available.
+stewartPlatformCalcs; % clears the workspace, then calculates the refined sweeps
+close all;
+
+sweepNames = {'Z', 'WX', 'WY', 'WZ'};
+sweepSets = {refinedZSet, refinedWXSet, refinedWYSet, refinedWZSet};
+sweepAxis = [2, 3, 4, 5]; % zero based index of the pose value that changes in each sweep
+
+%% Read the reference tables
+poseVals = [];
+thetaAll = [];
+degAll = [];
+thetaStart = 0;
+degStart = 0;
+for k = 1:4
+    theta = readmatrix(['theta' sweepNames{k} '.xls']);
+    theta = theta(2:end,:);
+    if size(theta,1) ~= length(sweepSets{k})
+        error('theta%s.xls does not match the refined %s sweep', sweepNames{k}, sweepNames{k});
+    end
+    deg = readmatrix(['deg' sweepNames{k} 'New.xls']);
+    if isequal(deg(end,:), deg(end-1,:))
+        deg = deg(1:end-1,:);
+    end
+    poseVals = [poseVals; sweepSets{k}(:)];
+    thetaAll = [thetaAll; theta];
+    degAll = [degAll; deg];
+    thetaStart(k+1) = size(thetaAll,1);
+    degStart(k+1) = size(degAll,1);
+end
+
+%% Write the header file
+fid = fopen('../NewNeckTest/stewartGoldenData.h','w');
+fprintf(fid,'/**********************************************************************************\n');
+fprintf(fid,'  stewartGoldenData.h\n\n');
+fprintf(fid,'  Generated by MATLAB/stewartGoldenData.m (or stewartGoldenData.py) - do not edit by hand.\n');
+fprintf(fid,'  Reference servo angles from the MATLAB model for the z, wx, wy and wz sweeps\n');
+fprintf(fid,'  (all other pose values are 0 and z is homeZ when it is not swept).\n');
+fprintf(fid,' *********************************************************************************/\n\n');
+fprintf(fid,'const int goldenNumSweeps = 4;\n');
+fprintf(fid,'const int goldenSweepAxis[4] = {%d, %d, %d, %d}; // pose value changed by each sweep\n', sweepAxis);
+fprintf(fid,'const int goldenThetaStart[5] = {%d, %d, %d, %d, %d}; // first row of each sweep in goldenPose and goldenTheta\n', thetaStart);
+fprintf(fid,'const int goldenDegStart[5] = {%d, %d, %d, %d, %d}; // first row of each sweep in goldenDeg\n\n', degStart);
+fprintf(fid,'// swept pose value for each row (inches for z, radians for wx, wy and wz)\n');
+fprintf(fid,'const float goldenPose[%d] PROGMEM = {\n', length(poseVals));
+fprintf(fid,'  %.7f,\n', poseVals);
+fprintf(fid,'};\n\n');
+fprintf(fid,'// exact servo angles in degrees (thetaZ/WX/WY/WZ.xls)\n');
+fprintf(fid,'const float goldenTheta[%d][6] PROGMEM = {\n', size(thetaAll,1));
+fprintf(fid,'  {%.6f, %.6f, %.6f, %.6f, %.6f, %.6f},\n', thetaAll');
+fprintf(fid,'};\n\n');
+fprintf(fid,'// rounded servo commands in degrees (degZ/WX/WY/WZNew.xls)\n');
+fprintf(fid,'const int8_t goldenDeg[%d][6] PROGMEM = {\n', size(degAll,1));
+fprintf(fid,'  {%d, %d, %d, %d, %d, %d},\n', degAll');
+fprintf(fid,'};\n');
+fclose(fid);
+fprintf('Golden poses = %d, rounded commands = %d\n', size(thetaAll,1), size(degAll,1));
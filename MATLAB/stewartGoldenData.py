@@ -0,0 +1,75 @@
+# RBE 598 HAL Stewart Platform Golden Data - Python port of stewartGoldenData.m
+# Writes the same NewNeckTest/stewartGoldenData.h as stewartGoldenData.m, for
+# when MATLAB is not available. Needs numpy and xlrd (to read the .xls files).
+# Run it from the MATLAB folder:
+#     python3 stewartGoldenData.py
+import numpy as np
+import xlrd
+from stewartModel import *
+
+# Pose sweeps (same as stewartPlatformCalcs.m)
+zSet = np.linspace(homeZ, homeZ + addL, 1000)
+wxSet = np.linspace(np.deg2rad(-70), np.deg2rad(70), 1000)
+wySet = np.linspace(-np.pi / 4, np.pi / 4, 1000)
+wzSet = np.linspace(-np.pi / 2, np.pi / 2, 1000)
+
+sweepNames = ['Z', 'WX', 'WY', 'WZ']
+sweepSets = [refinePoses(zSet, lambda v: [0, 0, v, 0, 0, 0]),
+             refinePoses(wxSet, lambda v: [0, 0, homeZ, v, 0, 0]),
+             refinePoses(wySet, lambda v: [0, 0, homeZ, 0, v, 0]),
+             refinePoses(wzSet, lambda v: [0, 0, homeZ, 0, 0, v])]
+sweepAxis = [2, 3, 4, 5]  # zero based index of the pose value that changes in each sweep
+
+
+def readXls(name):
+    sheet = xlrd.open_workbook(name).sheet_by_index(0)
+    return np.array([sheet.row_values(i) for i in range(sheet.nrows)])
+
+
+# Read the reference tables
+poseVals = []
+thetaAll = []
+degAll = []
+thetaStart = [0]
+degStart = [0]
+for name, sweep in zip(sweepNames, sweepSets):
+    theta = readXls('theta' + name + '.xls')[1:]  # the first row is left over from an older run
+    if len(theta) != len(sweep):
+        raise SystemExit('theta%s.xls does not match the refined %s sweep' % (name, name))
+    deg = readXls('deg' + name + 'New.xls')
+    if np.array_equal(deg[-1], deg[-2]):  # the last row is a repeat of the one before it
+        deg = deg[:-1]
+    poseVals += list(sweep)
+    thetaAll += list(theta)
+    degAll += list(deg)
+    thetaStart.append(len(thetaAll))
+    degStart.append(len(degAll))
+
+# Write the header file
+with open('../NewNeckTest/stewartGoldenData.h', 'w') as fid:
+    fid.write('/**********************************************************************************\n')
+    fid.write('  stewartGoldenData.h\n\n')
+    fid.write('  Generated by MATLAB/stewartGoldenData.m (or stewartGoldenData.py) - do not edit by hand.\n')
+    fid.write('  Reference servo angles from the MATLAB model for the z, wx, wy and wz sweeps\n')
+    fid.write('  (all other pose values are 0 and z is homeZ when it is not swept).\n')
+    fid.write(' *********************************************************************************/\n\n')
+    fid.write('const int goldenNumSweeps = 4;\n')
+    fid.write('const int goldenSweepAxis[4] = {%d, %d, %d, %d}; // pose value changed by each sweep\n' % tuple(sweepAxis))
+    fid.write('const int goldenThetaStart[5] = {%d, %d, %d, %d, %d}; // first row of each sweep in goldenPose and goldenTheta\n' % tuple(thetaStart))
+    fid.write('const int goldenDegStart[5] = {%d, %d, %d, %d, %d}; // first row of each sweep in goldenDeg\n\n' % tuple(degStart))
+    fid.write('// swept pose value for each row (inches for z, radians for wx, wy and wz)\n')
+    fid.write('const float goldenPose[%d] PROGMEM = {\n' % len(poseVals))
+    for p in poseVals:
+        fid.write('  %.7f,\n' % p)
+    fid.write('};\n\n')
+    fid.write('// exact servo angles in degrees (thetaZ/WX/WY/WZ.xls)\n')
+    fid.write('const float goldenTheta[%d][6] PROGMEM = {\n' % len(thetaAll))
+    for row in thetaAll:
+        fid.write('  {%.6f, %.6f, %.6f, %.6f, %.6f, %.6f},\n' % tuple(row))
+    fid.write('};\n\n')
+    fid.write('// rounded servo commands in degrees (degZ/WX/WY/WZNew.xls)\n')
+    fid.write('const int8_t goldenDeg[%d][6] PROGMEM = {\n' % len(degAll))
+    for row in degAll:
+        fid.write('  {%d, %d, %d, %d, %d, %d},\n' % tuple(matlabRound(row).astype(int)))
+    fid.write('};\n')
+print('Golden poses = %d, rounded commands = %d' % (len(thetaAll), len(degAll)))
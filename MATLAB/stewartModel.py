@@ -0,0 +1,74 @@
+# RBE 598 HAL Stewart Platform Model - Python port
+# The constants and inverse kinematics of stewartPlatformCalcs.m, used by
+# stewartGoldenData.py so the header file in
+# NewNeckTest can be generated without MATLAB. The results are the same as
+# the .m files (MATLAB's rotationVectorToMatrix gives the transpose of the
+# Rodrigues rotation, so the transpose is used here too).
+import numpy as np
+
+# Dimensions in inches
+topR = 5.65
+botR = 6.57
+
+rodLength = 4.724
+Lmin = rodLength - 2
+servoL = 2.0  # servo horn length
+
+maxServoAngRad = np.deg2rad(90)  # maximum servo arm angle wrt horizontal
+addL = np.sqrt(2 * servoL**2 - 2 * servoL**2 * np.cos(maxServoAngRad))  # law of cosines
+Lmax = addL + rodLength
+
+angTopMidRad = np.deg2rad(30)
+angTopInMidRad = np.deg2rad(9.39) / 2
+angBotMidRad = np.deg2rad(30)
+angBotInMidRad = np.deg2rad(44.72) / 2
+
+S = np.array([
+    [topR * np.cos(angTopMidRad + angTopInMidRad), topR * np.sin(angTopMidRad + angTopInMidRad), 0],
+    [-topR * np.cos(angTopMidRad + angTopInMidRad), topR * np.sin(angTopMidRad + angTopInMidRad), 0],
+    [-topR * np.cos(angTopMidRad - angTopInMidRad), topR * np.sin(angTopMidRad - angTopInMidRad), 0],
+    [-topR * np.cos(np.pi / 2 - angTopInMidRad), -topR * np.sin(np.pi / 2 - angTopInMidRad), 0],
+    [topR * np.cos(np.pi / 2 - angTopInMidRad), -topR * np.sin(np.pi / 2 - angTopInMidRad), 0],
+    [topR * np.cos(angTopMidRad - angTopInMidRad), topR * np.sin(angTopMidRad - angTopInMidRad), 0]])
+
+U = np.array([
+    [botR * np.cos(np.pi / 2 - angBotInMidRad), botR * np.sin(np.pi / 2 - angBotInMidRad), 0],
+    [-botR * np.cos(np.pi / 2 - angBotInMidRad), botR * np.sin(np.pi / 2 - angBotInMidRad), 0],
+    [-botR * np.cos(angBotMidRad - angBotInMidRad), -botR * np.sin(angBotMidRad - angBotInMidRad), 0],
+    [-botR * np.cos(angBotMidRad + angBotInMidRad), -botR * np.sin(angBotMidRad + angBotInMidRad), 0],
+    [botR * np.cos(angBotMidRad + angBotInMidRad), -botR * np.sin(angBotMidRad + angBotInMidRad), 0],
+    [botR * np.cos(angBotMidRad - angBotInMidRad), -botR * np.sin(angBotMidRad - angBotInMidRad), 0]])
+
+homeZ = 3.075
+
+
+def rotationVectorToMatrix(v):
+    """Same as MATLAB's rotationVectorToMatrix (the transpose of the Rodrigues rotation)."""
+    theta = np.linalg.norm(v)
+    if theta < 1e-12:
+        return np.eye(3)
+    k = v / theta
+    K = np.array([[0, -k[2], k[1]], [k[2], 0, -k[0]], [-k[1], k[0], 0]])
+    R = np.eye(3) + np.sin(theta) * K + (1 - np.cos(theta)) * K @ K
+    return R.T
+
+
+def invKin(pose):
+    """Leg lengths for a pose [x, y, z, wx, wy, wz] (see invKin in stewartPlatformCalcs.m)."""
+    pose = np.asarray(pose, dtype=float)
+    R = rotationVectorToMatrix(pose[3:6])
+    return np.array([np.linalg.norm(pose[0:3] + R @ S[i] - U[i]) for i in range(6)])
+
+
+def isReachable(Lmag):
+    return bool(np.all((Lmag >= Lmin) & (Lmag <= Lmax)))
+
+
+def refinePoses(poseSet, makePose):
+    """Poses of a sweep where every leg is in range (see refinePoses in stewartPlatformCalcs.m)."""
+    return np.array([v for v in poseSet if isReachable(invKin(makePose(v)))])
+
+
+def matlabRound(x):
+    """MATLAB rounds halves away from zero."""
+    return np.sign(x) * np.floor(np.abs(x) + 0.5)
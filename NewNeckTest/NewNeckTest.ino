@@ -1,6 +1,14 @@
 /**********************************************************************************
 
   Neck test file for stewart platform
+      The inverse kinematics (see stewartPlatform.h) run in a 200 Hz control loop.
+      Every pose is checked by the guard (see stewartGuard.h) so no leg is driven past its limits.
+      At startup the kinematics are checked against the MATLAB golden data (see stewartBenchmark.h).
+      The platform follows a slow nod and the six servo angles are sent to the legs. The whole
+      nod is checked with the batched inverse kinematics (see stewartBatch.h) before it starts.
+      The servo angles are run back through the forward kinematics (see stewartForwardKin.h)
+      and a warning is printed if the pose found does not match the commanded pose.
+      The longest time the inverse and forward kinematics took is printed every second.
  *********************************************************************************/
 
 //Include Libraries
@@ -14,7 +22,12 @@
 #include <SD.h>
 #include <SerialFlash.h>
 
-
+//Include Header Files and Necessary Classes
+#include "stewartPlatform.h"
+#include "stewartForwardKin.h"
+#include "stewartGuard.h"
+#include "stewartBatch.h"
+#include "stewartBenchmark.h"
 
 // called this way, it uses the default address 0x40
 Adafruit_PWMServoDriver pwm0 = Adafruit_PWMServoDriver(0x40);
@@ -28,7 +41,92 @@ const int Leg3 = 18;
 const int Leg4 = 19;
 const int Leg5 = 20;
 const int Leg6 = 21;
+const int legPins[] = {Leg1, Leg2, Leg3, Leg4, Leg5, Leg6};
+
+// Servos for the stewart platform design (same as pinSetUp.h in HAL)
+#define DATANMIN  90 // This is the 'minimum' pulse length count (out of 4096)
+#define DATANMAX  500 // This is the 'maximum' pulse length count (out of 4096)
+
+// LEG SERVO ADJUSTMENTS
+// Neighbouring servos are mirrored so a positive horn angle is CW for some legs and CCW for others
+// (see the note in stewartPlatformCalcs.m). The center is the servo position when the horn is horizontal.
+const int legDirection[] = {1, -1, 1, -1, 1, -1};
+const int legCenter[] = {90, 90, 90, 90, 90, 90};
+
+// CONTROL LOOP
+const unsigned long controlPeriod = 5000; // 200 Hz control loop (us)
+unsigned long lastControlTime = 0;
+unsigned long lastPrintTime = 0;
+float nodAmplitude = 15 * DEG_TO_RAD; // size of the demo nod (rad)
+unsigned long maxIKTime = 0;  // longest inverse kinematics time since the last print (us)
+unsigned long maxFKTime = 0;  // longest forward kinematics time since the last print (us)
+const int maxNodChecks = 20;     // times the nod is made smaller before giving up (0.8^20 is about 1% of the size)
+const float maxPoseError = 0.01; // largest difference between the commanded and found pose before warning (in or rad)
+
+StewartPlatform platform = StewartPlatform();
+StewartForwardKin forwardKin = StewartForwardKin(platform);
+StewartGuard guard = StewartGuard(platform);
+StewartBatch batchKin = StewartBatch(platform);
+StewartBenchmark benchmark = StewartBenchmark(platform, batchKin);
+const boolean runBenchmark = false; // check the kinematics against the MATLAB golden data and time them at startup (host/stewartHost.cpp does the same on a computer)
+
+
+/*
+   getNodPose - pose of the demo nod at a time
+       unsigned long timeMs - time in ms (the nod repeats every 4 seconds)
+       float pose[6] - resulting pose
+*/
+void getNodPose(unsigned long timeMs, float pose[6]) {
+  float nodAngle = nodAmplitude * sin(2 * PI * (timeMs % 4000) / 4000.0);
+  pose[0] = 0;
+  pose[1] = 0;
+  pose[2] = platform.homeZ + 0.5f;
+  pose[3] = nodAngle;
+  pose[4] = 0;
+  pose[5] = 0;
+}
 
+/*
+   checkNod - check every waypoint of the demo nod in one batch before it is started.
+              The nod is made smaller until every waypoint is reachable. If even a tiny
+              nod is out of range the nod is turned off (the head stays at the center pose).
+*/
+void checkNod() {
+  StewartPoseBatch nodBatch;
+  for (int check = 0; check < maxNodChecks; check++) {
+    StewartBatch::clear(nodBatch);
+    for (int i = 0; i < maxBatchPoses; i++) {
+      float pose[6];
+      getNodPose(i * 4000UL / maxBatchPoses, pose);
+      StewartBatch::addPose(nodBatch, pose);
+    }
+    int firstBad = batchKin.checkReachable(nodBatch);
+    if (firstBad < 0) {
+      Serial.print("Nod amplitude (deg) = "); Serial.println(nodAmplitude * RAD_TO_DEG);
+      return;
+    }
+    Serial.print("Nod waypoint "); Serial.print(firstBad); Serial.println(" is out of range, making the nod smaller");
+    nodAmplitude *= 0.8;
+  }
+  nodAmplitude = 0;
+  Serial.println("No nod is reachable, the nod is turned off");
+}
+
+/*
+   driveLeg - drive a leg servo to a horn angle
+       int leg - leg number (0-5)
+       float angleDeg - servo horn angle wrt horizontal from the inverse kinematics
+*/
+void driveLeg(int leg, float angleDeg) {
+  int deg = legCenter[leg] + legDirection[leg] * (int)lround(angleDeg);
+  deg = constrain(deg, 0, 180);
+  uint16_t pulse = (uint16_t) map(deg, 0, 180, DATANMIN, DATANMAX);
+  if (legPins[leg] < 16) {
+    pwm0.setPWM(legPins[leg] % 16, 0, pulse);
+  } else {
+    pwm1.setPWM(legPins[leg] % 16, 0, pulse);
+  }
+}
 
 
 void setup() {
@@ -44,9 +142,59 @@ void setup() {
   pwm0.setPWMFreq(60);  // Analog servos run at ~60 Hz updates
   pwm1.setPWMFreq(60);
 
+  if (runBenchmark) {
+    benchmark.run();
+  }
+  checkNod();
 }
 
 void loop() {
   // put your main code here, to run repeatedly:
+  if (micros() - lastControlTime >= controlPeriod) {
+    lastControlTime += controlPeriod;
+
+    // slow nod around the home pose (checked in setup())
+    float goalPose[6];
+    getNodPose(millis(), goalPose);
+    float pose[6];
+    float angles[6];
+    guard.limitPose(goalPose, controlPeriod / 1000000.0, pose);  // keep every leg in range
+
+    unsigned long startTime = micros();
+    boolean isReachable = platform.getServoAngles(pose, angles);
+    unsigned long ikTime = micros() - startTime;
+    maxIKTime = max(maxIKTime, ikTime);
+
+    if (isReachable) {
+      for (int leg = 0; leg < StewartPlatform::numLegs; leg++) {
+        driveLeg(leg, angles[leg]);
+      }
+
+      // find the pose from the servo angles to make sure it matches the command
+      float foundPose[6];
+      startTime = micros();
+      boolean isSolved = forwardKin.solve(angles, foundPose);
+      unsigned long fkTime = micros() - startTime;
+      maxFKTime = max(maxFKTime, fkTime);
+
+      float poseError = 0;
+      for (int i = 0; i < 6; i++) {
+        poseError = max(poseError, abs(foundPose[i] - pose[i]));
+      }
+      if (!isSolved || poseError > maxPoseError) {
+        Serial.print("Pose mismatch = "); Serial.println(poseError, 4);
+        forwardKin.printResult();
+      }
+    }
+  }
 
+  if (millis() > lastPrintTime + 1000) {
+    Serial.print("Max IK time (us) = "); Serial.print(maxIKTime);
+    Serial.print("  Max FK time (us) = "); Serial.println(maxFKTime);
+    forwardKin.printResult();
+    guard.printTelemetry();
+    maxIKTime = 0;
+    maxFKTime = 0;
+    lastPrintTime = millis();
+  }
 }
@@ -0,0 +1,55 @@
+/**********************************************************************************
+  Arduino.h (host)
+
+  The few parts of the Arduino core that the Stewart platform headers use, so they can
+  be built and run on a computer by stewartHost.cpp. Only used by the host build, the
+  Teensy build uses the real Arduino.h.
+ *********************************************************************************/
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+
+typedef bool boolean;
+
+#define PROGMEM
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::abs;
+using std::max;
+using std::min;
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  return (unsigned long)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+inline unsigned long millis() {
+  return micros() / 1000;
+}
+
+inline long random(long low, long high) {
+  return low + rand() % (high - low);
+}
+
+// Serial prints to stdout
+struct HostSerial {
+  void print(const char *s) { printf("%s", s); }
+  void print(double value, int digits = 2) { printf("%.*f", digits, value); }
+  void print(int value) { printf("%d", value); }
+  void print(long value) { printf("%ld", value); }
+  void print(unsigned long value) { printf("%lu", value); }
+  void println(const char *s = "") { printf("%s\n", s); }
+  void println(double value, int digits = 2) { printf("%.*f\n", digits, value); }
+  void println(int value) { printf("%d\n", value); }
+  void println(long value) { printf("%ld\n", value); }
+  void println(unsigned long value) { printf("%lu\n", value); }
+};
+static HostSerial Serial;
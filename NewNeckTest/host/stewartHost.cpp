@@ -0,0 +1,73 @@
+/**********************************************************************************
+  stewartHost.cpp
+
+  Host build of the Stewart platform kinematics. It runs the same golden data check and
+  throughput measurement as NewNeckTest (see stewartBenchmark.h) on a computer, then
+  plays the demo nod through the guard and the forward kinematics. It returns 1 if the
+  float kinematics do not match the MATLAB golden data or the nod does not round trip.
+
+  Build and run from the repository root:
+    g++ -std=gnu++14 -O3 -fno-math-errno -INewNeckTest/host -INewNeckTest NewNeckTest/host/stewartHost.cpp -o stewartHost
+    ./stewartHost
+  Add -fopt-info-vec to see which loops the compiler vectorized (the StewartBatch leg loops
+  need -fno-math-errno).
+ *********************************************************************************/
+#include <Arduino.h>
+#include "stewartPlatform.h"
+#include "stewartForwardKin.h"
+#include "stewartGuard.h"
+#include "stewartBatch.h"
+#include "stewartBenchmark.h"
+
+static const float maxGoldenError = 0.001;  // largest float error vs MATLAB (deg)
+static const float maxPoseError = 0.01;     // largest forward kinematics error (in or rad)
+
+StewartPlatform platform = StewartPlatform();
+StewartForwardKin forwardKin = StewartForwardKin(platform);
+StewartGuard guard = StewartGuard(platform);
+StewartBatch batchKin = StewartBatch(platform);
+StewartBenchmark benchmark = StewartBenchmark(platform, batchKin);
+
+/*
+   checkNod - run 8 s of the demo nod at 200 Hz through the guard, the inverse and the forward kinematics
+        return int - number of control steps where the found pose did not match the command
+*/
+int checkNod() {
+  const float amplitude = 15 * DEG_TO_RAD;
+  const float period = 0.005;
+  int numMismatches = 0;
+  float worstError = 0;
+  for (unsigned long timeNow = 0; timeNow < 8000; timeNow += 5) {
+    float goalPose[6] = {0, 0, platform.homeZ + 0.5f, (float)(amplitude * sin(2 * PI * (timeNow % 4000) / 4000.0)), 0, 0};
+    float pose[6];
+    float angles[6];
+    guard.limitPose(goalPose, period, pose);
+    if (!platform.getServoAngles(pose, angles)) {
+      numMismatches++;
+      continue;
+    }
+    float foundPose[6];
+    boolean isSolved = forwardKin.solve(angles, foundPose);
+    float poseError = 0;
+    for (int i = 0; i < 6; i++) {
+      poseError = max(poseError, std::fabs(foundPose[i] - pose[i]));
+    }
+    worstError = max(worstError, poseError);
+    if (!isSolved || poseError > maxPoseError) {
+      numMismatches++;
+    }
+  }
+  Serial.print("Nod mismatches = "); Serial.print(numMismatches);
+  Serial.print("  worst pose error = "); Serial.println(worstError, 6);
+  guard.printTelemetry();
+  return numMismatches;
+}
+
+int main() {
+  float goldenError = benchmark.checkGolden();
+  benchmark.measureThroughput(20);
+  int numMismatches = checkNod();
+  boolean isPassed = goldenError <= maxGoldenError && numMismatches == 0;
+  Serial.println(isPassed ? "PASS" : "FAIL");
+  return isPassed ? 0 : 1;
+}
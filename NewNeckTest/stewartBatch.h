@@ -0,0 +1,225 @@
+/**********************************************************************************
+  stewartBatch.h
+
+  This file contains the class definition, attributes, and methods of the StewartBatch.
+  It runs the inverse kinematics (see stewartPlatform.h) for a whole batch of poses at once,
+  ex. all of the waypoints of a nod, so a trajectory can be checked for reachability in one
+  call before it is started. It is the C++ version of the per-pose loops in
+  stewartPlatformCalcs.m (zLMagPlot, wxLMagPlot, ...).
+
+  The poses are stored as a structure of arrays (all of the x values together, all of the y
+  values together, ...) instead of an array of poses. The rotation terms are found once per
+  pose, then each leg is calculated for every pose in a tight loop without branches or
+  library calls (the square root is a single instruction and the arcsine is a polynomial).
+  This keeps the FPU busy on the Teensy. On a computer, both leg loops are vectorized when
+  built with -fno-math-errno (see host/stewartHost.cpp, add -fopt-info-vec to check).
+ *********************************************************************************/
+#include <Arduino.h>
+
+static const int maxBatchPoses = 64; // most poses in one batch
+
+// Batch of poses stored as a structure of arrays
+struct StewartPoseBatch {
+  int count;
+  float x[maxBatchPoses];
+  float y[maxBatchPoses];
+  float z[maxBatchPoses];
+  float wx[maxBatchPoses];
+  float wy[maxBatchPoses];
+  float wz[maxBatchPoses];
+};
+
+class StewartBatch {
+  private:
+    static const int numLegs = StewartPlatform::numLegs;
+    StewartPlatform *platform;
+
+    // ROTATION TERMS FOR EVERY POSE (see invKin() in stewartPlatform.h)
+    float cosT[maxBatchPoses];    // cos(theta)
+    float sinKx[maxBatchPoses];   // sin(theta) * kx
+    float sinKy[maxBatchPoses];
+    float sinKz[maxBatchPoses];
+    float omcKx[maxBatchPoses];   // (1 - cos(theta)) * kx
+    float omcKy[maxBatchPoses];
+    float omcKz[maxBatchPoses];
+    float kxArr[maxBatchPoses];   // unit rotation axis
+    float kyArr[maxBatchPoses];
+
+    /*
+       fastSqrt - square root with the FPU instruction on the Teensy (sqrtf() also checks for errors)
+    */
+    static inline float fastSqrt(float value) {
+#if defined(__arm__) && defined(__ARM_FP)
+      float result;
+      asm("vsqrt.f32 %0, %1" : "=t"(result) : "t"(value));
+      return result;
+#else
+      return __builtin_sqrtf(value);  // vectorizes when built with -fno-math-errno
+#endif
+    }
+
+    /*
+       fastAsin - arcsine from a polynomial (Abramowitz and Stegun 4.4.46, error < 2e-8 rad)
+            float value - sine, already limited to -1 to 1
+            return float - angle in radians
+    */
+    static inline float fastAsin(float value) {
+      float a = fabsf(value);
+      float poly = -0.0012624911f;
+      poly = poly * a + 0.0066700901f;
+      poly = poly * a - 0.0170881256f;
+      poly = poly * a + 0.0308918810f;
+      poly = poly * a - 0.0501743046f;
+      poly = poly * a + 0.0889789874f;
+      poly = poly * a - 0.2145988016f;
+      poly = poly * a + 1.5707963050f;
+      return copysignf(1.5707963268f - fastSqrt(1 - a) * poly, value);
+    }
+
+    /*
+       findRotationTerms - calculate the rotation terms of every pose in the batch
+    */
+    void findRotationTerms(const StewartPoseBatch &batch) {
+      for (int p = 0; p < batch.count; p++) {
+        float wx = batch.wx[p];
+        float wy = batch.wy[p];
+        float wz = batch.wz[p];
+        float theta = fastSqrt(wx * wx + wy * wy + wz * wz);
+        float kx = 0, ky = 0, kz = 0;
+        float s = 0, c = 1;
+        if (theta > 1e-7f) {
+          kx = wx / theta;
+          ky = wy / theta;
+          kz = wz / theta;
+          s = sinf(theta);
+          c = cosf(theta);
+        }
+        cosT[p] = c;
+        sinKx[p] = s * kx;
+        sinKy[p] = s * ky;
+        sinKz[p] = s * kz;
+        omcKx[p] = (1 - c) * kx;
+        omcKy[p] = (1 - c) * ky;
+        omcKz[p] = (1 - c) * kz;
+        kxArr[p] = kx;
+        kyArr[p] = ky;
+      }
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the batch solver
+    StewartBatch(StewartPlatform &stewartPlatform) {
+      platform = &stewartPlatform;
+    }
+
+    /*
+       clear - empty a batch
+    */
+    static void clear(StewartPoseBatch &batch) {
+      batch.count = 0;
+    }
+
+    /*
+       addPose - add a pose to the end of a batch
+            StewartPoseBatch &batch - batch to add to
+            const float pose[6] - [x, y, z, wx, wy, wz] in inches and radians
+            return boolean - false if the batch is full
+    */
+    static boolean addPose(StewartPoseBatch &batch, const float pose[6]) {
+      if (batch.count >= maxBatchPoses) {
+        return false;
+      }
+      int p = batch.count;
+      batch.x[p] = pose[0];
+      batch.y[p] = pose[1];
+      batch.z[p] = pose[2];
+      batch.wx[p] = pose[3];
+      batch.wy[p] = pose[4];
+      batch.wz[p] = pose[5];
+      batch.count++;
+      return true;
+    }
+
+    //************************************************BATCHED KINEMATICS********************************
+    /*
+       invKin - calculate the leg lengths of every pose in the batch (same math as StewartPlatform::invKin())
+            const StewartPoseBatch &batch - poses to calculate
+            float legLength[6][maxBatchPoses] - resulting leg lengths, one row per leg
+    */
+    void invKin(const StewartPoseBatch &batch, float legLength[6][maxBatchPoses]) {
+      findRotationTerms(batch);
+      int n = batch.count;
+      for (int i = 0; i < numLegs; i++) {
+        const float sx = platform->S[i][0];
+        const float sy = platform->S[i][1];
+        const float ux = platform->U[i][0];
+        const float uy = platform->U[i][1];
+        float *__restrict out = legLength[i];
+        for (int p = 0; p < n; p++) {
+          // R*S with the MATLAB (transposed) rotation: S*c - sin*(k x S) + (1-c)*(k.S)*k
+          float kDotS = kxArr[p] * sx + kyArr[p] * sy;
+          float rx = sx * cosT[p] + sinKz[p] * sy + kDotS * omcKx[p];
+          float ry = sy * cosT[p] - sinKz[p] * sx + kDotS * omcKy[p];
+          float rz = sinKy[p] * sx - sinKx[p] * sy + kDotS * omcKz[p];
+          float lx = batch.x[p] + rx - ux;
+          float ly = batch.y[p] + ry - uy;
+          float lz = batch.z[p] + rz;
+          out[p] = fastSqrt(lx * lx + ly * ly + lz * lz);
+        }
+      }
+    }
+
+    /*
+       getServoAngles - calculate the servo angles of every pose in the batch
+            const StewartPoseBatch &batch - poses to calculate
+            float angleDeg[6][maxBatchPoses] - resulting servo angles in degrees, one row per leg
+            return int - index of the first pose with a leg out of range, or -1 if every pose is reachable
+    */
+    int getServoAngles(const StewartPoseBatch &batch, float angleDeg[6][maxBatchPoses]) {
+      invKin(batch, angleDeg);   // the leg lengths are converted in place
+      int firstBad = findFirstUnreachable(batch.count, angleDeg);
+      // same as StewartPlatform::legToServoAngle() with the constants loaded once
+      const float rodLength = platform->rodLength;
+      const float ratioScale = 1 / (2 * platform->servoL);
+      const float toDeg = 2 * RAD_TO_DEG;
+      int n = batch.count;
+      for (int i = 0; i < numLegs; i++) {
+        float *__restrict angle = angleDeg[i];
+        for (int p = 0; p < n; p++) {
+          float ratio = (angle[p] - rodLength) * ratioScale;
+          ratio = 0.5f * (fabsf(ratio + 1) - fabsf(ratio - 1));   // limit to -1 to 1 without a branch
+          angle[p] = fastAsin(ratio) * toDeg;
+        }
+      }
+      return firstBad;
+    }
+
+    /*
+       checkReachable - check a whole trajectory before it is started
+            const StewartPoseBatch &batch - waypoints of the trajectory
+            return int - index of the first waypoint with a leg out of range, or -1 if every waypoint is reachable
+    */
+    int checkReachable(const StewartPoseBatch &batch) {
+      static float legLength[6][maxBatchPoses];
+      invKin(batch, legLength);
+      return findFirstUnreachable(batch.count, legLength);
+    }
+
+    /*
+       findFirstUnreachable - find the first pose with a leg shorter than Lmin or longer than Lmax
+            int count - number of poses
+            float legLength[6][maxBatchPoses] - leg lengths of every pose
+            return int - index of the first bad pose, or -1 if none
+    */
+    int findFirstUnreachable(int count, float legLength[6][maxBatchPoses]) {
+      for (int p = 0; p < count; p++) {
+        for (int i = 0; i < numLegs; i++) {
+          if (!platform->isLegInRange(legLength[i][p])) {
+            return p;
+          }
+        }
+      }
+      return -1;
+    }
+};
@@ -0,0 +1,250 @@
+/**********************************************************************************
+  stewartBenchmark.h
+
+  This file contains the class definition, attributes, and methods of the StewartBenchmark.
+  It checks the C++ kinematics against the golden data from the MATLAB model
+  (see stewartGoldenData.h, made by MATLAB/stewartGoldenData.m) and measures how fast
+  each version runs (including the batched version in stewartBatch.h) so accuracy and
+  speed changes are easy to spot after editing the kinematics. For every pose in the z, wx, wy and wz sweeps it prints:
+      - the max and RMS servo angle error of the floating point, batched and fixed point
+        versions compared to thetaZ/WX/WY/WZ.xls
+      - how many rounded servo commands (after refineDegs() in MATLAB) match degZ/WX/WY/WZNew.xls
+      - the number of poses per second for each version
+ *********************************************************************************/
+#include <Arduino.h>
+#include "stewartGoldenData.h" // generated reference servo angles
+
+class StewartBenchmark {
+  private:
+    static const int numLegs = StewartPlatform::numLegs;
+    StewartPlatform *platform;
+    StewartBatch *batchKin;
+
+    StewartPoseBatch batch;
+    float batchAngles[6][maxBatchPoses];
+
+    // ERROR OF ONE VERSION OF THE KINEMATICS
+    struct ErrorStats {
+      float maxErr;
+      double sumSq;
+      long count;
+    };
+
+    volatile float sink = 0; // keeps the compiler from removing the timed loops
+
+    /*
+       sumLegs - add up all six angles so none of them can be optimized out of a timed loop
+    */
+    float sumLegs(const float angleDeg[6]) {
+      return angleDeg[0] + angleDeg[1] + angleDeg[2] + angleDeg[3] + angleDeg[4] + angleDeg[5];
+    }
+
+    /*
+       makePose - build the pose for one row of the golden data
+            int row - row in goldenPose
+            int sweep - sweep the row belongs to (0-3)
+            float pose[6] - resulting pose
+    */
+    void makePose(int row, int sweep, float pose[6]) {
+      for (int i = 0; i < 6; i++) {
+        pose[i] = 0;
+      }
+      pose[2] = platform->homeZ;
+      pose[goldenSweepAxis[sweep]] = goldenPose[row];
+    }
+
+    /*
+       fillBatch - put the next rows of one sweep into the batch
+            int startRow - first row in goldenPose
+            int sweep - sweep the rows belong to (0-3)
+            return int - number of rows added
+    */
+    int fillBatch(int startRow, int sweep) {
+      StewartBatch::clear(batch);
+      float pose[6];
+      for (int row = startRow; row < goldenThetaStart[sweep + 1] && batch.count < maxBatchPoses; row++) {
+        makePose(row, sweep, pose);
+        StewartBatch::addPose(batch, pose);
+      }
+      return batch.count;
+    }
+
+    /*
+       addError - add the error of the six servo angles of one pose
+    */
+    void addError(ErrorStats &stats, const float angleDeg[6], int row) {
+      for (int leg = 0; leg < numLegs; leg++) {
+        float err = abs(angleDeg[leg] - goldenTheta[row][leg]);
+        stats.maxErr = max(stats.maxErr, err);
+        stats.sumSq += err * err;
+        stats.count++;
+      }
+    }
+
+    /*
+       printError - print the max and RMS error of one version
+    */
+    void printError(const char *name, ErrorStats &stats) {
+      Serial.print(name);
+      Serial.print(" max err (deg) = "); Serial.print(stats.maxErr, 5);
+      Serial.print("  RMS err (deg) = "); Serial.print(stats.count > 0 ? sqrt(stats.sumSq / stats.count) : 0, 5);
+      Serial.print("  angles checked = "); Serial.println(stats.count);
+    }
+
+    /*
+       printRate - print the number of poses per second
+            const char *name - name of the version
+            long numPoses - number of poses that were calculated
+            unsigned long elapsed - time they took (us)
+    */
+    void printRate(const char *name, long numPoses, unsigned long elapsed) {
+      Serial.print(name);
+      Serial.print(" poses/s = "); Serial.print(numPoses * 1000000.0 / max(elapsed, 1UL), 0);
+      Serial.print("  (us/pose = "); Serial.print((float)elapsed / numPoses, 3); Serial.println(")");
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the benchmark
+    StewartBenchmark(StewartPlatform &stewartPlatform, StewartBatch &stewartBatch) {
+      platform = &stewartPlatform;
+      batchKin = &stewartBatch;
+    }
+
+    //************************************************ACCURACY********************************
+    /*
+       checkGolden - compare every version of the kinematics against the golden data and print the errors
+            return float - largest floating point error in degrees
+    */
+    float checkGolden() {
+      ErrorStats floatStats = {0, 0, 0};
+      ErrorStats fixedStats = {0, 0, 0};
+      ErrorStats batchStats = {0, 0, 0};
+      int numMatched = 0;
+
+      for (int sweep = 0; sweep < goldenNumSweeps; sweep++) {
+        int8_t prevDeg[6] = {0, 0, 0, 0, 0, 0};
+        int degRow = goldenDegStart[sweep];
+        for (int row = goldenThetaStart[sweep]; row < goldenThetaStart[sweep + 1]; row++) {
+          float pose[6];
+          float angles[6];
+          makePose(row, sweep, pose);
+
+          platform->getServoAngles(pose, angles);
+          addError(floatStats, angles, row);
+
+          // rounded servo commands, only keeping the ones that change (same as refineDegs() in MATLAB)
+          int8_t deg[6];
+          boolean isChanged = (row == goldenThetaStart[sweep]);
+          for (int leg = 0; leg < numLegs; leg++) {
+            deg[leg] = (int8_t)lround(angles[leg]);
+            if (deg[leg] != prevDeg[leg]) {
+              isChanged = true;
+            }
+          }
+          if (isChanged) {
+            if (degRow < goldenDegStart[sweep + 1] && memcmp(deg, goldenDeg[degRow], sizeof(deg)) == 0) {
+              numMatched++;
+            }
+            degRow++;
+            memcpy(prevDeg, deg, sizeof(deg));
+          }
+
+          int32_t poseQ[6];
+          int16_t centiDeg[6];
+          StewartPlatform::poseToQ(pose, poseQ);
+          platform->getServoAnglesFixed(poseQ, centiDeg);
+          for (int leg = 0; leg < numLegs; leg++) {
+            angles[leg] = centiDeg[leg] / 100.0;
+          }
+          addError(fixedStats, angles, row);
+        }
+
+        // batched version, maxBatchPoses rows at a time
+        for (int row = goldenThetaStart[sweep]; row < goldenThetaStart[sweep + 1]; row += batch.count) {
+          fillBatch(row, sweep);
+          batchKin->getServoAngles(batch, batchAngles);
+          for (int p = 0; p < batch.count; p++) {
+            float angles[6];
+            for (int leg = 0; leg < numLegs; leg++) {
+              angles[leg] = batchAngles[leg][p];
+            }
+            addError(batchStats, angles, row + p);
+          }
+        }
+      }
+
+      Serial.println("Kinematics vs MATLAB golden data");
+      printError("  Float", floatStats);
+      printError("  Batch", batchStats);
+      printError("  Fixed", fixedStats);
+      Serial.print("  Rounded commands matched = "); Serial.print(numMatched);
+      Serial.print(" of "); Serial.println(goldenDegStart[goldenNumSweeps]);
+      return floatStats.maxErr;
+    }
+
+    //************************************************SPEED********************************
+    /*
+       measureThroughput - time every version of the kinematics over all of the golden poses
+            int numRepeats - number of times to go through the poses
+    */
+    void measureThroughput(int numRepeats) {
+      int numPoses = goldenThetaStart[goldenNumSweeps];
+      long total = (long)numPoses * numRepeats;
+      float pose[6];
+      float angles[6];
+      unsigned long startTime;
+
+      startTime = micros();
+      for (int r = 0; r < numRepeats; r++) {
+        for (int sweep = 0; sweep < goldenNumSweeps; sweep++) {
+          for (int row = goldenThetaStart[sweep]; row < goldenThetaStart[sweep + 1]; row++) {
+            makePose(row, sweep, pose);
+            platform->getServoAngles(pose, angles);
+            sink = sumLegs(angles);
+          }
+        }
+      }
+      unsigned long floatTime = micros() - startTime;
+
+      startTime = micros();
+      for (int r = 0; r < numRepeats; r++) {
+        for (int sweep = 0; sweep < goldenNumSweeps; sweep++) {
+          for (int row = goldenThetaStart[sweep]; row < goldenThetaStart[sweep + 1]; row += batch.count) {
+            fillBatch(row, sweep);
+            batchKin->getServoAngles(batch, batchAngles);
+            sink = batchAngles[0][0];
+          }
+        }
+      }
+      unsigned long batchTime = micros() - startTime;
+
+      startTime = micros();
+      for (int r = 0; r < numRepeats; r++) {
+        for (int sweep = 0; sweep < goldenNumSweeps; sweep++) {
+          for (int row = goldenThetaStart[sweep]; row < goldenThetaStart[sweep + 1]; row++) {
+            int32_t poseQ[6];
+            int16_t centiDeg[6];
+            makePose(row, sweep, pose);
+            StewartPlatform::poseToQ(pose, poseQ);
+            platform->getServoAnglesFixed(poseQ, centiDeg);
+            sink = centiDeg[0] + centiDeg[1] + centiDeg[2] + centiDeg[3] + centiDeg[4] + centiDeg[5];
+          }
+        }
+      }
+      unsigned long fixedTime = micros() - startTime;
+
+      Serial.println("Kinematics throughput");
+      printRate("  Float", total, floatTime);
+      printRate("  Batch", total, batchTime);
+      printRate("  Fixed", total, fixedTime);
+    }
+
+    /*
+       run - check the accuracy and speed of the kinematics
+    */
+    void run() {
+      checkGolden();
+      measureThroughput(3);
+    }
+};
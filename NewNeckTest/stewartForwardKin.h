@@ -0,0 +1,218 @@
+/**********************************************************************************
+  stewartForwardKin.h
+
+  This file contains the class definition, attributes, and methods of the StewartForwardKin.
+  The MATLAB model and stewartPlatform.h only go from a pose to the servo angles. This
+  class goes the other way: given the six servo angles (measured or commanded), it finds
+  the pose of the head [x, y, z, wx, wy, wz] with Newton-Raphson. Each iteration runs the
+  inverse kinematics to compare the leg lengths of the current guess with the leg lengths
+  from the servo angles, and moves the guess by solving J * step = -error, where J is the
+  6x6 Jacobian of the leg lengths with respect to the pose (found by finite differences).
+
+  The solver starts from the last pose it found (the head only moves a little between
+  control ticks) so it usually converges in two or three iterations, and it never runs
+  more than maxIterations. After every solve the number of iterations, whether it
+  converged, and the leftover leg length error (residual) of each leg are saved. A solve
+  that does not converge, or a pose that is far from the commanded pose, is a sign that a
+  leg is binding or a servo horn has slipped.
+ *********************************************************************************/
+#include <Arduino.h>
+
+class StewartForwardKin {
+  private:
+    static const int numLegs = StewartPlatform::numLegs;
+    StewartPlatform *platform;
+
+    // NEWTON-RAPHSON SETTINGS
+    const int maxIterations = 8;          // most iterations allowed in one solve
+    const float tolerance = 1e-4;         // largest leg length error (in) to count as converged
+    const float stepSize = 1e-3;          // pose change used to find the Jacobian (in or rad)
+
+    float estimate[6];                    // last pose that converged (used as the next starting guess)
+
+    // RESULTS OF THE LAST SOLVE
+    boolean converged = false;
+    int iterations = 0;
+    float legResidual[6] = {0, 0, 0, 0, 0, 0}; // leg length error of each leg (in)
+    float maxResidual = 0;                // largest leg length error (in)
+
+    /*
+       findError - leg length error of every leg for a pose
+            const float pose[6] - pose to check
+            const float goalLength[6] - leg lengths from the servo angles
+            float error[6] - resulting error of each leg (pose leg length - goal leg length)
+            return float - largest error magnitude
+    */
+    float findError(const float pose[6], const float goalLength[6], float error[6]) {
+      float legLength[numLegs];
+      float largest = 0;
+      platform->invKin(pose, legLength);
+      for (int i = 0; i < numLegs; i++) {
+        error[i] = legLength[i] - goalLength[i];
+        largest = max(largest, abs(error[i]));
+      }
+      return largest;
+    }
+
+    /*
+       solveLinear - solve A * x = b with Gaussian elimination and partial pivoting
+            float A[6][7] - matrix with b in the last column (changed by this function)
+            float x[6] - resulting solution
+            return boolean - false if the matrix is singular (the platform is at a singular pose)
+    */
+    boolean solveLinear(float A[6][7], float x[6]) {
+      for (int col = 0; col < numLegs; col++) {
+        // move the row with the largest value in this column to the top
+        int pivot = col;
+        for (int row = col + 1; row < numLegs; row++) {
+          if (abs(A[row][col]) > abs(A[pivot][col])) {
+            pivot = row;
+          }
+        }
+        if (abs(A[pivot][col]) < 1e-9f) {
+          return false;
+        }
+        if (pivot != col) {
+          for (int k = col; k <= numLegs; k++) {
+            float temp = A[col][k];
+            A[col][k] = A[pivot][k];
+            A[pivot][k] = temp;
+          }
+        }
+        // remove this column from the rows below
+        for (int row = col + 1; row < numLegs; row++) {
+          float factor = A[row][col] / A[col][col];
+          for (int k = col; k <= numLegs; k++) {
+            A[row][k] -= factor * A[col][k];
+          }
+        }
+      }
+      // back substitution
+      for (int row = numLegs - 1; row >= 0; row--) {
+        float sum = A[row][numLegs];
+        for (int k = row + 1; k < numLegs; k++) {
+          sum -= A[row][k] * x[k];
+        }
+        x[row] = sum / A[row][row];
+      }
+      return true;
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the solver
+    StewartForwardKin(StewartPlatform &stewartPlatform) {
+      platform = &stewartPlatform;
+      reset();
+    }
+
+    /*
+       reset - start the next solve from the home pose (use after the servos were off or a solve failed badly)
+    */
+    void reset() {
+      for (int i = 0; i < 6; i++) {
+        estimate[i] = 0;
+      }
+      estimate[2] = platform->homeZ;
+    }
+
+    //************************************************SOLVING********************************
+    /*
+       solve - find the pose of the head from the six servo angles
+            const float angleDeg[6] - servo angles in degrees (same as the output of StewartPlatform::getServoAngles())
+            float pose[6] - resulting pose [x, y, z, wx, wy, wz] in inches and radians
+            return boolean - true if the leg lengths match within the tolerance
+    */
+    boolean solve(const float angleDeg[6], float pose[6]) {
+      float goalLength[numLegs];
+      for (int i = 0; i < numLegs; i++) {
+        goalLength[i] = platform->servoAngleToLeg(angleDeg[i]);
+      }
+
+      float guess[6];
+      for (int i = 0; i < 6; i++) {
+        guess[i] = estimate[i];
+      }
+
+      converged = false;
+      iterations = 0;
+      maxResidual = findError(guess, goalLength, legResidual);
+      while (maxResidual > tolerance && iterations < maxIterations) {
+        // Jacobian by finite differences, with -error in the last column
+        float A[6][7];
+        for (int j = 0; j < 6; j++) {
+          float moved[6];
+          float movedError[numLegs];
+          for (int k = 0; k < 6; k++) {
+            moved[k] = guess[k];
+          }
+          moved[j] += stepSize;
+          findError(moved, goalLength, movedError);
+          for (int i = 0; i < numLegs; i++) {
+            A[i][j] = (movedError[i] - legResidual[i]) / stepSize;
+          }
+        }
+        for (int i = 0; i < numLegs; i++) {
+          A[i][6] = -legResidual[i];
+        }
+
+        float step[6];
+        if (!solveLinear(A, step)) {
+          break;
+        }
+        for (int k = 0; k < 6; k++) {
+          guess[k] += step[k];
+        }
+        iterations++;
+        maxResidual = findError(guess, goalLength, legResidual);
+      }
+      converged = (maxResidual <= tolerance);
+
+      for (int i = 0; i < 6; i++) {
+        pose[i] = guess[i];
+        if (converged) {      // only warm start from poses that were solved
+          estimate[i] = guess[i];
+        }
+      }
+      return converged;
+    }
+
+    //************************************************RESULTS********************************
+    /*
+       isConverged - check if the last solve converged
+    */
+    boolean isConverged() {
+      return converged;
+    }
+
+    /*
+       getIterations - number of Newton-Raphson iterations in the last solve
+    */
+    int getIterations() {
+      return iterations;
+    }
+
+    /*
+       getMaxResidual - largest leg length error (in) left after the last solve
+    */
+    float getMaxResidual() {
+      return maxResidual;
+    }
+
+    /*
+       getLegResidual - leg length error (in) of one leg after the last solve
+            int leg - leg number (0-5)
+    */
+    float getLegResidual(int leg) {
+      return legResidual[leg];
+    }
+
+    /*
+       printResult - print the iterations, convergence and residual of the last solve
+    */
+    void printResult() {
+      Serial.print("FK iterations = "); Serial.print(iterations);
+      Serial.print("  converged = "); Serial.print(converged);
+      Serial.print("  residual (in) = "); Serial.println(maxResidual, 6);
+    }
+};
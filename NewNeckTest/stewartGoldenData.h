@@ -0,0 +1,6897 @@
+/**********************************************************************************
+  stewartGoldenData.h
+
+  Generated by MATLAB/stewartGoldenData.m (or stewartGoldenData.py) - do not edit by hand.
+  Reference servo angles from the MATLAB model for the z, wx, wy and wz sweeps
+  (all other pose values are 0 and z is homeZ when it is not swept).
+ *********************************************************************************/
+
+const int goldenNumSweeps = 4;
+const int goldenSweepAxis[4] = {2, 3, 4, 5}; // pose value changed by each sweep
+const int goldenThetaStart[5] = {0, 1000, 1689, 2559, 2951}; // first row of each sweep in goldenPose and goldenTheta
+const int goldenDegStart[5] = {0, 67, 357, 742, 971}; // first row of each sweep in goldenDeg
+
+// swept pose value for each row (inches for z, radians for wx, wy and wz)
+const float goldenPose[2951] PROGMEM = {
+  3.0750000,
+  3.0778313,
+  3.0806625,
+  3.0834938,
+  3.0863250,
+  3.0891563,
+  3.0919876,
+  3.0948188,
+  3.0976501,
+  3.1004813,
+  3.1033126,
+  3.1061438,
+  3.1089751,
+  3.1118064,
+  3.1146376,
+  3.1174689,
+  3.1203001,
+  3.1231314,
+  3.1259627,
+  3.1287939,
+  3.1316252,
+  3.1344564,
+  3.1372877,
+  3.1401189,
+  3.1429502,
+  3.1457815,
+  3.1486127,
+  3.1514440,
+  3.1542752,
+  3.1571065,
+  3.1599378,
+  3.1627690,
+  3.1656003,
+  3.1684315,
+  3.1712628,
+  3.1740940,
+  3.1769253,
+  3.1797566,
+  3.1825878,
+  3.1854191,
+  3.1882503,
+  3.1910816,
+  3.1939129,
+  3.1967441,
+  3.1995754,
+  3.2024066,
+  3.2052379,
+  3.2080691,
+  3.2109004,
+  3.2137317,
+  3.2165629,
+  3.2193942,
+  3.2222254,
+  3.2250567,
+  3.2278880,
+  3.2307192,
+  3.2335505,
+  3.2363817,
+  3.2392130,
+  3.2420442,
+  3.2448755,
+  3.2477068,
+  3.2505380,
+  3.2533693,
+  3.2562005,
+  3.2590318,
+  3.2618631,
+  3.2646943,
+  3.2675256,
+  3.2703568,
+  3.2731881,
+  3.2760193,
+  3.2788506,
+  3.2816819,
+  3.2845131,
+  3.2873444,
+  3.2901756,
+  3.2930069,
+  3.2958382,
+  3.2986694,
+  3.3015007,
+  3.3043319,
+  3.3071632,
+  3.3099944,
+  3.3128257,
+  3.3156570,
+  3.3184882,
+  3.3213195,
+  3.3241507,
+  3.3269820,
+  3.3298133,
+  3.3326445,
+  3.3354758,
+  3.3383070,
+  3.3411383,
+  3.3439695,
+  3.3468008,
+  3.3496321,
+  3.3524633,
+  3.3552946,
+  3.3581258,
+  3.3609571,
+  3.3637884,
+  3.3666196,
+  3.3694509,
+  3.3722821,
+  3.3751134,
+  3.3779446,
+  3.3807759,
+  3.3836072,
+  3.3864384,
+  3.3892697,
+  3.3921009,
+  3.3949322,
+  3.3977635,
+  3.4005947,
+  3.4034260,
+  3.4062572,
+  3.4090885,
+  3.4119197,
+  3.4147510,
+  3.4175823,
+  3.4204135,
+  3.4232448,
+  3.4260760,
+  3.4289073,
+  3.4317386,
+  3.4345698,
+  3.4374011,
+  3.4402323,
+  3.4430636,
+  3.4458948,
+  3.4487261,
+  3.4515574,
+  3.4543886,
+  3.4572199,
+  3.4600511,
+  3.4628824,
+  3.4657137,
+  3.4685449,
+  3.4713762,
+  3.4742074,
+  3.4770387,
+  3.4798699,
+  3.4827012,
+  3.4855325,
+  3.4883637,
+  3.4911950,
+  3.4940262,
+  3.4968575,
+  3.4996888,
+  3.5025200,
+  3.5053513,
+  3.5081825,
+  3.5110138,
+  3.5138450,
+  3.5166763,
+  3.5195076,
+  3.5223388,
+  3.5251701,
+  3.5280013,
+  3.5308326,
+  3.5336639,
+  3.5364951,
+  3.5393264,
+  3.5421576,
+  3.5449889,
+  3.5478201,
+  3.5506514,
+  3.5534827,
+  3.5563139,
+  3.5591452,
+  3.5619764,
+  3.5648077,
+  3.5676390,
+  3.5704702,
+  3.5733015,
+  3.5761327,
+  3.5789640,
+  3.5817953,
+  3.5846265,
+  3.5874578,
+  3.5902890,
+  3.5931203,
+  3.5959515,
+  3.5987828,
+  3.6016141,
+  3.6044453,
+  3.6072766,
+  3.6101078,
+  3.6129391,
+  3.6157704,
+  3.6186016,
+  3.6214329,
+  3.6242641,
+  3.6270954,
+  3.6299266,
+  3.6327579,
+  3.6355892,
+  3.6384204,
+  3.6412517,
+  3.6440829,
+  3.6469142,
+  3.6497455,
+  3.6525767,
+  3.6554080,
+  3.6582392,
+  3.6610705,
+  3.6639017,
+  3.6667330,
+  3.6695643,
+  3.6723955,
+  3.6752268,
+  3.6780580,
+  3.6808893,
+  3.6837206,
+  3.6865518,
+  3.6893831,
+  3.6922143,
+  3.6950456,
+  3.6978768,
+  3.7007081,
+  3.7035394,
+  3.7063706,
+  3.7092019,
+  3.7120331,
+  3.7148644,
+  3.7176957,
+  3.7205269,
+  3.7233582,
+  3.7261894,
+  3.7290207,
+  3.7318519,
+  3.7346832,
+  3.7375145,
+  3.7403457,
+  3.7431770,
+  3.7460082,
+  3.7488395,
+  3.7516708,
+  3.7545020,
+  3.7573333,
+  3.7601645,
+  3.7629958,
+  3.7658270,
+  3.7686583,
+  3.7714896,
+  3.7743208,
+  3.7771521,
+  3.7799833,
+  3.7828146,
+  3.7856459,
+  3.7884771,
+  3.7913084,
+  3.7941396,
+  3.7969709,
+  3.7998021,
+  3.8026334,
+  3.8054647,
+  3.8082959,
+  3.8111272,
+  3.8139584,
+  3.8167897,
+  3.8196210,
+  3.8224522,
+  3.8252835,
+  3.8281147,
+  3.8309460,
+  3.8337772,
+  3.8366085,
+  3.8394398,
+  3.8422710,
+  3.8451023,
+  3.8479335,
+  3.8507648,
+  3.8535961,
+  3.8564273,
+  3.8592586,
+  3.8620898,
+  3.8649211,
+  3.8677523,
+  3.8705836,
+  3.8734149,
+  3.8762461,
+  3.8790774,
+  3.8819086,
+  3.8847399,
+  3.8875712,
+  3.8904024,
+  3.8932337,
+  3.8960649,
+  3.8988962,
+  3.9017274,
+  3.9045587,
+  3.9073900,
+  3.9102212,
+  3.9130525,
+  3.9158837,
+  3.9187150,
+  3.9215463,
+  3.9243775,
+  3.9272088,
+  3.9300400,
+  3.9328713,
+  3.9357025,
+  3.9385338,
+  3.9413651,
+  3.9441963,
+  3.9470276,
+  3.9498588,
+  3.9526901,
+  3.9555214,
+  3.9583526,
+  3.9611839,
+  3.9640151,
+  3.9668464,
+  3.9696776,
+  3.9725089,
+  3.9753402,
+  3.9781714,
+  3.9810027,
+  3.9838339,
+  3.9866652,
+  3.9894965,
+  3.9923277,
+  3.9951590,
+  3.9979902,
+  4.0008215,
+  4.0036527,
+  4.0064840,
+  4.0093153,
+  4.0121465,
+  4.0149778,
+  4.0178090,
+  4.0206403,
+  4.0234716,
+  4.0263028,
+  4.0291341,
+  4.0319653,
+  4.0347966,
+  4.0376279,
+  4.0404591,
+  4.0432904,
+  4.0461216,
+  4.0489529,
+  4.0517841,
+  4.0546154,
+  4.0574467,
+  4.0602779,
+  4.0631092,
+  4.0659404,
+  4.0687717,
+  4.0716030,
+  4.0744342,
+  4.0772655,
+  4.0800967,
+  4.0829280,
+  4.0857592,
+  4.0885905,
+  4.0914218,
+  4.0942530,
+  4.0970843,
+  4.0999155,
+  4.1027468,
+  4.1055781,
+  4.1084093,
+  4.1112406,
+  4.1140718,
+  4.1169031,
+  4.1197343,
+  4.1225656,
+  4.1253969,
+  4.1282281,
+  4.1310594,
+  4.1338906,
+  4.1367219,
+  4.1395532,
+  4.1423844,
+  4.1452157,
+  4.1480469,
+  4.1508782,
+  4.1537094,
+  4.1565407,
+  4.1593720,
+  4.1622032,
+  4.1650345,
+  4.1678657,
+  4.1706970,
+  4.1735283,
+  4.1763595,
+  4.1791908,
+  4.1820220,
+  4.1848533,
+  4.1876845,
+  4.1905158,
+  4.1933471,
+  4.1961783,
+  4.1990096,
+  4.2018408,
+  4.2046721,
+  4.2075034,
+  4.2103346,
+  4.2131659,
+  4.2159971,
+  4.2188284,
+  4.2216596,
+  4.2244909,
+  4.2273222,
+  4.2301534,
+  4.2329847,
+  4.2358159,
+  4.2386472,
+  4.2414785,
+  4.2443097,
+  4.2471410,
+  4.2499722,
+  4.2528035,
+  4.2556347,
+  4.2584660,
+  4.2612973,
+  4.2641285,
+  4.2669598,
+  4.2697910,
+  4.2726223,
+  4.2754536,
+  4.2782848,
+  4.2811161,
+  4.2839473,
+  4.2867786,
+  4.2896098,
+  4.2924411,
+  4.2952724,
+  4.2981036,
+  4.3009349,
+  4.3037661,
+  4.3065974,
+  4.3094287,
+  4.3122599,
+  4.3150912,
+  4.3179224,
+  4.3207537,
+  4.3235849,
+  4.3264162,
+  4.3292475,
+  4.3320787,
+  4.3349100,
+  4.3377412,
+  4.3405725,
+  4.3434038,
+  4.3462350,
+  4.3490663,
+  4.3518975,
+  4.3547288,
+  4.3575600,
+  4.3603913,
+  4.3632226,
+  4.3660538,
+  4.3688851,
+  4.3717163,
+  4.3745476,
+  4.3773789,
+  4.3802101,
+  4.3830414,
+  4.3858726,
+  4.3887039,
+  4.3915351,
+  4.3943664,
+  4.3971977,
+  4.4000289,
+  4.4028602,
+  4.4056914,
+  4.4085227,
+  4.4113540,
+  4.4141852,
+  4.4170165,
+  4.4198477,
+  4.4226790,
+  4.4255102,
+  4.4283415,
+  4.4311728,
+  4.4340040,
+  4.4368353,
+  4.4396665,
+  4.4424978,
+  4.4453291,
+  4.4481603,
+  4.4509916,
+  4.4538228,
+  4.4566541,
+  4.4594853,
+  4.4623166,
+  4.4651479,
+  4.4679791,
+  4.4708104,
+  4.4736416,
+  4.4764729,
+  4.4793042,
+  4.4821354,
+  4.4849667,
+  4.4877979,
+  4.4906292,
+  4.4934604,
+  4.4962917,
+  4.4991230,
+  4.5019542,
+  4.5047855,
+  4.5076167,
+  4.5104480,
+  4.5132793,
+  4.5161105,
+  4.5189418,
+  4.5217730,
+  4.5246043,
+  4.5274356,
+  4.5302668,
+  4.5330981,
+  4.5359293,
+  4.5387606,
+  4.5415918,
+  4.5444231,
+  4.5472544,
+  4.5500856,
+  4.5529169,
+  4.5557481,
+  4.5585794,
+  4.5614107,
+  4.5642419,
+  4.5670732,
+  4.5699044,
+  4.5727357,
+  4.5755669,
+  4.5783982,
+  4.5812295,
+  4.5840607,
+  4.5868920,
+  4.5897232,
+  4.5925545,
+  4.5953858,
+  4.5982170,
+  4.6010483,
+  4.6038795,
+  4.6067108,
+  4.6095420,
+  4.6123733,
+  4.6152046,
+  4.6180358,
+  4.6208671,
+  4.6236983,
+  4.6265296,
+  4.6293609,
+  4.6321921,
+  4.6350234,
+  4.6378546,
+  4.6406859,
+  4.6435171,
+  4.6463484,
+  4.6491797,
+  4.6520109,
+  4.6548422,
+  4.6576734,
+  4.6605047,
+  4.6633360,
+  4.6661672,
+  4.6689985,
+  4.6718297,
+  4.6746610,
+  4.6774922,
+  4.6803235,
+  4.6831548,
+  4.6859860,
+  4.6888173,
+  4.6916485,
+  4.6944798,
+  4.6973111,
+  4.7001423,
+  4.7029736,
+  4.7058048,
+  4.7086361,
+  4.7114673,
+  4.7142986,
+  4.7171299,
+  4.7199611,
+  4.7227924,
+  4.7256236,
+  4.7284549,
+  4.7312862,
+  4.7341174,
+  4.7369487,
+  4.7397799,
+  4.7426112,
+  4.7454424,
+  4.7482737,
+  4.7511050,
+  4.7539362,
+  4.7567675,
+  4.7595987,
+  4.7624300,
+  4.7652613,
+  4.7680925,
+  4.7709238,
+  4.7737550,
+  4.7765863,
+  4.7794175,
+  4.7822488,
+  4.7850801,
+  4.7879113,
+  4.7907426,
+  4.7935738,
+  4.7964051,
+  4.7992364,
+  4.8020676,
+  4.8048989,
+  4.8077301,
+  4.8105614,
+  4.8133926,
+  4.8162239,
+  4.8190552,
+  4.8218864,
+  4.8247177,
+  4.8275489,
+  4.8303802,
+  4.8332115,
+  4.8360427,
+  4.8388740,
+  4.8417052,
+  4.8445365,
+  4.8473677,
+  4.8501990,
+  4.8530303,
+  4.8558615,
+  4.8586928,
+  4.8615240,
+  4.8643553,
+  4.8671866,
+  4.8700178,
+  4.8728491,
+  4.8756803,
+  4.8785116,
+  4.8813428,
+  4.8841741,
+  4.8870054,
+  4.8898366,
+  4.8926679,
+  4.8954991,
+  4.8983304,
+  4.9011617,
+  4.9039929,
+  4.9068242,
+  4.9096554,
+  4.9124867,
+  4.9153179,
+  4.9181492,
+  4.9209805,
+  4.9238117,
+  4.9266430,
+  4.9294742,
+  4.9323055,
+  4.9351368,
+  4.9379680,
+  4.9407993,
+  4.9436305,
+  4.9464618,
+  4.9492930,
+  4.9521243,
+  4.9549556,
+  4.9577868,
+  4.9606181,
+  4.9634493,
+  4.9662806,
+  4.9691119,
+  4.9719431,
+  4.9747744,
+  4.9776056,
+  4.9804369,
+  4.9832682,
+  4.9860994,
+  4.9889307,
+  4.9917619,
+  4.9945932,
+  4.9974244,
+  5.0002557,
+  5.0030870,
+  5.0059182,
+  5.0087495,
+  5.0115807,
+  5.0144120,
+  5.0172433,
+  5.0200745,
+  5.0229058,
+  5.0257370,
+  5.0285683,
+  5.0313995,
+  5.0342308,
+  5.0370621,
+  5.0398933,
+  5.0427246,
+  5.0455558,
+  5.0483871,
+  5.0512184,
+  5.0540496,
+  5.0568809,
+  5.0597121,
+  5.0625434,
+  5.0653746,
+  5.0682059,
+  5.0710372,
+  5.0738684,
+  5.0766997,
+  5.0795309,
+  5.0823622,
+  5.0851935,
+  5.0880247,
+  5.0908560,
+  5.0936872,
+  5.0965185,
+  5.0993497,
+  5.1021810,
+  5.1050123,
+  5.1078435,
+  5.1106748,
+  5.1135060,
+  5.1163373,
+  5.1191686,
+  5.1219998,
+  5.1248311,
+  5.1276623,
+  5.1304936,
+  5.1333248,
+  5.1361561,
+  5.1389874,
+  5.1418186,
+  5.1446499,
+  5.1474811,
+  5.1503124,
+  5.1531437,
+  5.1559749,
+  5.1588062,
+  5.1616374,
+  5.1644687,
+  5.1672999,
+  5.1701312,
+  5.1729625,
+  5.1757937,
+  5.1786250,
+  5.1814562,
+  5.1842875,
+  5.1871188,
+  5.1899500,
+  5.1927813,
+  5.1956125,
+  5.1984438,
+  5.2012750,
+  5.2041063,
+  5.2069376,
+  5.2097688,
+  5.2126001,
+  5.2154313,
+  5.2182626,
+  5.2210939,
+  5.2239251,
+  5.2267564,
+  5.2295876,
+  5.2324189,
+  5.2352501,
+  5.2380814,
+  5.2409127,
+  5.2437439,
+  5.2465752,
+  5.2494064,
+  5.2522377,
+  5.2550690,
+  5.2579002,
+  5.2607315,
+  5.2635627,
+  5.2663940,
+  5.2692252,
+  5.2720565,
+  5.2748878,
+  5.2777190,
+  5.2805503,
+  5.2833815,
+  5.2862128,
+  5.2890441,
+  5.2918753,
+  5.2947066,
+  5.2975378,
+  5.3003691,
+  5.3032003,
+  5.3060316,
+  5.3088629,
+  5.3116941,
+  5.3145254,
+  5.3173566,
+  5.3201879,
+  5.3230192,
+  5.3258504,
+  5.3286817,
+  5.3315129,
+  5.3343442,
+  5.3371754,
+  5.3400067,
+  5.3428380,
+  5.3456692,
+  5.3485005,
+  5.3513317,
+  5.3541630,
+  5.3569943,
+  5.3598255,
+  5.3626568,
+  5.3654880,
+  5.3683193,
+  5.3711505,
+  5.3739818,
+  5.3768131,
+  5.3796443,
+  5.3824756,
+  5.3853068,
+  5.3881381,
+  5.3909694,
+  5.3938006,
+  5.3966319,
+  5.3994631,
+  5.4022944,
+  5.4051256,
+  5.4079569,
+  5.4107882,
+  5.4136194,
+  5.4164507,
+  5.4192819,
+  5.4221132,
+  5.4249445,
+  5.4277757,
+  5.4306070,
+  5.4334382,
+  5.4362695,
+  5.4391007,
+  5.4419320,
+  5.4447633,
+  5.4475945,
+  5.4504258,
+  5.4532570,
+  5.4560883,
+  5.4589196,
+  5.4617508,
+  5.4645821,
+  5.4674133,
+  5.4702446,
+  5.4730759,
+  5.4759071,
+  5.4787384,
+  5.4815696,
+  5.4844009,
+  5.4872321,
+  5.4900634,
+  5.4928947,
+  5.4957259,
+  5.4985572,
+  5.5013884,
+  5.5042197,
+  5.5070510,
+  5.5098822,
+  5.5127135,
+  5.5155447,
+  5.5183760,
+  5.5212072,
+  5.5240385,
+  5.5268698,
+  5.5297010,
+  5.5325323,
+  5.5353635,
+  5.5381948,
+  5.5410261,
+  5.5438573,
+  5.5466886,
+  5.5495198,
+  5.5523511,
+  5.5551823,
+  5.5580136,
+  5.5608449,
+  5.5636761,
+  5.5665074,
+  5.5693386,
+  5.5721699,
+  5.5750012,
+  5.5778324,
+  5.5806637,
+  5.5834949,
+  5.5863262,
+  5.5891574,
+  5.5919887,
+  5.5948200,
+  5.5976512,
+  5.6004825,
+  5.6033137,
+  5.6061450,
+  5.6089763,
+  5.6118075,
+  5.6146388,
+  5.6174700,
+  5.6203013,
+  5.6231325,
+  5.6259638,
+  5.6287951,
+  5.6316263,
+  5.6344576,
+  5.6372888,
+  5.6401201,
+  5.6429514,
+  5.6457826,
+  5.6486139,
+  5.6514451,
+  5.6542764,
+  5.6571076,
+  5.6599389,
+  5.6627702,
+  5.6656014,
+  5.6684327,
+  5.6712639,
+  5.6740952,
+  5.6769265,
+  5.6797577,
+  5.6825890,
+  5.6854202,
+  5.6882515,
+  5.6910827,
+  5.6939140,
+  5.6967453,
+  5.6995765,
+  5.7024078,
+  5.7052390,
+  5.7080703,
+  5.7109016,
+  5.7137328,
+  5.7165641,
+  5.7193953,
+  5.7222266,
+  5.7250578,
+  5.7278891,
+  5.7307204,
+  5.7335516,
+  5.7363829,
+  5.7392141,
+  5.7420454,
+  5.7448767,
+  5.7477079,
+  5.7505392,
+  5.7533704,
+  5.7562017,
+  5.7590329,
+  5.7618642,
+  5.7646955,
+  5.7675267,
+  5.7703580,
+  5.7731892,
+  5.7760205,
+  5.7788518,
+  5.7816830,
+  5.7845143,
+  5.7873455,
+  5.7901768,
+  5.7930080,
+  5.7958393,
+  5.7986706,
+  5.8015018,
+  5.8043331,
+  5.8071643,
+  5.8099956,
+  5.8128269,
+  5.8156581,
+  5.8184894,
+  5.8213206,
+  5.8241519,
+  5.8269831,
+  5.8298144,
+  5.8326457,
+  5.8354769,
+  5.8383082,
+  5.8411394,
+  5.8439707,
+  5.8468020,
+  5.8496332,
+  5.8524645,
+  5.8552957,
+  5.8581270,
+  5.8609582,
+  5.8637895,
+  5.8666208,
+  5.8694520,
+  5.8722833,
+  5.8751145,
+  5.8779458,
+  5.8807771,
+  5.8836083,
+  5.8864396,
+  5.8892708,
+  5.8921021,
+  5.8949333,
+  5.8977646,
+  5.9005959,
+  5.9034271,
+  -1.0040448,
+  -1.0015989,
+  -0.9991530,
+  -0.9967070,
+  -0.9942611,
+  -0.9918152,
+  -0.9893693,
+  -0.9869234,
+  -0.9844775,
+  -0.9820316,
+  -0.9795857,
+  -0.9771398,
+  -0.9746939,
+  -0.9722480,
+  -0.9698021,
+  -0.9673562,
+  -0.9649103,
+  -0.9624643,
+  -0.9600184,
+  -0.9575725,
+  -0.9551266,
+  -0.9526807,
+  -0.9502348,
+  -0.9477889,
+  -0.9453430,
+  -0.9428971,
+  -0.9404512,
+  -0.9380053,
+  -0.9355594,
+  -0.9331135,
+  -0.9306676,
+  -0.9282217,
+  -0.9257757,
+  -0.9233298,
+  -0.9208839,
+  -0.9184380,
+  -0.9159921,
+  -0.9135462,
+  -0.9111003,
+  -0.9086544,
+  -0.9062085,
+  -0.9037626,
+  -0.9013167,
+  -0.8988708,
+  -0.8964249,
+  -0.8939790,
+  -0.8915331,
+  -0.8890871,
+  -0.8866412,
+  -0.8841953,
+  -0.8817494,
+  -0.8793035,
+  -0.8768576,
+  -0.8744117,
+  -0.8719658,
+  -0.8695199,
+  -0.8670740,
+  -0.8646281,
+  -0.8621822,
+  -0.8597363,
+  -0.8572904,
+  -0.8548444,
+  -0.8523985,
+  -0.8499526,
+  -0.8475067,
+  -0.8450608,
+  -0.8426149,
+  -0.8401690,
+  -0.8377231,
+  -0.8352772,
+  -0.8328313,
+  -0.8303854,
+  -0.8279395,
+  -0.8254936,
+  -0.8230477,
+  -0.8206018,
+  -0.8181558,
+  -0.8157099,
+  -0.8132640,
+  -0.8108181,
+  -0.8083722,
+  -0.8059263,
+  -0.8034804,
+  -0.8010345,
+  -0.7985886,
+  -0.7961427,
+  -0.7936968,
+  -0.7912509,
+  -0.7888050,
+  -0.7863591,
+  -0.7839131,
+  -0.7814672,
+  -0.7790213,
+  -0.7765754,
+  -0.7741295,
+  -0.7716836,
+  -0.7692377,
+  -0.7667918,
+  -0.7643459,
+  -0.7619000,
+  -0.7594541,
+  -0.7570082,
+  -0.7545623,
+  -0.7521164,
+  -0.7496705,
+  -0.7472245,
+  -0.7447786,
+  -0.7423327,
+  -0.7398868,
+  -0.7374409,
+  -0.7349950,
+  -0.7325491,
+  -0.7301032,
+  -0.7276573,
+  -0.7252114,
+  -0.7227655,
+  -0.7203196,
+  -0.7178737,
+  -0.7154278,
+  -0.7129818,
+  -0.7105359,
+  -0.7080900,
+  -0.7056441,
+  -0.7031982,
+  -0.7007523,
+  -0.6983064,
+  -0.6958605,
+  -0.6934146,
+  -0.6909687,
+  -0.6885228,
+  -0.6860769,
+  -0.6836310,
+  -0.6811851,
+  -0.6787392,
+  -0.6762932,
+  -0.6738473,
+  -0.6714014,
+  -0.6689555,
+  -0.6665096,
+  -0.6640637,
+  -0.6616178,
+  -0.6591719,
+  -0.6567260,
+  -0.6542801,
+  -0.6518342,
+  -0.6493883,
+  -0.6469424,
+  -0.6444965,
+  -0.6420506,
+  -0.6396046,
+  -0.6371587,
+  -0.6347128,
+  -0.6322669,
+  -0.6298210,
+  -0.6273751,
+  -0.6249292,
+  -0.6224833,
+  -0.6200374,
+  -0.6175915,
+  -0.6151456,
+  -0.6126997,
+  -0.6102538,
+  -0.6078079,
+  -0.6053619,
+  -0.6029160,
+  -0.6004701,
+  -0.5980242,
+  -0.5955783,
+  -0.5931324,
+  -0.5906865,
+  -0.5882406,
+  -0.5857947,
+  -0.5833488,
+  -0.5809029,
+  -0.5784570,
+  -0.5760111,
+  -0.5735652,
+  -0.5711193,
+  -0.5686733,
+  -0.5662274,
+  -0.5637815,
+  -0.5613356,
+  -0.5588897,
+  -0.5564438,
+  -0.5539979,
+  -0.5515520,
+  -0.5491061,
+  -0.5466602,
+  -0.5442143,
+  -0.5417684,
+  -0.5393225,
+  -0.5368766,
+  -0.5344306,
+  -0.5319847,
+  -0.5295388,
+  -0.5270929,
+  -0.5246470,
+  -0.5222011,
+  -0.5197552,
+  -0.5173093,
+  -0.5148634,
+  -0.5124175,
+  -0.5099716,
+  -0.5075257,
+  -0.5050798,
+  -0.5026339,
+  -0.5001880,
+  -0.4977420,
+  -0.4952961,
+  -0.4928502,
+  -0.4904043,
+  -0.4879584,
+  -0.4855125,
+  -0.4830666,
+  -0.4806207,
+  -0.4781748,
+  -0.4757289,
+  -0.4732830,
+  -0.4708371,
+  -0.4683912,
+  -0.4659453,
+  -0.4634993,
+  -0.4610534,
+  -0.4586075,
+  -0.4561616,
+  -0.4537157,
+  -0.4512698,
+  -0.4488239,
+  -0.4463780,
+  -0.4439321,
+  -0.4414862,
+  -0.4390403,
+  -0.4365944,
+  -0.4341485,
+  -0.4317026,
+  -0.4292567,
+  -0.4268107,
+  -0.4243648,
+  -0.4219189,
+  -0.4194730,
+  -0.4170271,
+  -0.4145812,
+  -0.4121353,
+  -0.4096894,
+  -0.4072435,
+  -0.4047976,
+  -0.4023517,
+  -0.3999058,
+  -0.3974599,
+  -0.3950140,
+  -0.3925681,
+  -0.3901221,
+  -0.3876762,
+  -0.3852303,
+  -0.3827844,
+  -0.3803385,
+  -0.3778926,
+  -0.3754467,
+  -0.3730008,
+  -0.3705549,
+  -0.3681090,
+  -0.3656631,
+  -0.3632172,
+  -0.3607713,
+  -0.3583254,
+  -0.3558794,
+  -0.3534335,
+  -0.3509876,
+  -0.3485417,
+  -0.3460958,
+  -0.3436499,
+  -0.3412040,
+  -0.3387581,
+  -0.3363122,
+  -0.3338663,
+  -0.3314204,
+  -0.3289745,
+  -0.3265286,
+  -0.3240827,
+  -0.3216368,
+  -0.3191908,
+  -0.3167449,
+  -0.3142990,
+  -0.3118531,
+  -0.3094072,
+  -0.3069613,
+  -0.3045154,
+  -0.3020695,
+  -0.2996236,
+  -0.2971777,
+  -0.2947318,
+  -0.2922859,
+  -0.2898400,
+  -0.2873941,
+  -0.2849481,
+  -0.2825022,
+  -0.2800563,
+  -0.2776104,
+  -0.2751645,
+  -0.2727186,
+  -0.2702727,
+  -0.2678268,
+  -0.2653809,
+  -0.2629350,
+  -0.2604891,
+  -0.2580432,
+  -0.2555973,
+  -0.2531514,
+  -0.2507055,
+  -0.2482595,
+  -0.2458136,
+  -0.2433677,
+  -0.2409218,
+  -0.2384759,
+  -0.2360300,
+  -0.2335841,
+  -0.2311382,
+  -0.2286923,
+  -0.2262464,
+  -0.2238005,
+  -0.2213546,
+  -0.2189087,
+  -0.2164628,
+  -0.2140169,
+  -0.2115709,
+  -0.2091250,
+  -0.2066791,
+  -0.2042332,
+  -0.2017873,
+  -0.1993414,
+  -0.1968955,
+  -0.1944496,
+  -0.1920037,
+  -0.1895578,
+  -0.1871119,
+  -0.1846660,
+  -0.1822201,
+  -0.1797742,
+  -0.1773282,
+  -0.1748823,
+  -0.1724364,
+  -0.1699905,
+  -0.1675446,
+  -0.1650987,
+  -0.1626528,
+  -0.1602069,
+  -0.1577610,
+  -0.1553151,
+  -0.1528692,
+  -0.1504233,
+  -0.1479774,
+  -0.1455315,
+  -0.1430856,
+  -0.1406396,
+  -0.1381937,
+  -0.1357478,
+  -0.1333019,
+  -0.1308560,
+  -0.1284101,
+  -0.1259642,
+  -0.1235183,
+  -0.1210724,
+  -0.1186265,
+  -0.1161806,
+  -0.1137347,
+  -0.1112888,
+  -0.1088429,
+  -0.1063969,
+  -0.1039510,
+  -0.1015051,
+  -0.0990592,
+  -0.0966133,
+  -0.0941674,
+  -0.0917215,
+  -0.0892756,
+  -0.0868297,
+  -0.0843838,
+  -0.0819379,
+  -0.0794920,
+  -0.0770461,
+  -0.0746002,
+  -0.0721543,
+  -0.0697083,
+  -0.0672624,
+  -0.0648165,
+  -0.0623706,
+  -0.0599247,
+  -0.0574788,
+  -0.0550329,
+  -0.0525870,
+  -0.0501411,
+  -0.0476952,
+  -0.0452493,
+  -0.0428034,
+  -0.0403575,
+  -0.0379116,
+  -0.0354656,
+  -0.0330197,
+  -0.0305738,
+  -0.0281279,
+  -0.0256820,
+  -0.0232361,
+  -0.0207902,
+  -0.0183443,
+  -0.0158984,
+  -0.0134525,
+  -0.0110066,
+  -0.0085607,
+  -0.0061148,
+  -0.0036689,
+  -0.0012230,
+  0.0012230,
+  0.0036689,
+  0.0061148,
+  0.0085607,
+  0.0110066,
+  0.0134525,
+  0.0158984,
+  0.0183443,
+  0.0207902,
+  0.0232361,
+  0.0256820,
+  0.0281279,
+  0.0305738,
+  0.0330197,
+  0.0354656,
+  0.0379116,
+  0.0403575,
+  0.0428034,
+  0.0452493,
+  0.0476952,
+  0.0501411,
+  0.0525870,
+  0.0550329,
+  0.0574788,
+  0.0599247,
+  0.0623706,
+  0.0648165,
+  0.0672624,
+  0.0697083,
+  0.0721543,
+  0.0746002,
+  0.0770461,
+  0.0794920,
+  0.0819379,
+  0.0843838,
+  0.0868297,
+  0.0892756,
+  0.0917215,
+  0.0941674,
+  0.0966133,
+  0.0990592,
+  0.1015051,
+  0.1039510,
+  0.1063969,
+  0.1088429,
+  0.1112888,
+  0.1137347,
+  0.1161806,
+  0.1186265,
+  0.1210724,
+  0.1235183,
+  0.1259642,
+  0.1284101,
+  0.1308560,
+  0.1333019,
+  0.1357478,
+  0.1381937,
+  0.1406396,
+  0.1430856,
+  0.1455315,
+  0.1479774,
+  0.1504233,
+  0.1528692,
+  0.1553151,
+  0.1577610,
+  0.1602069,
+  0.1626528,
+  0.1650987,
+  0.1675446,
+  0.1699905,
+  0.1724364,
+  0.1748823,
+  0.1773282,
+  0.1797742,
+  0.1822201,
+  0.1846660,
+  0.1871119,
+  0.1895578,
+  0.1920037,
+  0.1944496,
+  0.1968955,
+  0.1993414,
+  0.2017873,
+  0.2042332,
+  0.2066791,
+  0.2091250,
+  0.2115709,
+  0.2140169,
+  0.2164628,
+  0.2189087,
+  0.2213546,
+  0.2238005,
+  0.2262464,
+  0.2286923,
+  0.2311382,
+  0.2335841,
+  0.2360300,
+  0.2384759,
+  0.2409218,
+  0.2433677,
+  0.2458136,
+  0.2482595,
+  0.2507055,
+  0.2531514,
+  0.2555973,
+  0.2580432,
+  0.2604891,
+  0.2629350,
+  0.2653809,
+  0.2678268,
+  0.2702727,
+  0.2727186,
+  0.2751645,
+  0.2776104,
+  0.2800563,
+  0.2825022,
+  0.2849481,
+  0.2873941,
+  0.2898400,
+  0.2922859,
+  0.2947318,
+  0.2971777,
+  0.2996236,
+  0.3020695,
+  0.3045154,
+  0.3069613,
+  0.3094072,
+  0.3118531,
+  0.3142990,
+  0.3167449,
+  0.3191908,
+  0.3216368,
+  0.3240827,
+  0.3265286,
+  0.3289745,
+  0.3314204,
+  0.3338663,
+  0.3363122,
+  0.3387581,
+  0.3412040,
+  0.3436499,
+  0.3460958,
+  0.3485417,
+  0.3509876,
+  0.3534335,
+  0.3558794,
+  0.3583254,
+  0.3607713,
+  0.3632172,
+  0.3656631,
+  0.3681090,
+  0.3705549,
+  0.3730008,
+  0.3754467,
+  0.3778926,
+  0.3803385,
+  0.3827844,
+  0.3852303,
+  0.3876762,
+  0.3901221,
+  0.3925681,
+  0.3950140,
+  0.3974599,
+  0.3999058,
+  0.4023517,
+  0.4047976,
+  0.4072435,
+  0.4096894,
+  0.4121353,
+  0.4145812,
+  0.4170271,
+  0.4194730,
+  0.4219189,
+  0.4243648,
+  0.4268107,
+  0.4292567,
+  0.4317026,
+  0.4341485,
+  0.4365944,
+  0.4390403,
+  0.4414862,
+  0.4439321,
+  0.4463780,
+  0.4488239,
+  0.4512698,
+  0.4537157,
+  0.4561616,
+  0.4586075,
+  0.4610534,
+  0.4634993,
+  0.4659453,
+  0.4683912,
+  0.4708371,
+  0.4732830,
+  0.4757289,
+  0.4781748,
+  0.4806207,
+  0.4830666,
+  0.4855125,
+  0.4879584,
+  0.4904043,
+  0.4928502,
+  0.4952961,
+  0.4977420,
+  0.5001880,
+  0.5026339,
+  0.5050798,
+  0.5075257,
+  0.5099716,
+  0.5124175,
+  0.5148634,
+  0.5173093,
+  0.5197552,
+  0.5222011,
+  0.5246470,
+  0.5270929,
+  0.5295388,
+  0.5319847,
+  0.5344306,
+  0.5368766,
+  0.5393225,
+  0.5417684,
+  0.5442143,
+  0.5466602,
+  0.5491061,
+  0.5515520,
+  0.5539979,
+  0.5564438,
+  0.5588897,
+  0.5613356,
+  0.5637815,
+  0.5662274,
+  0.5686733,
+  0.5711193,
+  0.5735652,
+  0.5760111,
+  0.5784570,
+  0.5809029,
+  0.5833488,
+  0.5857947,
+  0.5882406,
+  0.5906865,
+  0.5931324,
+  0.5955783,
+  0.5980242,
+  0.6004701,
+  0.6029160,
+  0.6053619,
+  0.6078079,
+  0.6102538,
+  0.6126997,
+  0.6151456,
+  0.6175915,
+  0.6200374,
+  0.6224833,
+  0.6249292,
+  0.6273751,
+  0.6298210,
+  0.6322669,
+  0.6347128,
+  0.6371587,
+  0.6396046,
+  0.6420506,
+  0.6444965,
+  0.6469424,
+  0.6493883,
+  0.6518342,
+  0.6542801,
+  0.6567260,
+  0.6591719,
+  0.6616178,
+  0.6640637,
+  0.6665096,
+  0.6689555,
+  0.6714014,
+  0.6738473,
+  0.6762932,
+  0.6787392,
+  -0.6831942,
+  -0.6816218,
+  -0.6800495,
+  -0.6784771,
+  -0.6769047,
+  -0.6753324,
+  -0.6737600,
+  -0.6721876,
+  -0.6706152,
+  -0.6690429,
+  -0.6674705,
+  -0.6658981,
+  -0.6643258,
+  -0.6627534,
+  -0.6611810,
+  -0.6596087,
+  -0.6580363,
+  -0.6564639,
+  -0.6548916,
+  -0.6533192,
+  -0.6517468,
+  -0.6501745,
+  -0.6486021,
+  -0.6470297,
+  -0.6454573,
+  -0.6438850,
+  -0.6423126,
+  -0.6407402,
+  -0.6391679,
+  -0.6375955,
+  -0.6360231,
+  -0.6344508,
+  -0.6328784,
+  -0.6313060,
+  -0.6297337,
+  -0.6281613,
+  -0.6265889,
+  -0.6250166,
+  -0.6234442,
+  -0.6218718,
+  -0.6202995,
+  -0.6187271,
+  -0.6171547,
+  -0.6155823,
+  -0.6140100,
+  -0.6124376,
+  -0.6108652,
+  -0.6092929,
+  -0.6077205,
+  -0.6061481,
+  -0.6045758,
+  -0.6030034,
+  -0.6014310,
+  -0.5998587,
+  -0.5982863,
+  -0.5967139,
+  -0.5951416,
+  -0.5935692,
+  -0.5919968,
+  -0.5904244,
+  -0.5888521,
+  -0.5872797,
+  -0.5857073,
+  -0.5841350,
+  -0.5825626,
+  -0.5809902,
+  -0.5794179,
+  -0.5778455,
+  -0.5762731,
+  -0.5747008,
+  -0.5731284,
+  -0.5715560,
+  -0.5699837,
+  -0.5684113,
+  -0.5668389,
+  -0.5652665,
+  -0.5636942,
+  -0.5621218,
+  -0.5605494,
+  -0.5589771,
+  -0.5574047,
+  -0.5558323,
+  -0.5542600,
+  -0.5526876,
+  -0.5511152,
+  -0.5495429,
+  -0.5479705,
+  -0.5463981,
+  -0.5448258,
+  -0.5432534,
+  -0.5416810,
+  -0.5401086,
+  -0.5385363,
+  -0.5369639,
+  -0.5353915,
+  -0.5338192,
+  -0.5322468,
+  -0.5306744,
+  -0.5291021,
+  -0.5275297,
+  -0.5259573,
+  -0.5243850,
+  -0.5228126,
+  -0.5212402,
+  -0.5196679,
+  -0.5180955,
+  -0.5165231,
+  -0.5149507,
+  -0.5133784,
+  -0.5118060,
+  -0.5102336,
+  -0.5086613,
+  -0.5070889,
+  -0.5055165,
+  -0.5039442,
+  -0.5023718,
+  -0.5007994,
+  -0.4992271,
+  -0.4976547,
+  -0.4960823,
+  -0.4945100,
+  -0.4929376,
+  -0.4913652,
+  -0.4897928,
+  -0.4882205,
+  -0.4866481,
+  -0.4850757,
+  -0.4835034,
+  -0.4819310,
+  -0.4803586,
+  -0.4787863,
+  -0.4772139,
+  -0.4756415,
+  -0.4740692,
+  -0.4724968,
+  -0.4709244,
+  -0.4693521,
+  -0.4677797,
+  -0.4662073,
+  -0.4646349,
+  -0.4630626,
+  -0.4614902,
+  -0.4599178,
+  -0.4583455,
+  -0.4567731,
+  -0.4552007,
+  -0.4536284,
+  -0.4520560,
+  -0.4504836,
+  -0.4489113,
+  -0.4473389,
+  -0.4457665,
+  -0.4441942,
+  -0.4426218,
+  -0.4410494,
+  -0.4394771,
+  -0.4379047,
+  -0.4363323,
+  -0.4347599,
+  -0.4331876,
+  -0.4316152,
+  -0.4300428,
+  -0.4284705,
+  -0.4268981,
+  -0.4253257,
+  -0.4237534,
+  -0.4221810,
+  -0.4206086,
+  -0.4190363,
+  -0.4174639,
+  -0.4158915,
+  -0.4143192,
+  -0.4127468,
+  -0.4111744,
+  -0.4096020,
+  -0.4080297,
+  -0.4064573,
+  -0.4048849,
+  -0.4033126,
+  -0.4017402,
+  -0.4001678,
+  -0.3985955,
+  -0.3970231,
+  -0.3954507,
+  -0.3938784,
+  -0.3923060,
+  -0.3907336,
+  -0.3891613,
+  -0.3875889,
+  -0.3860165,
+  -0.3844441,
+  -0.3828718,
+  -0.3812994,
+  -0.3797270,
+  -0.3781547,
+  -0.3765823,
+  -0.3750099,
+  -0.3734376,
+  -0.3718652,
+  -0.3702928,
+  -0.3687205,
+  -0.3671481,
+  -0.3655757,
+  -0.3640034,
+  -0.3624310,
+  -0.3608586,
+  -0.3592862,
+  -0.3577139,
+  -0.3561415,
+  -0.3545691,
+  -0.3529968,
+  -0.3514244,
+  -0.3498520,
+  -0.3482797,
+  -0.3467073,
+  -0.3451349,
+  -0.3435626,
+  -0.3419902,
+  -0.3404178,
+  -0.3388455,
+  -0.3372731,
+  -0.3357007,
+  -0.3341283,
+  -0.3325560,
+  -0.3309836,
+  -0.3294112,
+  -0.3278389,
+  -0.3262665,
+  -0.3246941,
+  -0.3231218,
+  -0.3215494,
+  -0.3199770,
+  -0.3184047,
+  -0.3168323,
+  -0.3152599,
+  -0.3136876,
+  -0.3121152,
+  -0.3105428,
+  -0.3089704,
+  -0.3073981,
+  -0.3058257,
+  -0.3042533,
+  -0.3026810,
+  -0.3011086,
+  -0.2995362,
+  -0.2979639,
+  -0.2963915,
+  -0.2948191,
+  -0.2932468,
+  -0.2916744,
+  -0.2901020,
+  -0.2885297,
+  -0.2869573,
+  -0.2853849,
+  -0.2838125,
+  -0.2822402,
+  -0.2806678,
+  -0.2790954,
+  -0.2775231,
+  -0.2759507,
+  -0.2743783,
+  -0.2728060,
+  -0.2712336,
+  -0.2696612,
+  -0.2680889,
+  -0.2665165,
+  -0.2649441,
+  -0.2633718,
+  -0.2617994,
+  -0.2602270,
+  -0.2586547,
+  -0.2570823,
+  -0.2555099,
+  -0.2539375,
+  -0.2523652,
+  -0.2507928,
+  -0.2492204,
+  -0.2476481,
+  -0.2460757,
+  -0.2445033,
+  -0.2429310,
+  -0.2413586,
+  -0.2397862,
+  -0.2382139,
+  -0.2366415,
+  -0.2350691,
+  -0.2334968,
+  -0.2319244,
+  -0.2303520,
+  -0.2287796,
+  -0.2272073,
+  -0.2256349,
+  -0.2240625,
+  -0.2224902,
+  -0.2209178,
+  -0.2193454,
+  -0.2177731,
+  -0.2162007,
+  -0.2146283,
+  -0.2130560,
+  -0.2114836,
+  -0.2099112,
+  -0.2083389,
+  -0.2067665,
+  -0.2051941,
+  -0.2036217,
+  -0.2020494,
+  -0.2004770,
+  -0.1989046,
+  -0.1973323,
+  -0.1957599,
+  -0.1941875,
+  -0.1926152,
+  -0.1910428,
+  -0.1894704,
+  -0.1878981,
+  -0.1863257,
+  -0.1847533,
+  -0.1831810,
+  -0.1816086,
+  -0.1800362,
+  -0.1784638,
+  -0.1768915,
+  -0.1753191,
+  -0.1737467,
+  -0.1721744,
+  -0.1706020,
+  -0.1690296,
+  -0.1674573,
+  -0.1658849,
+  -0.1643125,
+  -0.1627402,
+  -0.1611678,
+  -0.1595954,
+  -0.1580231,
+  -0.1564507,
+  -0.1548783,
+  -0.1533059,
+  -0.1517336,
+  -0.1501612,
+  -0.1485888,
+  -0.1470165,
+  -0.1454441,
+  -0.1438717,
+  -0.1422994,
+  -0.1407270,
+  -0.1391546,
+  -0.1375823,
+  -0.1360099,
+  -0.1344375,
+  -0.1328652,
+  -0.1312928,
+  -0.1297204,
+  -0.1281480,
+  -0.1265757,
+  -0.1250033,
+  -0.1234309,
+  -0.1218586,
+  -0.1202862,
+  -0.1187138,
+  -0.1171415,
+  -0.1155691,
+  -0.1139967,
+  -0.1124244,
+  -0.1108520,
+  -0.1092796,
+  -0.1077073,
+  -0.1061349,
+  -0.1045625,
+  -0.1029901,
+  -0.1014178,
+  -0.0998454,
+  -0.0982730,
+  -0.0967007,
+  -0.0951283,
+  -0.0935559,
+  -0.0919836,
+  -0.0904112,
+  -0.0888388,
+  -0.0872665,
+  -0.0856941,
+  -0.0841217,
+  -0.0825494,
+  -0.0809770,
+  -0.0794046,
+  -0.0778323,
+  -0.0762599,
+  -0.0746875,
+  -0.0731151,
+  -0.0715428,
+  -0.0699704,
+  -0.0683980,
+  -0.0668257,
+  -0.0652533,
+  -0.0636809,
+  -0.0621086,
+  -0.0605362,
+  -0.0589638,
+  -0.0573915,
+  -0.0558191,
+  -0.0542467,
+  -0.0526744,
+  -0.0511020,
+  -0.0495296,
+  -0.0479572,
+  -0.0463849,
+  -0.0448125,
+  -0.0432401,
+  -0.0416678,
+  -0.0400954,
+  -0.0385230,
+  -0.0369507,
+  -0.0353783,
+  -0.0338059,
+  -0.0322336,
+  -0.0306612,
+  -0.0290888,
+  -0.0275165,
+  -0.0259441,
+  -0.0243717,
+  -0.0227993,
+  -0.0212270,
+  -0.0196546,
+  -0.0180822,
+  -0.0165099,
+  -0.0149375,
+  -0.0133651,
+  -0.0117928,
+  -0.0102204,
+  -0.0086480,
+  -0.0070757,
+  -0.0055033,
+  -0.0039309,
+  -0.0023586,
+  -0.0007862,
+  0.0007862,
+  0.0023586,
+  0.0039309,
+  0.0055033,
+  0.0070757,
+  0.0086480,
+  0.0102204,
+  0.0117928,
+  0.0133651,
+  0.0149375,
+  0.0165099,
+  0.0180822,
+  0.0196546,
+  0.0212270,
+  0.0227993,
+  0.0243717,
+  0.0259441,
+  0.0275165,
+  0.0290888,
+  0.0306612,
+  0.0322336,
+  0.0338059,
+  0.0353783,
+  0.0369507,
+  0.0385230,
+  0.0400954,
+  0.0416678,
+  0.0432401,
+  0.0448125,
+  0.0463849,
+  0.0479572,
+  0.0495296,
+  0.0511020,
+  0.0526744,
+  0.0542467,
+  0.0558191,
+  0.0573915,
+  0.0589638,
+  0.0605362,
+  0.0621086,
+  0.0636809,
+  0.0652533,
+  0.0668257,
+  0.0683980,
+  0.0699704,
+  0.0715428,
+  0.0731151,
+  0.0746875,
+  0.0762599,
+  0.0778323,
+  0.0794046,
+  0.0809770,
+  0.0825494,
+  0.0841217,
+  0.0856941,
+  0.0872665,
+  0.0888388,
+  0.0904112,
+  0.0919836,
+  0.0935559,
+  0.0951283,
+  0.0967007,
+  0.0982730,
+  0.0998454,
+  0.1014178,
+  0.1029901,
+  0.1045625,
+  0.1061349,
+  0.1077073,
+  0.1092796,
+  0.1108520,
+  0.1124244,
+  0.1139967,
+  0.1155691,
+  0.1171415,
+  0.1187138,
+  0.1202862,
+  0.1218586,
+  0.1234309,
+  0.1250033,
+  0.1265757,
+  0.1281480,
+  0.1297204,
+  0.1312928,
+  0.1328652,
+  0.1344375,
+  0.1360099,
+  0.1375823,
+  0.1391546,
+  0.1407270,
+  0.1422994,
+  0.1438717,
+  0.1454441,
+  0.1470165,
+  0.1485888,
+  0.1501612,
+  0.1517336,
+  0.1533059,
+  0.1548783,
+  0.1564507,
+  0.1580231,
+  0.1595954,
+  0.1611678,
+  0.1627402,
+  0.1643125,
+  0.1658849,
+  0.1674573,
+  0.1690296,
+  0.1706020,
+  0.1721744,
+  0.1737467,
+  0.1753191,
+  0.1768915,
+  0.1784638,
+  0.1800362,
+  0.1816086,
+  0.1831810,
+  0.1847533,
+  0.1863257,
+  0.1878981,
+  0.1894704,
+  0.1910428,
+  0.1926152,
+  0.1941875,
+  0.1957599,
+  0.1973323,
+  0.1989046,
+  0.2004770,
+  0.2020494,
+  0.2036217,
+  0.2051941,
+  0.2067665,
+  0.2083389,
+  0.2099112,
+  0.2114836,
+  0.2130560,
+  0.2146283,
+  0.2162007,
+  0.2177731,
+  0.2193454,
+  0.2209178,
+  0.2224902,
+  0.2240625,
+  0.2256349,
+  0.2272073,
+  0.2287796,
+  0.2303520,
+  0.2319244,
+  0.2334968,
+  0.2350691,
+  0.2366415,
+  0.2382139,
+  0.2397862,
+  0.2413586,
+  0.2429310,
+  0.2445033,
+  0.2460757,
+  0.2476481,
+  0.2492204,
+  0.2507928,
+  0.2523652,
+  0.2539375,
+  0.2555099,
+  0.2570823,
+  0.2586547,
+  0.2602270,
+  0.2617994,
+  0.2633718,
+  0.2649441,
+  0.2665165,
+  0.2680889,
+  0.2696612,
+  0.2712336,
+  0.2728060,
+  0.2743783,
+  0.2759507,
+  0.2775231,
+  0.2790954,
+  0.2806678,
+  0.2822402,
+  0.2838125,
+  0.2853849,
+  0.2869573,
+  0.2885297,
+  0.2901020,
+  0.2916744,
+  0.2932468,
+  0.2948191,
+  0.2963915,
+  0.2979639,
+  0.2995362,
+  0.3011086,
+  0.3026810,
+  0.3042533,
+  0.3058257,
+  0.3073981,
+  0.3089704,
+  0.3105428,
+  0.3121152,
+  0.3136876,
+  0.3152599,
+  0.3168323,
+  0.3184047,
+  0.3199770,
+  0.3215494,
+  0.3231218,
+  0.3246941,
+  0.3262665,
+  0.3278389,
+  0.3294112,
+  0.3309836,
+  0.3325560,
+  0.3341283,
+  0.3357007,
+  0.3372731,
+  0.3388455,
+  0.3404178,
+  0.3419902,
+  0.3435626,
+  0.3451349,
+  0.3467073,
+  0.3482797,
+  0.3498520,
+  0.3514244,
+  0.3529968,
+  0.3545691,
+  0.3561415,
+  0.3577139,
+  0.3592862,
+  0.3608586,
+  0.3624310,
+  0.3640034,
+  0.3655757,
+  0.3671481,
+  0.3687205,
+  0.3702928,
+  0.3718652,
+  0.3734376,
+  0.3750099,
+  0.3765823,
+  0.3781547,
+  0.3797270,
+  0.3812994,
+  0.3828718,
+  0.3844441,
+  0.3860165,
+  0.3875889,
+  0.3891613,
+  0.3907336,
+  0.3923060,
+  0.3938784,
+  0.3954507,
+  0.3970231,
+  0.3985955,
+  0.4001678,
+  0.4017402,
+  0.4033126,
+  0.4048849,
+  0.4064573,
+  0.4080297,
+  0.4096020,
+  0.4111744,
+  0.4127468,
+  0.4143192,
+  0.4158915,
+  0.4174639,
+  0.4190363,
+  0.4206086,
+  0.4221810,
+  0.4237534,
+  0.4253257,
+  0.4268981,
+  0.4284705,
+  0.4300428,
+  0.4316152,
+  0.4331876,
+  0.4347599,
+  0.4363323,
+  0.4379047,
+  0.4394771,
+  0.4410494,
+  0.4426218,
+  0.4441942,
+  0.4457665,
+  0.4473389,
+  0.4489113,
+  0.4504836,
+  0.4520560,
+  0.4536284,
+  0.4552007,
+  0.4567731,
+  0.4583455,
+  0.4599178,
+  0.4614902,
+  0.4630626,
+  0.4646349,
+  0.4662073,
+  0.4677797,
+  0.4693521,
+  0.4709244,
+  0.4724968,
+  0.4740692,
+  0.4756415,
+  0.4772139,
+  0.4787863,
+  0.4803586,
+  0.4819310,
+  0.4835034,
+  0.4850757,
+  0.4866481,
+  0.4882205,
+  0.4897928,
+  0.4913652,
+  0.4929376,
+  0.4945100,
+  0.4960823,
+  0.4976547,
+  0.4992271,
+  0.5007994,
+  0.5023718,
+  0.5039442,
+  0.5055165,
+  0.5070889,
+  0.5086613,
+  0.5102336,
+  0.5118060,
+  0.5133784,
+  0.5149507,
+  0.5165231,
+  0.5180955,
+  0.5196679,
+  0.5212402,
+  0.5228126,
+  0.5243850,
+  0.5259573,
+  0.5275297,
+  0.5291021,
+  0.5306744,
+  0.5322468,
+  0.5338192,
+  0.5353915,
+  0.5369639,
+  0.5385363,
+  0.5401086,
+  0.5416810,
+  0.5432534,
+  0.5448258,
+  0.5463981,
+  0.5479705,
+  0.5495429,
+  0.5511152,
+  0.5526876,
+  0.5542600,
+  0.5558323,
+  0.5574047,
+  0.5589771,
+  0.5605494,
+  0.5621218,
+  0.5636942,
+  0.5652665,
+  0.5668389,
+  0.5684113,
+  0.5699837,
+  0.5715560,
+  0.5731284,
+  0.5747008,
+  0.5762731,
+  0.5778455,
+  0.5794179,
+  0.5809902,
+  0.5825626,
+  0.5841350,
+  0.5857073,
+  0.5872797,
+  0.5888521,
+  0.5904244,
+  0.5919968,
+  0.5935692,
+  0.5951416,
+  0.5967139,
+  0.5982863,
+  0.5998587,
+  0.6014310,
+  0.6030034,
+  0.6045758,
+  0.6061481,
+  0.6077205,
+  0.6092929,
+  0.6108652,
+  0.6124376,
+  0.6140100,
+  0.6155823,
+  0.6171547,
+  0.6187271,
+  0.6202995,
+  0.6218718,
+  0.6234442,
+  0.6250166,
+  0.6265889,
+  0.6281613,
+  0.6297337,
+  0.6313060,
+  0.6328784,
+  0.6344508,
+  0.6360231,
+  0.6375955,
+  0.6391679,
+  0.6407402,
+  0.6423126,
+  0.6438850,
+  0.6454573,
+  0.6470297,
+  0.6486021,
+  0.6501745,
+  0.6517468,
+  0.6533192,
+  0.6548916,
+  0.6564639,
+  0.6580363,
+  0.6596087,
+  0.6611810,
+  0.6627534,
+  0.6643258,
+  0.6658981,
+  0.6674705,
+  0.6690429,
+  0.6706152,
+  0.6721876,
+  0.6737600,
+  0.6753324,
+  0.6769047,
+  0.6784771,
+  0.6800495,
+  0.6816218,
+  0.6831942,
+  -0.6147962,
+  -0.6116514,
+  -0.6085067,
+  -0.6053619,
+  -0.6022172,
+  -0.5990725,
+  -0.5959277,
+  -0.5927830,
+  -0.5896383,
+  -0.5864935,
+  -0.5833488,
+  -0.5802040,
+  -0.5770593,
+  -0.5739146,
+  -0.5707698,
+  -0.5676251,
+  -0.5644804,
+  -0.5613356,
+  -0.5581909,
+  -0.5550461,
+  -0.5519014,
+  -0.5487567,
+  -0.5456119,
+  -0.5424672,
+  -0.5393225,
+  -0.5361777,
+  -0.5330330,
+  -0.5298883,
+  -0.5267435,
+  -0.5235988,
+  -0.5204540,
+  -0.5173093,
+  -0.5141646,
+  -0.5110198,
+  -0.5078751,
+  -0.5047304,
+  -0.5015856,
+  -0.4984409,
+  -0.4952961,
+  -0.4921514,
+  -0.4890067,
+  -0.4858619,
+  -0.4827172,
+  -0.4795725,
+  -0.4764277,
+  -0.4732830,
+  -0.4701382,
+  -0.4669935,
+  -0.4638488,
+  -0.4607040,
+  -0.4575593,
+  -0.4544146,
+  -0.4512698,
+  -0.4481251,
+  -0.4449803,
+  -0.4418356,
+  -0.4386909,
+  -0.4355461,
+  -0.4324014,
+  -0.4292567,
+  -0.4261119,
+  -0.4229672,
+  -0.4198224,
+  -0.4166777,
+  -0.4135330,
+  -0.4103882,
+  -0.4072435,
+  -0.4040988,
+  -0.4009540,
+  -0.3978093,
+  -0.3946645,
+  -0.3915198,
+  -0.3883751,
+  -0.3852303,
+  -0.3820856,
+  -0.3789409,
+  -0.3757961,
+  -0.3726514,
+  -0.3695066,
+  -0.3663619,
+  -0.3632172,
+  -0.3600724,
+  -0.3569277,
+  -0.3537830,
+  -0.3506382,
+  -0.3474935,
+  -0.3443487,
+  -0.3412040,
+  -0.3380593,
+  -0.3349145,
+  -0.3317698,
+  -0.3286251,
+  -0.3254803,
+  -0.3223356,
+  -0.3191908,
+  -0.3160461,
+  -0.3129014,
+  -0.3097566,
+  -0.3066119,
+  -0.3034672,
+  -0.3003224,
+  -0.2971777,
+  -0.2940329,
+  -0.2908882,
+  -0.2877435,
+  -0.2845987,
+  -0.2814540,
+  -0.2783093,
+  -0.2751645,
+  -0.2720198,
+  -0.2688750,
+  -0.2657303,
+  -0.2625856,
+  -0.2594408,
+  -0.2562961,
+  -0.2531514,
+  -0.2500066,
+  -0.2468619,
+  -0.2437171,
+  -0.2405724,
+  -0.2374277,
+  -0.2342829,
+  -0.2311382,
+  -0.2279935,
+  -0.2248487,
+  -0.2217040,
+  -0.2185592,
+  -0.2154145,
+  -0.2122698,
+  -0.2091250,
+  -0.2059803,
+  -0.2028356,
+  -0.1996908,
+  -0.1965461,
+  -0.1934013,
+  -0.1902566,
+  -0.1871119,
+  -0.1839671,
+  -0.1808224,
+  -0.1776777,
+  -0.1745329,
+  -0.1713882,
+  -0.1682435,
+  -0.1650987,
+  -0.1619540,
+  -0.1588092,
+  -0.1556645,
+  -0.1525198,
+  -0.1493750,
+  -0.1462303,
+  -0.1430856,
+  -0.1399408,
+  -0.1367961,
+  -0.1336513,
+  -0.1305066,
+  -0.1273619,
+  -0.1242171,
+  -0.1210724,
+  -0.1179277,
+  -0.1147829,
+  -0.1116382,
+  -0.1084934,
+  -0.1053487,
+  -0.1022040,
+  -0.0990592,
+  -0.0959145,
+  -0.0927698,
+  -0.0896250,
+  -0.0864803,
+  -0.0833355,
+  -0.0801908,
+  -0.0770461,
+  -0.0739013,
+  -0.0707566,
+  -0.0676119,
+  -0.0644671,
+  -0.0613224,
+  -0.0581776,
+  -0.0550329,
+  -0.0518882,
+  -0.0487434,
+  -0.0455987,
+  -0.0424540,
+  -0.0393092,
+  -0.0361645,
+  -0.0330197,
+  -0.0298750,
+  -0.0267303,
+  -0.0235855,
+  -0.0204408,
+  -0.0172961,
+  -0.0141513,
+  -0.0110066,
+  -0.0078618,
+  -0.0047171,
+  -0.0015724,
+  0.0015724,
+  0.0047171,
+  0.0078618,
+  0.0110066,
+  0.0141513,
+  0.0172961,
+  0.0204408,
+  0.0235855,
+  0.0267303,
+  0.0298750,
+  0.0330197,
+  0.0361645,
+  0.0393092,
+  0.0424540,
+  0.0455987,
+  0.0487434,
+  0.0518882,
+  0.0550329,
+  0.0581776,
+  0.0613224,
+  0.0644671,
+  0.0676119,
+  0.0707566,
+  0.0739013,
+  0.0770461,
+  0.0801908,
+  0.0833355,
+  0.0864803,
+  0.0896250,
+  0.0927698,
+  0.0959145,
+  0.0990592,
+  0.1022040,
+  0.1053487,
+  0.1084934,
+  0.1116382,
+  0.1147829,
+  0.1179277,
+  0.1210724,
+  0.1242171,
+  0.1273619,
+  0.1305066,
+  0.1336513,
+  0.1367961,
+  0.1399408,
+  0.1430856,
+  0.1462303,
+  0.1493750,
+  0.1525198,
+  0.1556645,
+  0.1588092,
+  0.1619540,
+  0.1650987,
+  0.1682435,
+  0.1713882,
+  0.1745329,
+  0.1776777,
+  0.1808224,
+  0.1839671,
+  0.1871119,
+  0.1902566,
+  0.1934013,
+  0.1965461,
+  0.1996908,
+  0.2028356,
+  0.2059803,
+  0.2091250,
+  0.2122698,
+  0.2154145,
+  0.2185592,
+  0.2217040,
+  0.2248487,
+  0.2279935,
+  0.2311382,
+  0.2342829,
+  0.2374277,
+  0.2405724,
+  0.2437171,
+  0.2468619,
+  0.2500066,
+  0.2531514,
+  0.2562961,
+  0.2594408,
+  0.2625856,
+  0.2657303,
+  0.2688750,
+  0.2720198,
+  0.2751645,
+  0.2783093,
+  0.2814540,
+  0.2845987,
+  0.2877435,
+  0.2908882,
+  0.2940329,
+  0.2971777,
+  0.3003224,
+  0.3034672,
+  0.3066119,
+  0.3097566,
+  0.3129014,
+  0.3160461,
+  0.3191908,
+  0.3223356,
+  0.3254803,
+  0.3286251,
+  0.3317698,
+  0.3349145,
+  0.3380593,
+  0.3412040,
+  0.3443487,
+  0.3474935,
+  0.3506382,
+  0.3537830,
+  0.3569277,
+  0.3600724,
+  0.3632172,
+  0.3663619,
+  0.3695066,
+  0.3726514,
+  0.3757961,
+  0.3789409,
+  0.3820856,
+  0.3852303,
+  0.3883751,
+  0.3915198,
+  0.3946645,
+  0.3978093,
+  0.4009540,
+  0.4040988,
+  0.4072435,
+  0.4103882,
+  0.4135330,
+  0.4166777,
+  0.4198224,
+  0.4229672,
+  0.4261119,
+  0.4292567,
+  0.4324014,
+  0.4355461,
+  0.4386909,
+  0.4418356,
+  0.4449803,
+  0.4481251,
+  0.4512698,
+  0.4544146,
+  0.4575593,
+  0.4607040,
+  0.4638488,
+  0.4669935,
+  0.4701382,
+  0.4732830,
+  0.4764277,
+  0.4795725,
+  0.4827172,
+  0.4858619,
+  0.4890067,
+  0.4921514,
+  0.4952961,
+  0.4984409,
+  0.5015856,
+  0.5047304,
+  0.5078751,
+  0.5110198,
+  0.5141646,
+  0.5173093,
+  0.5204540,
+  0.5235988,
+  0.5267435,
+  0.5298883,
+  0.5330330,
+  0.5361777,
+  0.5393225,
+  0.5424672,
+  0.5456119,
+  0.5487567,
+  0.5519014,
+  0.5550461,
+  0.5581909,
+  0.5613356,
+  0.5644804,
+  0.5676251,
+  0.5707698,
+  0.5739146,
+  0.5770593,
+  0.5802040,
+  0.5833488,
+  0.5864935,
+  0.5896383,
+  0.5927830,
+  0.5959277,
+  0.5990725,
+  0.6022172,
+  0.6053619,
+  0.6085067,
+  0.6116514,
+  0.6147962,
+};
+
+// exact servo angles in degrees (thetaZ/WX/WY/WZ.xls)
+const float goldenTheta[2951][6] PROGMEM = {
+  {-0.229664, -0.229664, -0.229664, -0.229664, -0.229664, -0.229664},
+  {-0.176764, -0.176764, -0.176764, -0.176764, -0.176764, -0.176764},
+  {-0.123835, -0.123835, -0.123835, -0.123835, -0.123835, -0.123835},
+  {-0.070879, -0.070879, -0.070879, -0.070879, -0.070879, -0.070879},
+  {-0.017894, -0.017894, -0.017894, -0.017894, -0.017894, -0.017894},
+  {0.035118, 0.035118, 0.035118, 0.035118, 0.035118, 0.035118},
+  {0.088158, 0.088158, 0.088158, 0.088158, 0.088158, 0.088158},
+  {0.141226, 0.141226, 0.141226, 0.141226, 0.141226, 0.141226},
+  {0.194321, 0.194321, 0.194321, 0.194321, 0.194321, 0.194321},
+  {0.247445, 0.247445, 0.247445, 0.247445, 0.247445, 0.247445},
+  {0.300596, 0.300596, 0.300596, 0.300596, 0.300596, 0.300596},
+  {0.353775, 0.353775, 0.353775, 0.353775, 0.353775, 0.353775},
+  {0.406981, 0.406981, 0.406981, 0.406981, 0.406981, 0.406981},
+  {0.460215, 0.460215, 0.460215, 0.460215, 0.460215, 0.460215},
+  {0.513477, 0.513477, 0.513477, 0.513477, 0.513477, 0.513477},
+  {0.566767, 0.566767, 0.566767, 0.566767, 0.566767, 0.566767},
+  {0.620084, 0.620084, 0.620084, 0.620084, 0.620084, 0.620084},
+  {0.673429, 0.673429, 0.673429, 0.673429, 0.673429, 0.673429},
+  {0.726801, 0.726801, 0.726801, 0.726801, 0.726801, 0.726801},
+  {0.780201, 0.780201, 0.780201, 0.780201, 0.780201, 0.780201},
+  {0.833629, 0.833629, 0.833629, 0.833629, 0.833629, 0.833629},
+  {0.887084, 0.887084, 0.887084, 0.887084, 0.887084, 0.887084},
+  {0.940566, 0.940566, 0.940566, 0.940566, 0.940566, 0.940566},
+  {0.994076, 0.994076, 0.994076, 0.994076, 0.994076, 0.994076},
+  {1.047614, 1.047614, 1.047614, 1.047614, 1.047614, 1.047614},
+  {1.101178, 1.101178, 1.101178, 1.101178, 1.101178, 1.101178},
+  {1.154771, 1.154771, 1.154771, 1.154771, 1.154771, 1.154771},
+  {1.208390, 1.208390, 1.208390, 1.208390, 1.208390, 1.208390},
+  {1.262038, 1.262038, 1.262038, 1.262038, 1.262038, 1.262038},
+  {1.315712, 1.315712, 1.315712, 1.315712, 1.315712, 1.315712},
+  {1.369414, 1.369414, 1.369414, 1.369414, 1.369414, 1.369414},
+  {1.423143, 1.423143, 1.423143, 1.423143, 1.423143, 1.423143},
+  {1.476899, 1.476899, 1.476899, 1.476899, 1.476899, 1.476899},
+  {1.530683, 1.530683, 1.530683, 1.530683, 1.530683, 1.530683},
+  {1.584494, 1.584494, 1.584494, 1.584494, 1.584494, 1.584494},
+  {1.638332, 1.638332, 1.638332, 1.638332, 1.638332, 1.638332},
+  {1.692198, 1.692198, 1.692198, 1.692198, 1.692198, 1.692198},
+  {1.746090, 1.746090, 1.746090, 1.746090, 1.746090, 1.746090},
+  {1.800010, 1.800010, 1.800010, 1.800010, 1.800010, 1.800010},
+  {1.853957, 1.853957, 1.853957, 1.853957, 1.853957, 1.853957},
+  {1.907932, 1.907932, 1.907932, 1.907932, 1.907932, 1.907932},
+  {1.961933, 1.961933, 1.961933, 1.961933, 1.961933, 1.961933},
+  {2.015961, 2.015961, 2.015961, 2.015961, 2.015961, 2.015961},
+  {2.070017, 2.070017, 2.070017, 2.070017, 2.070017, 2.070017},
+  {2.124099, 2.124099, 2.124099, 2.124099, 2.124099, 2.124099},
+  {2.178209, 2.178209, 2.178209, 2.178209, 2.178209, 2.178209},
+  {2.232346, 2.232346, 2.232346, 2.232346, 2.232346, 2.232346},
+  {2.286509, 2.286509, 2.286509, 2.286509, 2.286509, 2.286509},
+  {2.340700, 2.340700, 2.340700, 2.340700, 2.340700, 2.340700},
+  {2.394918, 2.394918, 2.394918, 2.394918, 2.394918, 2.394918},
+  {2.449162, 2.449162, 2.449162, 2.449162, 2.449162, 2.449162},
+  {2.503434, 2.503434, 2.503434, 2.503434, 2.503434, 2.503434},
+  {2.557733, 2.557733, 2.557733, 2.557733, 2.557733, 2.557733},
+  {2.612058, 2.612058, 2.612058, 2.612058, 2.612058, 2.612058},
+  {2.666410, 2.666410, 2.666410, 2.666410, 2.666410, 2.666410},
+  {2.720789, 2.720789, 2.720789, 2.720789, 2.720789, 2.720789},
+  {2.775196, 2.775196, 2.775196, 2.775196, 2.775196, 2.775196},
+  {2.829628, 2.829628, 2.829628, 2.829628, 2.829628, 2.829628},
+  {2.884088, 2.884088, 2.884088, 2.884088, 2.884088, 2.884088},
+  {2.938575, 2.938575, 2.938575, 2.938575, 2.938575, 2.938575},
+  {2.993088, 2.993088, 2.993088, 2.993088, 2.993088, 2.993088},
+  {3.047628, 3.047628, 3.047628, 3.047628, 3.047628, 3.047628},
+  {3.102195, 3.102195, 3.102195, 3.102195, 3.102195, 3.102195},
+  {3.156788, 3.156788, 3.156788, 3.156788, 3.156788, 3.156788},
+  {3.211409, 3.211409, 3.211409, 3.211409, 3.211409, 3.211409},
+  {3.266056, 3.266056, 3.266056, 3.266056, 3.266056, 3.266056},
+  {3.320729, 3.320729, 3.320729, 3.320729, 3.320729, 3.320729},
+  {3.375430, 3.375430, 3.375430, 3.375430, 3.375430, 3.375430},
+  {3.430157, 3.430157, 3.430157, 3.430157, 3.430157, 3.430157},
+  {3.484910, 3.484910, 3.484910, 3.484910, 3.484910, 3.484910},
+  {3.539690, 3.539690, 3.539690, 3.539690, 3.539690, 3.539690},
+  {3.594497, 3.594497, 3.594497, 3.594497, 3.594497, 3.594497},
+  {3.649330, 3.649330, 3.649330, 3.649330, 3.649330, 3.649330},
+  {3.704190, 3.704190, 3.704190, 3.704190, 3.704190, 3.704190},
+  {3.759077, 3.759077, 3.759077, 3.759077, 3.759077, 3.759077},
+  {3.813990, 3.813990, 3.813990, 3.813990, 3.813990, 3.813990},
+  {3.868929, 3.868929, 3.868929, 3.868929, 3.868929, 3.868929},
+  {3.923895, 3.923895, 3.923895, 3.923895, 3.923895, 3.923895},
+  {3.978888, 3.978888, 3.978888, 3.978888, 3.978888, 3.978888},
+  {4.033907, 4.033907, 4.033907, 4.033907, 4.033907, 4.033907},
+  {4.088952, 4.088952, 4.088952, 4.088952, 4.088952, 4.088952},
+  {4.144024, 4.144024, 4.144024, 4.144024, 4.144024, 4.144024},
+  {4.199122, 4.199122, 4.199122, 4.199122, 4.199122, 4.199122},
+  {4.254247, 4.254247, 4.254247, 4.254247, 4.254247, 4.254247},
+  {4.309398, 4.309398, 4.309398, 4.309398, 4.309398, 4.309398},
+  {4.364576, 4.364576, 4.364576, 4.364576, 4.364576, 4.364576},
+  {4.419779, 4.419779, 4.419779, 4.419779, 4.419779, 4.419779},
+  {4.475009, 4.475009, 4.475009, 4.475009, 4.475009, 4.475009},
+  {4.530266, 4.530266, 4.530266, 4.530266, 4.530266, 4.530266},
+  {4.585549, 4.585549, 4.585549, 4.585549, 4.585549, 4.585549},
+  {4.640858, 4.640858, 4.640858, 4.640858, 4.640858, 4.640858},
+  {4.696193, 4.696193, 4.696193, 4.696193, 4.696193, 4.696193},
+  {4.751554, 4.751554, 4.751554, 4.751554, 4.751554, 4.751554},
+  {4.806942, 4.806942, 4.806942, 4.806942, 4.806942, 4.806942},
+  {4.862356, 4.862356, 4.862356, 4.862356, 4.862356, 4.862356},
+  {4.917796, 4.917796, 4.917796, 4.917796, 4.917796, 4.917796},
+  {4.973263, 4.973263, 4.973263, 4.973263, 4.973263, 4.973263},
+  {5.028755, 5.028755, 5.028755, 5.028755, 5.028755, 5.028755},
+  {5.084274, 5.084274, 5.084274, 5.084274, 5.084274, 5.084274},
+  {5.139819, 5.139819, 5.139819, 5.139819, 5.139819, 5.139819},
+  {5.195390, 5.195390, 5.195390, 5.195390, 5.195390, 5.195390},
+  {5.250987, 5.250987, 5.250987, 5.250987, 5.250987, 5.250987},
+  {5.306611, 5.306611, 5.306611, 5.306611, 5.306611, 5.306611},
+  {5.362260, 5.362260, 5.362260, 5.362260, 5.362260, 5.362260},
+  {5.417936, 5.417936, 5.417936, 5.417936, 5.417936, 5.417936},
+  {5.473637, 5.473637, 5.473637, 5.473637, 5.473637, 5.473637},
+  {5.529365, 5.529365, 5.529365, 5.529365, 5.529365, 5.529365},
+  {5.585118, 5.585118, 5.585118, 5.585118, 5.585118, 5.585118},
+  {5.640898, 5.640898, 5.640898, 5.640898, 5.640898, 5.640898},
+  {5.696704, 5.696704, 5.696704, 5.696704, 5.696704, 5.696704},
+  {5.752535, 5.752535, 5.752535, 5.752535, 5.752535, 5.752535},
+  {5.808393, 5.808393, 5.808393, 5.808393, 5.808393, 5.808393},
+  {5.864277, 5.864277, 5.864277, 5.864277, 5.864277, 5.864277},
+  {5.920186, 5.920186, 5.920186, 5.920186, 5.920186, 5.920186},
+  {5.976122, 5.976122, 5.976122, 5.976122, 5.976122, 5.976122},
+  {6.032083, 6.032083, 6.032083, 6.032083, 6.032083, 6.032083},
+  {6.088070, 6.088070, 6.088070, 6.088070, 6.088070, 6.088070},
+  {6.144083, 6.144083, 6.144083, 6.144083, 6.144083, 6.144083},
+  {6.200123, 6.200123, 6.200123, 6.200123, 6.200123, 6.200123},
+  {6.256188, 6.256188, 6.256188, 6.256188, 6.256188, 6.256188},
+  {6.312278, 6.312278, 6.312278, 6.312278, 6.312278, 6.312278},
+  {6.368395, 6.368395, 6.368395, 6.368395, 6.368395, 6.368395},
+  {6.424538, 6.424538, 6.424538, 6.424538, 6.424538, 6.424538},
+  {6.480706, 6.480706, 6.480706, 6.480706, 6.480706, 6.480706},
+  {6.536900, 6.536900, 6.536900, 6.536900, 6.536900, 6.536900},
+  {6.593120, 6.593120, 6.593120, 6.593120, 6.593120, 6.593120},
+  {6.649366, 6.649366, 6.649366, 6.649366, 6.649366, 6.649366},
+  {6.705637, 6.705637, 6.705637, 6.705637, 6.705637, 6.705637},
+  {6.761934, 6.761934, 6.761934, 6.761934, 6.761934, 6.761934},
+  {6.818257, 6.818257, 6.818257, 6.818257, 6.818257, 6.818257},
+  {6.874606, 6.874606, 6.874606, 6.874606, 6.874606, 6.874606},
+  {6.930980, 6.930980, 6.930980, 6.930980, 6.930980, 6.930980},
+  {6.987380, 6.987380, 6.987380, 6.987380, 6.987380, 6.987380},
+  {7.043806, 7.043806, 7.043806, 7.043806, 7.043806, 7.043806},
+  {7.100257, 7.100257, 7.100257, 7.100257, 7.100257, 7.100257},
+  {7.156735, 7.156735, 7.156735, 7.156735, 7.156735, 7.156735},
+  {7.213237, 7.213237, 7.213237, 7.213237, 7.213237, 7.213237},
+  {7.269766, 7.269766, 7.269766, 7.269766, 7.269766, 7.269766},
+  {7.326320, 7.326320, 7.326320, 7.326320, 7.326320, 7.326320},
+  {7.382899, 7.382899, 7.382899, 7.382899, 7.382899, 7.382899},
+  {7.439505, 7.439505, 7.439505, 7.439505, 7.439505, 7.439505},
+  {7.496135, 7.496135, 7.496135, 7.496135, 7.496135, 7.496135},
+  {7.552792, 7.552792, 7.552792, 7.552792, 7.552792, 7.552792},
+  {7.609474, 7.609474, 7.609474, 7.609474, 7.609474, 7.609474},
+  {7.666181, 7.666181, 7.666181, 7.666181, 7.666181, 7.666181},
+  {7.722914, 7.722914, 7.722914, 7.722914, 7.722914, 7.722914},
+  {7.779673, 7.779673, 7.779673, 7.779673, 7.779673, 7.779673},
+  {7.836457, 7.836457, 7.836457, 7.836457, 7.836457, 7.836457},
+  {7.893267, 7.893267, 7.893267, 7.893267, 7.893267, 7.893267},
+  {7.950102, 7.950102, 7.950102, 7.950102, 7.950102, 7.950102},
+  {8.006963, 8.006963, 8.006963, 8.006963, 8.006963, 8.006963},
+  {8.063849, 8.063849, 8.063849, 8.063849, 8.063849, 8.063849},
+  {8.120760, 8.120760, 8.120760, 8.120760, 8.120760, 8.120760},
+  {8.177697, 8.177697, 8.177697, 8.177697, 8.177697, 8.177697},
+  {8.234660, 8.234660, 8.234660, 8.234660, 8.234660, 8.234660},
+  {8.291647, 8.291647, 8.291647, 8.291647, 8.291647, 8.291647},
+  {8.348661, 8.348661, 8.348661, 8.348661, 8.348661, 8.348661},
+  {8.405699, 8.405699, 8.405699, 8.405699, 8.405699, 8.405699},
+  {8.462764, 8.462764, 8.462764, 8.462764, 8.462764, 8.462764},
+  {8.519853, 8.519853, 8.519853, 8.519853, 8.519853, 8.519853},
+  {8.576968, 8.576968, 8.576968, 8.576968, 8.576968, 8.576968},
+  {8.634108, 8.634108, 8.634108, 8.634108, 8.634108, 8.634108},
+  {8.691274, 8.691274, 8.691274, 8.691274, 8.691274, 8.691274},
+  {8.748465, 8.748465, 8.748465, 8.748465, 8.748465, 8.748465},
+  {8.805681, 8.805681, 8.805681, 8.805681, 8.805681, 8.805681},
+  {8.862922, 8.862922, 8.862922, 8.862922, 8.862922, 8.862922},
+  {8.920189, 8.920189, 8.920189, 8.920189, 8.920189, 8.920189},
+  {8.977482, 8.977482, 8.977482, 8.977482, 8.977482, 8.977482},
+  {9.034799, 9.034799, 9.034799, 9.034799, 9.034799, 9.034799},
+  {9.092142, 9.092142, 9.092142, 9.092142, 9.092142, 9.092142},
+  {9.149510, 9.149510, 9.149510, 9.149510, 9.149510, 9.149510},
+  {9.206903, 9.206903, 9.206903, 9.206903, 9.206903, 9.206903},
+  {9.264322, 9.264322, 9.264322, 9.264322, 9.264322, 9.264322},
+  {9.321766, 9.321766, 9.321766, 9.321766, 9.321766, 9.321766},
+  {9.379235, 9.379235, 9.379235, 9.379235, 9.379235, 9.379235},
+  {9.436729, 9.436729, 9.436729, 9.436729, 9.436729, 9.436729},
+  {9.494248, 9.494248, 9.494248, 9.494248, 9.494248, 9.494248},
+  {9.551793, 9.551793, 9.551793, 9.551793, 9.551793, 9.551793},
+  {9.609363, 9.609363, 9.609363, 9.609363, 9.609363, 9.609363},
+  {9.666958, 9.666958, 9.666958, 9.666958, 9.666958, 9.666958},
+  {9.724578, 9.724578, 9.724578, 9.724578, 9.724578, 9.724578},
+  {9.782224, 9.782224, 9.782224, 9.782224, 9.782224, 9.782224},
+  {9.839894, 9.839894, 9.839894, 9.839894, 9.839894, 9.839894},
+  {9.897590, 9.897590, 9.897590, 9.897590, 9.897590, 9.897590},
+  {9.955311, 9.955311, 9.955311, 9.955311, 9.955311, 9.955311},
+  {10.013057, 10.013057, 10.013057, 10.013057, 10.013057, 10.013057},
+  {10.070828, 10.070828, 10.070828, 10.070828, 10.070828, 10.070828},
+  {10.128624, 10.128624, 10.128624, 10.128624, 10.128624, 10.128624},
+  {10.186446, 10.186446, 10.186446, 10.186446, 10.186446, 10.186446},
+  {10.244292, 10.244292, 10.244292, 10.244292, 10.244292, 10.244292},
+  {10.302164, 10.302164, 10.302164, 10.302164, 10.302164, 10.302164},
+  {10.360060, 10.360060, 10.360060, 10.360060, 10.360060, 10.360060},
+  {10.417982, 10.417982, 10.417982, 10.417982, 10.417982, 10.417982},
+  {10.475929, 10.475929, 10.475929, 10.475929, 10.475929, 10.475929},
+  {10.533901, 10.533901, 10.533901, 10.533901, 10.533901, 10.533901},
+  {10.591897, 10.591897, 10.591897, 10.591897, 10.591897, 10.591897},
+  {10.649919, 10.649919, 10.649919, 10.649919, 10.649919, 10.649919},
+  {10.707966, 10.707966, 10.707966, 10.707966, 10.707966, 10.707966},
+  {10.766038, 10.766038, 10.766038, 10.766038, 10.766038, 10.766038},
+  {10.824135, 10.824135, 10.824135, 10.824135, 10.824135, 10.824135},
+  {10.882257, 10.882257, 10.882257, 10.882257, 10.882257, 10.882257},
+  {10.940404, 10.940404, 10.940404, 10.940404, 10.940404, 10.940404},
+  {10.998576, 10.998576, 10.998576, 10.998576, 10.998576, 10.998576},
+  {11.056773, 11.056773, 11.056773, 11.056773, 11.056773, 11.056773},
+  {11.114995, 11.114995, 11.114995, 11.114995, 11.114995, 11.114995},
+  {11.173242, 11.173242, 11.173242, 11.173242, 11.173242, 11.173242},
+  {11.231514, 11.231514, 11.231514, 11.231514, 11.231514, 11.231514},
+  {11.289810, 11.289810, 11.289810, 11.289810, 11.289810, 11.289810},
+  {11.348132, 11.348132, 11.348132, 11.348132, 11.348132, 11.348132},
+  {11.406479, 11.406479, 11.406479, 11.406479, 11.406479, 11.406479},
+  {11.464851, 11.464851, 11.464851, 11.464851, 11.464851, 11.464851},
+  {11.523247, 11.523247, 11.523247, 11.523247, 11.523247, 11.523247},
+  {11.581669, 11.581669, 11.581669, 11.581669, 11.581669, 11.581669},
+  {11.640115, 11.640115, 11.640115, 11.640115, 11.640115, 11.640115},
+  {11.698586, 11.698586, 11.698586, 11.698586, 11.698586, 11.698586},
+  {11.757082, 11.757082, 11.757082, 11.757082, 11.757082, 11.757082},
+  {11.815603, 11.815603, 11.815603, 11.815603, 11.815603, 11.815603},
+  {11.874149, 11.874149, 11.874149, 11.874149, 11.874149, 11.874149},
+  {11.932720, 11.932720, 11.932720, 11.932720, 11.932720, 11.932720},
+  {11.991316, 11.991316, 11.991316, 11.991316, 11.991316, 11.991316},
+  {12.049936, 12.049936, 12.049936, 12.049936, 12.049936, 12.049936},
+  {12.108582, 12.108582, 12.108582, 12.108582, 12.108582, 12.108582},
+  {12.167252, 12.167252, 12.167252, 12.167252, 12.167252, 12.167252},
+  {12.225947, 12.225947, 12.225947, 12.225947, 12.225947, 12.225947},
+  {12.284667, 12.284667, 12.284667, 12.284667, 12.284667, 12.284667},
+  {12.343412, 12.343412, 12.343412, 12.343412, 12.343412, 12.343412},
+  {12.402182, 12.402182, 12.402182, 12.402182, 12.402182, 12.402182},
+  {12.460976, 12.460976, 12.460976, 12.460976, 12.460976, 12.460976},
+  {12.519795, 12.519795, 12.519795, 12.519795, 12.519795, 12.519795},
+  {12.578639, 12.578639, 12.578639, 12.578639, 12.578639, 12.578639},
+  {12.637508, 12.637508, 12.637508, 12.637508, 12.637508, 12.637508},
+  {12.696402, 12.696402, 12.696402, 12.696402, 12.696402, 12.696402},
+  {12.755320, 12.755320, 12.755320, 12.755320, 12.755320, 12.755320},
+  {12.814264, 12.814264, 12.814264, 12.814264, 12.814264, 12.814264},
+  {12.873232, 12.873232, 12.873232, 12.873232, 12.873232, 12.873232},
+  {12.932225, 12.932225, 12.932225, 12.932225, 12.932225, 12.932225},
+  {12.991242, 12.991242, 12.991242, 12.991242, 12.991242, 12.991242},
+  {13.050284, 13.050284, 13.050284, 13.050284, 13.050284, 13.050284},
+  {13.109352, 13.109352, 13.109352, 13.109352, 13.109352, 13.109352},
+  {13.168443, 13.168443, 13.168443, 13.168443, 13.168443, 13.168443},
+  {13.227560, 13.227560, 13.227560, 13.227560, 13.227560, 13.227560},
+  {13.286701, 13.286701, 13.286701, 13.286701, 13.286701, 13.286701},
+  {13.345867, 13.345867, 13.345867, 13.345867, 13.345867, 13.345867},
+  {13.405058, 13.405058, 13.405058, 13.405058, 13.405058, 13.405058},
+  {13.464274, 13.464274, 13.464274, 13.464274, 13.464274, 13.464274},
+  {13.523514, 13.523514, 13.523514, 13.523514, 13.523514, 13.523514},
+  {13.582779, 13.582779, 13.582779, 13.582779, 13.582779, 13.582779},
+  {13.642069, 13.642069, 13.642069, 13.642069, 13.642069, 13.642069},
+  {13.701383, 13.701383, 13.701383, 13.701383, 13.701383, 13.701383},
+  {13.760722, 13.760722, 13.760722, 13.760722, 13.760722, 13.760722},
+  {13.820086, 13.820086, 13.820086, 13.820086, 13.820086, 13.820086},
+  {13.879475, 13.879475, 13.879475, 13.879475, 13.879475, 13.879475},
+  {13.938888, 13.938888, 13.938888, 13.938888, 13.938888, 13.938888},
+  {13.998326, 13.998326, 13.998326, 13.998326, 13.998326, 13.998326},
+  {14.057788, 14.057788, 14.057788, 14.057788, 14.057788, 14.057788},
+  {14.117276, 14.117276, 14.117276, 14.117276, 14.117276, 14.117276},
+  {14.176788, 14.176788, 14.176788, 14.176788, 14.176788, 14.176788},
+  {14.236324, 14.236324, 14.236324, 14.236324, 14.236324, 14.236324},
+  {14.295886, 14.295886, 14.295886, 14.295886, 14.295886, 14.295886},
+  {14.355472, 14.355472, 14.355472, 14.355472, 14.355472, 14.355472},
+  {14.415082, 14.415082, 14.415082, 14.415082, 14.415082, 14.415082},
+  {14.474717, 14.474717, 14.474717, 14.474717, 14.474717, 14.474717},
+  {14.534377, 14.534377, 14.534377, 14.534377, 14.534377, 14.534377},
+  {14.594062, 14.594062, 14.594062, 14.594062, 14.594062, 14.594062},
+  {14.653771, 14.653771, 14.653771, 14.653771, 14.653771, 14.653771},
+  {14.713505, 14.713505, 14.713505, 14.713505, 14.713505, 14.713505},
+  {14.773264, 14.773264, 14.773264, 14.773264, 14.773264, 14.773264},
+  {14.833047, 14.833047, 14.833047, 14.833047, 14.833047, 14.833047},
+  {14.892855, 14.892855, 14.892855, 14.892855, 14.892855, 14.892855},
+  {14.952687, 14.952687, 14.952687, 14.952687, 14.952687, 14.952687},
+  {15.012544, 15.012544, 15.012544, 15.012544, 15.012544, 15.012544},
+  {15.072426, 15.072426, 15.072426, 15.072426, 15.072426, 15.072426},
+  {15.132332, 15.132332, 15.132332, 15.132332, 15.132332, 15.132332},
+  {15.192263, 15.192263, 15.192263, 15.192263, 15.192263, 15.192263},
+  {15.252219, 15.252219, 15.252219, 15.252219, 15.252219, 15.252219},
+  {15.312199, 15.312199, 15.312199, 15.312199, 15.312199, 15.312199},
+  {15.372204, 15.372204, 15.372204, 15.372204, 15.372204, 15.372204},
+  {15.432233, 15.432233, 15.432233, 15.432233, 15.432233, 15.432233},
+  {15.492287, 15.492287, 15.492287, 15.492287, 15.492287, 15.492287},
+  {15.552366, 15.552366, 15.552366, 15.552366, 15.552366, 15.552366},
+  {15.612469, 15.612469, 15.612469, 15.612469, 15.612469, 15.612469},
+  {15.672597, 15.672597, 15.672597, 15.672597, 15.672597, 15.672597},
+  {15.732749, 15.732749, 15.732749, 15.732749, 15.732749, 15.732749},
+  {15.792926, 15.792926, 15.792926, 15.792926, 15.792926, 15.792926},
+  {15.853128, 15.853128, 15.853128, 15.853128, 15.853128, 15.853128},
+  {15.913354, 15.913354, 15.913354, 15.913354, 15.913354, 15.913354},
+  {15.973605, 15.973605, 15.973605, 15.973605, 15.973605, 15.973605},
+  {16.033880, 16.033880, 16.033880, 16.033880, 16.033880, 16.033880},
+  {16.094180, 16.094180, 16.094180, 16.094180, 16.094180, 16.094180},
+  {16.154505, 16.154505, 16.154505, 16.154505, 16.154505, 16.154505},
+  {16.214854, 16.214854, 16.214854, 16.214854, 16.214854, 16.214854},
+  {16.275228, 16.275228, 16.275228, 16.275228, 16.275228, 16.275228},
+  {16.335626, 16.335626, 16.335626, 16.335626, 16.335626, 16.335626},
+  {16.396049, 16.396049, 16.396049, 16.396049, 16.396049, 16.396049},
+  {16.456496, 16.456496, 16.456496, 16.456496, 16.456496, 16.456496},
+  {16.516968, 16.516968, 16.516968, 16.516968, 16.516968, 16.516968},
+  {16.577465, 16.577465, 16.577465, 16.577465, 16.577465, 16.577465},
+  {16.637986, 16.637986, 16.637986, 16.637986, 16.637986, 16.637986},
+  {16.698532, 16.698532, 16.698532, 16.698532, 16.698532, 16.698532},
+  {16.759102, 16.759102, 16.759102, 16.759102, 16.759102, 16.759102},
+  {16.819697, 16.819697, 16.819697, 16.819697, 16.819697, 16.819697},
+  {16.880317, 16.880317, 16.880317, 16.880317, 16.880317, 16.880317},
+  {16.940961, 16.940961, 16.940961, 16.940961, 16.940961, 16.940961},
+  {17.001630, 17.001630, 17.001630, 17.001630, 17.001630, 17.001630},
+  {17.062323, 17.062323, 17.062323, 17.062323, 17.062323, 17.062323},
+  {17.123041, 17.123041, 17.123041, 17.123041, 17.123041, 17.123041},
+  {17.183783, 17.183783, 17.183783, 17.183783, 17.183783, 17.183783},
+  {17.244550, 17.244550, 17.244550, 17.244550, 17.244550, 17.244550},
+  {17.305341, 17.305341, 17.305341, 17.305341, 17.305341, 17.305341},
+  {17.366157, 17.366157, 17.366157, 17.366157, 17.366157, 17.366157},
+  {17.426998, 17.426998, 17.426998, 17.426998, 17.426998, 17.426998},
+  {17.487863, 17.487863, 17.487863, 17.487863, 17.487863, 17.487863},
+  {17.548753, 17.548753, 17.548753, 17.548753, 17.548753, 17.548753},
+  {17.609667, 17.609667, 17.609667, 17.609667, 17.609667, 17.609667},
+  {17.670606, 17.670606, 17.670606, 17.670606, 17.670606, 17.670606},
+  {17.731570, 17.731570, 17.731570, 17.731570, 17.731570, 17.731570},
+  {17.792558, 17.792558, 17.792558, 17.792558, 17.792558, 17.792558},
+  {17.853570, 17.853570, 17.853570, 17.853570, 17.853570, 17.853570},
+  {17.914608, 17.914608, 17.914608, 17.914608, 17.914608, 17.914608},
+  {17.975669, 17.975669, 17.975669, 17.975669, 17.975669, 17.975669},
+  {18.036756, 18.036756, 18.036756, 18.036756, 18.036756, 18.036756},
+  {18.097867, 18.097867, 18.097867, 18.097867, 18.097867, 18.097867},
+  {18.159002, 18.159002, 18.159002, 18.159002, 18.159002, 18.159002},
+  {18.220162, 18.220162, 18.220162, 18.220162, 18.220162, 18.220162},
+  {18.281347, 18.281347, 18.281347, 18.281347, 18.281347, 18.281347},
+  {18.342556, 18.342556, 18.342556, 18.342556, 18.342556, 18.342556},
+  {18.403790, 18.403790, 18.403790, 18.403790, 18.403790, 18.403790},
+  {18.465048, 18.465048, 18.465048, 18.465048, 18.465048, 18.465048},
+  {18.526331, 18.526331, 18.526331, 18.526331, 18.526331, 18.526331},
+  {18.587639, 18.587639, 18.587639, 18.587639, 18.587639, 18.587639},
+  {18.648971, 18.648971, 18.648971, 18.648971, 18.648971, 18.648971},
+  {18.710327, 18.710327, 18.710327, 18.710327, 18.710327, 18.710327},
+  {18.771709, 18.771709, 18.771709, 18.771709, 18.771709, 18.771709},
+  {18.833115, 18.833115, 18.833115, 18.833115, 18.833115, 18.833115},
+  {18.894545, 18.894545, 18.894545, 18.894545, 18.894545, 18.894545},
+  {18.956000, 18.956000, 18.956000, 18.956000, 18.956000, 18.956000},
+  {19.017480, 19.017480, 19.017480, 19.017480, 19.017480, 19.017480},
+  {19.078984, 19.078984, 19.078984, 19.078984, 19.078984, 19.078984},
+  {19.140513, 19.140513, 19.140513, 19.140513, 19.140513, 19.140513},
+  {19.202066, 19.202066, 19.202066, 19.202066, 19.202066, 19.202066},
+  {19.263644, 19.263644, 19.263644, 19.263644, 19.263644, 19.263644},
+  {19.325247, 19.325247, 19.325247, 19.325247, 19.325247, 19.325247},
+  {19.386874, 19.386874, 19.386874, 19.386874, 19.386874, 19.386874},
+  {19.448526, 19.448526, 19.448526, 19.448526, 19.448526, 19.448526},
+  {19.510202, 19.510202, 19.510202, 19.510202, 19.510202, 19.510202},
+  {19.571903, 19.571903, 19.571903, 19.571903, 19.571903, 19.571903},
+  {19.633629, 19.633629, 19.633629, 19.633629, 19.633629, 19.633629},
+  {19.695379, 19.695379, 19.695379, 19.695379, 19.695379, 19.695379},
+  {19.757154, 19.757154, 19.757154, 19.757154, 19.757154, 19.757154},
+  {19.818953, 19.818953, 19.818953, 19.818953, 19.818953, 19.818953},
+  {19.880777, 19.880777, 19.880777, 19.880777, 19.880777, 19.880777},
+  {19.942626, 19.942626, 19.942626, 19.942626, 19.942626, 19.942626},
+  {20.004500, 20.004500, 20.004500, 20.004500, 20.004500, 20.004500},
+  {20.066398, 20.066398, 20.066398, 20.066398, 20.066398, 20.066398},
+  {20.128320, 20.128320, 20.128320, 20.128320, 20.128320, 20.128320},
+  {20.190268, 20.190268, 20.190268, 20.190268, 20.190268, 20.190268},
+  {20.252239, 20.252239, 20.252239, 20.252239, 20.252239, 20.252239},
+  {20.314236, 20.314236, 20.314236, 20.314236, 20.314236, 20.314236},
+  {20.376257, 20.376257, 20.376257, 20.376257, 20.376257, 20.376257},
+  {20.438303, 20.438303, 20.438303, 20.438303, 20.438303, 20.438303},
+  {20.500374, 20.500374, 20.500374, 20.500374, 20.500374, 20.500374},
+  {20.562469, 20.562469, 20.562469, 20.562469, 20.562469, 20.562469},
+  {20.624589, 20.624589, 20.624589, 20.624589, 20.624589, 20.624589},
+  {20.686733, 20.686733, 20.686733, 20.686733, 20.686733, 20.686733},
+  {20.748902, 20.748902, 20.748902, 20.748902, 20.748902, 20.748902},
+  {20.811096, 20.811096, 20.811096, 20.811096, 20.811096, 20.811096},
+  {20.873315, 20.873315, 20.873315, 20.873315, 20.873315, 20.873315},
+  {20.935558, 20.935558, 20.935558, 20.935558, 20.935558, 20.935558},
+  {20.997826, 20.997826, 20.997826, 20.997826, 20.997826, 20.997826},
+  {21.060118, 21.060118, 21.060118, 21.060118, 21.060118, 21.060118},
+  {21.122436, 21.122436, 21.122436, 21.122436, 21.122436, 21.122436},
+  {21.184777, 21.184777, 21.184777, 21.184777, 21.184777, 21.184777},
+  {21.247144, 21.247144, 21.247144, 21.247144, 21.247144, 21.247144},
+  {21.309536, 21.309536, 21.309536, 21.309536, 21.309536, 21.309536},
+  {21.371952, 21.371952, 21.371952, 21.371952, 21.371952, 21.371952},
+  {21.434392, 21.434392, 21.434392, 21.434392, 21.434392, 21.434392},
+  {21.496858, 21.496858, 21.496858, 21.496858, 21.496858, 21.496858},
+  {21.559348, 21.559348, 21.559348, 21.559348, 21.559348, 21.559348},
+  {21.621863, 21.621863, 21.621863, 21.621863, 21.621863, 21.621863},
+  {21.684403, 21.684403, 21.684403, 21.684403, 21.684403, 21.684403},
+  {21.746967, 21.746967, 21.746967, 21.746967, 21.746967, 21.746967},
+  {21.809557, 21.809557, 21.809557, 21.809557, 21.809557, 21.809557},
+  {21.872170, 21.872170, 21.872170, 21.872170, 21.872170, 21.872170},
+  {21.934809, 21.934809, 21.934809, 21.934809, 21.934809, 21.934809},
+  {21.997473, 21.997473, 21.997473, 21.997473, 21.997473, 21.997473},
+  {22.060161, 22.060161, 22.060161, 22.060161, 22.060161, 22.060161},
+  {22.122874, 22.122874, 22.122874, 22.122874, 22.122874, 22.122874},
+  {22.185612, 22.185612, 22.185612, 22.185612, 22.185612, 22.185612},
+  {22.248374, 22.248374, 22.248374, 22.248374, 22.248374, 22.248374},
+  {22.311162, 22.311162, 22.311162, 22.311162, 22.311162, 22.311162},
+  {22.373974, 22.373974, 22.373974, 22.373974, 22.373974, 22.373974},
+  {22.436811, 22.436811, 22.436811, 22.436811, 22.436811, 22.436811},
+  {22.499672, 22.499672, 22.499672, 22.499672, 22.499672, 22.499672},
+  {22.562559, 22.562559, 22.562559, 22.562559, 22.562559, 22.562559},
+  {22.625470, 22.625470, 22.625470, 22.625470, 22.625470, 22.625470},
+  {22.688407, 22.688407, 22.688407, 22.688407, 22.688407, 22.688407},
+  {22.751368, 22.751368, 22.751368, 22.751368, 22.751368, 22.751368},
+  {22.814353, 22.814353, 22.814353, 22.814353, 22.814353, 22.814353},
+  {22.877364, 22.877364, 22.877364, 22.877364, 22.877364, 22.877364},
+  {22.940400, 22.940400, 22.940400, 22.940400, 22.940400, 22.940400},
+  {23.003460, 23.003460, 23.003460, 23.003460, 23.003460, 23.003460},
+  {23.066545, 23.066545, 23.066545, 23.066545, 23.066545, 23.066545},
+  {23.129656, 23.129656, 23.129656, 23.129656, 23.129656, 23.129656},
+  {23.192791, 23.192791, 23.192791, 23.192791, 23.192791, 23.192791},
+  {23.255950, 23.255950, 23.255950, 23.255950, 23.255950, 23.255950},
+  {23.319135, 23.319135, 23.319135, 23.319135, 23.319135, 23.319135},
+  {23.382345, 23.382345, 23.382345, 23.382345, 23.382345, 23.382345},
+  {23.445579, 23.445579, 23.445579, 23.445579, 23.445579, 23.445579},
+  {23.508839, 23.508839, 23.508839, 23.508839, 23.508839, 23.508839},
+  {23.572123, 23.572123, 23.572123, 23.572123, 23.572123, 23.572123},
+  {23.635433, 23.635433, 23.635433, 23.635433, 23.635433, 23.635433},
+  {23.698767, 23.698767, 23.698767, 23.698767, 23.698767, 23.698767},
+  {23.762126, 23.762126, 23.762126, 23.762126, 23.762126, 23.762126},
+  {23.825510, 23.825510, 23.825510, 23.825510, 23.825510, 23.825510},
+  {23.888920, 23.888920, 23.888920, 23.888920, 23.888920, 23.888920},
+  {23.952354, 23.952354, 23.952354, 23.952354, 23.952354, 23.952354},
+  {24.015813, 24.015813, 24.015813, 24.015813, 24.015813, 24.015813},
+  {24.079297, 24.079297, 24.079297, 24.079297, 24.079297, 24.079297},
+  {24.142806, 24.142806, 24.142806, 24.142806, 24.142806, 24.142806},
+  {24.206340, 24.206340, 24.206340, 24.206340, 24.206340, 24.206340},
+  {24.269899, 24.269899, 24.269899, 24.269899, 24.269899, 24.269899},
+  {24.333483, 24.333483, 24.333483, 24.333483, 24.333483, 24.333483},
+  {24.397092, 24.397092, 24.397092, 24.397092, 24.397092, 24.397092},
+  {24.460726, 24.460726, 24.460726, 24.460726, 24.460726, 24.460726},
+  {24.524385, 24.524385, 24.524385, 24.524385, 24.524385, 24.524385},
+  {24.588069, 24.588069, 24.588069, 24.588069, 24.588069, 24.588069},
+  {24.651778, 24.651778, 24.651778, 24.651778, 24.651778, 24.651778},
+  {24.715512, 24.715512, 24.715512, 24.715512, 24.715512, 24.715512},
+  {24.779272, 24.779272, 24.779272, 24.779272, 24.779272, 24.779272},
+  {24.843056, 24.843056, 24.843056, 24.843056, 24.843056, 24.843056},
+  {24.906866, 24.906866, 24.906866, 24.906866, 24.906866, 24.906866},
+  {24.970700, 24.970700, 24.970700, 24.970700, 24.970700, 24.970700},
+  {25.034560, 25.034560, 25.034560, 25.034560, 25.034560, 25.034560},
+  {25.098445, 25.098445, 25.098445, 25.098445, 25.098445, 25.098445},
+  {25.162354, 25.162354, 25.162354, 25.162354, 25.162354, 25.162354},
+  {25.226289, 25.226289, 25.226289, 25.226289, 25.226289, 25.226289},
+  {25.290250, 25.290250, 25.290250, 25.290250, 25.290250, 25.290250},
+  {25.354235, 25.354235, 25.354235, 25.354235, 25.354235, 25.354235},
+  {25.418245, 25.418245, 25.418245, 25.418245, 25.418245, 25.418245},
+  {25.482281, 25.482281, 25.482281, 25.482281, 25.482281, 25.482281},
+  {25.546342, 25.546342, 25.546342, 25.546342, 25.546342, 25.546342},
+  {25.610428, 25.610428, 25.610428, 25.610428, 25.610428, 25.610428},
+  {25.674539, 25.674539, 25.674539, 25.674539, 25.674539, 25.674539},
+  {25.738676, 25.738676, 25.738676, 25.738676, 25.738676, 25.738676},
+  {25.802837, 25.802837, 25.802837, 25.802837, 25.802837, 25.802837},
+  {25.867024, 25.867024, 25.867024, 25.867024, 25.867024, 25.867024},
+  {25.931236, 25.931236, 25.931236, 25.931236, 25.931236, 25.931236},
+  {25.995474, 25.995474, 25.995474, 25.995474, 25.995474, 25.995474},
+  {26.059736, 26.059736, 26.059736, 26.059736, 26.059736, 26.059736},
+  {26.124024, 26.124024, 26.124024, 26.124024, 26.124024, 26.124024},
+  {26.188337, 26.188337, 26.188337, 26.188337, 26.188337, 26.188337},
+  {26.252676, 26.252676, 26.252676, 26.252676, 26.252676, 26.252676},
+  {26.317039, 26.317039, 26.317039, 26.317039, 26.317039, 26.317039},
+  {26.381428, 26.381428, 26.381428, 26.381428, 26.381428, 26.381428},
+  {26.445843, 26.445843, 26.445843, 26.445843, 26.445843, 26.445843},
+  {26.510282, 26.510282, 26.510282, 26.510282, 26.510282, 26.510282},
+  {26.574748, 26.574748, 26.574748, 26.574748, 26.574748, 26.574748},
+  {26.639238, 26.639238, 26.639238, 26.639238, 26.639238, 26.639238},
+  {26.703754, 26.703754, 26.703754, 26.703754, 26.703754, 26.703754},
+  {26.768295, 26.768295, 26.768295, 26.768295, 26.768295, 26.768295},
+  {26.832861, 26.832861, 26.832861, 26.832861, 26.832861, 26.832861},
+  {26.897453, 26.897453, 26.897453, 26.897453, 26.897453, 26.897453},
+  {26.962071, 26.962071, 26.962071, 26.962071, 26.962071, 26.962071},
+  {27.026713, 27.026713, 27.026713, 27.026713, 27.026713, 27.026713},
+  {27.091381, 27.091381, 27.091381, 27.091381, 27.091381, 27.091381},
+  {27.156075, 27.156075, 27.156075, 27.156075, 27.156075, 27.156075},
+  {27.220794, 27.220794, 27.220794, 27.220794, 27.220794, 27.220794},
+  {27.285539, 27.285539, 27.285539, 27.285539, 27.285539, 27.285539},
+  {27.350309, 27.350309, 27.350309, 27.350309, 27.350309, 27.350309},
+  {27.415104, 27.415104, 27.415104, 27.415104, 27.415104, 27.415104},
+  {27.479925, 27.479925, 27.479925, 27.479925, 27.479925, 27.479925},
+  {27.544772, 27.544772, 27.544772, 27.544772, 27.544772, 27.544772},
+  {27.609644, 27.609644, 27.609644, 27.609644, 27.609644, 27.609644},
+  {27.674541, 27.674541, 27.674541, 27.674541, 27.674541, 27.674541},
+  {27.739465, 27.739465, 27.739465, 27.739465, 27.739465, 27.739465},
+  {27.804413, 27.804413, 27.804413, 27.804413, 27.804413, 27.804413},
+  {27.869388, 27.869388, 27.869388, 27.869388, 27.869388, 27.869388},
+  {27.934387, 27.934387, 27.934387, 27.934387, 27.934387, 27.934387},
+  {27.999413, 27.999413, 27.999413, 27.999413, 27.999413, 27.999413},
+  {28.064464, 28.064464, 28.064464, 28.064464, 28.064464, 28.064464},
+  {28.129541, 28.129541, 28.129541, 28.129541, 28.129541, 28.129541},
+  {28.194643, 28.194643, 28.194643, 28.194643, 28.194643, 28.194643},
+  {28.259771, 28.259771, 28.259771, 28.259771, 28.259771, 28.259771},
+  {28.324925, 28.324925, 28.324925, 28.324925, 28.324925, 28.324925},
+  {28.390104, 28.390104, 28.390104, 28.390104, 28.390104, 28.390104},
+  {28.455309, 28.455309, 28.455309, 28.455309, 28.455309, 28.455309},
+  {28.520540, 28.520540, 28.520540, 28.520540, 28.520540, 28.520540},
+  {28.585796, 28.585796, 28.585796, 28.585796, 28.585796, 28.585796},
+  {28.651079, 28.651079, 28.651079, 28.651079, 28.651079, 28.651079},
+  {28.716387, 28.716387, 28.716387, 28.716387, 28.716387, 28.716387},
+  {28.781720, 28.781720, 28.781720, 28.781720, 28.781720, 28.781720},
+  {28.847080, 28.847080, 28.847080, 28.847080, 28.847080, 28.847080},
+  {28.912465, 28.912465, 28.912465, 28.912465, 28.912465, 28.912465},
+  {28.977876, 28.977876, 28.977876, 28.977876, 28.977876, 28.977876},
+  {29.043313, 29.043313, 29.043313, 29.043313, 29.043313, 29.043313},
+  {29.108776, 29.108776, 29.108776, 29.108776, 29.108776, 29.108776},
+  {29.174264, 29.174264, 29.174264, 29.174264, 29.174264, 29.174264},
+  {29.239779, 29.239779, 29.239779, 29.239779, 29.239779, 29.239779},
+  {29.305319, 29.305319, 29.305319, 29.305319, 29.305319, 29.305319},
+  {29.370885, 29.370885, 29.370885, 29.370885, 29.370885, 29.370885},
+  {29.436477, 29.436477, 29.436477, 29.436477, 29.436477, 29.436477},
+  {29.502095, 29.502095, 29.502095, 29.502095, 29.502095, 29.502095},
+  {29.567739, 29.567739, 29.567739, 29.567739, 29.567739, 29.567739},
+  {29.633409, 29.633409, 29.633409, 29.633409, 29.633409, 29.633409},
+  {29.699105, 29.699105, 29.699105, 29.699105, 29.699105, 29.699105},
+  {29.764826, 29.764826, 29.764826, 29.764826, 29.764826, 29.764826},
+  {29.830574, 29.830574, 29.830574, 29.830574, 29.830574, 29.830574},
+  {29.896348, 29.896348, 29.896348, 29.896348, 29.896348, 29.896348},
+  {29.962148, 29.962148, 29.962148, 29.962148, 29.962148, 29.962148},
+  {30.027974, 30.027974, 30.027974, 30.027974, 30.027974, 30.027974},
+  {30.093826, 30.093826, 30.093826, 30.093826, 30.093826, 30.093826},
+  {30.159704, 30.159704, 30.159704, 30.159704, 30.159704, 30.159704},
+  {30.225608, 30.225608, 30.225608, 30.225608, 30.225608, 30.225608},
+  {30.291538, 30.291538, 30.291538, 30.291538, 30.291538, 30.291538},
+  {30.357494, 30.357494, 30.357494, 30.357494, 30.357494, 30.357494},
+  {30.423476, 30.423476, 30.423476, 30.423476, 30.423476, 30.423476},
+  {30.489485, 30.489485, 30.489485, 30.489485, 30.489485, 30.489485},
+  {30.555520, 30.555520, 30.555520, 30.555520, 30.555520, 30.555520},
+  {30.621580, 30.621580, 30.621580, 30.621580, 30.621580, 30.621580},
+  {30.687667, 30.687667, 30.687667, 30.687667, 30.687667, 30.687667},
+  {30.753781, 30.753781, 30.753781, 30.753781, 30.753781, 30.753781},
+  {30.819920, 30.819920, 30.819920, 30.819920, 30.819920, 30.819920},
+  {30.886086, 30.886086, 30.886086, 30.886086, 30.886086, 30.886086},
+  {30.952278, 30.952278, 30.952278, 30.952278, 30.952278, 30.952278},
+  {31.018496, 31.018496, 31.018496, 31.018496, 31.018496, 31.018496},
+  {31.084741, 31.084741, 31.084741, 31.084741, 31.084741, 31.084741},
+  {31.151012, 31.151012, 31.151012, 31.151012, 31.151012, 31.151012},
+  {31.217309, 31.217309, 31.217309, 31.217309, 31.217309, 31.217309},
+  {31.283632, 31.283632, 31.283632, 31.283632, 31.283632, 31.283632},
+  {31.349982, 31.349982, 31.349982, 31.349982, 31.349982, 31.349982},
+  {31.416358, 31.416358, 31.416358, 31.416358, 31.416358, 31.416358},
+  {31.482761, 31.482761, 31.482761, 31.482761, 31.482761, 31.482761},
+  {31.549190, 31.549190, 31.549190, 31.549190, 31.549190, 31.549190},
+  {31.615646, 31.615646, 31.615646, 31.615646, 31.615646, 31.615646},
+  {31.682127, 31.682127, 31.682127, 31.682127, 31.682127, 31.682127},
+  {31.748636, 31.748636, 31.748636, 31.748636, 31.748636, 31.748636},
+  {31.815171, 31.815171, 31.815171, 31.815171, 31.815171, 31.815171},
+  {31.881732, 31.881732, 31.881732, 31.881732, 31.881732, 31.881732},
+  {31.948320, 31.948320, 31.948320, 31.948320, 31.948320, 31.948320},
+  {32.014934, 32.014934, 32.014934, 32.014934, 32.014934, 32.014934},
+  {32.081575, 32.081575, 32.081575, 32.081575, 32.081575, 32.081575},
+  {32.148243, 32.148243, 32.148243, 32.148243, 32.148243, 32.148243},
+  {32.214937, 32.214937, 32.214937, 32.214937, 32.214937, 32.214937},
+  {32.281658, 32.281658, 32.281658, 32.281658, 32.281658, 32.281658},
+  {32.348405, 32.348405, 32.348405, 32.348405, 32.348405, 32.348405},
+  {32.415179, 32.415179, 32.415179, 32.415179, 32.415179, 32.415179},
+  {32.481980, 32.481980, 32.481980, 32.481980, 32.481980, 32.481980},
+  {32.548807, 32.548807, 32.548807, 32.548807, 32.548807, 32.548807},
+  {32.615661, 32.615661, 32.615661, 32.615661, 32.615661, 32.615661},
+  {32.682542, 32.682542, 32.682542, 32.682542, 32.682542, 32.682542},
+  {32.749449, 32.749449, 32.749449, 32.749449, 32.749449, 32.749449},
+  {32.816384, 32.816384, 32.816384, 32.816384, 32.816384, 32.816384},
+  {32.883345, 32.883345, 32.883345, 32.883345, 32.883345, 32.883345},
+  {32.950332, 32.950332, 32.950332, 32.950332, 32.950332, 32.950332},
+  {33.017347, 33.017347, 33.017347, 33.017347, 33.017347, 33.017347},
+  {33.084389, 33.084389, 33.084389, 33.084389, 33.084389, 33.084389},
+  {33.151457, 33.151457, 33.151457, 33.151457, 33.151457, 33.151457},
+  {33.218552, 33.218552, 33.218552, 33.218552, 33.218552, 33.218552},
+  {33.285674, 33.285674, 33.285674, 33.285674, 33.285674, 33.285674},
+  {33.352823, 33.352823, 33.352823, 33.352823, 33.352823, 33.352823},
+  {33.419999, 33.419999, 33.419999, 33.419999, 33.419999, 33.419999},
+  {33.487202, 33.487202, 33.487202, 33.487202, 33.487202, 33.487202},
+  {33.554432, 33.554432, 33.554432, 33.554432, 33.554432, 33.554432},
+  {33.621689, 33.621689, 33.621689, 33.621689, 33.621689, 33.621689},
+  {33.688972, 33.688972, 33.688972, 33.688972, 33.688972, 33.688972},
+  {33.756283, 33.756283, 33.756283, 33.756283, 33.756283, 33.756283},
+  {33.823621, 33.823621, 33.823621, 33.823621, 33.823621, 33.823621},
+  {33.890986, 33.890986, 33.890986, 33.890986, 33.890986, 33.890986},
+  {33.958378, 33.958378, 33.958378, 33.958378, 33.958378, 33.958378},
+  {34.025797, 34.025797, 34.025797, 34.025797, 34.025797, 34.025797},
+  {34.093244, 34.093244, 34.093244, 34.093244, 34.093244, 34.093244},
+  {34.160717, 34.160717, 34.160717, 34.160717, 34.160717, 34.160717},
+  {34.228218, 34.228218, 34.228218, 34.228218, 34.228218, 34.228218},
+  {34.295746, 34.295746, 34.295746, 34.295746, 34.295746, 34.295746},
+  {34.363301, 34.363301, 34.363301, 34.363301, 34.363301, 34.363301},
+  {34.430883, 34.430883, 34.430883, 34.430883, 34.430883, 34.430883},
+  {34.498493, 34.498493, 34.498493, 34.498493, 34.498493, 34.498493},
+  {34.566130, 34.566130, 34.566130, 34.566130, 34.566130, 34.566130},
+  {34.633794, 34.633794, 34.633794, 34.633794, 34.633794, 34.633794},
+  {34.701485, 34.701485, 34.701485, 34.701485, 34.701485, 34.701485},
+  {34.769204, 34.769204, 34.769204, 34.769204, 34.769204, 34.769204},
+  {34.836950, 34.836950, 34.836950, 34.836950, 34.836950, 34.836950},
+  {34.904724, 34.904724, 34.904724, 34.904724, 34.904724, 34.904724},
+  {34.972525, 34.972525, 34.972525, 34.972525, 34.972525, 34.972525},
+  {35.040353, 35.040353, 35.040353, 35.040353, 35.040353, 35.040353},
+  {35.108209, 35.108209, 35.108209, 35.108209, 35.108209, 35.108209},
+  {35.176093, 35.176093, 35.176093, 35.176093, 35.176093, 35.176093},
+  {35.244004, 35.244004, 35.244004, 35.244004, 35.244004, 35.244004},
+  {35.311942, 35.311942, 35.311942, 35.311942, 35.311942, 35.311942},
+  {35.379908, 35.379908, 35.379908, 35.379908, 35.379908, 35.379908},
+  {35.447901, 35.447901, 35.447901, 35.447901, 35.447901, 35.447901},
+  {35.515923, 35.515923, 35.515923, 35.515923, 35.515923, 35.515923},
+  {35.583971, 35.583971, 35.583971, 35.583971, 35.583971, 35.583971},
+  {35.652048, 35.652048, 35.652048, 35.652048, 35.652048, 35.652048},
+  {35.720152, 35.720152, 35.720152, 35.720152, 35.720152, 35.720152},
+  {35.788283, 35.788283, 35.788283, 35.788283, 35.788283, 35.788283},
+  {35.856443, 35.856443, 35.856443, 35.856443, 35.856443, 35.856443},
+  {35.924630, 35.924630, 35.924630, 35.924630, 35.924630, 35.924630},
+  {35.992845, 35.992845, 35.992845, 35.992845, 35.992845, 35.992845},
+  {36.061088, 36.061088, 36.061088, 36.061088, 36.061088, 36.061088},
+  {36.129358, 36.129358, 36.129358, 36.129358, 36.129358, 36.129358},
+  {36.197657, 36.197657, 36.197657, 36.197657, 36.197657, 36.197657},
+  {36.265983, 36.265983, 36.265983, 36.265983, 36.265983, 36.265983},
+  {36.334337, 36.334337, 36.334337, 36.334337, 36.334337, 36.334337},
+  {36.402719, 36.402719, 36.402719, 36.402719, 36.402719, 36.402719},
+  {36.471129, 36.471129, 36.471129, 36.471129, 36.471129, 36.471129},
+  {36.539566, 36.539566, 36.539566, 36.539566, 36.539566, 36.539566},
+  {36.608032, 36.608032, 36.608032, 36.608032, 36.608032, 36.608032},
+  {36.676526, 36.676526, 36.676526, 36.676526, 36.676526, 36.676526},
+  {36.745048, 36.745048, 36.745048, 36.745048, 36.745048, 36.745048},
+  {36.813598, 36.813598, 36.813598, 36.813598, 36.813598, 36.813598},
+  {36.882176, 36.882176, 36.882176, 36.882176, 36.882176, 36.882176},
+  {36.950782, 36.950782, 36.950782, 36.950782, 36.950782, 36.950782},
+  {37.019416, 37.019416, 37.019416, 37.019416, 37.019416, 37.019416},
+  {37.088078, 37.088078, 37.088078, 37.088078, 37.088078, 37.088078},
+  {37.156769, 37.156769, 37.156769, 37.156769, 37.156769, 37.156769},
+  {37.225487, 37.225487, 37.225487, 37.225487, 37.225487, 37.225487},
+  {37.294234, 37.294234, 37.294234, 37.294234, 37.294234, 37.294234},
+  {37.363009, 37.363009, 37.363009, 37.363009, 37.363009, 37.363009},
+  {37.431813, 37.431813, 37.431813, 37.431813, 37.431813, 37.431813},
+  {37.500644, 37.500644, 37.500644, 37.500644, 37.500644, 37.500644},
+  {37.569504, 37.569504, 37.569504, 37.569504, 37.569504, 37.569504},
+  {37.638393, 37.638393, 37.638393, 37.638393, 37.638393, 37.638393},
+  {37.707309, 37.707309, 37.707309, 37.707309, 37.707309, 37.707309},
+  {37.776255, 37.776255, 37.776255, 37.776255, 37.776255, 37.776255},
+  {37.845228, 37.845228, 37.845228, 37.845228, 37.845228, 37.845228},
+  {37.914230, 37.914230, 37.914230, 37.914230, 37.914230, 37.914230},
+  {37.983261, 37.983261, 37.983261, 37.983261, 37.983261, 37.983261},
+  {38.052320, 38.052320, 38.052320, 38.052320, 38.052320, 38.052320},
+  {38.121407, 38.121407, 38.121407, 38.121407, 38.121407, 38.121407},
+  {38.190524, 38.190524, 38.190524, 38.190524, 38.190524, 38.190524},
+  {38.259668, 38.259668, 38.259668, 38.259668, 38.259668, 38.259668},
+  {38.328842, 38.328842, 38.328842, 38.328842, 38.328842, 38.328842},
+  {38.398044, 38.398044, 38.398044, 38.398044, 38.398044, 38.398044},
+  {38.467274, 38.467274, 38.467274, 38.467274, 38.467274, 38.467274},
+  {38.536534, 38.536534, 38.536534, 38.536534, 38.536534, 38.536534},
+  {38.605822, 38.605822, 38.605822, 38.605822, 38.605822, 38.605822},
+  {38.675139, 38.675139, 38.675139, 38.675139, 38.675139, 38.675139},
+  {38.744484, 38.744484, 38.744484, 38.744484, 38.744484, 38.744484},
+  {38.813859, 38.813859, 38.813859, 38.813859, 38.813859, 38.813859},
+  {38.883262, 38.883262, 38.883262, 38.883262, 38.883262, 38.883262},
+  {38.952694, 38.952694, 38.952694, 38.952694, 38.952694, 38.952694},
+  {39.022155, 39.022155, 39.022155, 39.022155, 39.022155, 39.022155},
+  {39.091645, 39.091645, 39.091645, 39.091645, 39.091645, 39.091645},
+  {39.161164, 39.161164, 39.161164, 39.161164, 39.161164, 39.161164},
+  {39.230712, 39.230712, 39.230712, 39.230712, 39.230712, 39.230712},
+  {39.300289, 39.300289, 39.300289, 39.300289, 39.300289, 39.300289},
+  {39.369895, 39.369895, 39.369895, 39.369895, 39.369895, 39.369895},
+  {39.439530, 39.439530, 39.439530, 39.439530, 39.439530, 39.439530},
+  {39.509194, 39.509194, 39.509194, 39.509194, 39.509194, 39.509194},
+  {39.578887, 39.578887, 39.578887, 39.578887, 39.578887, 39.578887},
+  {39.648609, 39.648609, 39.648609, 39.648609, 39.648609, 39.648609},
+  {39.718361, 39.718361, 39.718361, 39.718361, 39.718361, 39.718361},
+  {39.788141, 39.788141, 39.788141, 39.788141, 39.788141, 39.788141},
+  {39.857951, 39.857951, 39.857951, 39.857951, 39.857951, 39.857951},
+  {39.927791, 39.927791, 39.927791, 39.927791, 39.927791, 39.927791},
+  {39.997659, 39.997659, 39.997659, 39.997659, 39.997659, 39.997659},
+  {40.067557, 40.067557, 40.067557, 40.067557, 40.067557, 40.067557},
+  {40.137484, 40.137484, 40.137484, 40.137484, 40.137484, 40.137484},
+  {40.207441, 40.207441, 40.207441, 40.207441, 40.207441, 40.207441},
+  {40.277427, 40.277427, 40.277427, 40.277427, 40.277427, 40.277427},
+  {40.347443, 40.347443, 40.347443, 40.347443, 40.347443, 40.347443},
+  {40.417488, 40.417488, 40.417488, 40.417488, 40.417488, 40.417488},
+  {40.487562, 40.487562, 40.487562, 40.487562, 40.487562, 40.487562},
+  {40.557666, 40.557666, 40.557666, 40.557666, 40.557666, 40.557666},
+  {40.627800, 40.627800, 40.627800, 40.627800, 40.627800, 40.627800},
+  {40.697963, 40.697963, 40.697963, 40.697963, 40.697963, 40.697963},
+  {40.768156, 40.768156, 40.768156, 40.768156, 40.768156, 40.768156},
+  {40.838378, 40.838378, 40.838378, 40.838378, 40.838378, 40.838378},
+  {40.908631, 40.908631, 40.908631, 40.908631, 40.908631, 40.908631},
+  {40.978913, 40.978913, 40.978913, 40.978913, 40.978913, 40.978913},
+  {41.049224, 41.049224, 41.049224, 41.049224, 41.049224, 41.049224},
+  {41.119566, 41.119566, 41.119566, 41.119566, 41.119566, 41.119566},
+  {41.189937, 41.189937, 41.189937, 41.189937, 41.189937, 41.189937},
+  {41.260338, 41.260338, 41.260338, 41.260338, 41.260338, 41.260338},
+  {41.330769, 41.330769, 41.330769, 41.330769, 41.330769, 41.330769},
+  {41.401230, 41.401230, 41.401230, 41.401230, 41.401230, 41.401230},
+  {41.471721, 41.471721, 41.471721, 41.471721, 41.471721, 41.471721},
+  {41.542242, 41.542242, 41.542242, 41.542242, 41.542242, 41.542242},
+  {41.612793, 41.612793, 41.612793, 41.612793, 41.612793, 41.612793},
+  {41.683374, 41.683374, 41.683374, 41.683374, 41.683374, 41.683374},
+  {41.753985, 41.753985, 41.753985, 41.753985, 41.753985, 41.753985},
+  {41.824626, 41.824626, 41.824626, 41.824626, 41.824626, 41.824626},
+  {41.895298, 41.895298, 41.895298, 41.895298, 41.895298, 41.895298},
+  {41.965999, 41.965999, 41.965999, 41.965999, 41.965999, 41.965999},
+  {42.036731, 42.036731, 42.036731, 42.036731, 42.036731, 42.036731},
+  {42.107493, 42.107493, 42.107493, 42.107493, 42.107493, 42.107493},
+  {42.178285, 42.178285, 42.178285, 42.178285, 42.178285, 42.178285},
+  {42.249108, 42.249108, 42.249108, 42.249108, 42.249108, 42.249108},
+  {42.319961, 42.319961, 42.319961, 42.319961, 42.319961, 42.319961},
+  {42.390844, 42.390844, 42.390844, 42.390844, 42.390844, 42.390844},
+  {42.461758, 42.461758, 42.461758, 42.461758, 42.461758, 42.461758},
+  {42.532702, 42.532702, 42.532702, 42.532702, 42.532702, 42.532702},
+  {42.603676, 42.603676, 42.603676, 42.603676, 42.603676, 42.603676},
+  {42.674681, 42.674681, 42.674681, 42.674681, 42.674681, 42.674681},
+  {42.745717, 42.745717, 42.745717, 42.745717, 42.745717, 42.745717},
+  {42.816783, 42.816783, 42.816783, 42.816783, 42.816783, 42.816783},
+  {42.887880, 42.887880, 42.887880, 42.887880, 42.887880, 42.887880},
+  {42.959008, 42.959008, 42.959008, 42.959008, 42.959008, 42.959008},
+  {43.030166, 43.030166, 43.030166, 43.030166, 43.030166, 43.030166},
+  {43.101355, 43.101355, 43.101355, 43.101355, 43.101355, 43.101355},
+  {43.172575, 43.172575, 43.172575, 43.172575, 43.172575, 43.172575},
+  {43.243826, 43.243826, 43.243826, 43.243826, 43.243826, 43.243826},
+  {43.315107, 43.315107, 43.315107, 43.315107, 43.315107, 43.315107},
+  {43.386419, 43.386419, 43.386419, 43.386419, 43.386419, 43.386419},
+  {43.457762, 43.457762, 43.457762, 43.457762, 43.457762, 43.457762},
+  {43.529136, 43.529136, 43.529136, 43.529136, 43.529136, 43.529136},
+  {43.600541, 43.600541, 43.600541, 43.600541, 43.600541, 43.600541},
+  {43.671978, 43.671978, 43.671978, 43.671978, 43.671978, 43.671978},
+  {43.743445, 43.743445, 43.743445, 43.743445, 43.743445, 43.743445},
+  {43.814943, 43.814943, 43.814943, 43.814943, 43.814943, 43.814943},
+  {43.886472, 43.886472, 43.886472, 43.886472, 43.886472, 43.886472},
+  {43.958033, 43.958033, 43.958033, 43.958033, 43.958033, 43.958033},
+  {44.029624, 44.029624, 44.029624, 44.029624, 44.029624, 44.029624},
+  {44.101247, 44.101247, 44.101247, 44.101247, 44.101247, 44.101247},
+  {44.172901, 44.172901, 44.172901, 44.172901, 44.172901, 44.172901},
+  {44.244587, 44.244587, 44.244587, 44.244587, 44.244587, 44.244587},
+  {44.316304, 44.316304, 44.316304, 44.316304, 44.316304, 44.316304},
+  {44.388052, 44.388052, 44.388052, 44.388052, 44.388052, 44.388052},
+  {44.459832, 44.459832, 44.459832, 44.459832, 44.459832, 44.459832},
+  {44.531643, 44.531643, 44.531643, 44.531643, 44.531643, 44.531643},
+  {44.603485, 44.603485, 44.603485, 44.603485, 44.603485, 44.603485},
+  {44.675359, 44.675359, 44.675359, 44.675359, 44.675359, 44.675359},
+  {44.747265, 44.747265, 44.747265, 44.747265, 44.747265, 44.747265},
+  {44.819202, 44.819202, 44.819202, 44.819202, 44.819202, 44.819202},
+  {44.891171, 44.891171, 44.891171, 44.891171, 44.891171, 44.891171},
+  {44.963172, 44.963172, 44.963172, 44.963172, 44.963172, 44.963172},
+  {45.035204, 45.035204, 45.035204, 45.035204, 45.035204, 45.035204},
+  {45.107268, 45.107268, 45.107268, 45.107268, 45.107268, 45.107268},
+  {45.179364, 45.179364, 45.179364, 45.179364, 45.179364, 45.179364},
+  {45.251492, 45.251492, 45.251492, 45.251492, 45.251492, 45.251492},
+  {45.323652, 45.323652, 45.323652, 45.323652, 45.323652, 45.323652},
+  {45.395843, 45.395843, 45.395843, 45.395843, 45.395843, 45.395843},
+  {45.468067, 45.468067, 45.468067, 45.468067, 45.468067, 45.468067},
+  {45.540322, 45.540322, 45.540322, 45.540322, 45.540322, 45.540322},
+  {45.612610, 45.612610, 45.612610, 45.612610, 45.612610, 45.612610},
+  {45.684929, 45.684929, 45.684929, 45.684929, 45.684929, 45.684929},
+  {45.757281, 45.757281, 45.757281, 45.757281, 45.757281, 45.757281},
+  {45.829665, 45.829665, 45.829665, 45.829665, 45.829665, 45.829665},
+  {45.902081, 45.902081, 45.902081, 45.902081, 45.902081, 45.902081},
+  {45.974529, 45.974529, 45.974529, 45.974529, 45.974529, 45.974529},
+  {46.047010, 46.047010, 46.047010, 46.047010, 46.047010, 46.047010},
+  {46.119523, 46.119523, 46.119523, 46.119523, 46.119523, 46.119523},
+  {46.192068, 46.192068, 46.192068, 46.192068, 46.192068, 46.192068},
+  {46.264646, 46.264646, 46.264646, 46.264646, 46.264646, 46.264646},
+  {46.337256, 46.337256, 46.337256, 46.337256, 46.337256, 46.337256},
+  {46.409898, 46.409898, 46.409898, 46.409898, 46.409898, 46.409898},
+  {46.482573, 46.482573, 46.482573, 46.482573, 46.482573, 46.482573},
+  {46.555281, 46.555281, 46.555281, 46.555281, 46.555281, 46.555281},
+  {46.628021, 46.628021, 46.628021, 46.628021, 46.628021, 46.628021},
+  {46.700794, 46.700794, 46.700794, 46.700794, 46.700794, 46.700794},
+  {46.773600, 46.773600, 46.773600, 46.773600, 46.773600, 46.773600},
+  {46.846438, 46.846438, 46.846438, 46.846438, 46.846438, 46.846438},
+  {46.919310, 46.919310, 46.919310, 46.919310, 46.919310, 46.919310},
+  {46.992214, 46.992214, 46.992214, 46.992214, 46.992214, 46.992214},
+  {47.065150, 47.065150, 47.065150, 47.065150, 47.065150, 47.065150},
+  {47.138120, 47.138120, 47.138120, 47.138120, 47.138120, 47.138120},
+  {47.211123, 47.211123, 47.211123, 47.211123, 47.211123, 47.211123},
+  {47.284158, 47.284158, 47.284158, 47.284158, 47.284158, 47.284158},
+  {47.357227, 47.357227, 47.357227, 47.357227, 47.357227, 47.357227},
+  {47.430329, 47.430329, 47.430329, 47.430329, 47.430329, 47.430329},
+  {47.503464, 47.503464, 47.503464, 47.503464, 47.503464, 47.503464},
+  {47.576632, 47.576632, 47.576632, 47.576632, 47.576632, 47.576632},
+  {47.649833, 47.649833, 47.649833, 47.649833, 47.649833, 47.649833},
+  {47.723068, 47.723068, 47.723068, 47.723068, 47.723068, 47.723068},
+  {47.796336, 47.796336, 47.796336, 47.796336, 47.796336, 47.796336},
+  {47.869637, 47.869637, 47.869637, 47.869637, 47.869637, 47.869637},
+  {47.942971, 47.942971, 47.942971, 47.942971, 47.942971, 47.942971},
+  {48.016339, 48.016339, 48.016339, 48.016339, 48.016339, 48.016339},
+  {48.089741, 48.089741, 48.089741, 48.089741, 48.089741, 48.089741},
+  {48.163176, 48.163176, 48.163176, 48.163176, 48.163176, 48.163176},
+  {48.236644, 48.236644, 48.236644, 48.236644, 48.236644, 48.236644},
+  {48.310147, 48.310147, 48.310147, 48.310147, 48.310147, 48.310147},
+  {48.383682, 48.383682, 48.383682, 48.383682, 48.383682, 48.383682},
+  {48.457252, 48.457252, 48.457252, 48.457252, 48.457252, 48.457252},
+  {48.530855, 48.530855, 48.530855, 48.530855, 48.530855, 48.530855},
+  {48.604492, 48.604492, 48.604492, 48.604492, 48.604492, 48.604492},
+  {48.678163, 48.678163, 48.678163, 48.678163, 48.678163, 48.678163},
+  {48.751868, 48.751868, 48.751868, 48.751868, 48.751868, 48.751868},
+  {48.825607, 48.825607, 48.825607, 48.825607, 48.825607, 48.825607},
+  {48.899379, 48.899379, 48.899379, 48.899379, 48.899379, 48.899379},
+  {48.973186, 48.973186, 48.973186, 48.973186, 48.973186, 48.973186},
+  {49.047027, 49.047027, 49.047027, 49.047027, 49.047027, 49.047027},
+  {49.120902, 49.120902, 49.120902, 49.120902, 49.120902, 49.120902},
+  {49.194811, 49.194811, 49.194811, 49.194811, 49.194811, 49.194811},
+  {49.268754, 49.268754, 49.268754, 49.268754, 49.268754, 49.268754},
+  {49.342732, 49.342732, 49.342732, 49.342732, 49.342732, 49.342732},
+  {49.416744, 49.416744, 49.416744, 49.416744, 49.416744, 49.416744},
+  {49.490790, 49.490790, 49.490790, 49.490790, 49.490790, 49.490790},
+  {49.564870, 49.564870, 49.564870, 49.564870, 49.564870, 49.564870},
+  {49.638986, 49.638986, 49.638986, 49.638986, 49.638986, 49.638986},
+  {49.713135, 49.713135, 49.713135, 49.713135, 49.713135, 49.713135},
+  {49.787319, 49.787319, 49.787319, 49.787319, 49.787319, 49.787319},
+  {49.861538, 49.861538, 49.861538, 49.861538, 49.861538, 49.861538},
+  {49.935791, 49.935791, 49.935791, 49.935791, 49.935791, 49.935791},
+  {50.010079, 50.010079, 50.010079, 50.010079, 50.010079, 50.010079},
+  {50.084402, 50.084402, 50.084402, 50.084402, 50.084402, 50.084402},
+  {50.158760, 50.158760, 50.158760, 50.158760, 50.158760, 50.158760},
+  {50.233152, 50.233152, 50.233152, 50.233152, 50.233152, 50.233152},
+  {50.307580, 50.307580, 50.307580, 50.307580, 50.307580, 50.307580},
+  {50.382042, 50.382042, 50.382042, 50.382042, 50.382042, 50.382042},
+  {50.456539, 50.456539, 50.456539, 50.456539, 50.456539, 50.456539},
+  {50.531072, 50.531072, 50.531072, 50.531072, 50.531072, 50.531072},
+  {50.605639, 50.605639, 50.605639, 50.605639, 50.605639, 50.605639},
+  {50.680242, 50.680242, 50.680242, 50.680242, 50.680242, 50.680242},
+  {50.754879, 50.754879, 50.754879, 50.754879, 50.754879, 50.754879},
+  {50.829553, 50.829553, 50.829553, 50.829553, 50.829553, 50.829553},
+  {50.904261, 50.904261, 50.904261, 50.904261, 50.904261, 50.904261},
+  {50.979005, 50.979005, 50.979005, 50.979005, 50.979005, 50.979005},
+  {51.053784, 51.053784, 51.053784, 51.053784, 51.053784, 51.053784},
+  {51.128598, 51.128598, 51.128598, 51.128598, 51.128598, 51.128598},
+  {51.203448, 51.203448, 51.203448, 51.203448, 51.203448, 51.203448},
+  {51.278334, 51.278334, 51.278334, 51.278334, 51.278334, 51.278334},
+  {51.353255, 51.353255, 51.353255, 51.353255, 51.353255, 51.353255},
+  {51.428212, 51.428212, 51.428212, 51.428212, 51.428212, 51.428212},
+  {51.503204, 51.503204, 51.503204, 51.503204, 51.503204, 51.503204},
+  {51.578233, 51.578233, 51.578233, 51.578233, 51.578233, 51.578233},
+  {51.653297, 51.653297, 51.653297, 51.653297, 51.653297, 51.653297},
+  {51.728397, 51.728397, 51.728397, 51.728397, 51.728397, 51.728397},
+  {51.803533, 51.803533, 51.803533, 51.803533, 51.803533, 51.803533},
+  {51.878705, 51.878705, 51.878705, 51.878705, 51.878705, 51.878705},
+  {51.953913, 51.953913, 51.953913, 51.953913, 51.953913, 51.953913},
+  {52.029157, 52.029157, 52.029157, 52.029157, 52.029157, 52.029157},
+  {52.104437, 52.104437, 52.104437, 52.104437, 52.104437, 52.104437},
+  {52.179753, 52.179753, 52.179753, 52.179753, 52.179753, 52.179753},
+  {52.255106, 52.255106, 52.255106, 52.255106, 52.255106, 52.255106},
+  {52.330495, 52.330495, 52.330495, 52.330495, 52.330495, 52.330495},
+  {52.405920, 52.405920, 52.405920, 52.405920, 52.405920, 52.405920},
+  {52.481382, 52.481382, 52.481382, 52.481382, 52.481382, 52.481382},
+  {52.556880, 52.556880, 52.556880, 52.556880, 52.556880, 52.556880},
+  {52.632415, 52.632415, 52.632415, 52.632415, 52.632415, 52.632415},
+  {52.707986, 52.707986, 52.707986, 52.707986, 52.707986, 52.707986},
+  {52.783594, 52.783594, 52.783594, 52.783594, 52.783594, 52.783594},
+  {52.859239, 52.859239, 52.859239, 52.859239, 52.859239, 52.859239},
+  {52.934920, 52.934920, 52.934920, 52.934920, 52.934920, 52.934920},
+  {53.010638, 53.010638, 53.010638, 53.010638, 53.010638, 53.010638},
+  {53.086393, 53.086393, 53.086393, 53.086393, 53.086393, 53.086393},
+  {53.162185, 53.162185, 53.162185, 53.162185, 53.162185, 53.162185},
+  {53.238014, 53.238014, 53.238014, 53.238014, 53.238014, 53.238014},
+  {53.313880, 53.313880, 53.313880, 53.313880, 53.313880, 53.313880},
+  {53.389783, 53.389783, 53.389783, 53.389783, 53.389783, 53.389783},
+  {53.465723, 53.465723, 53.465723, 53.465723, 53.465723, 53.465723},
+  {53.541700, 53.541700, 53.541700, 53.541700, 53.541700, 53.541700},
+  {53.617715, 53.617715, 53.617715, 53.617715, 53.617715, 53.617715},
+  {53.693767, 53.693767, 53.693767, 53.693767, 53.693767, 53.693767},
+  {53.769856, 53.769856, 53.769856, 53.769856, 53.769856, 53.769856},
+  {53.845983, 53.845983, 53.845983, 53.845983, 53.845983, 53.845983},
+  {53.922147, 53.922147, 53.922147, 53.922147, 53.922147, 53.922147},
+  {53.998349, 53.998349, 53.998349, 53.998349, 53.998349, 53.998349},
+  {54.074589, 54.074589, 54.074589, 54.074589, 54.074589, 54.074589},
+  {54.150866, 54.150866, 54.150866, 54.150866, 54.150866, 54.150866},
+  {54.227180, 54.227180, 54.227180, 54.227180, 54.227180, 54.227180},
+  {54.303533, 54.303533, 54.303533, 54.303533, 54.303533, 54.303533},
+  {54.379923, 54.379923, 54.379923, 54.379923, 54.379923, 54.379923},
+  {54.456352, 54.456352, 54.456352, 54.456352, 54.456352, 54.456352},
+  {54.532818, 54.532818, 54.532818, 54.532818, 54.532818, 54.532818},
+  {54.609322, 54.609322, 54.609322, 54.609322, 54.609322, 54.609322},
+  {54.685865, 54.685865, 54.685865, 54.685865, 54.685865, 54.685865},
+  {54.762446, 54.762446, 54.762446, 54.762446, 54.762446, 54.762446},
+  {54.839064, 54.839064, 54.839064, 54.839064, 54.839064, 54.839064},
+  {54.915721, 54.915721, 54.915721, 54.915721, 54.915721, 54.915721},
+  {54.992417, 54.992417, 54.992417, 54.992417, 54.992417, 54.992417},
+  {55.069151, 55.069151, 55.069151, 55.069151, 55.069151, 55.069151},
+  {55.145923, 55.145923, 55.145923, 55.145923, 55.145923, 55.145923},
+  {55.222734, 55.222734, 55.222734, 55.222734, 55.222734, 55.222734},
+  {55.299583, 55.299583, 55.299583, 55.299583, 55.299583, 55.299583},
+  {55.376471, 55.376471, 55.376471, 55.376471, 55.376471, 55.376471},
+  {55.453398, 55.453398, 55.453398, 55.453398, 55.453398, 55.453398},
+  {55.530363, 55.530363, 55.530363, 55.530363, 55.530363, 55.530363},
+  {55.607368, 55.607368, 55.607368, 55.607368, 55.607368, 55.607368},
+  {55.684411, 55.684411, 55.684411, 55.684411, 55.684411, 55.684411},
+  {55.761493, 55.761493, 55.761493, 55.761493, 55.761493, 55.761493},
+  {55.838615, 55.838615, 55.838615, 55.838615, 55.838615, 55.838615},
+  {55.915775, 55.915775, 55.915775, 55.915775, 55.915775, 55.915775},
+  {55.992974, 55.992974, 55.992974, 55.992974, 55.992974, 55.992974},
+  {56.070213, 56.070213, 56.070213, 56.070213, 56.070213, 56.070213},
+  {56.147491, 56.147491, 56.147491, 56.147491, 56.147491, 56.147491},
+  {56.224808, 56.224808, 56.224808, 56.224808, 56.224808, 56.224808},
+  {56.302165, 56.302165, 56.302165, 56.302165, 56.302165, 56.302165},
+  {56.379561, 56.379561, 56.379561, 56.379561, 56.379561, 56.379561},
+  {56.456997, 56.456997, 56.456997, 56.456997, 56.456997, 56.456997},
+  {56.534473, 56.534473, 56.534473, 56.534473, 56.534473, 56.534473},
+  {56.611988, 56.611988, 56.611988, 56.611988, 56.611988, 56.611988},
+  {56.689542, 56.689542, 56.689542, 56.689542, 56.689542, 56.689542},
+  {56.767137, 56.767137, 56.767137, 56.767137, 56.767137, 56.767137},
+  {56.844772, 56.844772, 56.844772, 56.844772, 56.844772, 56.844772},
+  {56.922446, 56.922446, 56.922446, 56.922446, 56.922446, 56.922446},
+  {57.000161, 57.000161, 57.000161, 57.000161, 57.000161, 57.000161},
+  {57.077915, 57.077915, 57.077915, 57.077915, 57.077915, 57.077915},
+  {57.155710, 57.155710, 57.155710, 57.155710, 57.155710, 57.155710},
+  {57.233545, 57.233545, 57.233545, 57.233545, 57.233545, 57.233545},
+  {57.311420, 57.311420, 57.311420, 57.311420, 57.311420, 57.311420},
+  {57.389336, 57.389336, 57.389336, 57.389336, 57.389336, 57.389336},
+  {57.467292, 57.467292, 57.467292, 57.467292, 57.467292, 57.467292},
+  {57.545288, 57.545288, 57.545288, 57.545288, 57.545288, 57.545288},
+  {57.623325, 57.623325, 57.623325, 57.623325, 57.623325, 57.623325},
+  {57.701403, 57.701403, 57.701403, 57.701403, 57.701403, 57.701403},
+  {57.779521, 57.779521, 57.779521, 57.779521, 57.779521, 57.779521},
+  {57.857680, 57.857680, 57.857680, 57.857680, 57.857680, 57.857680},
+  {57.935880, 57.935880, 57.935880, 57.935880, 57.935880, 57.935880},
+  {58.014121, 58.014121, 58.014121, 58.014121, 58.014121, 58.014121},
+  {58.092403, 58.092403, 58.092403, 58.092403, 58.092403, 58.092403},
+  {58.170726, 58.170726, 58.170726, 58.170726, 58.170726, 58.170726},
+  {58.249090, 58.249090, 58.249090, 58.249090, 58.249090, 58.249090},
+  {58.327495, 58.327495, 58.327495, 58.327495, 58.327495, 58.327495},
+  {58.405942, 58.405942, 58.405942, 58.405942, 58.405942, 58.405942},
+  {58.484429, 58.484429, 58.484429, 58.484429, 58.484429, 58.484429},
+  {58.562959, 58.562959, 58.562959, 58.562959, 58.562959, 58.562959},
+  {58.641529, 58.641529, 58.641529, 58.641529, 58.641529, 58.641529},
+  {58.720142, 58.720142, 58.720142, 58.720142, 58.720142, 58.720142},
+  {58.798796, 58.798796, 58.798796, 58.798796, 58.798796, 58.798796},
+  {58.877491, 58.877491, 58.877491, 58.877491, 58.877491, 58.877491},
+  {58.956229, 58.956229, 58.956229, 58.956229, 58.956229, 58.956229},
+  {59.035008, 59.035008, 59.035008, 59.035008, 59.035008, 59.035008},
+  {59.113829, 59.113829, 59.113829, 59.113829, 59.113829, 59.113829},
+  {59.192692, 59.192692, 59.192692, 59.192692, 59.192692, 59.192692},
+  {59.271598, 59.271598, 59.271598, 59.271598, 59.271598, 59.271598},
+  {59.350545, 59.350545, 59.350545, 59.350545, 59.350545, 59.350545},
+  {59.429535, 59.429535, 59.429535, 59.429535, 59.429535, 59.429535},
+  {59.508567, 59.508567, 59.508567, 59.508567, 59.508567, 59.508567},
+  {59.587641, 59.587641, 59.587641, 59.587641, 59.587641, 59.587641},
+  {59.666758, 59.666758, 59.666758, 59.666758, 59.666758, 59.666758},
+  {59.745917, 59.745917, 59.745917, 59.745917, 59.745917, 59.745917},
+  {59.825119, 59.825119, 59.825119, 59.825119, 59.825119, 59.825119},
+  {59.904363, 59.904363, 59.904363, 59.904363, 59.904363, 59.904363},
+  {59.983651, 59.983651, 59.983651, 59.983651, 59.983651, 59.983651},
+  {60.062981, 60.062981, 60.062981, 60.062981, 60.062981, 60.062981},
+  {60.142354, 60.142354, 60.142354, 60.142354, 60.142354, 60.142354},
+  {60.221770, 60.221770, 60.221770, 60.221770, 60.221770, 60.221770},
+  {60.301229, 60.301229, 60.301229, 60.301229, 60.301229, 60.301229},
+  {60.380731, 60.380731, 60.380731, 60.380731, 60.380731, 60.380731},
+  {60.460277, 60.460277, 60.460277, 60.460277, 60.460277, 60.460277},
+  {60.539865, 60.539865, 60.539865, 60.539865, 60.539865, 60.539865},
+  {60.619497, 60.619497, 60.619497, 60.619497, 60.619497, 60.619497},
+  {60.699173, 60.699173, 60.699173, 60.699173, 60.699173, 60.699173},
+  {60.778892, 60.778892, 60.778892, 60.778892, 60.778892, 60.778892},
+  {60.858655, 60.858655, 60.858655, 60.858655, 60.858655, 60.858655},
+  {60.938462, 60.938462, 60.938462, 60.938462, 60.938462, 60.938462},
+  {61.018312, 61.018312, 61.018312, 61.018312, 61.018312, 61.018312},
+  {61.098206, 61.098206, 61.098206, 61.098206, 61.098206, 61.098206},
+  {61.178144, 61.178144, 61.178144, 61.178144, 61.178144, 61.178144},
+  {61.258126, 61.258126, 61.258126, 61.258126, 61.258126, 61.258126},
+  {61.338152, 61.338152, 61.338152, 61.338152, 61.338152, 61.338152},
+  {61.418223, 61.418223, 61.418223, 61.418223, 61.418223, 61.418223},
+  {61.498337, 61.498337, 61.498337, 61.498337, 61.498337, 61.498337},
+  {61.578496, 61.578496, 61.578496, 61.578496, 61.578496, 61.578496},
+  {61.658700, 61.658700, 61.658700, 61.658700, 61.658700, 61.658700},
+  {61.738948, 61.738948, 61.738948, 61.738948, 61.738948, 61.738948},
+  {61.819240, 61.819240, 61.819240, 61.819240, 61.819240, 61.819240},
+  {61.899578, 61.899578, 61.899578, 61.899578, 61.899578, 61.899578},
+  {61.979960, 61.979960, 61.979960, 61.979960, 61.979960, 61.979960},
+  {62.060386, 62.060386, 62.060386, 62.060386, 62.060386, 62.060386},
+  {62.140858, 62.140858, 62.140858, 62.140858, 62.140858, 62.140858},
+  {62.221375, 62.221375, 62.221375, 62.221375, 62.221375, 62.221375},
+  {62.301937, 62.301937, 62.301937, 62.301937, 62.301937, 62.301937},
+  {62.382544, 62.382544, 62.382544, 62.382544, 62.382544, 62.382544},
+  {62.463197, 62.463197, 62.463197, 62.463197, 62.463197, 62.463197},
+  {62.543895, 62.543895, 62.543895, 62.543895, 62.543895, 62.543895},
+  {62.624638, 62.624638, 62.624638, 62.624638, 62.624638, 62.624638},
+  {62.705427, 62.705427, 62.705427, 62.705427, 62.705427, 62.705427},
+  {62.786261, 62.786261, 62.786261, 62.786261, 62.786261, 62.786261},
+  {62.867141, 62.867141, 62.867141, 62.867141, 62.867141, 62.867141},
+  {62.948067, 62.948067, 62.948067, 62.948067, 62.948067, 62.948067},
+  {63.029039, 63.029039, 63.029039, 63.029039, 63.029039, 63.029039},
+  {63.110057, 63.110057, 63.110057, 63.110057, 63.110057, 63.110057},
+  {63.191121, 63.191121, 63.191121, 63.191121, 63.191121, 63.191121},
+  {63.272231, 63.272231, 63.272231, 63.272231, 63.272231, 63.272231},
+  {63.353387, 63.353387, 63.353387, 63.353387, 63.353387, 63.353387},
+  {63.434590, 63.434590, 63.434590, 63.434590, 63.434590, 63.434590},
+  {63.515839, 63.515839, 63.515839, 63.515839, 63.515839, 63.515839},
+  {63.597135, 63.597135, 63.597135, 63.597135, 63.597135, 63.597135},
+  {63.678477, 63.678477, 63.678477, 63.678477, 63.678477, 63.678477},
+  {63.759866, 63.759866, 63.759866, 63.759866, 63.759866, 63.759866},
+  {63.841302, 63.841302, 63.841302, 63.841302, 63.841302, 63.841302},
+  {63.922784, 63.922784, 63.922784, 63.922784, 63.922784, 63.922784},
+  {64.004314, 64.004314, 64.004314, 64.004314, 64.004314, 64.004314},
+  {64.085891, 64.085891, 64.085891, 64.085891, 64.085891, 64.085891},
+  {64.167515, 64.167515, 64.167515, 64.167515, 64.167515, 64.167515},
+  {64.249186, 64.249186, 64.249186, 64.249186, 64.249186, 64.249186},
+  {64.330904, 64.330904, 64.330904, 64.330904, 64.330904, 64.330904},
+  {64.412670, 64.412670, 64.412670, 64.412670, 64.412670, 64.412670},
+  {64.494483, 64.494483, 64.494483, 64.494483, 64.494483, 64.494483},
+  {64.576344, 64.576344, 64.576344, 64.576344, 64.576344, 64.576344},
+  {64.658253, 64.658253, 64.658253, 64.658253, 64.658253, 64.658253},
+  {64.740210, 64.740210, 64.740210, 64.740210, 64.740210, 64.740210},
+  {64.822214, 64.822214, 64.822214, 64.822214, 64.822214, 64.822214},
+  {64.904267, 64.904267, 64.904267, 64.904267, 64.904267, 64.904267},
+  {64.986368, 64.986368, 64.986368, 64.986368, 64.986368, 64.986368},
+  {65.068517, 65.068517, 65.068517, 65.068517, 65.068517, 65.068517},
+  {65.150714, 65.150714, 65.150714, 65.150714, 65.150714, 65.150714},
+  {65.232959, 65.232959, 65.232959, 65.232959, 65.232959, 65.232959},
+  {65.315253, 65.315253, 65.315253, 65.315253, 65.315253, 65.315253},
+  {65.397596, 65.397596, 65.397596, 65.397596, 65.397596, 65.397596},
+  {65.479987, 65.479987, 65.479987, 65.479987, 65.479987, 65.479987},
+  {65.562428, 65.562428, 65.562428, 65.562428, 65.562428, 65.562428},
+  {65.644917, 65.644917, 65.644917, 65.644917, 65.644917, 65.644917},
+  {65.727455, 65.727455, 65.727455, 65.727455, 65.727455, 65.727455},
+  {65.810042, 65.810042, 65.810042, 65.810042, 65.810042, 65.810042},
+  {65.892678, 65.892678, 65.892678, 65.892678, 65.892678, 65.892678},
+  {65.975364, 65.975364, 65.975364, 65.975364, 65.975364, 65.975364},
+  {89.963080, 89.963080, 29.091227, -6.713525, -6.713525, 29.091227},
+  {89.677427, 89.677427, 29.063216, -6.954232, -6.954232, 29.063216},
+  {89.392284, 89.392284, 29.034975, -7.194255, -7.194255, 29.034975},
+  {89.107647, 89.107647, 29.006502, -7.433589, -7.433589, 29.006502},
+  {88.823511, 88.823511, 28.977798, -7.672230, -7.672230, 28.977798},
+  {88.539872, 88.539872, 28.948862, -7.910173, -7.910173, 28.948862},
+  {88.256727, 88.256727, 28.919696, -8.147413, -8.147413, 28.919696},
+  {87.974070, 87.974070, 28.890299, -8.383945, -8.383945, 28.890299},
+  {87.691898, 87.691898, 28.860671, -8.619765, -8.619765, 28.860671},
+  {87.410207, 87.410207, 28.830812, -8.854867, -8.854867, 28.830812},
+  {87.128993, 87.128993, 28.800723, -9.089247, -9.089247, 28.800723},
+  {86.848252, 86.848252, 28.770403, -9.322899, -9.322899, 28.770403},
+  {86.567981, 86.567981, 28.739853, -9.555819, -9.555819, 28.739853},
+  {86.288175, 86.288175, 28.709072, -9.788001, -9.788001, 28.709072},
+  {86.008831, 86.008831, 28.678062, -10.019440, -10.019440, 28.678062},
+  {85.729945, 85.729945, 28.646821, -10.250132, -10.250132, 28.646821},
+  {85.451513, 85.451513, 28.615350, -10.480070, -10.480070, 28.615350},
+  {85.173533, 85.173533, 28.583649, -10.709251, -10.709251, 28.583649},
+  {84.896000, 84.896000, 28.551719, -10.937667, -10.937667, 28.551719},
+  {84.618911, 84.618911, 28.519559, -11.165315, -11.165315, 28.519559},
+  {84.342264, 84.342264, 28.487169, -11.392188, -11.392188, 28.487169},
+  {84.066053, 84.066053, 28.454550, -11.618282, -11.618282, 28.454550},
+  {83.790277, 83.790277, 28.421702, -11.843590, -11.843590, 28.421702},
+  {83.514932, 83.514932, 28.388624, -12.068108, -12.068108, 28.388624},
+  {83.240014, 83.240014, 28.355317, -12.291830, -12.291830, 28.355317},
+  {82.965521, 82.965521, 28.321781, -12.514750, -12.514750, 28.321781},
+  {82.691450, 82.691450, 28.288016, -12.736862, -12.736862, 28.288016},
+  {82.417797, 82.417797, 28.254023, -12.958162, -12.958162, 28.254023},
+  {82.144560, 82.144560, 28.219801, -13.178643, -13.178643, 28.219801},
+  {81.871735, 81.871735, 28.185350, -13.398299, -13.398299, 28.185350},
+  {81.599320, 81.599320, 28.150670, -13.617125, -13.617125, 28.150670},
+  {81.327311, 81.327311, 28.115763, -13.835116, -13.835116, 28.115763},
+  {81.055706, 81.055706, 28.080627, -14.052264, -14.052264, 28.080627},
+  {80.784503, 80.784503, 28.045263, -14.268565, -14.268565, 28.045263},
+  {80.513697, 80.513697, 28.009671, -14.484013, -14.484013, 28.009671},
+  {80.243288, 80.243288, 27.973851, -14.698601, -14.698601, 27.973851},
+  {79.973271, 79.973271, 27.937803, -14.912323, -14.912323, 27.937803},
+  {79.703645, 79.703645, 27.901528, -15.125174, -15.125174, 27.901528},
+  {79.434406, 79.434406, 27.865025, -15.337147, -15.337147, 27.865025},
+  {79.165552, 79.165552, 27.828294, -15.548237, -15.548237, 27.828294},
+  {78.897082, 78.897082, 27.791337, -15.758436, -15.758436, 27.791337},
+  {78.628991, 78.628991, 27.754152, -15.967740, -15.967740, 27.754152},
+  {78.361278, 78.361278, 27.716740, -16.176142, -16.176142, 27.716740},
+  {78.093940, 78.093940, 27.679101, -16.383635, -16.383635, 27.679101},
+  {77.826975, 77.826975, 27.641236, -16.590214, -16.590214, 27.641236},
+  {77.560381, 77.560381, 27.603143, -16.795872, -16.795872, 27.603143},
+  {77.294154, 77.294154, 27.564824, -17.000602, -17.000602, 27.564824},
+  {77.028294, 77.028294, 27.526279, -17.204399, -17.204399, 27.526279},
+  {76.762798, 76.762798, 27.487507, -17.407256, -17.407256, 27.487507},
+  {76.497663, 76.497663, 27.448509, -17.609166, -17.609166, 27.448509},
+  {76.232887, 76.232887, 27.409285, -17.810124, -17.810124, 27.409285},
+  {75.968468, 75.968468, 27.369835, -18.010122, -18.010122, 27.369835},
+  {75.704404, 75.704404, 27.330160, -18.209154, -18.209154, 27.330160},
+  {75.440694, 75.440694, 27.290258, -18.407214, -18.407214, 27.290258},
+  {75.177334, 75.177334, 27.250131, -18.604294, -18.604294, 27.250131},
+  {74.914323, 74.914323, 27.209778, -18.800389, -18.800389, 27.209778},
+  {74.651658, 74.651658, 27.169201, -18.995492, -18.995492, 27.169201},
+  {74.389339, 74.389339, 27.128398, -19.189596, -19.189596, 27.128398},
+  {74.127362, 74.127362, 27.087370, -19.382695, -19.382695, 27.087370},
+  {73.865727, 73.865727, 27.046116, -19.574781, -19.574781, 27.046116},
+  {73.604430, 73.604430, 27.004639, -19.765848, -19.765848, 27.004639},
+  {73.343471, 73.343471, 26.962936, -19.955889, -19.955889, 26.962936},
+  {73.082847, 73.082847, 26.921009, -20.144898, -20.144898, 26.921009},
+  {72.822557, 72.822557, 26.878858, -20.332867, -20.332867, 26.878858},
+  {72.562598, 72.562598, 26.836482, -20.519790, -20.519790, 26.836482},
+  {72.302970, 72.302970, 26.793882, -20.705661, -20.705661, 26.793882},
+  {72.043669, 72.043669, 26.751058, -20.890471, -20.890471, 26.751058},
+  {71.784696, 71.784696, 26.708011, -21.074214, -21.074214, 26.708011},
+  {71.526047, 71.526047, 26.664739, -21.256884, -21.256884, 26.664739},
+  {71.267721, 71.267721, 26.621244, -21.438473, -21.438473, 26.621244},
+  {71.009717, 71.009717, 26.577525, -21.618975, -21.618975, 26.577525},
+  {70.752034, 70.752034, 26.533584, -21.798382, -21.798382, 26.533584},
+  {70.494668, 70.494668, 26.489418, -21.976688, -21.976688, 26.489418},
+  {70.237619, 70.237619, 26.445030, -22.153885, -22.153885, 26.445030},
+  {69.980886, 69.980886, 26.400419, -22.329967, -22.329967, 26.400419},
+  {69.724467, 69.724467, 26.355585, -22.504926, -22.504926, 26.355585},
+  {69.468359, 69.468359, 26.310529, -22.678755, -22.678755, 26.310529},
+  {69.212563, 69.212563, 26.265250, -22.851448, -22.851448, 26.265250},
+  {68.957076, 68.957076, 26.219749, -23.022998, -23.022998, 26.219749},
+  {68.701897, 68.701897, 26.174025, -23.193397, -23.193397, 26.174025},
+  {68.447024, 68.447024, 26.128079, -23.362638, -23.362638, 26.128079},
+  {68.192457, 68.192457, 26.081912, -23.530714, -23.530714, 26.081912},
+  {67.938194, 67.938194, 26.035522, -23.697618, -23.697618, 26.035522},
+  {67.684233, 67.684233, 25.988911, -23.863343, -23.863343, 25.988911},
+  {67.430573, 67.430573, 25.942079, -24.027883, -24.027883, 25.942079},
+  {67.177213, 67.177213, 25.895025, -24.191229, -24.191229, 25.895025},
+  {66.924152, 66.924152, 25.847749, -24.353374, -24.353374, 25.847749},
+  {66.671388, 66.671388, 25.800253, -24.514313, -24.514313, 25.800253},
+  {66.418920, 66.418920, 25.752536, -24.674036, -24.674036, 25.752536},
+  {66.166746, 66.166746, 25.704598, -24.832538, -24.832538, 25.704598},
+  {65.914867, 65.914867, 25.656439, -24.989812, -24.989812, 25.656439},
+  {65.663280, 65.663280, 25.608060, -25.145850, -25.145850, 25.608060},
+  {65.411984, 65.411984, 25.559460, -25.300644, -25.300644, 25.559460},
+  {65.160979, 65.160979, 25.510641, -25.454189, -25.454189, 25.510641},
+  {64.910263, 64.910263, 25.461601, -25.606477, -25.606477, 25.461601},
+  {64.659834, 64.659834, 25.412341, -25.757501, -25.757501, 25.412341},
+  {64.409693, 64.409693, 25.362861, -25.907253, -25.907253, 25.362861},
+  {64.159837, 64.159837, 25.313162, -26.055727, -26.055727, 25.313162},
+  {63.910266, 63.910266, 25.263244, -26.202916, -26.202916, 25.263244},
+  {63.660978, 63.660978, 25.213106, -26.348813, -26.348813, 25.213106},
+  {63.411974, 63.411974, 25.162749, -26.493410, -26.493410, 25.162749},
+  {63.163251, 63.163251, 25.112172, -26.636701, -26.636701, 25.112172},
+  {62.914809, 62.914809, 25.061377, -26.778679, -26.778679, 25.061377},
+  {62.666646, 62.666646, 25.010364, -26.919336, -26.919336, 25.010364},
+  {62.418763, 62.418763, 24.959131, -27.058666, -27.058666, 24.959131},
+  {62.171157, 62.171157, 24.907681, -27.196662, -27.196662, 24.907681},
+  {61.923828, 61.923828, 24.856012, -27.333317, -27.333317, 24.856012},
+  {61.676776, 61.676776, 24.804124, -27.468624, -27.468624, 24.804124},
+  {61.429998, 61.429998, 24.752019, -27.602576, -27.602576, 24.752019},
+  {61.183495, 61.183495, 24.699696, -27.735167, -27.735167, 24.699696},
+  {60.937266, 60.937266, 24.647156, -27.866389, -27.866389, 24.647156},
+  {60.691309, 60.691309, 24.594398, -27.996236, -27.996236, 24.594398},
+  {60.445624, 60.445624, 24.541422, -28.124701, -28.124701, 24.541422},
+  {60.200210, 60.200210, 24.488230, -28.251778, -28.251778, 24.488230},
+  {59.955066, 59.955066, 24.434820, -28.377459, -28.377459, 24.434820},
+  {59.710192, 59.710192, 24.381194, -28.501738, -28.501738, 24.381194},
+  {59.465586, 59.465586, 24.327350, -28.624609, -28.624609, 24.327350},
+  {59.221249, 59.221249, 24.273290, -28.746064, -28.746064, 24.273290},
+  {58.977179, 58.977179, 24.219014, -28.866098, -28.866098, 24.219014},
+  {58.733375, 58.733375, 24.164522, -28.984703, -28.984703, 24.164522},
+  {58.489838, 58.489838, 24.109813, -29.101874, -29.101874, 24.109813},
+  {58.246565, 58.246565, 24.054889, -29.217604, -29.217604, 24.054889},
+  {58.003557, 58.003557, 23.999748, -29.331887, -29.331887, 23.999748},
+  {57.760813, 57.760813, 23.944392, -29.444716, -29.444716, 23.944392},
+  {57.518333, 57.518333, 23.888821, -29.556084, -29.556084, 23.888821},
+  {57.276115, 57.276115, 23.833034, -29.665987, -29.665987, 23.833034},
+  {57.034159, 57.034159, 23.777032, -29.774417, -29.774417, 23.777032},
+  {56.792464, 56.792464, 23.720815, -29.881369, -29.881369, 23.720815},
+  {56.551031, 56.551031, 23.664384, -29.986836, -29.986836, 23.664384},
+  {56.309857, 56.309857, 23.607737, -30.090812, -30.090812, 23.607737},
+  {56.068944, 56.068944, 23.550876, -30.193292, -30.193292, 23.550876},
+  {55.828290, 55.828290, 23.493801, -30.294270, -30.294270, 23.493801},
+  {55.587894, 55.587894, 23.436512, -30.393739, -30.393739, 23.436512},
+  {55.347757, 55.347757, 23.379008, -30.491694, -30.491694, 23.379008},
+  {55.107877, 55.107877, 23.321291, -30.588129, -30.588129, 23.321291},
+  {54.868255, 54.868255, 23.263360, -30.683039, -30.683039, 23.263360},
+  {54.628889, 54.628889, 23.205215, -30.776417, -30.776417, 23.205215},
+  {54.389780, 54.389780, 23.146857, -30.868259, -30.868259, 23.146857},
+  {54.150927, 54.150927, 23.088286, -30.958560, -30.958560, 23.088286},
+  {53.912329, 53.912329, 23.029502, -31.047312, -31.047312, 23.029502},
+  {53.673986, 53.673986, 22.970505, -31.134512, -31.134512, 22.970505},
+  {53.435898, 53.435898, 22.911295, -31.220154, -31.220154, 22.911295},
+  {53.198064, 53.198064, 22.851873, -31.304233, -31.304233, 22.851873},
+  {52.960484, 52.960484, 22.792238, -31.386743, -31.386743, 22.792238},
+  {52.723158, 52.723158, 22.732391, -31.467680, -31.467680, 22.732391},
+  {52.486084, 52.486084, 22.672332, -31.547039, -31.547039, 22.672332},
+  {52.249264, 52.249264, 22.612061, -31.624814, -31.624814, 22.612061},
+  {52.012696, 52.012696, 22.551578, -31.701002, -31.701002, 22.551578},
+  {51.776380, 51.776380, 22.490884, -31.775597, -31.775597, 22.490884},
+  {51.540316, 51.540316, 22.429979, -31.848595, -31.848595, 22.429979},
+  {51.304504, 51.304504, 22.368862, -31.919991, -31.919991, 22.368862},
+  {51.068943, 51.068943, 22.307534, -31.989780, -31.989780, 22.307534},
+  {50.833634, 50.833634, 22.245995, -32.057959, -32.057959, 22.245995},
+  {50.598575, 50.598575, 22.184246, -32.124523, -32.124523, 22.184246},
+  {50.363766, 50.363766, 22.122285, -32.189468, -32.189468, 22.122285},
+  {50.129208, 50.129208, 22.060115, -32.252790, -32.252790, 22.060115},
+  {49.894901, 49.894901, 21.997734, -32.314484, -32.314484, 21.997734},
+  {49.660843, 49.660843, 21.935144, -32.374547, -32.374547, 21.935144},
+  {49.427035, 49.427035, 21.872343, -32.432976, -32.432976, 21.872343},
+  {49.193476, 49.193476, 21.809332, -32.489765, -32.489765, 21.809332},
+  {48.960167, 48.960167, 21.746113, -32.544912, -32.544912, 21.746113},
+  {48.727108, 48.727108, 21.682683, -32.598413, -32.598413, 21.682683},
+  {48.494297, 48.494297, 21.619045, -32.650264, -32.650264, 21.619045},
+  {48.261735, 48.261735, 21.555197, -32.700463, -32.700463, 21.555197},
+  {48.029423, 48.029423, 21.491141, -32.749005, -32.749005, 21.491141},
+  {47.797359, 47.797359, 21.426876, -32.795889, -32.795889, 21.426876},
+  {47.565543, 47.565543, 21.362402, -32.841110, -32.841110, 21.362402},
+  {47.333977, 47.333977, 21.297720, -32.884666, -32.884666, 21.297720},
+  {47.102658, 47.102658, 21.232830, -32.926553, -32.926553, 21.232830},
+  {46.871589, 46.871589, 21.167731, -32.966771, -32.966771, 21.167731},
+  {46.640767, 46.640767, 21.102425, -33.005314, -33.005314, 21.102425},
+  {46.410195, 46.410195, 21.036911, -33.042182, -33.042182, 21.036911},
+  {46.179870, 46.179870, 20.971190, -33.077371, -33.077371, 20.971190},
+  {45.949794, 45.949794, 20.905261, -33.110879, -33.110879, 20.905261},
+  {45.719966, 45.719966, 20.839126, -33.142705, -33.142705, 20.839126},
+  {45.490386, 45.490386, 20.772783, -33.172845, -33.172845, 20.772783},
+  {45.261055, 45.261055, 20.706233, -33.201298, -33.201298, 20.706233},
+  {45.031972, 45.031972, 20.639477, -33.228063, -33.228063, 20.639477},
+  {44.803138, 44.803138, 20.572514, -33.253136, -33.253136, 20.572514},
+  {44.574552, 44.574552, 20.505345, -33.276518, -33.276518, 20.505345},
+  {44.346215, 44.346215, 20.437970, -33.298205, -33.298205, 20.437970},
+  {44.118126, 44.118126, 20.370389, -33.318197, -33.318197, 20.370389},
+  {43.890286, 43.890286, 20.302602, -33.336492, -33.336492, 20.302602},
+  {43.662695, 43.662695, 20.234609, -33.353089, -33.353089, 20.234609},
+  {43.435352, 43.435352, 20.166411, -33.367987, -33.367987, 20.166411},
+  {43.208259, 43.208259, 20.098008, -33.381185, -33.381185, 20.098008},
+  {42.981415, 42.981415, 20.029400, -33.392682, -33.392682, 20.029400},
+  {42.754820, 42.754820, 19.960587, -33.402477, -33.402477, 19.960587},
+  {42.528475, 42.528475, 19.891569, -33.410569, -33.410569, 19.891569},
+  {42.302379, 42.302379, 19.822346, -33.416959, -33.416959, 19.822346},
+  {42.076533, 42.076533, 19.752919, -33.421646, -33.421646, 19.752919},
+  {41.850937, 41.850937, 19.683288, -33.424629, -33.424629, 19.683288},
+  {41.625591, 41.625591, 19.613453, -33.425907, -33.425907, 19.613453},
+  {41.400495, 41.400495, 19.543414, -33.425482, -33.425482, 19.543414},
+  {41.175651, 41.175651, 19.473171, -33.423353, -33.423353, 19.473171},
+  {40.951056, 40.951056, 19.402725, -33.419520, -33.419520, 19.402725},
+  {40.726713, 40.726713, 19.332075, -33.413984, -33.413984, 19.332075},
+  {40.502622, 40.502622, 19.261222, -33.406744, -33.406744, 19.261222},
+  {40.278781, 40.278781, 19.190167, -33.397802, -33.397802, 19.190167},
+  {40.055193, 40.055193, 19.118908, -33.387158, -33.387158, 19.118908},
+  {39.831857, 39.831857, 19.047447, -33.374812, -33.374812, 19.047447},
+  {39.608773, 39.608773, 18.975783, -33.360766, -33.360766, 18.975783},
+  {39.385941, 39.385941, 18.903917, -33.345020, -33.345020, 18.903917},
+  {39.163363, 39.163363, 18.831849, -33.327576, -33.327576, 18.831849},
+  {38.941038, 38.941038, 18.759579, -33.308434, -33.308434, 18.759579},
+  {38.718967, 38.718967, 18.687107, -33.287596, -33.287596, 18.687107},
+  {38.497150, 38.497150, 18.614434, -33.265063, -33.265063, 18.614434},
+  {38.275587, 38.275587, 18.541559, -33.240837, -33.240837, 18.541559},
+  {38.054279, 38.054279, 18.468483, -33.214920, -33.214920, 18.468483},
+  {37.833226, 37.833226, 18.395206, -33.187313, -33.187313, 18.395206},
+  {37.612429, 37.612429, 18.321728, -33.158017, -33.158017, 18.321728},
+  {37.391887, 37.391887, 18.248049, -33.127036, -33.127036, 18.248049},
+  {37.171602, 37.171602, 18.174170, -33.094371, -33.094371, 18.174170},
+  {36.951573, 36.951573, 18.100090, -33.060023, -33.060023, 18.100090},
+  {36.731802, 36.731802, 18.025811, -33.023996, -33.023996, 18.025811},
+  {36.512288, 36.512288, 17.951331, -32.986292, -32.986292, 17.951331},
+  {36.293032, 36.293032, 17.876651, -32.946913, -32.946913, 17.876651},
+  {36.074035, 36.074035, 17.801772, -32.905862, -32.905862, 17.801772},
+  {35.855296, 35.855296, 17.726694, -32.863142, -32.863142, 17.726694},
+  {35.636818, 35.636818, 17.651416, -32.818755, -32.818755, 17.651416},
+  {35.418599, 35.418599, 17.575938, -32.772704, -32.772704, 17.575938},
+  {35.200640, 35.200640, 17.500262, -32.724992, -32.724992, 17.500262},
+  {34.982943, 34.982943, 17.424388, -32.675623, -32.675623, 17.424388},
+  {34.765507, 34.765507, 17.348314, -32.624599, -32.624599, 17.348314},
+  {34.548333, 34.548333, 17.272043, -32.571925, -32.571925, 17.272043},
+  {34.331421, 34.331421, 17.195573, -32.517602, -32.517602, 17.195573},
+  {34.114773, 34.114773, 17.118905, -32.461635, -32.461635, 17.118905},
+  {33.898388, 33.898388, 17.042039, -32.404028, -32.404028, 17.042039},
+  {33.682268, 33.682268, 16.964975, -32.344783, -32.344783, 16.964975},
+  {33.466412, 33.466412, 16.887714, -32.283906, -32.283906, 16.887714},
+  {33.250822, 33.250822, 16.810256, -32.221399, -32.221399, 16.810256},
+  {33.035498, 33.035498, 16.732600, -32.157267, -32.157267, 16.732600},
+  {32.820441, 32.820441, 16.654747, -32.091514, -32.091514, 16.654747},
+  {32.605651, 32.605651, 16.576698, -32.024144, -32.024144, 16.576698},
+  {32.391129, 32.391129, 16.498452, -31.955160, -31.955160, 16.498452},
+  {32.176875, 32.176875, 16.420010, -31.884569, -31.884569, 16.420010},
+  {31.962891, 31.962891, 16.341371, -31.812373, -31.812373, 16.341371},
+  {31.749177, 31.749177, 16.262536, -31.738578, -31.738578, 16.262536},
+  {31.535733, 31.535733, 16.183505, -31.663187, -31.663187, 16.183505},
+  {31.322561, 31.322561, 16.104279, -31.586207, -31.586207, 16.104279},
+  {31.109661, 31.109661, 16.024857, -31.507641, -31.507641, 16.024857},
+  {30.897033, 30.897033, 15.945239, -31.427494, -31.427494, 15.945239},
+  {30.684679, 30.684679, 15.865426, -31.345771, -31.345771, 15.865426},
+  {30.472599, 30.472599, 15.785419, -31.262478, -31.262478, 15.785419},
+  {30.260794, 30.260794, 15.705216, -31.177618, -31.177618, 15.705216},
+  {30.049264, 30.049264, 15.624819, -31.091199, -31.091199, 15.624819},
+  {29.838011, 29.838011, 15.544227, -31.003223, -31.003223, 15.544227},
+  {29.627036, 29.627036, 15.463441, -30.913698, -30.913698, 15.463441},
+  {29.416338, 29.416338, 15.382461, -30.822628, -30.822628, 15.382461},
+  {29.205919, 29.205919, 15.301287, -30.730018, -30.730018, 15.301287},
+  {28.995780, 28.995780, 15.219919, -30.635875, -30.635875, 15.219919},
+  {28.785921, 28.785921, 15.138357, -30.540203, -30.540203, 15.138357},
+  {28.576344, 28.576344, 15.056602, -30.443009, -30.443009, 15.056602},
+  {28.367048, 28.367048, 14.974654, -30.344298, -30.344298, 14.974654},
+  {28.158036, 28.158036, 14.892513, -30.244076, -30.244076, 14.892513},
+  {27.949307, 27.949307, 14.810178, -30.142348, -30.142348, 14.810178},
+  {27.740863, 27.740863, 14.727651, -30.039120, -30.039120, 14.727651},
+  {27.532705, 27.532705, 14.644932, -29.934399, -29.934399, 14.644932},
+  {27.324833, 27.324833, 14.562020, -29.828191, -29.828191, 14.562020},
+  {27.117249, 27.117249, 14.478916, -29.720501, -29.720501, 14.478916},
+  {26.909953, 26.909953, 14.395620, -29.611335, -29.611335, 14.395620},
+  {26.702946, 26.702946, 14.312132, -29.500700, -29.500700, 14.312132},
+  {26.496229, 26.496229, 14.228452, -29.388602, -29.388602, 14.228452},
+  {26.289803, 26.289803, 14.144581, -29.275047, -29.275047, 14.144581},
+  {26.083670, 26.083670, 14.060519, -29.160042, -29.160042, 14.060519},
+  {25.877829, 25.877829, 13.976265, -29.043592, -29.043592, 13.976265},
+  {25.672283, 25.672283, 13.891820, -28.925705, -28.925705, 13.891820},
+  {25.467031, 25.467031, 13.807185, -28.806386, -28.806386, 13.807185},
+  {25.262076, 25.262076, 13.722359, -28.685642, -28.685642, 13.722359},
+  {25.057418, 25.057418, 13.637343, -28.563480, -28.563480, 13.637343},
+  {24.853057, 24.853057, 13.552136, -28.439905, -28.439905, 13.552136},
+  {24.648996, 24.648996, 13.466740, -28.314926, -28.314926, 13.466740},
+  {24.445235, 24.445235, 13.381153, -28.188548, -28.188548, 13.381153},
+  {24.241775, 24.241775, 13.295377, -28.060778, -28.060778, 13.295377},
+  {24.038617, 24.038617, 13.209411, -27.931622, -27.931622, 13.209411},
+  {23.835763, 23.835763, 13.123256, -27.801088, -27.801088, 13.123256},
+  {23.633213, 23.633213, 13.036911, -27.669182, -27.669182, 13.036911},
+  {23.430968, 23.430968, 12.950378, -27.535911, -27.535911, 12.950378},
+  {23.229030, 23.229030, 12.863656, -27.401282, -27.401282, 12.863656},
+  {23.027400, 23.027400, 12.776745, -27.265302, -27.265302, 12.776745},
+  {22.826079, 22.826079, 12.689645, -27.127977, -27.127977, 12.689645},
+  {22.625068, 22.625068, 12.602357, -26.989314, -26.989314, 12.602357},
+  {22.424368, 22.424368, 12.514881, -26.849321, -26.849321, 12.514881},
+  {22.223980, 22.223980, 12.427218, -26.708004, -26.708004, 12.427218},
+  {22.023906, 22.023906, 12.339366, -26.565370, -26.565370, 12.339366},
+  {21.824147, 21.824147, 12.251327, -26.421427, -26.421427, 12.251327},
+  {21.624703, 21.624703, 12.163100, -26.276180, -26.276180, 12.163100},
+  {21.425577, 21.425577, 12.074686, -26.129638, -26.129638, 12.074686},
+  {21.226769, 21.226769, 11.986085, -25.981807, -25.981807, 11.986085},
+  {21.028280, 21.028280, 11.897297, -25.832694, -25.832694, 11.897297},
+  {20.830112, 20.830112, 11.808322, -25.682307, -25.682307, 11.808322},
+  {20.632266, 20.632266, 11.719160, -25.530651, -25.530651, 11.719160},
+  {20.434744, 20.434744, 11.629813, -25.377736, -25.377736, 11.629813},
+  {20.237546, 20.237546, 11.540279, -25.223566, -25.223566, 11.540279},
+  {20.040674, 20.040674, 11.450559, -25.068150, -25.068150, 11.450559},
+  {19.844129, 19.844129, 11.360653, -24.911495, -24.911495, 11.360653},
+  {19.647913, 19.647913, 11.270561, -24.753608, -24.753608, 11.270561},
+  {19.452026, 19.452026, 11.180284, -24.594495, -24.594495, 11.180284},
+  {19.256471, 19.256471, 11.089821, -24.434165, -24.434165, 11.089821},
+  {19.061248, 19.061248, 10.999174, -24.272623, -24.272623, 10.999174},
+  {18.866358, 18.866358, 10.908341, -24.109878, -24.109878, 10.908341},
+  {18.671804, 18.671804, 10.817323, -23.945935, -23.945935, 10.817323},
+  {18.477587, 18.477587, 10.726121, -23.780804, -23.780804, 10.726121},
+  {18.283707, 18.283707, 10.634734, -23.614489, -23.614489, 10.634734},
+  {18.090167, 18.090167, 10.543163, -23.446999, -23.446999, 10.543163},
+  {17.896967, 17.896967, 10.451408, -23.278341, -23.278341, 10.451408},
+  {17.704109, 17.704109, 10.359469, -23.108521, -23.108521, 10.359469},
+  {17.511595, 17.511595, 10.267346, -22.937548, -22.937548, 10.267346},
+  {17.319427, 17.319427, 10.175039, -22.765427, -22.765427, 10.175039},
+  {17.127604, 17.127604, 10.082549, -22.592166, -22.592166, 10.082549},
+  {16.936129, 16.936129, 9.989876, -22.417772, -22.417772, 9.989876},
+  {16.745004, 16.745004, 9.897019, -22.242251, -22.242251, 9.897019},
+  {16.554230, 16.554230, 9.803980, -22.065612, -22.065612, 9.803980},
+  {16.363808, 16.363808, 9.710757, -21.887861, -21.887861, 9.710757},
+  {16.173739, 16.173739, 9.617353, -21.709005, -21.709005, 9.617353},
+  {15.984027, 15.984027, 9.523765, -21.529051, -21.529051, 9.523765},
+  {15.794671, 15.794671, 9.429996, -21.348006, -21.348006, 9.429996},
+  {15.605673, 15.605673, 9.336044, -21.165877, -21.165877, 9.336044},
+  {15.417036, 15.417036, 9.241911, -20.982670, -20.982670, 9.241911},
+  {15.228760, 15.228760, 9.147595, -20.798394, -20.798394, 9.147595},
+  {15.040847, 15.040847, 9.053098, -20.613054, -20.613054, 9.053098},
+  {14.853298, 14.853298, 8.958420, -20.426657, -20.426657, 8.958420},
+  {14.666116, 14.666116, 8.863560, -20.239211, -20.239211, 8.863560},
+  {14.479302, 14.479302, 8.768520, -20.050722, -20.050722, 8.768520},
+  {14.292858, 14.292858, 8.673298, -19.861198, -19.861198, 8.673298},
+  {14.106784, 14.106784, 8.577896, -19.670644, -19.670644, 8.577896},
+  {13.921084, 13.921084, 8.482313, -19.479067, -19.479067, 8.482313},
+  {13.735757, 13.735757, 8.386550, -19.286475, -19.286475, 8.386550},
+  {13.550807, 13.550807, 8.290606, -19.092874, -19.092874, 8.290606},
+  {13.366235, 13.366235, 8.194482, -18.898271, -18.898271, 8.194482},
+  {13.182042, 13.182042, 8.098179, -18.702672, -18.702672, 8.098179},
+  {12.998230, 12.998230, 8.001696, -18.506085, -18.506085, 8.001696},
+  {12.814800, 12.814800, 7.905033, -18.308515, -18.308515, 7.905033},
+  {12.631756, 12.631756, 7.808191, -18.109969, -18.109969, 7.808191},
+  {12.449097, 12.449097, 7.711169, -17.910454, -17.910454, 7.711169},
+  {12.266827, 12.266827, 7.613969, -17.709976, -17.709976, 7.613969},
+  {12.084946, 12.084946, 7.516589, -17.508543, -17.508543, 7.516589},
+  {11.903457, 11.903457, 7.419031, -17.306159, -17.306159, 7.419031},
+  {11.722360, 11.722360, 7.321294, -17.102833, -17.102833, 7.321294},
+  {11.541659, 11.541659, 7.223379, -16.898569, -16.898569, 7.223379},
+  {11.361355, 11.361355, 7.125286, -16.693375, -16.693375, 7.125286},
+  {11.181449, 11.181449, 7.027014, -16.487257, -16.487257, 7.027014},
+  {11.001944, 11.001944, 6.928565, -16.280222, -16.280222, 6.928565},
+  {10.822841, 10.822841, 6.829938, -16.072274, -16.072274, 6.829938},
+  {10.644142, 10.644142, 6.731133, -15.863422, -15.863422, 6.731133},
+  {10.465849, 10.465849, 6.632151, -15.653670, -15.653670, 6.632151},
+  {10.287963, 10.287963, 6.532992, -15.443025, -15.443025, 6.532992},
+  {10.110488, 10.110488, 6.433656, -15.231494, -15.231494, 6.433656},
+  {9.933423, 9.933423, 6.334142, -15.019082, -15.019082, 6.334142},
+  {9.756772, 9.756772, 6.234452, -14.805796, -14.805796, 6.234452},
+  {9.580537, 9.580537, 6.134586, -14.591641, -14.591641, 6.134586},
+  {9.404718, 9.404718, 6.034543, -14.376624, -14.376624, 6.034543},
+  {9.229319, 9.229319, 5.934323, -14.160750, -14.160750, 5.934323},
+  {9.054340, 9.054340, 5.833928, -13.944025, -13.944025, 5.833928},
+  {8.879785, 8.879785, 5.733357, -13.726456, -13.726456, 5.733357},
+  {8.705654, 8.705654, 5.632610, -13.508047, -13.508047, 5.632610},
+  {8.531950, 8.531950, 5.531687, -13.288806, -13.288806, 5.531687},
+  {8.358675, 8.358675, 5.430589, -13.068738, -13.068738, 5.430589},
+  {8.185831, 8.185831, 5.329315, -12.847848, -12.847848, 5.329315},
+  {8.013420, 8.013420, 5.227867, -12.626142, -12.626142, 5.227867},
+  {7.841443, 7.841443, 5.126243, -12.403626, -12.403626, 5.126243},
+  {7.669903, 7.669903, 5.024445, -12.180305, -12.180305, 5.024445},
+  {7.498802, 7.498802, 4.922472, -11.956185, -11.956185, 4.922472},
+  {7.328141, 7.328141, 4.820324, -11.731272, -11.731272, 4.820324},
+  {7.157924, 7.157924, 4.718003, -11.505571, -11.505571, 4.718003},
+  {6.988151, 6.988151, 4.615507, -11.279088, -11.279088, 4.615507},
+  {6.818826, 6.818826, 4.512837, -11.051828, -11.051828, 4.512837},
+  {6.649949, 6.649949, 4.409993, -10.823796, -10.823796, 4.409993},
+  {6.481524, 6.481524, 4.306976, -10.594998, -10.594998, 4.306976},
+  {6.313551, 6.313551, 4.203785, -10.365438, -10.365438, 4.203785},
+  {6.146034, 6.146034, 4.100420, -10.135123, -10.135123, 4.100420},
+  {5.978974, 5.978974, 3.996883, -9.904058, -9.904058, 3.996883},
+  {5.812374, 5.812374, 3.893172, -9.672247, -9.672247, 3.893172},
+  {5.646236, 5.646236, 3.789289, -9.439697, -9.439697, 3.789289},
+  {5.480561, 5.480561, 3.685232, -9.206411, -9.206411, 3.685232},
+  {5.315352, 5.315352, 3.581004, -8.972395, -8.972395, 3.581004},
+  {5.150611, 5.150611, 3.476602, -8.737654, -8.737654, 3.476602},
+  {4.986341, 4.986341, 3.372029, -8.502193, -8.502193, 3.372029},
+  {4.822542, 4.822542, 3.267283, -8.266017, -8.266017, 3.267283},
+  {4.659219, 4.659219, 3.162366, -8.029132, -8.029132, 3.162366},
+  {4.496372, 4.496372, 3.057277, -7.791540, -7.791540, 3.057277},
+  {4.334004, 4.334004, 2.952016, -7.553249, -7.553249, 2.952016},
+  {4.172117, 4.172117, 2.846583, -7.314261, -7.314261, 2.846583},
+  {4.010714, 4.010714, 2.740980, -7.074583, -7.074583, 2.740980},
+  {3.849796, 3.849796, 2.635205, -6.834218, -6.834218, 2.635205},
+  {3.689366, 3.689366, 2.529259, -6.593172, -6.593172, 2.529259},
+  {3.529426, 3.529426, 2.423142, -6.351449, -6.351449, 2.423142},
+  {3.369979, 3.369979, 2.316855, -6.109053, -6.109053, 2.316855},
+  {3.211026, 3.211026, 2.210397, -5.865989, -5.865989, 2.210397},
+  {3.052570, 3.052570, 2.103769, -5.622262, -5.622262, 2.103769},
+  {2.894613, 2.894613, 1.996970, -5.377876, -5.377876, 1.996970},
+  {2.737157, 2.737157, 1.890001, -5.132835, -5.132835, 1.890001},
+  {2.580206, 2.580206, 1.782863, -4.887144, -4.887144, 1.782863},
+  {2.423760, 2.423760, 1.675554, -4.640807, -4.640807, 1.675554},
+  {2.267822, 2.267822, 1.568076, -4.393828, -4.393828, 1.568076},
+  {2.112396, 2.112396, 1.460429, -4.146212, -4.146212, 1.460429},
+  {1.957482, 1.957482, 1.352612, -3.897963, -3.897963, 1.352612},
+  {1.803084, 1.803084, 1.244626, -3.649084, -3.649084, 1.244626},
+  {1.649203, 1.649203, 1.136471, -3.399581, -3.399581, 1.136471},
+  {1.495842, 1.495842, 1.028148, -3.149457, -3.149457, 1.028148},
+  {1.343003, 1.343003, 0.919655, -2.898715, -2.898715, 0.919655},
+  {1.190690, 1.190690, 0.810994, -2.647361, -2.647361, 0.810994},
+  {1.038903, 1.038903, 0.702164, -2.395398, -2.395398, 0.702164},
+  {0.887646, 0.887646, 0.593167, -2.142830, -2.142830, 0.593167},
+  {0.736921, 0.736921, 0.484001, -1.889660, -1.889660, 0.484001},
+  {0.586730, 0.586730, 0.374667, -1.635894, -1.635894, 0.374667},
+  {0.437075, 0.437075, 0.265166, -1.381533, -1.381533, 0.265166},
+  {0.287960, 0.287960, 0.155496, -1.126583, -1.126583, 0.155496},
+  {0.139386, 0.139386, 0.045660, -0.871046, -0.871046, 0.045660},
+  {-0.008644, -0.008644, -0.064345, -0.614927, -0.614927, -0.064345},
+  {-0.156128, -0.156128, -0.174516, -0.358229, -0.358229, -0.174516},
+  {-0.303063, -0.303063, -0.284854, -0.100956, -0.100956, -0.284854},
+  {-0.449447, -0.449447, -0.395359, 0.156889, 0.156889, -0.395359},
+  {-0.595277, -0.595277, -0.506032, 0.415303, 0.415303, -0.506032},
+  {-0.740551, -0.740551, -0.616870, 0.674281, 0.674281, -0.616870},
+  {-0.885267, -0.885267, -0.727875, 0.933821, 0.933821, -0.727875},
+  {-1.029421, -1.029421, -0.839047, 1.193919, 1.193919, -0.839047},
+  {-1.173013, -1.173013, -0.950384, 1.454571, 1.454571, -0.950384},
+  {-1.316038, -1.316038, -1.061888, 1.715776, 1.715776, -1.061888},
+  {-1.458495, -1.458495, -1.173558, 1.977528, 1.977528, -1.173558},
+  {-1.600381, -1.600381, -1.285393, 2.239825, 2.239825, -1.285393},
+  {-1.741693, -1.741693, -1.397394, 2.502664, 2.502664, -1.397394},
+  {-1.882430, -1.882430, -1.509560, 2.766042, 2.766042, -1.509560},
+  {-2.022589, -2.022589, -1.621892, 3.029955, 3.029955, -1.621892},
+  {-2.162166, -2.162166, -1.734388, 3.294401, 3.294401, -1.734388},
+  {-2.301161, -2.301161, -1.847050, 3.559377, 3.559377, -1.847050},
+  {-2.439569, -2.439569, -1.959877, 3.824879, 3.824879, -1.959877},
+  {-2.577389, -2.577389, -2.072868, 4.090904, 4.090904, -2.072868},
+  {-2.714618, -2.714618, -2.186024, 4.357450, 4.357450, -2.186024},
+  {-2.851254, -2.851254, -2.299345, 4.624514, 4.624514, -2.299345},
+  {-2.987293, -2.987293, -2.412829, 4.892093, 4.892093, -2.412829},
+  {-3.122735, -3.122735, -2.526478, 5.160185, 5.160185, -2.526478},
+  {-3.257575, -3.257575, -2.640291, 5.428786, 5.428786, -2.640291},
+  {-3.391812, -3.391812, -2.754268, 5.697893, 5.697893, -2.754268},
+  {-3.525442, -3.525442, -2.868408, 5.967505, 5.967505, -2.868408},
+  {-3.658464, -3.658464, -2.982712, 6.237618, 6.237618, -2.982712},
+  {-3.790875, -3.790875, -3.097179, 6.508230, 6.508230, -3.097179},
+  {-3.922672, -3.922672, -3.211810, 6.779338, 6.779338, -3.211810},
+  {-4.053853, -4.053853, -3.326604, 7.050941, 7.050941, -3.326604},
+  {-4.184415, -4.184415, -3.441561, 7.323034, 7.323034, -3.441561},
+  {-4.314356, -4.314356, -3.556680, 7.595617, 7.595617, -3.556680},
+  {-4.443672, -4.443672, -3.671963, 7.868685, 7.868685, -3.671963},
+  {-4.572363, -4.572363, -3.787408, 8.142238, 8.142238, -3.787408},
+  {-4.700424, -4.700424, -3.903015, 8.416273, 8.416273, -3.903015},
+  {-4.827853, -4.827853, -4.018785, 8.690787, 8.690787, -4.018785},
+  {-4.954649, -4.954649, -4.134717, 8.965779, 8.965779, -4.134717},
+  {-5.080808, -5.080808, -4.250811, 9.241245, 9.241245, -4.250811},
+  {-5.206327, -5.206327, -4.367067, 9.517184, 9.517184, -4.367067},
+  {-5.331205, -5.331205, -4.483485, 9.793594, 9.793594, -4.483485},
+  {-5.455438, -5.455438, -4.600064, 10.070473, 10.070473, -4.600064},
+  {-5.579024, -5.579024, -4.716805, 10.347818, 10.347818, -4.716805},
+  {-5.701960, -5.701960, -4.833707, 10.625627, 10.625627, -4.833707},
+  {-5.824245, -5.824245, -4.950770, 10.903899, 10.903899, -4.950770},
+  {-5.945875, -5.945875, -5.067995, 11.182631, 11.182631, -5.067995},
+  {-6.066847, -6.066847, -5.185380, 11.461822, 11.461822, -5.185380},
+  {-6.187160, -6.187160, -5.302926, 11.741469, 11.741469, -5.302926},
+  {-6.306811, -6.306811, -5.420633, 12.021571, 12.021571, -5.420633},
+  {-6.425796, -6.425796, -5.538500, 12.302126, 12.302126, -5.538500},
+  {-6.544114, -6.544114, -5.656528, 12.583132, 12.583132, -5.656528},
+  {-6.661762, -6.661762, -5.774715, 12.864588, 12.864588, -5.774715},
+  {-6.778738, -6.778738, -5.893063, 13.146491, 13.146491, -5.893063},
+  {-6.895038, -6.895038, -6.011571, 13.428840, 13.428840, -6.011571},
+  {-7.010661, -7.010661, -6.130239, 13.711633, 13.711633, -6.130239},
+  {-7.125603, -7.125603, -6.249067, 13.994869, 13.994869, -6.249067},
+  {-7.239862, -7.239862, -6.368054, 14.278547, 14.278547, -6.368054},
+  {-7.353437, -7.353437, -6.487200, 14.562663, 14.562663, -6.487200},
+  {-7.466323, -7.466323, -6.606506, 14.847218, 14.847218, -6.606506},
+  {-7.578519, -7.578519, -6.725971, 15.132209, 15.132209, -6.725971},
+  {-7.690022, -7.690022, -6.845595, 15.417636, 15.417636, -6.845595},
+  {-7.800829, -7.800829, -6.965378, 15.703496, 15.703496, -6.965378},
+  {-7.910939, -7.910939, -7.085320, 15.989789, 15.989789, -7.085320},
+  {-8.020348, -8.020348, -7.205420, 16.276512, 16.276512, -7.205420},
+  {-8.129054, -8.129054, -7.325679, 16.563665, 16.563665, -7.325679},
+  {-8.237054, -8.237054, -7.446096, 16.851247, 16.851247, -7.446096},
+  {-8.344346, -8.344346, -7.566671, 17.139255, 17.139255, -7.566671},
+  {-8.450928, -8.450928, -7.687405, 17.427690, 17.427690, -7.687405},
+  {-8.556797, -8.556797, -7.808296, 17.716549, 17.716549, -7.808296},
+  {-8.661950, -8.661950, -7.929346, 18.005832, 18.005832, -7.929346},
+  {-8.766385, -8.766385, -8.050553, 18.295538, 18.295538, -8.050553},
+  {-8.870100, -8.870100, -8.171917, 18.585664, 18.585664, -8.171917},
+  {-8.973091, -8.973091, -8.293439, 18.876212, 18.876212, -8.293439},
+  {-9.075357, -9.075357, -8.415119, 19.167178, 19.167178, -8.415119},
+  {-9.176896, -9.176896, -8.536955, 19.458563, 19.458563, -8.536955},
+  {-9.277703, -9.277703, -8.658949, 19.750366, 19.750366, -8.658949},
+  {-9.377778, -9.377778, -8.781099, 20.042585, 20.042585, -8.781099},
+  {-9.477118, -9.477118, -8.903407, 20.335220, 20.335220, -8.903407},
+  {-9.575720, -9.575720, -9.025871, 20.628269, 20.628269, -9.025871},
+  {-9.673582, -9.673582, -9.148491, 20.921733, 20.921733, -9.148491},
+  {-9.770701, -9.770701, -9.271268, 21.215609, 21.215609, -9.271268},
+  {-9.867076, -9.867076, -9.394202, 21.509899, 21.509899, -9.394202},
+  {-9.962703, -9.962703, -9.517291, 21.804600, 21.804600, -9.517291},
+  {-10.057580, -10.057580, -9.640536, 22.099712, 22.099712, -9.640536},
+  {-10.151705, -10.151705, -9.763938, 22.395234, 22.395234, -9.763938},
+  {-10.245076, -10.245076, -9.887495, 22.691166, 22.691166, -9.887495},
+  {-10.337690, -10.337690, -10.011208, 22.987508, 22.987508, -10.011208},
+  {-10.429545, -10.429545, -10.135076, 23.284258, 23.284258, -10.135076},
+  {-10.520638, -10.520638, -10.259099, 23.581417, 23.581417, -10.259099},
+  {-10.610967, -10.610967, -10.383278, 23.878983, 23.878983, -10.383278},
+  {-10.700530, -10.700530, -10.507612, 24.176956, 24.176956, -10.507612},
+  {-10.789325, -10.789325, -10.632101, 24.475336, 24.475336, -10.632101},
+  {-10.877349, -10.877349, -10.756745, 24.774123, 24.774123, -10.756745},
+  {-10.964600, -10.964600, -10.881544, 25.073315, 25.073315, -10.881544},
+  {-11.051075, -11.051075, -11.006497, 25.372914, 25.372914, -11.006497},
+  {-11.136773, -11.136773, -11.131605, 25.672917, 25.672917, -11.131605},
+  {-11.221691, -11.221691, -11.256867, 25.973326, 25.973326, -11.256867},
+  {-11.305826, -11.305826, -11.382284, 26.274140, 26.274140, -11.382284},
+  {-11.389178, -11.389178, -11.507854, 26.575359, 26.575359, -11.507854},
+  {-11.471743, -11.471743, -11.633579, 26.876982, 26.876982, -11.633579},
+  {-11.553519, -11.553519, -11.759457, 27.179010, 27.179010, -11.759457},
+  {-11.634504, -11.634504, -11.885489, 27.481442, 27.481442, -11.885489},
+  {-11.714696, -11.714696, -12.011675, 27.784278, 27.784278, -12.011675},
+  {-11.794093, -11.794093, -12.138014, 28.087518, 28.087518, -12.138014},
+  {-11.872693, -11.872693, -12.264507, 28.391163, 28.391163, -12.264507},
+  {-11.950493, -11.950493, -12.391153, 28.695212, 28.695212, -12.391153},
+  {-12.027491, -12.027491, -12.517952, 28.999666, 28.999666, -12.517952},
+  {-12.103686, -12.103686, -12.644904, 29.304524, 29.304524, -12.644904},
+  {-12.179074, -12.179074, -12.772008, 29.609786, 29.609786, -12.772008},
+  {-12.253655, -12.253655, -12.899266, 29.915454, 29.915454, -12.899266},
+  {-12.327426, -12.327426, -13.026676, 30.221526, 30.221526, -13.026676},
+  {-12.400385, -12.400385, -13.154239, 30.528003, 30.528003, -13.154239},
+  {-12.472530, -12.472530, -13.281954, 30.834886, 30.834886, -13.281954},
+  {-12.543858, -12.543858, -13.409821, 31.142174, 31.142174, -13.409821},
+  {-12.614369, -12.614369, -13.537841, 31.449869, 31.449869, -13.537841},
+  {-12.684060, -12.684060, -13.666013, 31.757970, 31.757970, -13.666013},
+  {-12.752929, -12.752929, -13.794336, 32.066478, 32.066478, -13.794336},
+  {-12.820973, -12.820973, -13.922811, 32.375393, 32.375393, -13.922811},
+  {-12.888193, -12.888193, -14.051438, 32.684715, 32.684715, -14.051438},
+  {-12.954584, -12.954584, -14.180216, 32.994446, 32.994446, -14.180216},
+  {-13.020146, -13.020146, -14.309146, 33.304586, 33.304586, -14.309146},
+  {-13.084876, -13.084876, -14.438227, 33.615135, 33.615135, -14.438227},
+  {-13.148773, -13.148773, -14.567459, 33.926093, 33.926093, -14.567459},
+  {-13.211835, -13.211835, -14.696843, 34.237462, 34.237462, -14.696843},
+  {-13.274060, -13.274060, -14.826377, 34.549243, 34.549243, -14.826377},
+  {-13.335446, -13.335446, -14.956062, 34.861435, 34.861435, -14.956062},
+  {-13.395992, -13.395992, -15.085897, 35.174040, 35.174040, -15.085897},
+  {-13.455695, -13.455695, -15.215883, 35.487058, 35.487058, -15.215883},
+  {-13.514555, -13.514555, -15.346020, 35.800490, 35.800490, -15.346020},
+  {-13.572568, -13.572568, -15.476307, 36.114337, 36.114337, -15.476307},
+  {-13.629735, -13.629735, -15.606744, 36.428600, 36.428600, -15.606744},
+  {-13.686052, -13.686052, -15.737331, 36.743280, 36.743280, -15.737331},
+  {-13.741519, -13.741519, -15.868068, 37.058377, 37.058377, -15.868068},
+  {-13.796133, -13.796133, -15.998955, 37.373894, 37.373894, -15.998955},
+  {-13.849893, -13.849893, -16.129991, 37.689829, 37.689829, -16.129991},
+  {-13.902798, -13.902798, -16.261178, 38.006186, 38.006186, -16.261178},
+  {-13.954846, -13.954846, -16.392513, 38.322964, 38.322964, -16.392513},
+  {-14.006035, -14.006035, -16.523998, 38.640165, 38.640165, -16.523998},
+  {-14.056363, -14.056363, -16.655632, 38.957791, 38.957791, -16.655632},
+  {-14.105831, -14.105831, -16.787416, 39.275841, 39.275841, -16.787416},
+  {-14.154435, -14.154435, -16.919348, 39.594318, 39.594318, -16.919348},
+  {-14.202174, -14.202174, -17.051429, 39.913223, 39.913223, -17.051429},
+  {-14.249048, -14.249048, -17.183659, 40.232557, 40.232557, -17.183659},
+  {-14.295054, -14.295054, -17.316037, 40.552321, 40.552321, -17.316037},
+  {-14.340191, -14.340191, -17.448564, 40.872517, 40.872517, -17.448564},
+  {-14.384458, -14.384458, -17.581239, 41.193146, 41.193146, -17.581239},
+  {-14.427854, -14.427854, -17.714063, 41.514209, 41.514209, -17.714063},
+  {-14.470376, -14.470376, -17.847034, 41.835709, 41.835709, -17.847034},
+  {-14.512025, -14.512025, -17.980154, 42.157646, 42.157646, -17.980154},
+  {-14.552798, -14.552798, -18.113422, 42.480023, 42.480023, -18.113422},
+  {-14.592695, -14.592695, -18.246837, 42.802840, 42.802840, -18.246837},
+  {-14.631714, -14.631714, -18.380400, 43.126100, 43.126100, -18.380400},
+  {-14.669854, -14.669854, -18.514110, 43.449804, 43.449804, -18.514110},
+  {-14.707114, -14.707114, -18.647968, 43.773954, 43.773954, -18.647968},
+  {-14.743492, -14.743492, -18.781973, 44.098552, 44.098552, -18.781973},
+  {-14.778988, -14.778988, -18.916126, 44.423598, 44.423598, -18.916126},
+  {-14.813601, -14.813601, -19.050425, 44.749097, 44.749097, -19.050425},
+  {-14.847328, -14.847328, -19.184871, 45.075048, 45.075048, -19.184871},
+  {-14.880171, -14.880171, -19.319465, 45.401454, 45.401454, -19.319465},
+  {-14.912126, -14.912126, -19.454204, 45.728318, 45.728318, -19.454204},
+  {-14.943194, -14.943194, -19.589091, 46.055641, 46.055641, -19.589091},
+  {-14.973374, -14.973374, -19.724124, 46.383424, 46.383424, -19.724124},
+  {-15.002664, -15.002664, -19.859303, 46.711671, 46.711671, -19.859303},
+  {-15.031063, -15.031063, -19.994628, 47.040384, 47.040384, -19.994628},
+  {-15.058571, -15.058571, -20.130099, 47.369564, 47.369564, -20.130099},
+  {-15.085187, -15.085187, -20.265717, 47.699214, 47.699214, -20.265717},
+  {-15.110910, -15.110910, -20.401480, 48.029336, 48.029336, -20.401480},
+  {-15.135740, -15.135740, -20.537389, 48.359932, 48.359932, -20.537389},
+  {-15.159674, -15.159674, -20.673443, 48.691005, 48.691005, -20.673443},
+  {-15.182714, -15.182714, -20.809643, 49.022558, 49.022558, -20.809643},
+  {-15.204857, -15.204857, -20.945988, 49.354592, 49.354592, -20.945988},
+  {-15.226104, -15.226104, -21.082479, 49.687110, 49.687110, -21.082479},
+  {-15.246453, -15.246453, -21.219114, 50.020115, 50.020115, -21.219114},
+  {-15.265904, -15.265904, -21.355895, 50.353610, 50.353610, -21.355895},
+  {-15.284457, -15.284457, -21.492820, 50.687596, 50.687596, -21.492820},
+  {-15.302110, -15.302110, -21.629891, 51.022077, 51.022077, -21.629891},
+  {-15.318864, -15.318864, -21.767105, 51.357056, 51.357056, -21.767105},
+  {-15.334717, -15.334717, -21.904465, 51.692535, 51.692535, -21.904465},
+  {-15.349670, -15.349670, -22.041968, 52.028517, 52.028517, -22.041968},
+  {-15.363721, -15.363721, -22.179616, 52.365005, 52.365005, -22.179616},
+  {-15.376871, -15.376871, -22.317408, 52.702002, 52.702002, -22.317408},
+  {-15.389118, -15.389118, -22.455344, 53.039511, 53.039511, -22.455344},
+  {-15.400463, -15.400463, -22.593424, 53.377536, 53.377536, -22.593424},
+  {-15.410905, -15.410905, -22.731648, 53.716078, 53.716078, -22.731648},
+  {-15.420444, -15.420444, -22.870015, 54.055142, 54.055142, -22.870015},
+  {-15.429080, -15.429080, -23.008526, 54.394731, 54.394731, -23.008526},
+  {-15.436811, -15.436811, -23.147180, 54.734848, 54.734848, -23.147180},
+  {-15.443639, -15.443639, -23.285977, 55.075496, 55.075496, -23.285977},
+  {-15.449562, -15.449562, -23.424918, 55.416678, 55.416678, -23.424918},
+  {-15.454581, -15.454581, -23.564001, 55.758399, 55.758399, -23.564001},
+  {-15.458696, -15.458696, -23.703228, 56.100662, 56.100662, -23.703228},
+  {-15.461906, -15.461906, -23.842597, 56.443469, 56.443469, -23.842597},
+  {-15.464210, -15.464210, -23.982109, 56.786826, 56.786826, -23.982109},
+  {-15.465611, -15.465611, -24.121763, 57.130736, 57.130736, -24.121763},
+  {-15.466106, -15.466106, -24.261560, 57.475201, 57.475201, -24.261560},
+  {-15.465696, -15.465696, -24.401498, 57.820228, 57.820228, -24.401498},
+  {-15.464381, -15.464381, -24.541579, 58.165818, 58.165818, -24.541579},
+  {-15.462161, -15.462161, -24.681802, 58.511976, 58.511976, -24.681802},
+  {-15.459037, -15.459037, -24.822167, 58.858707, 58.858707, -24.822167},
+  {-15.455008, -15.455008, -24.962674, 59.206014, 59.206014, -24.962674},
+  {-15.450074, -15.450074, -25.103322, 59.553901, 59.553901, -25.103322},
+  {-15.444236, -15.444236, -25.244112, 59.902373, 59.902373, -25.244112},
+  {-15.437494, -15.437494, -25.385042, 60.251434, 60.251434, -25.385042},
+  {-15.429847, -15.429847, -25.526115, 60.601089, 60.601089, -25.526115},
+  {-15.421297, -15.421297, -25.667328, 60.951341, 60.951341, -25.667328},
+  {-15.411843, -15.411843, -25.808682, 61.302196, 61.302196, -25.808682},
+  {-15.401486, -15.401486, -25.950177, 61.653657, 61.653657, -25.950177},
+  {-15.390226, -15.390226, -26.091813, 62.005731, 62.005731, -26.091813},
+  {-15.378064, -15.378064, -26.233589, 62.358420, 62.358420, -26.233589},
+  {-15.364999, -15.364999, -26.375506, 62.711732, 62.711732, -26.375506},
+  {-15.351033, -15.351033, -26.517563, 63.065669, 63.065669, -26.517563},
+  {-15.336165, -15.336165, -26.659760, 63.420237, 63.420237, -26.659760},
+  {-15.320397, -15.320397, -26.802097, 63.775442, 63.775442, -26.802097},
+  {-15.303728, -15.303728, -26.944574, 64.131289, 64.131289, -26.944574},
+  {-15.286159, -15.286159, -27.087191, 64.487782, 64.487782, -27.087191},
+  {-15.267692, -15.267692, -27.229948, 64.844927, 64.844927, -27.229948},
+  {-15.248325, -15.248325, -27.372844, 65.202730, 65.202730, -27.372844},
+  {-15.228060, -15.228060, -27.515879, 65.561195, 65.561195, -27.515879},
+  {-15.206898, -15.206898, -27.659054, 65.920330, 65.920330, -27.659054},
+  {-15.184839, -15.184839, -27.802367, 66.280139, 66.280139, -27.802367},
+  {-15.161884, -15.161884, -27.945820, 66.640628, 66.640628, -27.945820},
+  {-15.138034, -15.138034, -28.089411, 67.001803, 67.001803, -28.089411},
+  {-15.113289, -15.113289, -28.233141, 67.363670, 67.363670, -28.233141},
+  {-15.087650, -15.087650, -28.377010, 67.726236, 67.726236, -28.377010},
+  {-15.061118, -15.061118, -28.521017, 68.089506, 68.089506, -28.521017},
+  {-15.033694, -15.033694, -28.665162, 68.453486, 68.453486, -28.665162},
+  {-15.005379, -15.005379, -28.809445, 68.818184, 68.818184, -28.809445},
+  {-14.976173, -14.976173, -28.953866, 69.183606, 69.183606, -28.953866},
+  {-14.946077, -14.946077, -29.098425, 69.549758, 69.549758, -29.098425},
+  {-14.915093, -14.915093, -29.243122, 69.916647, 69.916647, -29.243122},
+  {-14.883221, -14.883221, -29.387956, 70.284280, 70.284280, -29.387956},
+  {-14.850462, -14.850462, -29.532928, 70.652664, 70.652664, -29.532928},
+  {-14.816818, -14.816818, -29.678037, 71.021806, 71.021806, -29.678037},
+  {-14.782288, -14.782288, -29.823283, 71.391714, 71.391714, -29.823283},
+  {-14.746876, -14.746876, -29.968665, 71.762394, 71.762394, -29.968665},
+  {-14.710580, -14.710580, -30.114185, 72.133854, 72.133854, -30.114185},
+  {-14.673404, -14.673404, -30.259842, 72.506102, 72.506102, -30.259842},
+  {-14.635347, -14.635347, -30.405634, 72.879146, 72.879146, -30.405634},
+  {-14.596411, -14.596411, -30.551564, 73.252993, 73.252993, -30.551564},
+  {-14.556597, -14.556597, -30.697629, 73.627651, 73.627651, -30.697629},
+  {-14.515906, -14.515906, -30.843830, 74.003129, 74.003129, -30.843830},
+  {-14.474340, -14.474340, -30.990168, 74.379435, 74.379435, -30.990168},
+  {-14.431899, -14.431899, -31.136641, 74.756578, 74.756578, -31.136641},
+  {-14.388586, -14.388586, -31.283250, 75.134565, 75.134565, -31.283250},
+  {-14.344401, -14.344401, -31.429994, 75.513406, 75.513406, -31.429994},
+  {-14.299346, -14.299346, -31.576873, 75.893110, 75.893110, -31.576873},
+  {-14.253421, -14.253421, -31.723888, 76.273685, 76.273685, -31.723888},
+  {-14.206630, -14.206630, -31.871037, 76.655142, 76.655142, -31.871037},
+  {-14.158972, -14.158972, -32.018321, 77.037489, 77.037489, -32.018321},
+  {-14.110449, -14.110449, -32.165740, 77.420735, 77.420735, -32.165740},
+  {-14.061063, -14.061063, -32.313294, 77.804892, 77.804892, -32.313294},
+  {-14.010816, -14.010816, -32.460981, 78.189968, 78.189968, -32.460981},
+  {-13.959708, -13.959708, -32.608803, 78.575974, 78.575974, -32.608803},
+  {-13.907741, -13.907741, -32.756759, 78.962920, 78.962920, -32.756759},
+  {-13.854917, -13.854917, -32.904849, 79.350817, 79.350817, -32.904849},
+  {-13.801237, -13.801237, -33.053072, 79.739675, 79.739675, -33.053072},
+  {-13.746703, -13.746703, -33.201429, 80.129506, 80.129506, -33.201429},
+  {-13.691317, -13.691317, -33.349919, 80.520319, 80.520319, -33.349919},
+  {-13.635080, -13.635080, -33.498543, 80.912128, 80.912128, -33.498543},
+  {-13.577993, -13.577993, -33.647299, 81.304943, 81.304943, -33.647299},
+  {-13.520059, -13.520059, -33.796188, 81.698775, 81.698775, -33.796188},
+  {-13.461280, -13.461280, -33.945210, 82.093638, 82.093638, -33.945210},
+  {-13.401656, -13.401656, -34.094365, 82.489543, 82.489543, -34.094365},
+  {-13.341189, -13.341189, -34.243651, 82.886503, 82.886503, -34.243651},
+  {-13.279882, -13.279882, -34.393070, 83.284530, 83.284530, -34.393070},
+  {-13.217736, -13.217736, -34.542621, 83.683638, 83.683638, -34.542621},
+  {-13.154753, -13.154753, -34.692303, 84.083839, 84.083839, -34.692303},
+  {-13.090935, -13.090935, -34.842117, 84.485147, 84.485147, -34.842117},
+  {-13.026283, -13.026283, -34.992063, 84.887577, 84.887577, -34.992063},
+  {-12.960799, -12.960799, -35.142140, 85.291141, 85.291141, -35.142140},
+  {-12.894486, -12.894486, -35.292347, 85.695855, 85.695855, -35.292347},
+  {-12.827345, -12.827345, -35.442686, 86.101733, 86.101733, -35.442686},
+  {-12.759378, -12.759378, -35.593155, 86.508789, 86.508789, -35.593155},
+  {-12.690587, -12.690587, -35.743755, 86.917040, 86.917040, -35.743755},
+  {-12.620973, -12.620973, -35.894485, 87.326501, 87.326501, -35.894485},
+  {-12.550540, -12.550540, -36.045345, 87.737187, 87.737187, -36.045345},
+  {-12.479288, -12.479288, -36.196336, 88.149115, 88.149115, -36.196336},
+  {-12.407220, -12.407220, -36.347455, 88.562302, 88.562302, -36.347455},
+  {-12.334338, -12.334338, -36.498705, 88.976764, 88.976764, -36.498705},
+  {-12.260644, -12.260644, -36.650083, 89.392520, 89.392520, -36.650083},
+  {-12.186139, -12.186139, -36.801591, 89.809585, 89.809585, -36.801591},
+  {-48.888640, 60.676762, 89.897529, 7.535990, -3.185889, -16.091318},
+  {-48.827988, 60.534315, 89.618151, 7.515405, -3.186539, -16.187360},
+  {-48.766934, 60.391882, 89.339404, 7.494826, -3.187154, -16.282875},
+  {-48.705477, 60.249461, 89.061281, 7.474251, -3.187733, -16.377861},
+  {-48.643619, 60.107053, 88.783778, 7.453682, -3.188276, -16.472318},
+  {-48.581362, 59.964658, 88.506888, 7.433118, -3.188783, -16.566243},
+  {-48.518706, 59.822274, 88.230606, 7.412559, -3.189254, -16.659635},
+  {-48.455653, 59.679904, 87.954928, 7.392005, -3.189690, -16.752492},
+  {-48.392204, 59.537546, 87.679847, 7.371457, -3.190089, -16.844813},
+  {-48.328360, 59.395200, 87.405359, 7.350914, -3.190453, -16.936595},
+  {-48.264122, 59.252866, 87.131458, 7.330377, -3.190780, -17.027838},
+  {-48.199493, 59.110544, 86.858140, 7.309845, -3.191072, -17.118539},
+  {-48.134472, 58.968235, 86.585400, 7.289318, -3.191328, -17.208698},
+  {-48.069061, 58.825938, 86.313233, 7.268798, -3.191548, -17.298312},
+  {-48.003262, 58.683652, 86.041633, 7.248283, -3.191732, -17.387380},
+  {-47.937076, 58.541379, 85.770597, 7.227773, -3.191880, -17.475900},
+  {-47.870504, 58.399117, 85.500119, 7.207270, -3.191992, -17.563870},
+  {-47.803547, 58.256867, 85.230195, 7.186772, -3.192068, -17.651290},
+  {-47.736207, 58.114629, 84.960821, 7.166280, -3.192108, -17.738156},
+  {-47.668484, 57.972403, 84.691992, 7.145794, -3.192113, -17.824469},
+  {-47.600381, 57.830188, 84.423704, 7.125314, -3.192081, -17.910226},
+  {-47.531898, 57.687985, 84.155952, 7.104840, -3.192014, -17.995426},
+  {-47.463037, 57.545793, 83.888732, 7.084372, -3.191910, -18.080066},
+  {-47.393798, 57.403613, 83.622040, 7.063911, -3.191771, -18.164146},
+  {-47.324184, 57.261444, 83.355871, 7.043455, -3.191596, -18.247664},
+  {-47.254196, 57.119286, 83.090222, 7.023006, -3.191385, -18.330619},
+  {-47.183834, 56.977140, 82.825089, 7.002563, -3.191138, -18.413008},
+  {-47.113100, 56.835004, 82.560467, 6.982126, -3.190855, -18.494830},
+  {-47.041996, 56.692880, 82.296353, 6.961696, -3.190536, -18.576084},
+  {-46.970523, 56.550768, 82.032742, 6.941272, -3.190182, -18.656768},
+  {-46.898681, 56.408666, 81.769631, 6.920855, -3.189791, -18.736880},
+  {-46.826473, 56.266575, 81.507017, 6.900444, -3.189365, -18.816420},
+  {-46.753899, 56.124495, 81.244894, 6.880040, -3.188902, -18.895385},
+  {-46.680962, 55.982426, 80.983260, 6.859643, -3.188404, -18.973774},
+  {-46.607661, 55.840368, 80.722111, 6.839252, -3.187870, -19.051586},
+  {-46.533999, 55.698320, 80.461444, 6.818868, -3.187300, -19.128818},
+  {-46.459977, 55.556283, 80.201254, 6.798491, -3.186694, -19.205470},
+  {-46.385596, 55.414257, 79.941539, 6.778121, -3.186052, -19.281540},
+  {-46.310858, 55.272242, 79.682295, 6.757757, -3.185374, -19.357026},
+  {-46.235763, 55.130237, 79.423518, 6.737401, -3.184660, -19.431927},
+  {-46.160314, 54.988242, 79.165205, 6.717052, -3.183911, -19.506242},
+  {-46.084511, 54.846258, 78.907353, 6.696709, -3.183125, -19.579968},
+  {-46.008356, 54.704285, 78.649959, 6.676374, -3.182304, -19.653105},
+  {-45.931849, 54.562322, 78.393019, 6.656046, -3.181447, -19.725652},
+  {-45.854993, 54.420369, 78.136530, 6.635725, -3.180554, -19.797605},
+  {-45.777789, 54.278426, 77.880488, 6.615412, -3.179625, -19.868965},
+  {-45.700238, 54.136494, 77.624892, 6.595106, -3.178660, -19.939730},
+  {-45.622341, 53.994572, 77.369737, 6.574807, -3.177660, -20.009897},
+  {-45.544100, 53.852660, 77.115021, 6.554516, -3.176623, -20.079467},
+  {-45.465516, 53.710758, 76.860741, 6.534232, -3.175551, -20.148437},
+  {-45.386590, 53.568866, 76.606894, 6.513956, -3.174442, -20.216806},
+  {-45.307324, 53.426984, 76.353476, 6.493687, -3.173298, -20.284572},
+  {-45.227719, 53.285111, 76.100485, 6.473426, -3.172118, -20.351735},
+  {-45.147776, 53.143249, 75.847918, 6.453173, -3.170902, -20.418293},
+  {-45.067497, 53.001397, 75.595773, 6.432928, -3.169651, -20.484244},
+  {-44.986882, 52.859554, 75.344046, 6.412690, -3.168363, -20.549587},
+  {-44.905934, 52.717722, 75.092734, 6.392460, -3.167040, -20.614321},
+  {-44.824654, 52.575899, 74.841836, 6.372238, -3.165681, -20.678444},
+  {-44.743042, 52.434085, 74.591347, 6.352024, -3.164286, -20.741955},
+  {-44.661101, 52.292282, 74.341267, 6.331818, -3.162855, -20.804853},
+  {-44.578831, 52.150487, 74.091591, 6.311621, -3.161389, -20.867136},
+  {-44.496234, 52.008703, 73.842318, 6.291431, -3.159886, -20.928803},
+  {-44.413312, 51.866928, 73.593445, 6.271249, -3.158348, -20.989853},
+  {-44.330065, 51.725162, 73.344969, 6.251076, -3.156774, -21.050284},
+  {-44.246495, 51.583406, 73.096888, 6.230911, -3.155164, -21.110096},
+  {-44.162603, 51.441659, 72.849199, 6.210755, -3.153519, -21.169286},
+  {-44.078390, 51.299922, 72.601901, 6.190606, -3.151837, -21.227854},
+  {-43.993859, 51.158194, 72.354990, 6.170466, -3.150120, -21.285798},
+  {-43.909009, 51.016475, 72.108464, 6.150335, -3.148367, -21.343118},
+  {-43.823843, 50.874765, 71.862321, 6.130212, -3.146578, -21.399811},
+  {-43.738362, 50.733065, 71.616558, 6.110098, -3.144754, -21.455877},
+  {-43.652567, 50.591374, 71.371173, 6.089993, -3.142894, -21.511314},
+  {-43.566460, 50.449692, 71.126165, 6.069896, -3.140998, -21.566121},
+  {-43.480041, 50.308019, 70.881530, 6.049808, -3.139066, -21.620297},
+  {-43.393313, 50.166355, 70.637267, 6.029728, -3.137099, -21.673842},
+  {-43.306275, 50.024700, 70.393373, 6.009658, -3.135096, -21.726752},
+  {-43.218931, 49.883054, 70.149846, 5.989597, -3.133057, -21.779029},
+  {-43.131280, 49.741417, 69.906684, 5.969544, -3.130982, -21.830669},
+  {-43.043325, 49.599789, 69.663886, 5.949501, -3.128872, -21.881673},
+  {-42.955067, 49.458170, 69.421447, 5.929466, -3.126726, -21.932039},
+  {-42.866507, 49.316560, 69.179368, 5.909441, -3.124544, -21.981766},
+  {-42.777645, 49.174958, 68.937646, 5.889425, -3.122327, -22.030852},
+  {-42.688485, 49.033366, 68.696278, 5.869418, -3.120074, -22.079298},
+  {-42.599026, 48.891782, 68.455262, 5.849420, -3.117785, -22.127101},
+  {-42.509271, 48.750207, 68.214598, 5.829432, -3.115460, -22.174260},
+  {-42.419220, 48.608640, 67.974282, 5.809453, -3.113100, -22.220775},
+  {-42.328875, 48.467082, 67.734314, 5.789484, -3.110705, -22.266645},
+  {-42.238237, 48.325533, 67.494690, 5.769524, -3.108273, -22.311868},
+  {-42.147307, 48.183993, 67.255409, 5.749573, -3.105806, -22.356443},
+  {-42.056087, 48.042461, 67.016470, 5.729632, -3.103304, -22.400370},
+  {-41.964578, 47.900937, 66.777870, 5.709701, -3.100765, -22.443647},
+  {-41.872782, 47.759422, 66.539608, 5.689780, -3.098192, -22.486274},
+  {-41.780699, 47.617916, 66.301682, 5.669868, -3.095582, -22.528249},
+  {-41.688331, 47.476418, 66.064089, 5.649966, -3.092937, -22.569572},
+  {-41.595679, 47.334929, 65.826829, 5.630074, -3.090256, -22.610241},
+  {-41.502744, 47.193448, 65.589900, 5.610192, -3.087540, -22.650256},
+  {-41.409528, 47.051975, 65.353299, 5.590320, -3.084789, -22.689616},
+  {-41.316033, 46.910511, 65.117026, 5.570458, -3.082001, -22.728319},
+  {-41.222258, 46.769055, 64.881078, 5.550606, -3.079178, -22.766366},
+  {-41.128206, 46.627607, 64.645454, 5.530764, -3.076320, -22.803754},
+  {-41.033878, 46.486168, 64.410152, 5.510932, -3.073426, -22.840484},
+  {-40.939276, 46.344737, 64.175171, 5.491110, -3.070497, -22.876554},
+  {-40.844399, 46.203314, 63.940509, 5.471299, -3.067532, -22.911963},
+  {-40.749250, 46.061900, 63.706165, 5.451498, -3.064531, -22.946711},
+  {-40.653830, 45.920493, 63.472136, 5.431707, -3.061495, -22.980797},
+  {-40.558141, 45.779095, 63.238422, 5.411927, -3.058424, -23.014220},
+  {-40.462182, 45.637705, 63.005021, 5.392158, -3.055317, -23.046980},
+  {-40.365957, 45.496324, 62.771931, 5.372398, -3.052175, -23.079074},
+  {-40.269465, 45.354950, 62.539151, 5.352650, -3.048997, -23.110504},
+  {-40.172709, 45.213584, 62.306679, 5.332912, -3.045784, -23.141268},
+  {-40.075689, 45.072227, 62.074514, 5.313185, -3.042535, -23.171365},
+  {-39.978407, 44.930877, 61.842655, 5.293468, -3.039251, -23.200795},
+  {-39.880863, 44.789536, 61.611100, 5.273763, -3.035931, -23.229556},
+  {-39.783060, 44.648203, 61.379847, 5.254068, -3.032576, -23.257649},
+  {-39.684999, 44.506877, 61.148896, 5.234384, -3.029186, -23.285073},
+  {-39.586680, 44.365560, 60.918245, 5.214711, -3.025760, -23.311826},
+  {-39.488105, 44.224251, 60.687893, 5.195049, -3.022299, -23.337909},
+  {-39.389275, 44.082949, 60.457838, 5.175398, -3.018803, -23.363320},
+  {-39.290192, 43.941656, 60.228078, 5.155759, -3.015271, -23.388060},
+  {-39.190856, 43.800371, 59.998614, 5.136130, -3.011704, -23.412127},
+  {-39.091269, 43.659093, 59.769443, 5.116513, -3.008102, -23.435521},
+  {-38.991432, 43.517823, 59.540564, 5.096907, -3.004464, -23.458241},
+  {-38.891346, 43.376562, 59.311975, 5.077312, -3.000792, -23.480287},
+  {-38.791013, 43.235308, 59.083677, 5.057729, -2.997083, -23.501659},
+  {-38.690434, 43.094062, 58.855666, 5.038157, -2.993340, -23.522355},
+  {-38.589609, 42.952824, 58.627943, 5.018596, -2.989561, -23.542376},
+  {-38.488540, 42.811593, 58.400506, 4.999047, -2.985747, -23.561720},
+  {-38.387229, 42.670371, 58.173354, 4.979510, -2.981898, -23.580388},
+  {-38.285676, 42.529156, 57.946485, 4.959984, -2.978014, -23.598379},
+  {-38.183883, 42.387949, 57.719899, 4.940470, -2.974094, -23.615692},
+  {-38.081851, 42.246750, 57.493594, 4.920968, -2.970139, -23.632327},
+  {-37.979581, 42.105559, 57.267569, 4.901478, -2.966149, -23.648284},
+  {-37.877074, 41.964375, 57.041823, 4.881999, -2.962124, -23.663562},
+  {-37.774332, 41.823200, 56.816355, 4.862532, -2.958064, -23.678162},
+  {-37.671355, 41.682032, 56.591164, 4.843078, -2.953968, -23.692081},
+  {-37.568146, 41.540872, 56.366249, 4.823635, -2.949838, -23.705321},
+  {-37.464704, 41.399719, 56.141609, 4.804204, -2.945672, -23.717881},
+  {-37.361031, 41.258574, 55.917242, 4.784786, -2.941471, -23.729761},
+  {-37.257128, 41.117438, 55.693148, 4.765379, -2.937235, -23.740960},
+  {-37.152997, 40.976308, 55.469325, 4.745985, -2.932964, -23.751478},
+  {-37.048639, 40.835187, 55.245774, 4.726603, -2.928658, -23.761315},
+  {-36.944055, 40.694073, 55.022491, 4.707233, -2.924317, -23.770470},
+  {-36.839245, 40.552967, 54.799478, 4.687876, -2.919941, -23.778944},
+  {-36.734211, 40.411869, 54.576732, 4.668531, -2.915530, -23.786736},
+  {-36.628955, 40.270778, 54.354253, 4.649199, -2.911084, -23.793846},
+  {-36.523477, 40.129695, 54.132039, 4.629879, -2.906603, -23.800273},
+  {-36.417779, 39.988620, 53.910091, 4.610572, -2.902087, -23.806019},
+  {-36.311861, 39.847552, 53.688406, 4.591277, -2.897536, -23.811081},
+  {-36.205725, 39.706492, 53.466984, 4.571995, -2.892950, -23.815462},
+  {-36.099372, 39.565440, 53.245825, 4.552726, -2.888329, -23.819159},
+  {-35.992803, 39.424396, 53.024926, 4.533470, -2.883674, -23.822174},
+  {-35.886019, 39.283359, 52.804288, 4.514226, -2.878983, -23.824505},
+  {-35.779022, 39.142330, 52.583910, 4.494995, -2.874258, -23.826154},
+  {-35.671812, 39.001309, 52.363790, 4.475778, -2.869497, -23.827120},
+  {-35.564390, 38.860295, 52.143927, 4.456573, -2.864702, -23.827403},
+  {-35.456758, 38.719289, 51.924322, 4.437381, -2.859872, -23.827003},
+  {-35.348917, 38.578291, 51.704973, 4.418203, -2.855007, -23.825919},
+  {-35.240867, 38.437301, 51.485879, 4.399037, -2.850107, -23.824153},
+  {-35.132610, 38.296318, 51.267039, 4.379885, -2.845173, -23.821704},
+  {-35.024148, 38.155343, 51.048454, 4.360746, -2.840204, -23.818572},
+  {-34.915480, 38.014375, 50.830121, 4.341620, -2.835200, -23.814757},
+  {-34.806609, 37.873416, 50.612040, 4.322508, -2.830161, -23.810259},
+  {-34.697534, 37.732464, 50.394211, 4.303409, -2.825088, -23.805079},
+  {-34.588259, 37.591519, 50.176633, 4.284323, -2.819979, -23.799217},
+  {-34.478782, 37.450583, 49.959304, 4.265251, -2.814837, -23.792672},
+  {-34.369106, 37.309654, 49.742225, 4.246193, -2.809659, -23.785444},
+  {-34.259232, 37.168733, 49.525394, 4.227148, -2.804447, -23.777535},
+  {-34.149160, 37.027820, 49.308811, 4.208117, -2.799200, -23.768944},
+  {-34.038892, 36.886915, 49.092475, 4.189100, -2.793919, -23.759672},
+  {-33.928428, 36.746017, 48.876385, 4.170096, -2.788603, -23.749718},
+  {-33.817770, 36.605127, 48.660541, 4.151106, -2.783252, -23.739082},
+  {-33.706919, 36.464245, 48.444943, 4.132131, -2.777867, -23.727766},
+  {-33.595876, 36.323371, 48.229588, 4.113169, -2.772447, -23.715770},
+  {-33.484642, 36.182504, 48.014478, 4.094221, -2.766993, -23.703093},
+  {-33.373217, 36.041646, 47.799610, 4.075287, -2.761504, -23.689736},
+  {-33.261604, 35.900795, 47.584986, 4.056367, -2.755981, -23.675699},
+  {-33.149803, 35.759952, 47.370603, 4.037461, -2.750424, -23.660983},
+  {-33.037814, 35.619117, 47.156461, 4.018569, -2.744831, -23.645588},
+  {-32.925640, 35.478290, 46.942560, 3.999692, -2.739205, -23.629514},
+  {-32.813280, 35.337471, 46.728899, 3.980829, -2.733544, -23.612763},
+  {-32.700737, 35.196659, 46.515478, 3.961980, -2.727848, -23.595333},
+  {-32.588010, 35.055856, 46.302296, 3.943146, -2.722119, -23.577226},
+  {-32.475102, 34.915060, 46.089352, 3.924326, -2.716355, -23.558441},
+  {-32.362013, 34.774273, 45.876646, 3.905521, -2.710556, -23.538981},
+  {-32.248744, 34.633493, 45.664177, 3.886730, -2.704723, -23.518844},
+  {-32.135296, 34.492722, 45.451945, 3.867954, -2.698856, -23.498031},
+  {-32.021669, 34.351958, 45.239950, 3.849192, -2.692955, -23.476544},
+  {-31.907866, 34.211202, 45.028190, 3.830445, -2.687019, -23.454382},
+  {-31.793887, 34.070455, 44.816666, 3.811713, -2.681049, -23.431545},
+  {-31.679733, 33.929715, 44.605376, 3.792996, -2.675045, -23.408036},
+  {-31.565405, 33.788984, 44.394320, 3.774294, -2.669006, -23.383853},
+  {-31.450903, 33.648261, 44.183499, 3.755606, -2.662934, -23.358998},
+  {-31.336230, 33.507545, 43.972910, 3.736934, -2.656827, -23.333471},
+  {-31.221385, 33.366838, 43.762555, 3.718276, -2.650686, -23.307273},
+  {-31.106370, 33.226139, 43.552432, 3.699634, -2.644511, -23.280404},
+  {-30.991186, 33.085449, 43.342541, 3.681006, -2.638302, -23.252865},
+  {-30.875834, 32.944766, 43.132881, 3.662394, -2.632059, -23.224657},
+  {-30.760314, 32.804092, 42.923453, 3.643797, -2.625782, -23.195781},
+  {-30.644628, 32.663426, 42.714255, 3.625215, -2.619470, -23.166236},
+  {-30.528776, 32.522768, 42.505288, 3.606649, -2.613125, -23.136025},
+  {-30.412760, 32.382119, 42.296550, 3.588098, -2.606745, -23.105146},
+  {-30.296580, 32.241478, 42.088042, 3.569562, -2.600332, -23.073602},
+  {-30.180238, 32.100845, 41.879763, 3.551042, -2.593885, -23.041393},
+  {-30.063733, 31.960220, 41.671713, 3.532538, -2.587403, -23.008519},
+  {-29.947068, 31.819604, 41.463892, 3.514049, -2.580888, -22.974982},
+  {-29.830243, 31.678997, 41.256298, 3.495575, -2.574339, -22.940782},
+  {-29.713259, 31.538398, 41.048932, 3.477117, -2.567756, -22.905920},
+  {-29.596116, 31.397807, 40.841793, 3.458675, -2.561139, -22.870397},
+  {-29.478817, 31.257225, 40.634882, 3.440249, -2.554489, -22.834214},
+  {-29.361361, 31.116652, 40.428196, 3.421839, -2.547804, -22.797371},
+  {-29.243750, 30.976087, 40.221738, 3.403444, -2.541086, -22.759869},
+  {-29.125984, 30.835530, 40.015505, 3.385066, -2.534334, -22.721710},
+  {-29.008064, 30.694983, 39.809498, 3.366703, -2.527548, -22.682893},
+  {-28.889992, 30.554444, 39.603717, 3.348357, -2.520728, -22.643421},
+  {-28.771768, 30.413914, 39.398160, 3.330026, -2.513875, -22.603293},
+  {-28.653393, 30.273392, 39.192829, 3.311712, -2.506988, -22.562512},
+  {-28.534868, 30.132879, 38.987722, 3.293414, -2.500067, -22.521077},
+  {-28.416193, 29.992375, 38.782840, 3.275132, -2.493113, -22.478989},
+  {-28.297370, 29.851880, 38.578181, 3.256866, -2.486125, -22.436251},
+  {-28.178399, 29.711394, 38.373746, 3.238617, -2.479104, -22.392862},
+  {-28.059282, 29.570917, 38.169535, 3.220384, -2.472049, -22.348823},
+  {-27.940019, 29.430448, 37.965548, 3.202168, -2.464960, -22.304136},
+  {-27.820611, 29.289989, 37.761783, 3.183968, -2.457838, -22.258802},
+  {-27.701058, 29.149539, 37.558242, 3.165785, -2.450682, -22.212821},
+  {-27.581363, 29.009097, 37.354923, 3.147618, -2.443493, -22.166195},
+  {-27.461525, 28.868665, 37.151826, 3.129468, -2.436271, -22.118925},
+  {-27.341545, 28.728242, 36.948952, 3.111334, -2.429014, -22.071012},
+  {-27.221424, 28.587828, 36.746300, 3.093217, -2.421725, -22.022456},
+  {-27.101164, 28.447424, 36.543870, 3.075118, -2.414402, -21.973259},
+  {-26.980764, 28.307028, 36.341662, 3.057035, -2.407046, -21.923422},
+  {-26.860226, 28.166642, 36.139676, 3.038968, -2.399657, -21.872947},
+  {-26.739550, 28.026266, 35.937910, 3.020919, -2.392234, -21.821833},
+  {-26.618738, 27.885898, 35.736366, 3.002887, -2.384778, -21.770083},
+  {-26.497790, 27.745541, 35.535044, 2.984872, -2.377288, -21.717698},
+  {-26.376706, 27.605192, 35.333942, 2.966874, -2.369766, -21.664678},
+  {-26.255488, 27.464854, 35.133061, 2.948893, -2.362210, -21.611025},
+  {-26.134137, 27.324524, 34.932401, 2.930929, -2.354621, -21.556740},
+  {-26.012653, 27.184205, 34.731962, 2.912983, -2.346999, -21.501824},
+  {-25.891037, 27.043895, 34.531743, 2.895054, -2.339343, -21.446279},
+  {-25.769290, 26.903595, 34.331744, 2.877142, -2.331655, -21.390105},
+  {-25.647412, 26.763304, 34.131966, 2.859248, -2.323933, -21.333304},
+  {-25.525405, 26.623024, 33.932409, 2.841371, -2.316178, -21.275877},
+  {-25.403269, 26.482753, 33.733071, 2.823511, -2.308391, -21.217826},
+  {-25.281005, 26.342492, 33.533954, 2.805670, -2.300570, -21.159151},
+  {-25.158613, 26.202241, 33.335056, 2.787845, -2.292716, -21.099854},
+  {-25.036095, 26.062001, 33.136379, 2.770039, -2.284830, -21.039935},
+  {-24.913452, 25.921770, 32.937921, 2.752250, -2.276910, -20.979398},
+  {-24.790683, 25.781549, 32.739684, 2.734479, -2.268958, -20.918241},
+  {-24.667790, 25.641339, 32.541666, 2.716726, -2.260972, -20.856468},
+  {-24.544773, 25.501139, 32.343868, 2.698990, -2.252954, -20.794079},
+  {-24.421634, 25.360949, 32.146290, 2.681273, -2.244903, -20.731076},
+  {-24.298372, 25.220769, 31.948932, 2.663573, -2.236819, -20.667459},
+  {-24.174989, 25.080600, 31.751794, 2.645891, -2.228702, -20.603231},
+  {-24.051486, 24.940441, 31.554875, 2.628228, -2.220552, -20.538392},
+  {-23.927863, 24.800293, 31.358176, 2.610582, -2.212370, -20.472945},
+  {-23.804120, 24.660156, 31.161698, 2.592955, -2.204155, -20.406889},
+  {-23.680259, 24.520029, 30.965438, 2.575346, -2.195908, -20.340227},
+  {-23.556281, 24.379912, 30.769399, 2.557755, -2.187627, -20.272961},
+  {-23.432185, 24.239807, 30.573580, 2.540183, -2.179314, -20.205090},
+  {-23.307974, 24.099712, 30.377981, 2.522629, -2.170969, -20.136618},
+  {-23.183646, 23.959628, 30.182601, 2.505093, -2.162591, -20.067545},
+  {-23.059204, 23.819556, 29.987442, 2.487576, -2.154180, -19.997872},
+  {-22.934648, 23.679494, 29.792503, 2.470077, -2.145737, -19.927602},
+  {-22.809978, 23.539443, 29.597784, 2.452597, -2.137261, -19.856735},
+  {-22.685195, 23.399403, 29.403285, 2.435135, -2.128753, -19.785273},
+  {-22.560300, 23.259375, 29.209007, 2.417692, -2.120213, -19.713217},
+  {-22.435294, 23.119358, 29.014949, 2.400268, -2.111640, -19.640569},
+  {-22.310178, 22.979352, 28.821111, 2.382863, -2.103034, -19.567331},
+  {-22.184951, 22.839357, 28.627494, 2.365476, -2.094396, -19.493503},
+  {-22.059614, 22.699374, 28.434098, 2.348108, -2.085726, -19.419087},
+  {-21.934169, 22.559403, 28.240923, 2.330759, -2.077024, -19.344085},
+  {-21.808617, 22.419443, 28.047969, 2.313429, -2.068289, -19.268499},
+  {-21.682956, 22.279495, 27.855236, 2.296118, -2.059522, -19.192329},
+  {-21.557189, 22.139559, 27.662724, 2.278826, -2.050723, -19.115577},
+  {-21.431316, 21.999634, 27.470433, 2.261554, -2.041892, -19.038245},
+  {-21.305338, 21.859721, 27.278364, 2.244300, -2.033028, -18.960334},
+  {-21.179255, 21.719821, 27.086517, 2.227065, -2.024133, -18.881846},
+  {-21.053067, 21.579932, 26.894892, 2.209850, -2.015205, -18.802782},
+  {-20.926777, 21.440055, 26.703488, 2.192654, -2.006245, -18.723143},
+  {-20.800383, 21.300191, 26.512307, 2.175478, -1.997254, -18.642932},
+  {-20.673888, 21.160339, 26.321349, 2.158321, -1.988230, -18.562150},
+  {-20.547291, 21.020499, 26.130612, 2.141183, -1.979174, -18.480798},
+  {-20.420593, 20.880672, 25.940099, 2.124065, -1.970086, -18.398879},
+  {-20.293794, 20.740857, 25.749809, 2.106966, -1.960966, -18.316392},
+  {-20.166896, 20.601054, 25.559742, 2.089887, -1.951815, -18.233341},
+  {-20.039899, 20.461265, 25.369898, 2.072827, -1.942631, -18.149726},
+  {-19.912804, 20.321488, 25.180278, 2.055788, -1.933416, -18.065549},
+  {-19.785611, 20.181724, 24.990882, 2.038767, -1.924169, -17.980813},
+  {-19.658321, 20.041973, 24.801709, 2.021767, -1.914890, -17.895517},
+  {-19.530934, 19.902234, 24.612762, 2.004787, -1.905579, -17.809664},
+  {-19.403451, 19.762509, 24.424039, 1.987826, -1.896236, -17.723256},
+  {-19.275873, 19.622797, 24.235540, 1.970886, -1.886862, -17.636294},
+  {-19.148200, 19.483099, 24.047267, 1.953965, -1.877456, -17.548780},
+  {-19.020433, 19.343413, 23.859220, 1.937065, -1.868019, -17.460715},
+  {-18.892572, 19.203741, 23.671398, 1.920184, -1.858550, -17.372101},
+  {-18.764618, 19.064083, 23.483802, 1.903324, -1.849049, -17.282939},
+  {-18.636572, 18.924438, 23.296432, 1.886484, -1.839517, -17.193231},
+  {-18.508435, 18.784807, 23.109289, 1.869664, -1.829953, -17.102979},
+  {-18.380206, 18.645190, 22.922372, 1.852864, -1.820358, -17.012184},
+  {-18.251886, 18.505586, 22.735683, 1.836084, -1.810732, -16.920849},
+  {-18.123476, 18.365996, 22.549221, 1.819326, -1.801073, -16.828974},
+  {-17.994977, 18.226421, 22.362987, 1.802587, -1.791384, -16.736561},
+  {-17.866389, 18.086860, 22.176982, 1.785869, -1.781663, -16.643611},
+  {-17.737712, 17.947312, 21.991204, 1.769171, -1.771911, -16.550128},
+  {-17.608947, 17.807780, 21.805656, 1.752494, -1.762128, -16.456111},
+  {-17.480096, 17.668261, 21.620337, 1.735838, -1.752313, -16.361563},
+  {-17.351157, 17.528757, 21.435247, 1.719202, -1.742467, -16.266485},
+  {-17.222133, 17.389268, 21.250387, 1.702587, -1.732590, -16.170880},
+  {-17.093023, 17.249794, 21.065758, 1.685993, -1.722681, -16.074748},
+  {-16.963828, 17.110334, 20.881359, 1.669419, -1.712742, -15.978091},
+  {-16.834548, 16.970889, 20.697191, 1.652867, -1.702771, -15.880911},
+  {-16.705184, 16.831460, 20.513255, 1.636335, -1.692770, -15.783210},
+  {-16.575737, 16.692045, 20.329550, 1.619824, -1.682737, -15.684989},
+  {-16.446207, 16.552646, 20.146078, 1.603334, -1.672673, -15.586249},
+  {-16.316595, 16.413262, 19.962839, 1.586866, -1.662578, -15.486994},
+  {-16.186901, 16.273893, 19.779832, 1.570418, -1.652453, -15.387223},
+  {-16.057125, 16.134540, 19.597059, 1.553992, -1.642296, -15.286939},
+  {-15.927269, 15.995203, 19.414520, 1.537586, -1.632109, -15.186144},
+  {-15.797332, 15.855881, 19.232215, 1.521202, -1.621890, -15.084839},
+  {-15.667316, 15.716576, 19.050145, 1.504839, -1.611641, -14.983025},
+  {-15.537221, 15.577286, 18.868310, 1.488498, -1.601361, -14.880705},
+  {-15.407046, 15.438012, 18.686711, 1.472178, -1.591050, -14.777880},
+  {-15.276794, 15.298755, 18.505348, 1.455879, -1.580709, -14.674552},
+  {-15.146464, 15.159514, 18.324222, 1.439602, -1.570337, -14.570723},
+  {-15.016056, 15.020289, 18.143333, 1.423346, -1.559934, -14.466393},
+  {-14.885572, 14.881081, 17.962682, 1.407112, -1.549500, -14.361565},
+  {-14.755012, 14.741890, 17.782268, 1.390900, -1.539036, -14.256240},
+  {-14.624376, 14.602715, 17.602094, 1.374709, -1.528542, -14.150421},
+  {-14.493665, 14.463557, 17.422158, 1.358540, -1.518017, -14.044108},
+  {-14.362879, 14.324417, 17.242462, 1.342393, -1.507461, -13.937303},
+  {-14.232018, 14.185293, 17.063006, 1.326267, -1.496875, -13.830009},
+  {-14.101084, 14.046187, 16.883791, 1.310164, -1.486258, -13.722226},
+  {-13.970077, 13.907098, 16.704817, 1.294082, -1.475612, -13.613957},
+  {-13.838997, 13.768026, 16.526085, 1.278022, -1.464934, -13.505202},
+  {-13.707844, 13.628972, 16.347595, 1.261984, -1.454227, -13.395964},
+  {-13.576620, 13.489936, 16.169347, 1.245968, -1.443489, -13.286245},
+  {-13.445324, 13.350918, 15.991344, 1.229975, -1.432721, -13.176045},
+  {-13.313958, 13.211918, 15.813584, 1.214003, -1.421922, -13.065367},
+  {-13.182520, 13.072936, 15.636069, 1.198054, -1.411094, -12.954212},
+  {-13.051013, 12.933972, 15.458798, 1.182127, -1.400235, -12.842582},
+  {-12.919437, 12.795026, 15.281774, 1.166222, -1.389346, -12.730479},
+  {-12.787791, 12.656099, 15.104996, 1.150339, -1.378427, -12.617904},
+  {-12.656076, 12.517191, 14.928464, 1.134479, -1.367478, -12.504858},
+  {-12.524294, 12.378301, 14.752180, 1.118641, -1.356499, -12.391345},
+  {-12.392443, 12.239431, 14.576145, 1.102826, -1.345490, -12.277364},
+  {-12.260526, 12.100579, 14.400357, 1.087033, -1.334451, -12.162918},
+  {-12.128541, 11.961747, 14.224820, 1.071263, -1.323382, -12.048008},
+  {-11.996491, 11.822934, 14.049532, 1.055515, -1.312283, -11.932637},
+  {-11.864374, 11.684140, 13.874495, 1.039790, -1.301155, -11.816805},
+  {-11.732191, 11.545366, 13.699709, 1.024088, -1.289996, -11.700515},
+  {-11.599944, 11.406611, 13.525175, 1.008408, -1.278808, -11.583767},
+  {-11.467632, 11.267877, 13.350893, 0.992752, -1.267590, -11.466564},
+  {-11.335255, 11.129163, 13.176865, 0.977118, -1.256343, -11.348907},
+  {-11.202815, 10.990468, 13.003091, 0.961507, -1.245065, -11.230798},
+  {-11.070312, 10.851794, 12.829571, 0.945918, -1.233758, -11.112239},
+  {-10.937745, 10.713141, 12.656307, 0.930353, -1.222422, -10.993230},
+  {-10.805116, 10.574508, 12.483298, 0.914811, -1.211056, -10.873775},
+  {-10.672425, 10.435895, 12.310546, 0.899292, -1.199660, -10.753873},
+  {-10.539672, 10.297304, 12.138052, 0.883796, -1.188235, -10.633528},
+  {-10.406858, 10.158734, 11.965816, 0.868323, -1.176780, -10.512740},
+  {-10.273982, 10.020185, 11.793838, 0.852874, -1.165296, -10.391511},
+  {-10.141047, 9.881657, 11.622120, 0.837447, -1.153783, -10.269843},
+  {-10.008051, 9.743150, 11.450662, 0.822044, -1.142240, -10.147737},
+  {-9.874995, 9.604666, 11.279465, 0.806664, -1.130668, -10.025195},
+  {-9.741881, 9.466203, 11.108530, 0.791308, -1.119066, -9.902218},
+  {-9.608707, 9.327762, 10.937858, 0.775975, -1.107436, -9.778809},
+  {-9.475475, 9.189343, 10.767448, 0.760666, -1.095776, -9.654968},
+  {-9.342185, 9.050947, 10.597303, 0.745380, -1.084087, -9.530698},
+  {-9.208837, 8.912572, 10.427423, 0.730117, -1.072369, -9.405999},
+  {-9.075431, 8.774221, 10.257808, 0.714879, -1.060622, -9.280874},
+  {-8.941969, 8.635892, 10.088459, 0.699663, -1.048845, -9.155324},
+  {-8.808450, 8.497586, 9.919378, 0.684472, -1.037040, -9.029351},
+  {-8.674875, 8.359303, 9.750565, 0.669304, -1.025206, -8.902955},
+  {-8.541244, 8.221044, 9.582020, 0.654161, -1.013343, -8.776139},
+  {-8.407558, 8.082808, 9.413745, 0.639040, -1.001450, -8.648905},
+  {-8.273817, 7.944595, 9.245740, 0.623944, -0.989529, -8.521253},
+  {-8.140021, 7.806406, 9.078007, 0.608872, -0.977579, -8.393186},
+  {-8.006170, 7.668242, 8.910545, 0.593824, -0.965601, -8.264704},
+  {-7.872266, 7.530101, 8.743357, 0.578800, -0.953593, -8.135810},
+  {-7.738308, 7.391984, 8.576442, 0.563799, -0.941557, -8.006505},
+  {-7.604297, 7.253892, 8.409802, 0.548823, -0.929492, -7.876790},
+  {-7.470233, 7.115825, 8.243438, 0.533871, -0.917399, -7.746668},
+  {-7.336117, 6.977782, 8.077349, 0.518944, -0.905277, -7.616138},
+  {-7.201948, 6.839764, 7.911538, 0.504040, -0.893126, -7.485204},
+  {-7.067728, 6.701772, 7.746005, 0.489161, -0.880947, -7.353867},
+  {-6.933456, 6.563805, 7.580751, 0.474306, -0.868739, -7.222128},
+  {-6.799133, 6.425863, 7.415777, 0.459476, -0.856503, -7.089988},
+  {-6.664759, 6.287947, 7.251084, 0.444670, -0.844238, -6.957449},
+  {-6.530335, 6.150057, 7.086672, 0.429888, -0.831945, -6.824513},
+  {-6.395861, 6.012193, 6.922543, 0.415131, -0.819624, -6.691181},
+  {-6.261337, 5.874355, 6.758698, 0.400398, -0.807274, -6.557455},
+  {-6.126763, 5.736543, 6.595137, 0.385690, -0.794896, -6.423335},
+  {-5.992141, 5.598759, 6.431861, 0.371007, -0.782490, -6.288824},
+  {-5.857470, 5.461001, 6.268872, 0.356348, -0.770056, -6.153924},
+  {-5.722751, 5.323270, 6.106170, 0.341714, -0.757593, -6.018634},
+  {-5.587983, 5.185566, 5.943756, 0.327105, -0.745102, -5.882958},
+  {-5.453168, 5.047890, 5.781632, 0.312521, -0.732584, -5.746896},
+  {-5.318305, 4.910241, 5.619797, 0.297961, -0.720037, -5.610449},
+  {-5.183396, 4.772620, 5.458254, 0.283427, -0.707462, -5.473620},
+  {-5.048439, 4.635027, 5.297003, 0.268917, -0.694859, -5.336410},
+  {-4.913436, 4.497462, 5.136045, 0.254433, -0.682229, -5.198820},
+  {-4.778388, 4.359926, 4.975381, 0.239973, -0.669570, -5.060851},
+  {-4.643293, 4.222418, 4.815012, 0.225538, -0.656884, -4.922506},
+  {-4.508153, 4.084939, 4.654940, 0.211129, -0.644169, -4.783785},
+  {-4.372967, 3.947489, 4.495164, 0.196745, -0.631427, -4.644689},
+  {-4.237737, 3.810068, 4.335687, 0.182386, -0.618658, -4.505221},
+  {-4.102462, 3.672677, 4.176509, 0.168052, -0.605860, -4.365382},
+  {-3.967143, 3.535315, 4.017631, 0.153743, -0.593035, -4.225173},
+  {-3.831780, 3.397984, 3.859055, 0.139460, -0.580183, -4.084595},
+  {-3.696374, 3.260682, 3.700780, 0.125202, -0.567302, -3.943650},
+  {-3.560924, 3.123410, 3.542810, 0.110970, -0.554395, -3.802339},
+  {-3.425431, 2.986169, 3.385143, 0.096763, -0.541459, -3.660664},
+  {-3.289895, 2.848959, 3.227782, 0.082582, -0.528497, -3.518625},
+  {-3.154317, 2.711780, 3.070728, 0.068426, -0.515506, -3.376225},
+  {-3.018697, 2.574631, 2.913982, 0.054296, -0.502489, -3.233465},
+  {-2.883035, 2.437515, 2.757544, 0.040191, -0.489444, -3.090346},
+  {-2.747332, 2.300429, 2.601416, 0.026112, -0.476372, -2.946869},
+  {-2.611587, 2.163376, 2.445599, 0.012059, -0.463273, -2.803036},
+  {-2.475801, 2.026354, 2.290094, -0.001969, -0.450146, -2.658848},
+  {-2.339974, 1.889365, 2.134902, -0.015970, -0.436992, -2.514306},
+  {-2.204107, 1.752409, 1.980025, -0.029946, -0.423811, -2.369412},
+  {-2.068200, 1.615485, 1.825463, -0.043896, -0.410603, -2.224167},
+  {-1.932253, 1.478594, 1.671218, -0.057820, -0.397368, -2.078573},
+  {-1.796267, 1.341736, 1.517290, -0.071718, -0.384106, -1.932630},
+  {-1.660241, 1.204912, 1.363681, -0.085590, -0.370817, -1.786340},
+  {-1.524176, 1.068121, 1.210393, -0.099436, -0.357501, -1.639704},
+  {-1.388072, 0.931364, 1.057425, -0.113256, -0.344158, -1.492724},
+  {-1.251930, 0.794642, 0.904780, -0.127049, -0.330789, -1.345401},
+  {-1.115750, 0.657954, 0.752458, -0.140817, -0.317392, -1.197736},
+  {-0.979531, 0.521300, 0.600461, -0.154558, -0.303969, -1.049730},
+  {-0.843275, 0.384681, 0.448790, -0.168273, -0.290519, -0.901384},
+  {-0.706982, 0.248098, 0.297446, -0.181962, -0.277042, -0.752701},
+  {-0.570651, 0.111550, 0.146431, -0.195624, -0.263539, -0.603681},
+  {-0.434284, -0.024963, -0.004255, -0.209260, -0.250009, -0.454325},
+  {-0.297880, -0.161439, -0.154611, -0.222869, -0.236452, -0.304634},
+  {-0.161439, -0.297880, -0.304634, -0.236452, -0.222869, -0.154611},
+  {-0.024963, -0.434284, -0.454325, -0.250009, -0.209260, -0.004255},
+  {0.111550, -0.570651, -0.603681, -0.263539, -0.195624, 0.146431},
+  {0.248098, -0.706982, -0.752701, -0.277042, -0.181962, 0.297446},
+  {0.384681, -0.843275, -0.901384, -0.290519, -0.168273, 0.448790},
+  {0.521300, -0.979531, -1.049730, -0.303969, -0.154558, 0.600461},
+  {0.657954, -1.115750, -1.197736, -0.317392, -0.140817, 0.752458},
+  {0.794642, -1.251930, -1.345401, -0.330789, -0.127049, 0.904780},
+  {0.931364, -1.388072, -1.492724, -0.344158, -0.113256, 1.057425},
+  {1.068121, -1.524176, -1.639704, -0.357501, -0.099436, 1.210393},
+  {1.204912, -1.660241, -1.786340, -0.370817, -0.085590, 1.363681},
+  {1.341736, -1.796267, -1.932630, -0.384106, -0.071718, 1.517290},
+  {1.478594, -1.932253, -2.078573, -0.397368, -0.057820, 1.671218},
+  {1.615485, -2.068200, -2.224167, -0.410603, -0.043896, 1.825463},
+  {1.752409, -2.204107, -2.369412, -0.423811, -0.029946, 1.980025},
+  {1.889365, -2.339974, -2.514306, -0.436992, -0.015970, 2.134902},
+  {2.026354, -2.475801, -2.658848, -0.450146, -0.001969, 2.290094},
+  {2.163376, -2.611587, -2.803036, -0.463273, 0.012059, 2.445599},
+  {2.300429, -2.747332, -2.946869, -0.476372, 0.026112, 2.601416},
+  {2.437515, -2.883035, -3.090346, -0.489444, 0.040191, 2.757544},
+  {2.574631, -3.018697, -3.233465, -0.502489, 0.054296, 2.913982},
+  {2.711780, -3.154317, -3.376225, -0.515506, 0.068426, 3.070728},
+  {2.848959, -3.289895, -3.518625, -0.528497, 0.082582, 3.227782},
+  {2.986169, -3.425431, -3.660664, -0.541459, 0.096763, 3.385143},
+  {3.123410, -3.560924, -3.802339, -0.554395, 0.110970, 3.542810},
+  {3.260682, -3.696374, -3.943650, -0.567302, 0.125202, 3.700780},
+  {3.397984, -3.831780, -4.084595, -0.580183, 0.139460, 3.859055},
+  {3.535315, -3.967143, -4.225173, -0.593035, 0.153743, 4.017631},
+  {3.672677, -4.102462, -4.365382, -0.605860, 0.168052, 4.176509},
+  {3.810068, -4.237737, -4.505221, -0.618658, 0.182386, 4.335687},
+  {3.947489, -4.372967, -4.644689, -0.631427, 0.196745, 4.495164},
+  {4.084939, -4.508153, -4.783785, -0.644169, 0.211129, 4.654940},
+  {4.222418, -4.643293, -4.922506, -0.656884, 0.225538, 4.815012},
+  {4.359926, -4.778388, -5.060851, -0.669570, 0.239973, 4.975381},
+  {4.497462, -4.913436, -5.198820, -0.682229, 0.254433, 5.136045},
+  {4.635027, -5.048439, -5.336410, -0.694859, 0.268917, 5.297003},
+  {4.772620, -5.183396, -5.473620, -0.707462, 0.283427, 5.458254},
+  {4.910241, -5.318305, -5.610449, -0.720037, 0.297961, 5.619797},
+  {5.047890, -5.453168, -5.746896, -0.732584, 0.312521, 5.781632},
+  {5.185566, -5.587983, -5.882958, -0.745102, 0.327105, 5.943756},
+  {5.323270, -5.722751, -6.018634, -0.757593, 0.341714, 6.106170},
+  {5.461001, -5.857470, -6.153924, -0.770056, 0.356348, 6.268872},
+  {5.598759, -5.992141, -6.288824, -0.782490, 0.371007, 6.431861},
+  {5.736543, -6.126763, -6.423335, -0.794896, 0.385690, 6.595137},
+  {5.874355, -6.261337, -6.557455, -0.807274, 0.400398, 6.758698},
+  {6.012193, -6.395861, -6.691181, -0.819624, 0.415131, 6.922543},
+  {6.150057, -6.530335, -6.824513, -0.831945, 0.429888, 7.086672},
+  {6.287947, -6.664759, -6.957449, -0.844238, 0.444670, 7.251084},
+  {6.425863, -6.799133, -7.089988, -0.856503, 0.459476, 7.415777},
+  {6.563805, -6.933456, -7.222128, -0.868739, 0.474306, 7.580751},
+  {6.701772, -7.067728, -7.353867, -0.880947, 0.489161, 7.746005},
+  {6.839764, -7.201948, -7.485204, -0.893126, 0.504040, 7.911538},
+  {6.977782, -7.336117, -7.616138, -0.905277, 0.518944, 8.077349},
+  {7.115825, -7.470233, -7.746668, -0.917399, 0.533871, 8.243438},
+  {7.253892, -7.604297, -7.876790, -0.929492, 0.548823, 8.409802},
+  {7.391984, -7.738308, -8.006505, -0.941557, 0.563799, 8.576442},
+  {7.530101, -7.872266, -8.135810, -0.953593, 0.578800, 8.743357},
+  {7.668242, -8.006170, -8.264704, -0.965601, 0.593824, 8.910545},
+  {7.806406, -8.140021, -8.393186, -0.977579, 0.608872, 9.078007},
+  {7.944595, -8.273817, -8.521253, -0.989529, 0.623944, 9.245740},
+  {8.082808, -8.407558, -8.648905, -1.001450, 0.639040, 9.413745},
+  {8.221044, -8.541244, -8.776139, -1.013343, 0.654161, 9.582020},
+  {8.359303, -8.674875, -8.902955, -1.025206, 0.669304, 9.750565},
+  {8.497586, -8.808450, -9.029351, -1.037040, 0.684472, 9.919378},
+  {8.635892, -8.941969, -9.155324, -1.048845, 0.699663, 10.088459},
+  {8.774221, -9.075431, -9.280874, -1.060622, 0.714879, 10.257808},
+  {8.912572, -9.208837, -9.405999, -1.072369, 0.730117, 10.427423},
+  {9.050947, -9.342185, -9.530698, -1.084087, 0.745380, 10.597303},
+  {9.189343, -9.475475, -9.654968, -1.095776, 0.760666, 10.767448},
+  {9.327762, -9.608707, -9.778809, -1.107436, 0.775975, 10.937858},
+  {9.466203, -9.741881, -9.902218, -1.119066, 0.791308, 11.108530},
+  {9.604666, -9.874995, -10.025195, -1.130668, 0.806664, 11.279465},
+  {9.743150, -10.008051, -10.147737, -1.142240, 0.822044, 11.450662},
+  {9.881657, -10.141047, -10.269843, -1.153783, 0.837447, 11.622120},
+  {10.020185, -10.273982, -10.391511, -1.165296, 0.852874, 11.793838},
+  {10.158734, -10.406858, -10.512740, -1.176780, 0.868323, 11.965816},
+  {10.297304, -10.539672, -10.633528, -1.188235, 0.883796, 12.138052},
+  {10.435895, -10.672425, -10.753873, -1.199660, 0.899292, 12.310546},
+  {10.574508, -10.805116, -10.873775, -1.211056, 0.914811, 12.483298},
+  {10.713141, -10.937745, -10.993230, -1.222422, 0.930353, 12.656307},
+  {10.851794, -11.070312, -11.112239, -1.233758, 0.945918, 12.829571},
+  {10.990468, -11.202815, -11.230798, -1.245065, 0.961507, 13.003091},
+  {11.129163, -11.335255, -11.348907, -1.256343, 0.977118, 13.176865},
+  {11.267877, -11.467632, -11.466564, -1.267590, 0.992752, 13.350893},
+  {11.406611, -11.599944, -11.583767, -1.278808, 1.008408, 13.525175},
+  {11.545366, -11.732191, -11.700515, -1.289996, 1.024088, 13.699709},
+  {11.684140, -11.864374, -11.816805, -1.301155, 1.039790, 13.874495},
+  {11.822934, -11.996491, -11.932637, -1.312283, 1.055515, 14.049532},
+  {11.961747, -12.128541, -12.048008, -1.323382, 1.071263, 14.224820},
+  {12.100579, -12.260526, -12.162918, -1.334451, 1.087033, 14.400357},
+  {12.239431, -12.392443, -12.277364, -1.345490, 1.102826, 14.576145},
+  {12.378301, -12.524294, -12.391345, -1.356499, 1.118641, 14.752180},
+  {12.517191, -12.656076, -12.504858, -1.367478, 1.134479, 14.928464},
+  {12.656099, -12.787791, -12.617904, -1.378427, 1.150339, 15.104996},
+  {12.795026, -12.919437, -12.730479, -1.389346, 1.166222, 15.281774},
+  {12.933972, -13.051013, -12.842582, -1.400235, 1.182127, 15.458798},
+  {13.072936, -13.182520, -12.954212, -1.411094, 1.198054, 15.636069},
+  {13.211918, -13.313958, -13.065367, -1.421922, 1.214003, 15.813584},
+  {13.350918, -13.445324, -13.176045, -1.432721, 1.229975, 15.991344},
+  {13.489936, -13.576620, -13.286245, -1.443489, 1.245968, 16.169347},
+  {13.628972, -13.707844, -13.395964, -1.454227, 1.261984, 16.347595},
+  {13.768026, -13.838997, -13.505202, -1.464934, 1.278022, 16.526085},
+  {13.907098, -13.970077, -13.613957, -1.475612, 1.294082, 16.704817},
+  {14.046187, -14.101084, -13.722226, -1.486258, 1.310164, 16.883791},
+  {14.185293, -14.232018, -13.830009, -1.496875, 1.326267, 17.063006},
+  {14.324417, -14.362879, -13.937303, -1.507461, 1.342393, 17.242462},
+  {14.463557, -14.493665, -14.044108, -1.518017, 1.358540, 17.422158},
+  {14.602715, -14.624376, -14.150421, -1.528542, 1.374709, 17.602094},
+  {14.741890, -14.755012, -14.256240, -1.539036, 1.390900, 17.782268},
+  {14.881081, -14.885572, -14.361565, -1.549500, 1.407112, 17.962682},
+  {15.020289, -15.016056, -14.466393, -1.559934, 1.423346, 18.143333},
+  {15.159514, -15.146464, -14.570723, -1.570337, 1.439602, 18.324222},
+  {15.298755, -15.276794, -14.674552, -1.580709, 1.455879, 18.505348},
+  {15.438012, -15.407046, -14.777880, -1.591050, 1.472178, 18.686711},
+  {15.577286, -15.537221, -14.880705, -1.601361, 1.488498, 18.868310},
+  {15.716576, -15.667316, -14.983025, -1.611641, 1.504839, 19.050145},
+  {15.855881, -15.797332, -15.084839, -1.621890, 1.521202, 19.232215},
+  {15.995203, -15.927269, -15.186144, -1.632109, 1.537586, 19.414520},
+  {16.134540, -16.057125, -15.286939, -1.642296, 1.553992, 19.597059},
+  {16.273893, -16.186901, -15.387223, -1.652453, 1.570418, 19.779832},
+  {16.413262, -16.316595, -15.486994, -1.662578, 1.586866, 19.962839},
+  {16.552646, -16.446207, -15.586249, -1.672673, 1.603334, 20.146078},
+  {16.692045, -16.575737, -15.684989, -1.682737, 1.619824, 20.329550},
+  {16.831460, -16.705184, -15.783210, -1.692770, 1.636335, 20.513255},
+  {16.970889, -16.834548, -15.880911, -1.702771, 1.652867, 20.697191},
+  {17.110334, -16.963828, -15.978091, -1.712742, 1.669419, 20.881359},
+  {17.249794, -17.093023, -16.074748, -1.722681, 1.685993, 21.065758},
+  {17.389268, -17.222133, -16.170880, -1.732590, 1.702587, 21.250387},
+  {17.528757, -17.351157, -16.266485, -1.742467, 1.719202, 21.435247},
+  {17.668261, -17.480096, -16.361563, -1.752313, 1.735838, 21.620337},
+  {17.807780, -17.608947, -16.456111, -1.762128, 1.752494, 21.805656},
+  {17.947312, -17.737712, -16.550128, -1.771911, 1.769171, 21.991204},
+  {18.086860, -17.866389, -16.643611, -1.781663, 1.785869, 22.176982},
+  {18.226421, -17.994977, -16.736561, -1.791384, 1.802587, 22.362987},
+  {18.365996, -18.123476, -16.828974, -1.801073, 1.819326, 22.549221},
+  {18.505586, -18.251886, -16.920849, -1.810732, 1.836084, 22.735683},
+  {18.645190, -18.380206, -17.012184, -1.820358, 1.852864, 22.922372},
+  {18.784807, -18.508435, -17.102979, -1.829953, 1.869664, 23.109289},
+  {18.924438, -18.636572, -17.193231, -1.839517, 1.886484, 23.296432},
+  {19.064083, -18.764618, -17.282939, -1.849049, 1.903324, 23.483802},
+  {19.203741, -18.892572, -17.372101, -1.858550, 1.920184, 23.671398},
+  {19.343413, -19.020433, -17.460715, -1.868019, 1.937065, 23.859220},
+  {19.483099, -19.148200, -17.548780, -1.877456, 1.953965, 24.047267},
+  {19.622797, -19.275873, -17.636294, -1.886862, 1.970886, 24.235540},
+  {19.762509, -19.403451, -17.723256, -1.896236, 1.987826, 24.424039},
+  {19.902234, -19.530934, -17.809664, -1.905579, 2.004787, 24.612762},
+  {20.041973, -19.658321, -17.895517, -1.914890, 2.021767, 24.801709},
+  {20.181724, -19.785611, -17.980813, -1.924169, 2.038767, 24.990882},
+  {20.321488, -19.912804, -18.065549, -1.933416, 2.055788, 25.180278},
+  {20.461265, -20.039899, -18.149726, -1.942631, 2.072827, 25.369898},
+  {20.601054, -20.166896, -18.233341, -1.951815, 2.089887, 25.559742},
+  {20.740857, -20.293794, -18.316392, -1.960966, 2.106966, 25.749809},
+  {20.880672, -20.420593, -18.398879, -1.970086, 2.124065, 25.940099},
+  {21.020499, -20.547291, -18.480798, -1.979174, 2.141183, 26.130612},
+  {21.160339, -20.673888, -18.562150, -1.988230, 2.158321, 26.321349},
+  {21.300191, -20.800383, -18.642932, -1.997254, 2.175478, 26.512307},
+  {21.440055, -20.926777, -18.723143, -2.006245, 2.192654, 26.703488},
+  {21.579932, -21.053067, -18.802782, -2.015205, 2.209850, 26.894892},
+  {21.719821, -21.179255, -18.881846, -2.024133, 2.227065, 27.086517},
+  {21.859721, -21.305338, -18.960334, -2.033028, 2.244300, 27.278364},
+  {21.999634, -21.431316, -19.038245, -2.041892, 2.261554, 27.470433},
+  {22.139559, -21.557189, -19.115577, -2.050723, 2.278826, 27.662724},
+  {22.279495, -21.682956, -19.192329, -2.059522, 2.296118, 27.855236},
+  {22.419443, -21.808617, -19.268499, -2.068289, 2.313429, 28.047969},
+  {22.559403, -21.934169, -19.344085, -2.077024, 2.330759, 28.240923},
+  {22.699374, -22.059614, -19.419087, -2.085726, 2.348108, 28.434098},
+  {22.839357, -22.184951, -19.493503, -2.094396, 2.365476, 28.627494},
+  {22.979352, -22.310178, -19.567331, -2.103034, 2.382863, 28.821111},
+  {23.119358, -22.435294, -19.640569, -2.111640, 2.400268, 29.014949},
+  {23.259375, -22.560300, -19.713217, -2.120213, 2.417692, 29.209007},
+  {23.399403, -22.685195, -19.785273, -2.128753, 2.435135, 29.403285},
+  {23.539443, -22.809978, -19.856735, -2.137261, 2.452597, 29.597784},
+  {23.679494, -22.934648, -19.927602, -2.145737, 2.470077, 29.792503},
+  {23.819556, -23.059204, -19.997872, -2.154180, 2.487576, 29.987442},
+  {23.959628, -23.183646, -20.067545, -2.162591, 2.505093, 30.182601},
+  {24.099712, -23.307974, -20.136618, -2.170969, 2.522629, 30.377981},
+  {24.239807, -23.432185, -20.205090, -2.179314, 2.540183, 30.573580},
+  {24.379912, -23.556281, -20.272961, -2.187627, 2.557755, 30.769399},
+  {24.520029, -23.680259, -20.340227, -2.195908, 2.575346, 30.965438},
+  {24.660156, -23.804120, -20.406889, -2.204155, 2.592955, 31.161698},
+  {24.800293, -23.927863, -20.472945, -2.212370, 2.610582, 31.358176},
+  {24.940441, -24.051486, -20.538392, -2.220552, 2.628228, 31.554875},
+  {25.080600, -24.174989, -20.603231, -2.228702, 2.645891, 31.751794},
+  {25.220769, -24.298372, -20.667459, -2.236819, 2.663573, 31.948932},
+  {25.360949, -24.421634, -20.731076, -2.244903, 2.681273, 32.146290},
+  {25.501139, -24.544773, -20.794079, -2.252954, 2.698990, 32.343868},
+  {25.641339, -24.667790, -20.856468, -2.260972, 2.716726, 32.541666},
+  {25.781549, -24.790683, -20.918241, -2.268958, 2.734479, 32.739684},
+  {25.921770, -24.913452, -20.979398, -2.276910, 2.752250, 32.937921},
+  {26.062001, -25.036095, -21.039935, -2.284830, 2.770039, 33.136379},
+  {26.202241, -25.158613, -21.099854, -2.292716, 2.787845, 33.335056},
+  {26.342492, -25.281005, -21.159151, -2.300570, 2.805670, 33.533954},
+  {26.482753, -25.403269, -21.217826, -2.308391, 2.823511, 33.733071},
+  {26.623024, -25.525405, -21.275877, -2.316178, 2.841371, 33.932409},
+  {26.763304, -25.647412, -21.333304, -2.323933, 2.859248, 34.131966},
+  {26.903595, -25.769290, -21.390105, -2.331655, 2.877142, 34.331744},
+  {27.043895, -25.891037, -21.446279, -2.339343, 2.895054, 34.531743},
+  {27.184205, -26.012653, -21.501824, -2.346999, 2.912983, 34.731962},
+  {27.324524, -26.134137, -21.556740, -2.354621, 2.930929, 34.932401},
+  {27.464854, -26.255488, -21.611025, -2.362210, 2.948893, 35.133061},
+  {27.605192, -26.376706, -21.664678, -2.369766, 2.966874, 35.333942},
+  {27.745541, -26.497790, -21.717698, -2.377288, 2.984872, 35.535044},
+  {27.885898, -26.618738, -21.770083, -2.384778, 3.002887, 35.736366},
+  {28.026266, -26.739550, -21.821833, -2.392234, 3.020919, 35.937910},
+  {28.166642, -26.860226, -21.872947, -2.399657, 3.038968, 36.139676},
+  {28.307028, -26.980764, -21.923422, -2.407046, 3.057035, 36.341662},
+  {28.447424, -27.101164, -21.973259, -2.414402, 3.075118, 36.543870},
+  {28.587828, -27.221424, -22.022456, -2.421725, 3.093217, 36.746300},
+  {28.728242, -27.341545, -22.071012, -2.429014, 3.111334, 36.948952},
+  {28.868665, -27.461525, -22.118925, -2.436271, 3.129468, 37.151826},
+  {29.009097, -27.581363, -22.166195, -2.443493, 3.147618, 37.354923},
+  {29.149539, -27.701058, -22.212821, -2.450682, 3.165785, 37.558242},
+  {29.289989, -27.820611, -22.258802, -2.457838, 3.183968, 37.761783},
+  {29.430448, -27.940019, -22.304136, -2.464960, 3.202168, 37.965548},
+  {29.570917, -28.059282, -22.348823, -2.472049, 3.220384, 38.169535},
+  {29.711394, -28.178399, -22.392862, -2.479104, 3.238617, 38.373746},
+  {29.851880, -28.297370, -22.436251, -2.486125, 3.256866, 38.578181},
+  {29.992375, -28.416193, -22.478989, -2.493113, 3.275132, 38.782840},
+  {30.132879, -28.534868, -22.521077, -2.500067, 3.293414, 38.987722},
+  {30.273392, -28.653393, -22.562512, -2.506988, 3.311712, 39.192829},
+  {30.413914, -28.771768, -22.603293, -2.513875, 3.330026, 39.398160},
+  {30.554444, -28.889992, -22.643421, -2.520728, 3.348357, 39.603717},
+  {30.694983, -29.008064, -22.682893, -2.527548, 3.366703, 39.809498},
+  {30.835530, -29.125984, -22.721710, -2.534334, 3.385066, 40.015505},
+  {30.976087, -29.243750, -22.759869, -2.541086, 3.403444, 40.221738},
+  {31.116652, -29.361361, -22.797371, -2.547804, 3.421839, 40.428196},
+  {31.257225, -29.478817, -22.834214, -2.554489, 3.440249, 40.634882},
+  {31.397807, -29.596116, -22.870397, -2.561139, 3.458675, 40.841793},
+  {31.538398, -29.713259, -22.905920, -2.567756, 3.477117, 41.048932},
+  {31.678997, -29.830243, -22.940782, -2.574339, 3.495575, 41.256298},
+  {31.819604, -29.947068, -22.974982, -2.580888, 3.514049, 41.463892},
+  {31.960220, -30.063733, -23.008519, -2.587403, 3.532538, 41.671713},
+  {32.100845, -30.180238, -23.041393, -2.593885, 3.551042, 41.879763},
+  {32.241478, -30.296580, -23.073602, -2.600332, 3.569562, 42.088042},
+  {32.382119, -30.412760, -23.105146, -2.606745, 3.588098, 42.296550},
+  {32.522768, -30.528776, -23.136025, -2.613125, 3.606649, 42.505288},
+  {32.663426, -30.644628, -23.166236, -2.619470, 3.625215, 42.714255},
+  {32.804092, -30.760314, -23.195781, -2.625782, 3.643797, 42.923453},
+  {32.944766, -30.875834, -23.224657, -2.632059, 3.662394, 43.132881},
+  {33.085449, -30.991186, -23.252865, -2.638302, 3.681006, 43.342541},
+  {33.226139, -31.106370, -23.280404, -2.644511, 3.699634, 43.552432},
+  {33.366838, -31.221385, -23.307273, -2.650686, 3.718276, 43.762555},
+  {33.507545, -31.336230, -23.333471, -2.656827, 3.736934, 43.972910},
+  {33.648261, -31.450903, -23.358998, -2.662934, 3.755606, 44.183499},
+  {33.788984, -31.565405, -23.383853, -2.669006, 3.774294, 44.394320},
+  {33.929715, -31.679733, -23.408036, -2.675045, 3.792996, 44.605376},
+  {34.070455, -31.793887, -23.431545, -2.681049, 3.811713, 44.816666},
+  {34.211202, -31.907866, -23.454382, -2.687019, 3.830445, 45.028190},
+  {34.351958, -32.021669, -23.476544, -2.692955, 3.849192, 45.239950},
+  {34.492722, -32.135296, -23.498031, -2.698856, 3.867954, 45.451945},
+  {34.633493, -32.248744, -23.518844, -2.704723, 3.886730, 45.664177},
+  {34.774273, -32.362013, -23.538981, -2.710556, 3.905521, 45.876646},
+  {34.915060, -32.475102, -23.558441, -2.716355, 3.924326, 46.089352},
+  {35.055856, -32.588010, -23.577226, -2.722119, 3.943146, 46.302296},
+  {35.196659, -32.700737, -23.595333, -2.727848, 3.961980, 46.515478},
+  {35.337471, -32.813280, -23.612763, -2.733544, 3.980829, 46.728899},
+  {35.478290, -32.925640, -23.629514, -2.739205, 3.999692, 46.942560},
+  {35.619117, -33.037814, -23.645588, -2.744831, 4.018569, 47.156461},
+  {35.759952, -33.149803, -23.660983, -2.750424, 4.037461, 47.370603},
+  {35.900795, -33.261604, -23.675699, -2.755981, 4.056367, 47.584986},
+  {36.041646, -33.373217, -23.689736, -2.761504, 4.075287, 47.799610},
+  {36.182504, -33.484642, -23.703093, -2.766993, 4.094221, 48.014478},
+  {36.323371, -33.595876, -23.715770, -2.772447, 4.113169, 48.229588},
+  {36.464245, -33.706919, -23.727766, -2.777867, 4.132131, 48.444943},
+  {36.605127, -33.817770, -23.739082, -2.783252, 4.151106, 48.660541},
+  {36.746017, -33.928428, -23.749718, -2.788603, 4.170096, 48.876385},
+  {36.886915, -34.038892, -23.759672, -2.793919, 4.189100, 49.092475},
+  {37.027820, -34.149160, -23.768944, -2.799200, 4.208117, 49.308811},
+  {37.168733, -34.259232, -23.777535, -2.804447, 4.227148, 49.525394},
+  {37.309654, -34.369106, -23.785444, -2.809659, 4.246193, 49.742225},
+  {37.450583, -34.478782, -23.792672, -2.814837, 4.265251, 49.959304},
+  {37.591519, -34.588259, -23.799217, -2.819979, 4.284323, 50.176633},
+  {37.732464, -34.697534, -23.805079, -2.825088, 4.303409, 50.394211},
+  {37.873416, -34.806609, -23.810259, -2.830161, 4.322508, 50.612040},
+  {38.014375, -34.915480, -23.814757, -2.835200, 4.341620, 50.830121},
+  {38.155343, -35.024148, -23.818572, -2.840204, 4.360746, 51.048454},
+  {38.296318, -35.132610, -23.821704, -2.845173, 4.379885, 51.267039},
+  {38.437301, -35.240867, -23.824153, -2.850107, 4.399037, 51.485879},
+  {38.578291, -35.348917, -23.825919, -2.855007, 4.418203, 51.704973},
+  {38.719289, -35.456758, -23.827003, -2.859872, 4.437381, 51.924322},
+  {38.860295, -35.564390, -23.827403, -2.864702, 4.456573, 52.143927},
+  {39.001309, -35.671812, -23.827120, -2.869497, 4.475778, 52.363790},
+  {39.142330, -35.779022, -23.826154, -2.874258, 4.494995, 52.583910},
+  {39.283359, -35.886019, -23.824505, -2.878983, 4.514226, 52.804288},
+  {39.424396, -35.992803, -23.822174, -2.883674, 4.533470, 53.024926},
+  {39.565440, -36.099372, -23.819159, -2.888329, 4.552726, 53.245825},
+  {39.706492, -36.205725, -23.815462, -2.892950, 4.571995, 53.466984},
+  {39.847552, -36.311861, -23.811081, -2.897536, 4.591277, 53.688406},
+  {39.988620, -36.417779, -23.806019, -2.902087, 4.610572, 53.910091},
+  {40.129695, -36.523477, -23.800273, -2.906603, 4.629879, 54.132039},
+  {40.270778, -36.628955, -23.793846, -2.911084, 4.649199, 54.354253},
+  {40.411869, -36.734211, -23.786736, -2.915530, 4.668531, 54.576732},
+  {40.552967, -36.839245, -23.778944, -2.919941, 4.687876, 54.799478},
+  {40.694073, -36.944055, -23.770470, -2.924317, 4.707233, 55.022491},
+  {40.835187, -37.048639, -23.761315, -2.928658, 4.726603, 55.245774},
+  {40.976308, -37.152997, -23.751478, -2.932964, 4.745985, 55.469325},
+  {41.117438, -37.257128, -23.740960, -2.937235, 4.765379, 55.693148},
+  {41.258574, -37.361031, -23.729761, -2.941471, 4.784786, 55.917242},
+  {41.399719, -37.464704, -23.717881, -2.945672, 4.804204, 56.141609},
+  {41.540872, -37.568146, -23.705321, -2.949838, 4.823635, 56.366249},
+  {41.682032, -37.671355, -23.692081, -2.953968, 4.843078, 56.591164},
+  {41.823200, -37.774332, -23.678162, -2.958064, 4.862532, 56.816355},
+  {41.964375, -37.877074, -23.663562, -2.962124, 4.881999, 57.041823},
+  {42.105559, -37.979581, -23.648284, -2.966149, 4.901478, 57.267569},
+  {42.246750, -38.081851, -23.632327, -2.970139, 4.920968, 57.493594},
+  {42.387949, -38.183883, -23.615692, -2.974094, 4.940470, 57.719899},
+  {42.529156, -38.285676, -23.598379, -2.978014, 4.959984, 57.946485},
+  {42.670371, -38.387229, -23.580388, -2.981898, 4.979510, 58.173354},
+  {42.811593, -38.488540, -23.561720, -2.985747, 4.999047, 58.400506},
+  {42.952824, -38.589609, -23.542376, -2.989561, 5.018596, 58.627943},
+  {43.094062, -38.690434, -23.522355, -2.993340, 5.038157, 58.855666},
+  {43.235308, -38.791013, -23.501659, -2.997083, 5.057729, 59.083677},
+  {43.376562, -38.891346, -23.480287, -3.000792, 5.077312, 59.311975},
+  {43.517823, -38.991432, -23.458241, -3.004464, 5.096907, 59.540564},
+  {43.659093, -39.091269, -23.435521, -3.008102, 5.116513, 59.769443},
+  {43.800371, -39.190856, -23.412127, -3.011704, 5.136130, 59.998614},
+  {43.941656, -39.290192, -23.388060, -3.015271, 5.155759, 60.228078},
+  {44.082949, -39.389275, -23.363320, -3.018803, 5.175398, 60.457838},
+  {44.224251, -39.488105, -23.337909, -3.022299, 5.195049, 60.687893},
+  {44.365560, -39.586680, -23.311826, -3.025760, 5.214711, 60.918245},
+  {44.506877, -39.684999, -23.285073, -3.029186, 5.234384, 61.148896},
+  {44.648203, -39.783060, -23.257649, -3.032576, 5.254068, 61.379847},
+  {44.789536, -39.880863, -23.229556, -3.035931, 5.273763, 61.611100},
+  {44.930877, -39.978407, -23.200795, -3.039251, 5.293468, 61.842655},
+  {45.072227, -40.075689, -23.171365, -3.042535, 5.313185, 62.074514},
+  {45.213584, -40.172709, -23.141268, -3.045784, 5.332912, 62.306679},
+  {45.354950, -40.269465, -23.110504, -3.048997, 5.352650, 62.539151},
+  {45.496324, -40.365957, -23.079074, -3.052175, 5.372398, 62.771931},
+  {45.637705, -40.462182, -23.046980, -3.055317, 5.392158, 63.005021},
+  {45.779095, -40.558141, -23.014220, -3.058424, 5.411927, 63.238422},
+  {45.920493, -40.653830, -22.980797, -3.061495, 5.431707, 63.472136},
+  {46.061900, -40.749250, -22.946711, -3.064531, 5.451498, 63.706165},
+  {46.203314, -40.844399, -22.911963, -3.067532, 5.471299, 63.940509},
+  {46.344737, -40.939276, -22.876554, -3.070497, 5.491110, 64.175171},
+  {46.486168, -41.033878, -22.840484, -3.073426, 5.510932, 64.410152},
+  {46.627607, -41.128206, -22.803754, -3.076320, 5.530764, 64.645454},
+  {46.769055, -41.222258, -22.766366, -3.079178, 5.550606, 64.881078},
+  {46.910511, -41.316033, -22.728319, -3.082001, 5.570458, 65.117026},
+  {47.051975, -41.409528, -22.689616, -3.084789, 5.590320, 65.353299},
+  {47.193448, -41.502744, -22.650256, -3.087540, 5.610192, 65.589900},
+  {47.334929, -41.595679, -22.610241, -3.090256, 5.630074, 65.826829},
+  {47.476418, -41.688331, -22.569572, -3.092937, 5.649966, 66.064089},
+  {47.617916, -41.780699, -22.528249, -3.095582, 5.669868, 66.301682},
+  {47.759422, -41.872782, -22.486274, -3.098192, 5.689780, 66.539608},
+  {47.900937, -41.964578, -22.443647, -3.100765, 5.709701, 66.777870},
+  {48.042461, -42.056087, -22.400370, -3.103304, 5.729632, 67.016470},
+  {48.183993, -42.147307, -22.356443, -3.105806, 5.749573, 67.255409},
+  {48.325533, -42.238237, -22.311868, -3.108273, 5.769524, 67.494690},
+  {48.467082, -42.328875, -22.266645, -3.110705, 5.789484, 67.734314},
+  {48.608640, -42.419220, -22.220775, -3.113100, 5.809453, 67.974282},
+  {48.750207, -42.509271, -22.174260, -3.115460, 5.829432, 68.214598},
+  {48.891782, -42.599026, -22.127101, -3.117785, 5.849420, 68.455262},
+  {49.033366, -42.688485, -22.079298, -3.120074, 5.869418, 68.696278},
+  {49.174958, -42.777645, -22.030852, -3.122327, 5.889425, 68.937646},
+  {49.316560, -42.866507, -21.981766, -3.124544, 5.909441, 69.179368},
+  {49.458170, -42.955067, -21.932039, -3.126726, 5.929466, 69.421447},
+  {49.599789, -43.043325, -21.881673, -3.128872, 5.949501, 69.663886},
+  {49.741417, -43.131280, -21.830669, -3.130982, 5.969544, 69.906684},
+  {49.883054, -43.218931, -21.779029, -3.133057, 5.989597, 70.149846},
+  {50.024700, -43.306275, -21.726752, -3.135096, 6.009658, 70.393373},
+  {50.166355, -43.393313, -21.673842, -3.137099, 6.029728, 70.637267},
+  {50.308019, -43.480041, -21.620297, -3.139066, 6.049808, 70.881530},
+  {50.449692, -43.566460, -21.566121, -3.140998, 6.069896, 71.126165},
+  {50.591374, -43.652567, -21.511314, -3.142894, 6.089993, 71.371173},
+  {50.733065, -43.738362, -21.455877, -3.144754, 6.110098, 71.616558},
+  {50.874765, -43.823843, -21.399811, -3.146578, 6.130212, 71.862321},
+  {51.016475, -43.909009, -21.343118, -3.148367, 6.150335, 72.108464},
+  {51.158194, -43.993859, -21.285798, -3.150120, 6.170466, 72.354990},
+  {51.299922, -44.078390, -21.227854, -3.151837, 6.190606, 72.601901},
+  {51.441659, -44.162603, -21.169286, -3.153519, 6.210755, 72.849199},
+  {51.583406, -44.246495, -21.110096, -3.155164, 6.230911, 73.096888},
+  {51.725162, -44.330065, -21.050284, -3.156774, 6.251076, 73.344969},
+  {51.866928, -44.413312, -20.989853, -3.158348, 6.271249, 73.593445},
+  {52.008703, -44.496234, -20.928803, -3.159886, 6.291431, 73.842318},
+  {52.150487, -44.578831, -20.867136, -3.161389, 6.311621, 74.091591},
+  {52.292282, -44.661101, -20.804853, -3.162855, 6.331818, 74.341267},
+  {52.434085, -44.743042, -20.741955, -3.164286, 6.352024, 74.591347},
+  {52.575899, -44.824654, -20.678444, -3.165681, 6.372238, 74.841836},
+  {52.717722, -44.905934, -20.614321, -3.167040, 6.392460, 75.092734},
+  {52.859554, -44.986882, -20.549587, -3.168363, 6.412690, 75.344046},
+  {53.001397, -45.067497, -20.484244, -3.169651, 6.432928, 75.595773},
+  {53.143249, -45.147776, -20.418293, -3.170902, 6.453173, 75.847918},
+  {53.285111, -45.227719, -20.351735, -3.172118, 6.473426, 76.100485},
+  {53.426984, -45.307324, -20.284572, -3.173298, 6.493687, 76.353476},
+  {53.568866, -45.386590, -20.216806, -3.174442, 6.513956, 76.606894},
+  {53.710758, -45.465516, -20.148437, -3.175551, 6.534232, 76.860741},
+  {53.852660, -45.544100, -20.079467, -3.176623, 6.554516, 77.115021},
+  {53.994572, -45.622341, -20.009897, -3.177660, 6.574807, 77.369737},
+  {54.136494, -45.700238, -19.939730, -3.178660, 6.595106, 77.624892},
+  {54.278426, -45.777789, -19.868965, -3.179625, 6.615412, 77.880488},
+  {54.420369, -45.854993, -19.797605, -3.180554, 6.635725, 78.136530},
+  {54.562322, -45.931849, -19.725652, -3.181447, 6.656046, 78.393019},
+  {54.704285, -46.008356, -19.653105, -3.182304, 6.676374, 78.649959},
+  {54.846258, -46.084511, -19.579968, -3.183125, 6.696709, 78.907353},
+  {54.988242, -46.160314, -19.506242, -3.183911, 6.717052, 79.165205},
+  {55.130237, -46.235763, -19.431927, -3.184660, 6.737401, 79.423518},
+  {55.272242, -46.310858, -19.357026, -3.185374, 6.757757, 79.682295},
+  {55.414257, -46.385596, -19.281540, -3.186052, 6.778121, 79.941539},
+  {55.556283, -46.459977, -19.205470, -3.186694, 6.798491, 80.201254},
+  {55.698320, -46.533999, -19.128818, -3.187300, 6.818868, 80.461444},
+  {55.840368, -46.607661, -19.051586, -3.187870, 6.839252, 80.722111},
+  {55.982426, -46.680962, -18.973774, -3.188404, 6.859643, 80.983260},
+  {56.124495, -46.753899, -18.895385, -3.188902, 6.880040, 81.244894},
+  {56.266575, -46.826473, -18.816420, -3.189365, 6.900444, 81.507017},
+  {56.408666, -46.898681, -18.736880, -3.189791, 6.920855, 81.769631},
+  {56.550768, -46.970523, -18.656768, -3.190182, 6.941272, 82.032742},
+  {56.692880, -47.041996, -18.576084, -3.190536, 6.961696, 82.296353},
+  {56.835004, -47.113100, -18.494830, -3.190855, 6.982126, 82.560467},
+  {56.977140, -47.183834, -18.413008, -3.191138, 7.002563, 82.825089},
+  {57.119286, -47.254196, -18.330619, -3.191385, 7.023006, 83.090222},
+  {57.261444, -47.324184, -18.247664, -3.191596, 7.043455, 83.355871},
+  {57.403613, -47.393798, -18.164146, -3.191771, 7.063911, 83.622040},
+  {57.545793, -47.463037, -18.080066, -3.191910, 7.084372, 83.888732},
+  {57.687985, -47.531898, -17.995426, -3.192014, 7.104840, 84.155952},
+  {57.830188, -47.600381, -17.910226, -3.192081, 7.125314, 84.423704},
+  {57.972403, -47.668484, -17.824469, -3.192113, 7.145794, 84.691992},
+  {58.114629, -47.736207, -17.738156, -3.192108, 7.166280, 84.960821},
+  {58.256867, -47.803547, -17.651290, -3.192068, 7.186772, 85.230195},
+  {58.399117, -47.870504, -17.563870, -3.191992, 7.207270, 85.500119},
+  {58.541379, -47.937076, -17.475900, -3.191880, 7.227773, 85.770597},
+  {58.683652, -48.003262, -17.387380, -3.191732, 7.248283, 86.041633},
+  {58.825938, -48.069061, -17.298312, -3.191548, 7.268798, 86.313233},
+  {58.968235, -48.134472, -17.208698, -3.191328, 7.289318, 86.585400},
+  {59.110544, -48.199493, -17.118539, -3.191072, 7.309845, 86.858140},
+  {59.252866, -48.264122, -17.027838, -3.190780, 7.330377, 87.131458},
+  {59.395200, -48.328360, -16.936595, -3.190453, 7.350914, 87.405359},
+  {59.537546, -48.392204, -16.844813, -3.190089, 7.371457, 87.679847},
+  {59.679904, -48.455653, -16.752492, -3.189690, 7.392005, 87.954928},
+  {59.822274, -48.518706, -16.659635, -3.189254, 7.412559, 88.230606},
+  {59.964658, -48.581362, -16.566243, -3.188783, 7.433118, 88.506888},
+  {60.107053, -48.643619, -16.472318, -3.188276, 7.453682, 88.783778},
+  {60.249461, -48.705477, -16.377861, -3.187733, 7.474251, 89.061281},
+  {60.391882, -48.766934, -16.282875, -3.187154, 7.494826, 89.339404},
+  {60.534315, -48.827988, -16.187360, -3.186539, 7.515405, 89.618151},
+  {60.676762, -48.888640, -16.091318, -3.185889, 7.535990, 89.897529},
+  {-44.208711, 89.724830, -44.208711, 89.724830, -44.208711, 89.724830},
+  {-44.251578, 89.145661, -44.251578, 89.145661, -44.251578, 89.145661},
+  {-44.290941, 88.568996, -44.290941, 88.568996, -44.290941, 88.568996},
+  {-44.326795, 87.994786, -44.326795, 87.994786, -44.326795, 87.994786},
+  {-44.359135, 87.422986, -44.359135, 87.422986, -44.359135, 87.422986},
+  {-44.387955, 86.853550, -44.387955, 86.853550, -44.387955, 86.853550},
+  {-44.413251, 86.286435, -44.413251, 86.286435, -44.413251, 86.286435},
+  {-44.435020, 85.721598, -44.435020, 85.721598, -44.435020, 85.721598},
+  {-44.453257, 85.158998, -44.453257, 85.158998, -44.453257, 85.158998},
+  {-44.467960, 84.598596, -44.467960, 84.598596, -44.467960, 84.598596},
+  {-44.479126, 84.040351, -44.479126, 84.040351, -44.479126, 84.040351},
+  {-44.486755, 83.484227, -44.486755, 83.484227, -44.486755, 83.484227},
+  {-44.490844, 82.930186, -44.490844, 82.930186, -44.490844, 82.930186},
+  {-44.491394, 82.378192, -44.491394, 82.378192, -44.491394, 82.378192},
+  {-44.488404, 81.828211, -44.488404, 81.828211, -44.488404, 81.828211},
+  {-44.481874, 81.280207, -44.481874, 81.280207, -44.481874, 81.280207},
+  {-44.471806, 80.734149, -44.471806, 80.734149, -44.471806, 80.734149},
+  {-44.458200, 80.190004, -44.458200, 80.190004, -44.458200, 80.190004},
+  {-44.441060, 79.647740, -44.441060, 79.647740, -44.441060, 79.647740},
+  {-44.420388, 79.107327, -44.420388, 79.107327, -44.420388, 79.107327},
+  {-44.396187, 78.568734, -44.396187, 78.568734, -44.396187, 78.568734},
+  {-44.368461, 78.031934, -44.368461, 78.031934, -44.368461, 78.031934},
+  {-44.337213, 77.496896, -44.337213, 77.496896, -44.337213, 77.496896},
+  {-44.302450, 76.963594, -44.302450, 76.963594, -44.302450, 76.963594},
+  {-44.264175, 76.432000, -44.264175, 76.432000, -44.264175, 76.432000},
+  {-44.222396, 75.902088, -44.222396, 75.902088, -44.222396, 75.902088},
+  {-44.177118, 75.373833, -44.177118, 75.373833, -44.177118, 75.373833},
+  {-44.128348, 74.847208, -44.128348, 74.847208, -44.128348, 74.847208},
+  {-44.076094, 74.322191, -44.076094, 74.322191, -44.076094, 74.322191},
+  {-44.020364, 73.798755, -44.020364, 73.798755, -44.020364, 73.798755},
+  {-43.961165, 73.276879, -43.961165, 73.276879, -43.961165, 73.276879},
+  {-43.898508, 72.756539, -43.898508, 72.756539, -43.898508, 72.756539},
+  {-43.832401, 72.237713, -43.832401, 72.237713, -43.832401, 72.237713},
+  {-43.762855, 71.720380, -43.762855, 71.720380, -43.762855, 71.720380},
+  {-43.689879, 71.204517, -43.689879, 71.204517, -43.689879, 71.204517},
+  {-43.613485, 70.690104, -43.613485, 70.690104, -43.613485, 70.690104},
+  {-43.533683, 70.177120, -43.533683, 70.177120, -43.533683, 70.177120},
+  {-43.450487, 69.665546, -43.450487, 69.665546, -43.450487, 69.665546},
+  {-43.363907, 69.155362, -43.363907, 69.155362, -43.363907, 69.155362},
+  {-43.273957, 68.646550, -43.273957, 68.646550, -43.273957, 68.646550},
+  {-43.180650, 68.139090, -43.180650, 68.139090, -43.180650, 68.139090},
+  {-43.083999, 67.632964, -43.083999, 67.632964, -43.083999, 67.632964},
+  {-42.984018, 67.128154, -42.984018, 67.128154, -42.984018, 67.128154},
+  {-42.880722, 66.624644, -42.880722, 66.624644, -42.880722, 66.624644},
+  {-42.774126, 66.122415, -42.774126, 66.122415, -42.774126, 66.122415},
+  {-42.664244, 65.621452, -42.664244, 65.621452, -42.664244, 65.621452},
+  {-42.551092, 65.121738, -42.551092, 65.121738, -42.551092, 65.121738},
+  {-42.434687, 64.623256, -42.434687, 64.623256, -42.434687, 64.623256},
+  {-42.315044, 64.125992, -42.315044, 64.125992, -42.315044, 64.125992},
+  {-42.192179, 63.629930, -42.192179, 63.629930, -42.192179, 63.629930},
+  {-42.066111, 63.135055, -42.066111, 63.135055, -42.066111, 63.135055},
+  {-41.936857, 62.641352, -41.936857, 62.641352, -41.936857, 62.641352},
+  {-41.804433, 62.148807, -41.804433, 62.148807, -41.804433, 62.148807},
+  {-41.668859, 61.657406, -41.668859, 61.657406, -41.668859, 61.657406},
+  {-41.530151, 61.167135, -41.530151, 61.167135, -41.530151, 61.167135},
+  {-41.388330, 60.677980, -41.388330, 60.677980, -41.388330, 60.677980},
+  {-41.243413, 60.189929, -41.243413, 60.189929, -41.243413, 60.189929},
+  {-41.095421, 59.702969, -41.095421, 59.702969, -41.095421, 59.702969},
+  {-40.944371, 59.217086, -40.944371, 59.217086, -40.944371, 59.217086},
+  {-40.790285, 58.732269, -40.790285, 58.732269, -40.790285, 58.732269},
+  {-40.633181, 58.248505, -40.633181, 58.248505, -40.633181, 58.248505},
+  {-40.473080, 57.765782, -40.473080, 57.765782, -40.473080, 57.765782},
+  {-40.310003, 57.284089, -40.310003, 57.284089, -40.310003, 57.284089},
+  {-40.143970, 56.803414, -40.143970, 56.803414, -40.143970, 56.803414},
+  {-39.975001, 56.323746, -39.975001, 56.323746, -39.975001, 56.323746},
+  {-39.803118, 55.845075, -39.803118, 55.845075, -39.803118, 55.845075},
+  {-39.628341, 55.367389, -39.628341, 55.367389, -39.628341, 55.367389},
+  {-39.450693, 54.890677, -39.450693, 54.890677, -39.450693, 54.890677},
+  {-39.270195, 54.414931, -39.270195, 54.414931, -39.270195, 54.414931},
+  {-39.086867, 53.940138, -39.086867, 53.940138, -39.086867, 53.940138},
+  {-38.900733, 53.466291, -38.900733, 53.466291, -38.900733, 53.466291},
+  {-38.711814, 52.993378, -38.711814, 52.993378, -38.711814, 52.993378},
+  {-38.520131, 52.521391, -38.520131, 52.521391, -38.520131, 52.521391},
+  {-38.325708, 52.050320, -38.325708, 52.050320, -38.325708, 52.050320},
+  {-38.128566, 51.580156, -38.128566, 51.580156, -38.128566, 51.580156},
+  {-37.928728, 51.110890, -37.928728, 51.110890, -37.928728, 51.110890},
+  {-37.726216, 50.642514, -37.726216, 50.642514, -37.726216, 50.642514},
+  {-37.521052, 50.175019, -37.521052, 50.175019, -37.521052, 50.175019},
+  {-37.313260, 49.708397, -37.313260, 49.708397, -37.313260, 49.708397},
+  {-37.102862, 49.242639, -37.102862, 49.242639, -37.102862, 49.242639},
+  {-36.889880, 48.777737, -36.889880, 48.777737, -36.889880, 48.777737},
+  {-36.674338, 48.313684, -36.674338, 48.313684, -36.674338, 48.313684},
+  {-36.456257, 47.850472, -36.456257, 47.850472, -36.456257, 47.850472},
+  {-36.235662, 47.388093, -36.235662, 47.388093, -36.235662, 47.388093},
+  {-36.012574, 46.926541, -36.012574, 46.926541, -36.012574, 46.926541},
+  {-35.787016, 46.465807, -35.787016, 46.465807, -35.787016, 46.465807},
+  {-35.559012, 46.005885, -35.559012, 46.005885, -35.559012, 46.005885},
+  {-35.328584, 45.546769, -35.328584, 45.546769, -35.328584, 45.546769},
+  {-35.095754, 45.088450, -35.095754, 45.088450, -35.095754, 45.088450},
+  {-34.860546, 44.630923, -34.860546, 44.630923, -34.860546, 44.630923},
+  {-34.622983, 44.174182, -34.622983, 44.174182, -34.622983, 44.174182},
+  {-34.383086, 43.718219, -34.383086, 43.718219, -34.383086, 43.718219},
+  {-34.140879, 43.263030, -34.140879, 43.263030, -34.140879, 43.263030},
+  {-33.896384, 42.808607, -33.896384, 42.808607, -33.896384, 42.808607},
+  {-33.649625, 42.354946, -33.649625, 42.354946, -33.649625, 42.354946},
+  {-33.400622, 41.902039, -33.400622, 41.902039, -33.400622, 41.902039},
+  {-33.149399, 41.449883, -33.149399, 41.449883, -33.149399, 41.449883},
+  {-32.895978, 40.998471, -32.895978, 40.998471, -32.895978, 40.998471},
+  {-32.640381, 40.547797, -32.640381, 40.547797, -32.640381, 40.547797},
+  {-32.382631, 40.097858, -32.382631, 40.097858, -32.382631, 40.097858},
+  {-32.122749, 39.648647, -32.122749, 39.648647, -32.122749, 39.648647},
+  {-31.860758, 39.200160, -31.860758, 39.200160, -31.860758, 39.200160},
+  {-31.596680, 38.752392, -31.596680, 38.752392, -31.596680, 38.752392},
+  {-31.330535, 38.305339, -31.330535, 38.305339, -31.330535, 38.305339},
+  {-31.062346, 37.858995, -31.062346, 37.858995, -31.062346, 37.858995},
+  {-30.792135, 37.413357, -30.792135, 37.413357, -30.792135, 37.413357},
+  {-30.519922, 36.968420, -30.519922, 36.968420, -30.519922, 36.968420},
+  {-30.245729, 36.524179, -30.245729, 36.524179, -30.245729, 36.524179},
+  {-29.969578, 36.080632, -29.969578, 36.080632, -29.969578, 36.080632},
+  {-29.691489, 35.637773, -29.691489, 35.637773, -29.691489, 35.637773},
+  {-29.411483, 35.195600, -29.411483, 35.195600, -29.411483, 35.195600},
+  {-29.129581, 34.754108, -29.129581, 34.754108, -29.129581, 34.754108},
+  {-28.845804, 34.313293, -28.845804, 34.313293, -28.845804, 34.313293},
+  {-28.560172, 33.873153, -28.560172, 33.873153, -28.560172, 33.873153},
+  {-28.272705, 33.433684, -28.272705, 33.433684, -28.272705, 33.433684},
+  {-27.983423, 32.994883, -27.983423, 32.994883, -27.983423, 32.994883},
+  {-27.692347, 32.556746, -27.692347, 32.556746, -27.692347, 32.556746},
+  {-27.399497, 32.119271, -27.399497, 32.119271, -27.399497, 32.119271},
+  {-27.104891, 31.682454, -27.104891, 31.682454, -27.104891, 31.682454},
+  {-26.808550, 31.246293, -26.808550, 31.246293, -26.808550, 31.246293},
+  {-26.510493, 30.810785, -26.510493, 30.810785, -26.510493, 30.810785},
+  {-26.210739, 30.375928, -26.210739, 30.375928, -26.210739, 30.375928},
+  {-25.909307, 29.941719, -25.909307, 29.941719, -25.909307, 29.941719},
+  {-25.606216, 29.508155, -25.606216, 29.508155, -25.606216, 29.508155},
+  {-25.301485, 29.075235, -25.301485, 29.075235, -25.301485, 29.075235},
+  {-24.995131, 28.642956, -24.995131, 28.642956, -24.995131, 28.642956},
+  {-24.687175, 28.211316, -24.687175, 28.211316, -24.687175, 28.211316},
+  {-24.377632, 27.780313, -24.377632, 27.780313, -24.377632, 27.780313},
+  {-24.066523, 27.349946, -24.066523, 27.349946, -24.066523, 27.349946},
+  {-23.753863, 26.920213, -23.753863, 26.920213, -23.753863, 26.920213},
+  {-23.439672, 26.491111, -23.439672, 26.491111, -23.439672, 26.491111},
+  {-23.123966, 26.062640, -23.123966, 26.062640, -23.123966, 26.062640},
+  {-22.806762, 25.634799, -22.806762, 25.634799, -22.806762, 25.634799},
+  {-22.488078, 25.207585, -22.488078, 25.207585, -22.488078, 25.207585},
+  {-22.167930, 24.780997, -22.167930, 24.780997, -22.167930, 24.780997},
+  {-21.846336, 24.355035, -21.846336, 24.355035, -21.846336, 24.355035},
+  {-21.523310, 23.929698, -21.523310, 23.929698, -21.523310, 23.929698},
+  {-21.198871, 23.504984, -21.198871, 23.504984, -21.198871, 23.504984},
+  {-20.873034, 23.080893, -20.873034, 23.080893, -20.873034, 23.080893},
+  {-20.545814, 22.657424, -20.545814, 22.657424, -20.545814, 22.657424},
+  {-20.217228, 22.234576, -20.217228, 22.234576, -20.217228, 22.234576},
+  {-19.887292, 21.812350, -19.887292, 21.812350, -19.887292, 21.812350},
+  {-19.556019, 21.390744, -19.556019, 21.390744, -19.556019, 21.390744},
+  {-19.223426, 20.969758, -19.223426, 20.969758, -19.223426, 20.969758},
+  {-18.889528, 20.549393, -18.889528, 20.549393, -18.889528, 20.549393},
+  {-18.554339, 20.129648, -18.554339, 20.129648, -18.554339, 20.129648},
+  {-18.217874, 19.710523, -18.217874, 19.710523, -18.217874, 19.710523},
+  {-17.880148, 19.292019, -17.880148, 19.292019, -17.880148, 19.292019},
+  {-17.541173, 18.874135, -17.541173, 18.874135, -17.541173, 18.874135},
+  {-17.200966, 18.456872, -17.200966, 18.456872, -17.200966, 18.456872},
+  {-16.859539, 18.040230, -16.859539, 18.040230, -16.859539, 18.040230},
+  {-16.516906, 17.624211, -16.516906, 17.624211, -16.516906, 17.624211},
+  {-16.173080, 17.208814, -16.173080, 17.208814, -16.173080, 17.208814},
+  {-15.828075, 16.794040, -15.828075, 16.794040, -15.828075, 16.794040},
+  {-15.481904, 16.379891, -15.481904, 16.379891, -15.481904, 16.379891},
+  {-15.134580, 15.966367, -15.134580, 15.966367, -15.134580, 15.966367},
+  {-14.786116, 15.553470, -14.786116, 15.553470, -14.786116, 15.553470},
+  {-14.436523, 15.141200, -14.436523, 15.141200, -14.436523, 15.141200},
+  {-14.085815, 14.729559, -14.085815, 14.729559, -14.085815, 14.729559},
+  {-13.734004, 14.318548, -13.734004, 14.318548, -13.734004, 14.318548},
+  {-13.381101, 13.908169, -13.381101, 13.908169, -13.381101, 13.908169},
+  {-13.027119, 13.498424, -13.027119, 13.498424, -13.027119, 13.498424},
+  {-12.672068, 13.089314, -12.672068, 13.089314, -12.672068, 13.089314},
+  {-12.315962, 12.680841, -12.315962, 12.680841, -12.315962, 12.680841},
+  {-11.958810, 12.273007, -11.958810, 12.273007, -11.958810, 12.273007},
+  {-11.600624, 11.865814, -11.600624, 11.865814, -11.600624, 11.865814},
+  {-11.241414, 11.459265, -11.241414, 11.459265, -11.241414, 11.459265},
+  {-10.881193, 11.053361, -10.881193, 11.053361, -10.881193, 11.053361},
+  {-10.519969, 10.648105, -10.519969, 10.648105, -10.519969, 10.648105},
+  {-10.157755, 10.243500, -10.157755, 10.243500, -10.157755, 10.243500},
+  {-9.794559, 9.839548, -9.794559, 9.839548, -9.794559, 9.839548},
+  {-9.430392, 9.436253, -9.430392, 9.436253, -9.430392, 9.436253},
+  {-9.065264, 9.033616, -9.065264, 9.033616, -9.065264, 9.033616},
+  {-8.699184, 8.631641, -8.699184, 8.631641, -8.699184, 8.631641},
+  {-8.332163, 8.230331, -8.332163, 8.230331, -8.332163, 8.230331},
+  {-7.964209, 7.829689, -7.964209, 7.829689, -7.964209, 7.829689},
+  {-7.595332, 7.429719, -7.595332, 7.429719, -7.595332, 7.429719},
+  {-7.225541, 7.030425, -7.225541, 7.030425, -7.225541, 7.030425},
+  {-6.854844, 6.631808, -6.854844, 6.631808, -6.854844, 6.631808},
+  {-6.483252, 6.233874, -6.483252, 6.233874, -6.483252, 6.233874},
+  {-6.110771, 5.836627, -6.110771, 5.836627, -6.110771, 5.836627},
+  {-5.737411, 5.440069, -5.737411, 5.440069, -5.737411, 5.440069},
+  {-5.363180, 5.044206, -5.363180, 5.044206, -5.363180, 5.044206},
+  {-4.988085, 4.649041, -4.988085, 4.649041, -4.988085, 4.649041},
+  {-4.612136, 4.254580, -4.612136, 4.254580, -4.612136, 4.254580},
+  {-4.235340, 3.860825, -4.235340, 3.860825, -4.235340, 3.860825},
+  {-3.857704, 3.467782, -3.857704, 3.467782, -3.857704, 3.467782},
+  {-3.479236, 3.075456, -3.479236, 3.075456, -3.479236, 3.075456},
+  {-3.099943, 2.683851, -3.099943, 2.683851, -3.099943, 2.683851},
+  {-2.719833, 2.292973, -2.719833, 2.292973, -2.719833, 2.292973},
+  {-2.338912, 1.902826, -2.338912, 1.902826, -2.338912, 1.902826},
+  {-1.957188, 1.513416, -1.957188, 1.513416, -1.957188, 1.513416},
+  {-1.574667, 1.124748, -1.574667, 1.124748, -1.574667, 1.124748},
+  {-1.191356, 0.736828, -1.191356, 0.736828, -1.191356, 0.736828},
+  {-0.807261, 0.349661, -0.807261, 0.349661, -0.807261, 0.349661},
+  {-0.422390, -0.036747, -0.422390, -0.036747, -0.422390, -0.036747},
+  {-0.036747, -0.422390, -0.036747, -0.422390, -0.036747, -0.422390},
+  {0.349661, -0.807261, 0.349661, -0.807261, 0.349661, -0.807261},
+  {0.736828, -1.191356, 0.736828, -1.191356, 0.736828, -1.191356},
+  {1.124748, -1.574667, 1.124748, -1.574667, 1.124748, -1.574667},
+  {1.513416, -1.957188, 1.513416, -1.957188, 1.513416, -1.957188},
+  {1.902826, -2.338912, 1.902826, -2.338912, 1.902826, -2.338912},
+  {2.292973, -2.719833, 2.292973, -2.719833, 2.292973, -2.719833},
+  {2.683851, -3.099943, 2.683851, -3.099943, 2.683851, -3.099943},
+  {3.075456, -3.479236, 3.075456, -3.479236, 3.075456, -3.479236},
+  {3.467782, -3.857704, 3.467782, -3.857704, 3.467782, -3.857704},
+  {3.860825, -4.235340, 3.860825, -4.235340, 3.860825, -4.235340},
+  {4.254580, -4.612136, 4.254580, -4.612136, 4.254580, -4.612136},
+  {4.649041, -4.988085, 4.649041, -4.988085, 4.649041, -4.988085},
+  {5.044206, -5.363180, 5.044206, -5.363180, 5.044206, -5.363180},
+  {5.440069, -5.737411, 5.440069, -5.737411, 5.440069, -5.737411},
+  {5.836627, -6.110771, 5.836627, -6.110771, 5.836627, -6.110771},
+  {6.233874, -6.483252, 6.233874, -6.483252, 6.233874, -6.483252},
+  {6.631808, -6.854844, 6.631808, -6.854844, 6.631808, -6.854844},
+  {7.030425, -7.225541, 7.030425, -7.225541, 7.030425, -7.225541},
+  {7.429719, -7.595332, 7.429719, -7.595332, 7.429719, -7.595332},
+  {7.829689, -7.964209, 7.829689, -7.964209, 7.829689, -7.964209},
+  {8.230331, -8.332163, 8.230331, -8.332163, 8.230331, -8.332163},
+  {8.631641, -8.699184, 8.631641, -8.699184, 8.631641, -8.699184},
+  {9.033616, -9.065264, 9.033616, -9.065264, 9.033616, -9.065264},
+  {9.436253, -9.430392, 9.436253, -9.430392, 9.436253, -9.430392},
+  {9.839548, -9.794559, 9.839548, -9.794559, 9.839548, -9.794559},
+  {10.243500, -10.157755, 10.243500, -10.157755, 10.243500, -10.157755},
+  {10.648105, -10.519969, 10.648105, -10.519969, 10.648105, -10.519969},
+  {11.053361, -10.881193, 11.053361, -10.881193, 11.053361, -10.881193},
+  {11.459265, -11.241414, 11.459265, -11.241414, 11.459265, -11.241414},
+  {11.865814, -11.600624, 11.865814, -11.600624, 11.865814, -11.600624},
+  {12.273007, -11.958810, 12.273007, -11.958810, 12.273007, -11.958810},
+  {12.680841, -12.315962, 12.680841, -12.315962, 12.680841, -12.315962},
+  {13.089314, -12.672068, 13.089314, -12.672068, 13.089314, -12.672068},
+  {13.498424, -13.027119, 13.498424, -13.027119, 13.498424, -13.027119},
+  {13.908169, -13.381101, 13.908169, -13.381101, 13.908169, -13.381101},
+  {14.318548, -13.734004, 14.318548, -13.734004, 14.318548, -13.734004},
+  {14.729559, -14.085815, 14.729559, -14.085815, 14.729559, -14.085815},
+  {15.141200, -14.436523, 15.141200, -14.436523, 15.141200, -14.436523},
+  {15.553470, -14.786116, 15.553470, -14.786116, 15.553470, -14.786116},
+  {15.966367, -15.134580, 15.966367, -15.134580, 15.966367, -15.134580},
+  {16.379891, -15.481904, 16.379891, -15.481904, 16.379891, -15.481904},
+  {16.794040, -15.828075, 16.794040, -15.828075, 16.794040, -15.828075},
+  {17.208814, -16.173080, 17.208814, -16.173080, 17.208814, -16.173080},
+  {17.624211, -16.516906, 17.624211, -16.516906, 17.624211, -16.516906},
+  {18.040230, -16.859539, 18.040230, -16.859539, 18.040230, -16.859539},
+  {18.456872, -17.200966, 18.456872, -17.200966, 18.456872, -17.200966},
+  {18.874135, -17.541173, 18.874135, -17.541173, 18.874135, -17.541173},
+  {19.292019, -17.880148, 19.292019, -17.880148, 19.292019, -17.880148},
+  {19.710523, -18.217874, 19.710523, -18.217874, 19.710523, -18.217874},
+  {20.129648, -18.554339, 20.129648, -18.554339, 20.129648, -18.554339},
+  {20.549393, -18.889528, 20.549393, -18.889528, 20.549393, -18.889528},
+  {20.969758, -19.223426, 20.969758, -19.223426, 20.969758, -19.223426},
+  {21.390744, -19.556019, 21.390744, -19.556019, 21.390744, -19.556019},
+  {21.812350, -19.887292, 21.812350, -19.887292, 21.812350, -19.887292},
+  {22.234576, -20.217228, 22.234576, -20.217228, 22.234576, -20.217228},
+  {22.657424, -20.545814, 22.657424, -20.545814, 22.657424, -20.545814},
+  {23.080893, -20.873034, 23.080893, -20.873034, 23.080893, -20.873034},
+  {23.504984, -21.198871, 23.504984, -21.198871, 23.504984, -21.198871},
+  {23.929698, -21.523310, 23.929698, -21.523310, 23.929698, -21.523310},
+  {24.355035, -21.846336, 24.355035, -21.846336, 24.355035, -21.846336},
+  {24.780997, -22.167930, 24.780997, -22.167930, 24.780997, -22.167930},
+  {25.207585, -22.488078, 25.207585, -22.488078, 25.207585, -22.488078},
+  {25.634799, -22.806762, 25.634799, -22.806762, 25.634799, -22.806762},
+  {26.062640, -23.123966, 26.062640, -23.123966, 26.062640, -23.123966},
+  {26.491111, -23.439672, 26.491111, -23.439672, 26.491111, -23.439672},
+  {26.920213, -23.753863, 26.920213, -23.753863, 26.920213, -23.753863},
+  {27.349946, -24.066523, 27.349946, -24.066523, 27.349946, -24.066523},
+  {27.780313, -24.377632, 27.780313, -24.377632, 27.780313, -24.377632},
+  {28.211316, -24.687175, 28.211316, -24.687175, 28.211316, -24.687175},
+  {28.642956, -24.995131, 28.642956, -24.995131, 28.642956, -24.995131},
+  {29.075235, -25.301485, 29.075235, -25.301485, 29.075235, -25.301485},
+  {29.508155, -25.606216, 29.508155, -25.606216, 29.508155, -25.606216},
+  {29.941719, -25.909307, 29.941719, -25.909307, 29.941719, -25.909307},
+  {30.375928, -26.210739, 30.375928, -26.210739, 30.375928, -26.210739},
+  {30.810785, -26.510493, 30.810785, -26.510493, 30.810785, -26.510493},
+  {31.246293, -26.808550, 31.246293, -26.808550, 31.246293, -26.808550},
+  {31.682454, -27.104891, 31.682454, -27.104891, 31.682454, -27.104891},
+  {32.119271, -27.399497, 32.119271, -27.399497, 32.119271, -27.399497},
+  {32.556746, -27.692347, 32.556746, -27.692347, 32.556746, -27.692347},
+  {32.994883, -27.983423, 32.994883, -27.983423, 32.994883, -27.983423},
+  {33.433684, -28.272705, 33.433684, -28.272705, 33.433684, -28.272705},
+  {33.873153, -28.560172, 33.873153, -28.560172, 33.873153, -28.560172},
+  {34.313293, -28.845804, 34.313293, -28.845804, 34.313293, -28.845804},
+  {34.754108, -29.129581, 34.754108, -29.129581, 34.754108, -29.129581},
+  {35.195600, -29.411483, 35.195600, -29.411483, 35.195600, -29.411483},
+  {35.637773, -29.691489, 35.637773, -29.691489, 35.637773, -29.691489},
+  {36.080632, -29.969578, 36.080632, -29.969578, 36.080632, -29.969578},
+  {36.524179, -30.245729, 36.524179, -30.245729, 36.524179, -30.245729},
+  {36.968420, -30.519922, 36.968420, -30.519922, 36.968420, -30.519922},
+  {37.413357, -30.792135, 37.413357, -30.792135, 37.413357, -30.792135},
+  {37.858995, -31.062346, 37.858995, -31.062346, 37.858995, -31.062346},
+  {38.305339, -31.330535, 38.305339, -31.330535, 38.305339, -31.330535},
+  {38.752392, -31.596680, 38.752392, -31.596680, 38.752392, -31.596680},
+  {39.200160, -31.860758, 39.200160, -31.860758, 39.200160, -31.860758},
+  {39.648647, -32.122749, 39.648647, -32.122749, 39.648647, -32.122749},
+  {40.097858, -32.382631, 40.097858, -32.382631, 40.097858, -32.382631},
+  {40.547797, -32.640381, 40.547797, -32.640381, 40.547797, -32.640381},
+  {40.998471, -32.895978, 40.998471, -32.895978, 40.998471, -32.895978},
+  {41.449883, -33.149399, 41.449883, -33.149399, 41.449883, -33.149399},
+  {41.902039, -33.400622, 41.902039, -33.400622, 41.902039, -33.400622},
+  {42.354946, -33.649625, 42.354946, -33.649625, 42.354946, -33.649625},
+  {42.808607, -33.896384, 42.808607, -33.896384, 42.808607, -33.896384},
+  {43.263030, -34.140879, 43.263030, -34.140879, 43.263030, -34.140879},
+  {43.718219, -34.383086, 43.718219, -34.383086, 43.718219, -34.383086},
+  {44.174182, -34.622983, 44.174182, -34.622983, 44.174182, -34.622983},
+  {44.630923, -34.860546, 44.630923, -34.860546, 44.630923, -34.860546},
+  {45.088450, -35.095754, 45.088450, -35.095754, 45.088450, -35.095754},
+  {45.546769, -35.328584, 45.546769, -35.328584, 45.546769, -35.328584},
+  {46.005885, -35.559012, 46.005885, -35.559012, 46.005885, -35.559012},
+  {46.465807, -35.787016, 46.465807, -35.787016, 46.465807, -35.787016},
+  {46.926541, -36.012574, 46.926541, -36.012574, 46.926541, -36.012574},
+  {47.388093, -36.235662, 47.388093, -36.235662, 47.388093, -36.235662},
+  {47.850472, -36.456257, 47.850472, -36.456257, 47.850472, -36.456257},
+  {48.313684, -36.674338, 48.313684, -36.674338, 48.313684, -36.674338},
+  {48.777737, -36.889880, 48.777737, -36.889880, 48.777737, -36.889880},
+  {49.242639, -37.102862, 49.242639, -37.102862, 49.242639, -37.102862},
+  {49.708397, -37.313260, 49.708397, -37.313260, 49.708397, -37.313260},
+  {50.175019, -37.521052, 50.175019, -37.521052, 50.175019, -37.521052},
+  {50.642514, -37.726216, 50.642514, -37.726216, 50.642514, -37.726216},
+  {51.110890, -37.928728, 51.110890, -37.928728, 51.110890, -37.928728},
+  {51.580156, -38.128566, 51.580156, -38.128566, 51.580156, -38.128566},
+  {52.050320, -38.325708, 52.050320, -38.325708, 52.050320, -38.325708},
+  {52.521391, -38.520131, 52.521391, -38.520131, 52.521391, -38.520131},
+  {52.993378, -38.711814, 52.993378, -38.711814, 52.993378, -38.711814},
+  {53.466291, -38.900733, 53.466291, -38.900733, 53.466291, -38.900733},
+  {53.940138, -39.086867, 53.940138, -39.086867, 53.940138, -39.086867},
+  {54.414931, -39.270195, 54.414931, -39.270195, 54.414931, -39.270195},
+  {54.890677, -39.450693, 54.890677, -39.450693, 54.890677, -39.450693},
+  {55.367389, -39.628341, 55.367389, -39.628341, 55.367389, -39.628341},
+  {55.845075, -39.803118, 55.845075, -39.803118, 55.845075, -39.803118},
+  {56.323746, -39.975001, 56.323746, -39.975001, 56.323746, -39.975001},
+  {56.803414, -40.143970, 56.803414, -40.143970, 56.803414, -40.143970},
+  {57.284089, -40.310003, 57.284089, -40.310003, 57.284089, -40.310003},
+  {57.765782, -40.473080, 57.765782, -40.473080, 57.765782, -40.473080},
+  {58.248505, -40.633181, 58.248505, -40.633181, 58.248505, -40.633181},
+  {58.732269, -40.790285, 58.732269, -40.790285, 58.732269, -40.790285},
+  {59.217086, -40.944371, 59.217086, -40.944371, 59.217086, -40.944371},
+  {59.702969, -41.095421, 59.702969, -41.095421, 59.702969, -41.095421},
+  {60.189929, -41.243413, 60.189929, -41.243413, 60.189929, -41.243413},
+  {60.677980, -41.388330, 60.677980, -41.388330, 60.677980, -41.388330},
+  {61.167135, -41.530151, 61.167135, -41.530151, 61.167135, -41.530151},
+  {61.657406, -41.668859, 61.657406, -41.668859, 61.657406, -41.668859},
+  {62.148807, -41.804433, 62.148807, -41.804433, 62.148807, -41.804433},
+  {62.641352, -41.936857, 62.641352, -41.936857, 62.641352, -41.936857},
+  {63.135055, -42.066111, 63.135055, -42.066111, 63.135055, -42.066111},
+  {63.629930, -42.192179, 63.629930, -42.192179, 63.629930, -42.192179},
+  {64.125992, -42.315044, 64.125992, -42.315044, 64.125992, -42.315044},
+  {64.623256, -42.434687, 64.623256, -42.434687, 64.623256, -42.434687},
+  {65.121738, -42.551092, 65.121738, -42.551092, 65.121738, -42.551092},
+  {65.621452, -42.664244, 65.621452, -42.664244, 65.621452, -42.664244},
+  {66.122415, -42.774126, 66.122415, -42.774126, 66.122415, -42.774126},
+  {66.624644, -42.880722, 66.624644, -42.880722, 66.624644, -42.880722},
+  {67.128154, -42.984018, 67.128154, -42.984018, 67.128154, -42.984018},
+  {67.632964, -43.083999, 67.632964, -43.083999, 67.632964, -43.083999},
+  {68.139090, -43.180650, 68.139090, -43.180650, 68.139090, -43.180650},
+  {68.646550, -43.273957, 68.646550, -43.273957, 68.646550, -43.273957},
+  {69.155362, -43.363907, 69.155362, -43.363907, 69.155362, -43.363907},
+  {69.665546, -43.450487, 69.665546, -43.450487, 69.665546, -43.450487},
+  {70.177120, -43.533683, 70.177120, -43.533683, 70.177120, -43.533683},
+  {70.690104, -43.613485, 70.690104, -43.613485, 70.690104, -43.613485},
+  {71.204517, -43.689879, 71.204517, -43.689879, 71.204517, -43.689879},
+  {71.720380, -43.762855, 71.720380, -43.762855, 71.720380, -43.762855},
+  {72.237713, -43.832401, 72.237713, -43.832401, 72.237713, -43.832401},
+  {72.756539, -43.898508, 72.756539, -43.898508, 72.756539, -43.898508},
+  {73.276879, -43.961165, 73.276879, -43.961165, 73.276879, -43.961165},
+  {73.798755, -44.020364, 73.798755, -44.020364, 73.798755, -44.020364},
+  {74.322191, -44.076094, 74.322191, -44.076094, 74.322191, -44.076094},
+  {74.847208, -44.128348, 74.847208, -44.128348, 74.847208, -44.128348},
+  {75.373833, -44.177118, 75.373833, -44.177118, 75.373833, -44.177118},
+  {75.902088, -44.222396, 75.902088, -44.222396, 75.902088, -44.222396},
+  {76.432000, -44.264175, 76.432000, -44.264175, 76.432000, -44.264175},
+  {76.963594, -44.302450, 76.963594, -44.302450, 76.963594, -44.302450},
+  {77.496896, -44.337213, 77.496896, -44.337213, 77.496896, -44.337213},
+  {78.031934, -44.368461, 78.031934, -44.368461, 78.031934, -44.368461},
+  {78.568734, -44.396187, 78.568734, -44.396187, 78.568734, -44.396187},
+  {79.107327, -44.420388, 79.107327, -44.420388, 79.107327, -44.420388},
+  {79.647740, -44.441060, 79.647740, -44.441060, 79.647740, -44.441060},
+  {80.190004, -44.458200, 80.190004, -44.458200, 80.190004, -44.458200},
+  {80.734149, -44.471806, 80.734149, -44.471806, 80.734149, -44.471806},
+  {81.280207, -44.481874, 81.280207, -44.481874, 81.280207, -44.481874},
+  {81.828211, -44.488404, 81.828211, -44.488404, 81.828211, -44.488404},
+  {82.378192, -44.491394, 82.378192, -44.491394, 82.378192, -44.491394},
+  {82.930186, -44.490844, 82.930186, -44.490844, 82.930186, -44.490844},
+  {83.484227, -44.486755, 83.484227, -44.486755, 83.484227, -44.486755},
+  {84.040351, -44.479126, 84.040351, -44.479126, 84.040351, -44.479126},
+  {84.598596, -44.467960, 84.598596, -44.467960, 84.598596, -44.467960},
+  {85.158998, -44.453257, 85.158998, -44.453257, 85.158998, -44.453257},
+  {85.721598, -44.435020, 85.721598, -44.435020, 85.721598, -44.435020},
+  {86.286435, -44.413251, 86.286435, -44.413251, 86.286435, -44.413251},
+  {86.853550, -44.387955, 86.853550, -44.387955, 86.853550, -44.387955},
+  {87.422986, -44.359135, 87.422986, -44.359135, 87.422986, -44.359135},
+  {87.994786, -44.326795, 87.994786, -44.326795, 87.994786, -44.326795},
+  {88.568996, -44.290941, 88.568996, -44.290941, 88.568996, -44.290941},
+  {89.145661, -44.251578, 89.145661, -44.251578, 89.145661, -44.251578},
+  {89.724830, -44.208711, 89.724830, -44.208711, 89.724830, -44.208711},
+};
+
+// rounded servo commands in degrees (degZ/WX/WY/WZNew.xls)
+const int8_t goldenDeg[971][6] PROGMEM = {
+  {0, 0, 0, 0, 0, 0},
+  {1, 1, 1, 1, 1, 1},
+  {2, 2, 2, 2, 2, 2},
+  {3, 3, 3, 3, 3, 3},
+  {4, 4, 4, 4, 4, 4},
+  {5, 5, 5, 5, 5, 5},
+  {6, 6, 6, 6, 6, 6},
+  {7, 7, 7, 7, 7, 7},
+  {8, 8, 8, 8, 8, 8},
+  {9, 9, 9, 9, 9, 9},
+  {10, 10, 10, 10, 10, 10},
+  {11, 11, 11, 11, 11, 11},
+  {12, 12, 12, 12, 12, 12},
+  {13, 13, 13, 13, 13, 13},
+  {14, 14, 14, 14, 14, 14},
+  {15, 15, 15, 15, 15, 15},
+  {16, 16, 16, 16, 16, 16},
+  {17, 17, 17, 17, 17, 17},
+  {18, 18, 18, 18, 18, 18},
+  {19, 19, 19, 19, 19, 19},
+  {20, 20, 20, 20, 20, 20},
+  {21, 21, 21, 21, 21, 21},
+  {22, 22, 22, 22, 22, 22},
+  {23, 23, 23, 23, 23, 23},
+  {24, 24, 24, 24, 24, 24},
+  {25, 25, 25, 25, 25, 25},
+  {26, 26, 26, 26, 26, 26},
+  {27, 27, 27, 27, 27, 27},
+  {28, 28, 28, 28, 28, 28},
+  {29, 29, 29, 29, 29, 29},
+  {30, 30, 30, 30, 30, 30},
+  {31, 31, 31, 31, 31, 31},
+  {32, 32, 32, 32, 32, 32},
+  {33, 33, 33, 33, 33, 33},
+  {34, 34, 34, 34, 34, 34},
+  {35, 35, 35, 35, 35, 35},
+  {36, 36, 36, 36, 36, 36},
+  {37, 37, 37, 37, 37, 37},
+  {38, 38, 38, 38, 38, 38},
+  {39, 39, 39, 39, 39, 39},
+  {40, 40, 40, 40, 40, 40},
+  {41, 41, 41, 41, 41, 41},
+  {42, 42, 42, 42, 42, 42},
+  {43, 43, 43, 43, 43, 43},
+  {44, 44, 44, 44, 44, 44},
+  {45, 45, 45, 45, 45, 45},
+  {46, 46, 46, 46, 46, 46},
+  {47, 47, 47, 47, 47, 47},
+  {48, 48, 48, 48, 48, 48},
+  {49, 49, 49, 49, 49, 49},
+  {50, 50, 50, 50, 50, 50},
+  {51, 51, 51, 51, 51, 51},
+  {52, 52, 52, 52, 52, 52},
+  {53, 53, 53, 53, 53, 53},
+  {54, 54, 54, 54, 54, 54},
+  {55, 55, 55, 55, 55, 55},
+  {56, 56, 56, 56, 56, 56},
+  {57, 57, 57, 57, 57, 57},
+  {58, 58, 58, 58, 58, 58},
+  {59, 59, 59, 59, 59, 59},
+  {60, 60, 60, 60, 60, 60},
+  {61, 61, 61, 61, 61, 61},
+  {62, 62, 62, 62, 62, 62},
+  {63, 63, 63, 63, 63, 63},
+  {64, 64, 64, 64, 64, 64},
+  {65, 65, 65, 65, 65, 65},
+  {66, 66, 66, 66, 66, 66},
+  {90, 90, 29, -7, -7, 29},
+  {89, 89, 29, -7, -7, 29},
+  {89, 89, 29, -8, -8, 29},
+  {88, 88, 29, -8, -8, 29},
+  {88, 88, 29, -9, -9, 29},
+  {87, 87, 29, -9, -9, 29},
+  {87, 87, 29, -10, -10, 29},
+  {86, 86, 29, -10, -10, 29},
+  {85, 85, 29, -10, -10, 29},
+  {85, 85, 29, -11, -11, 29},
+  {84, 84, 28, -11, -11, 28},
+  {84, 84, 28, -12, -12, 28},
+  {83, 83, 28, -12, -12, 28},
+  {83, 83, 28, -13, -13, 28},
+  {82, 82, 28, -13, -13, 28},
+  {82, 82, 28, -14, -14, 28},
+  {81, 81, 28, -14, -14, 28},
+  {80, 80, 28, -15, -15, 28},
+  {79, 79, 28, -15, -15, 28},
+  {79, 79, 28, -16, -16, 28},
+  {78, 78, 28, -16, -16, 28},
+  {78, 78, 28, -17, -17, 28},
+  {77, 77, 28, -17, -17, 28},
+  {77, 77, 27, -17, -17, 27},
+  {76, 76, 27, -18, -18, 27},
+  {75, 75, 27, -18, -18, 27},
+  {75, 75, 27, -19, -19, 27},
+  {74, 74, 27, -19, -19, 27},
+  {74, 74, 27, -20, -20, 27},
+  {73, 73, 27, -20, -20, 27},
+  {73, 73, 27, -21, -21, 27},
+  {72, 72, 27, -21, -21, 27},
+  {71, 71, 27, -21, -21, 27},
+  {71, 71, 27, -22, -22, 27},
+  {70, 70, 26, -22, -22, 26},
+  {70, 70, 26, -23, -23, 26},
+  {69, 69, 26, -23, -23, 26},
+  {68, 68, 26, -23, -23, 26},
+  {68, 68, 26, -24, -24, 26},
+  {67, 67, 26, -24, -24, 26},
+  {67, 67, 26, -25, -25, 26},
+  {66, 66, 26, -25, -25, 26},
+  {65, 65, 26, -25, -25, 26},
+  {65, 65, 25, -26, -26, 25},
+  {64, 64, 25, -26, -26, 25},
+  {63, 63, 25, -26, -26, 25},
+  {63, 63, 25, -27, -27, 25},
+  {62, 62, 25, -27, -27, 25},
+  {61, 61, 25, -28, -28, 25},
+  {60, 60, 25, -28, -28, 25},
+  {60, 60, 24, -28, -28, 24},
+  {60, 60, 24, -29, -29, 24},
+  {59, 59, 24, -29, -29, 24},
+  {58, 58, 24, -29, -29, 24},
+  {58, 58, 24, -30, -30, 24},
+  {57, 57, 24, -30, -30, 24},
+  {56, 56, 24, -30, -30, 24},
+  {56, 56, 23, -30, -30, 23},
+  {55, 55, 23, -30, -30, 23},
+  {55, 55, 23, -31, -31, 23},
+  {54, 54, 23, -31, -31, 23},
+  {53, 53, 23, -31, -31, 23},
+  {52, 52, 23, -32, -32, 23},
+  {52, 52, 22, -32, -32, 22},
+  {51, 51, 22, -32, -32, 22},
+  {50, 50, 22, -32, -32, 22},
+  {49, 49, 22, -32, -32, 22},
+  {49, 49, 22, -33, -33, 22},
+  {48, 48, 22, -33, -33, 22},
+  {48, 48, 21, -33, -33, 21},
+  {47, 47, 21, -33, -33, 21},
+  {46, 46, 21, -33, -33, 21},
+  {45, 45, 21, -33, -33, 21},
+  {44, 44, 20, -33, -33, 20},
+  {43, 43, 20, -33, -33, 20},
+  {42, 42, 20, -33, -33, 20},
+  {41, 41, 20, -33, -33, 20},
+  {41, 41, 19, -33, -33, 19},
+  {40, 40, 19, -33, -33, 19},
+  {39, 39, 19, -33, -33, 19},
+  {38, 38, 19, -33, -33, 19},
+  {38, 38, 18, -33, -33, 18},
+  {37, 37, 18, -33, -33, 18},
+  {36, 36, 18, -33, -33, 18},
+  {35, 35, 18, -33, -33, 18},
+  {35, 35, 17, -33, -33, 17},
+  {34, 34, 17, -33, -33, 17},
+  {34, 34, 17, -32, -32, 17},
+  {33, 33, 17, -32, -32, 17},
+  {32, 32, 16, -32, -32, 16},
+  {31, 31, 16, -32, -32, 16},
+  {31, 31, 16, -31, -31, 16},
+  {30, 30, 16, -31, -31, 16},
+  {30, 30, 15, -31, -31, 15},
+  {29, 29, 15, -31, -31, 15},
+  {29, 29, 15, -30, -30, 15},
+  {28, 28, 15, -30, -30, 15},
+  {27, 27, 15, -30, -30, 15},
+  {27, 27, 14, -30, -30, 14},
+  {26, 26, 14, -29, -29, 14},
+  {25, 25, 14, -29, -29, 14},
+  {25, 25, 14, -28, -28, 14},
+  {25, 25, 13, -28, -28, 13},
+  {24, 24, 13, -28, -28, 13},
+  {23, 23, 13, -28, -28, 13},
+  {23, 23, 13, -27, -27, 13},
+  {22, 22, 13, -27, -27, 13},
+  {22, 22, 12, -27, -27, 12},
+  {22, 22, 12, -26, -26, 12},
+  {21, 21, 12, -26, -26, 12},
+  {20, 20, 12, -25, -25, 12},
+  {20, 20, 11, -25, -25, 11},
+  {19, 19, 11, -25, -25, 11},
+  {19, 19, 11, -24, -24, 11},
+  {18, 18, 11, -24, -24, 11},
+  {18, 18, 11, -23, -23, 11},
+  {18, 18, 10, -23, -23, 10},
+  {17, 17, 10, -23, -23, 10},
+  {17, 17, 10, -22, -22, 10},
+  {16, 16, 10, -22, -22, 10},
+  {16, 16, 9, -21, -21, 9},
+  {15, 15, 9, -21, -21, 9},
+  {15, 15, 9, -20, -20, 9},
+  {14, 14, 9, -20, -20, 9},
+  {14, 14, 8, -19, -19, 8},
+  {13, 13, 8, -19, -19, 8},
+  {13, 13, 8, -18, -18, 8},
+  {12, 12, 8, -18, -18, 8},
+  {12, 12, 7, -17, -17, 7},
+  {11, 11, 7, -17, -17, 7},
+  {11, 11, 7, -16, -16, 7},
+  {10, 10, 7, -16, -16, 7},
+  {10, 10, 7, -15, -15, 7},
+  {10, 10, 6, -15, -15, 6},
+  {9, 9, 6, -14, -14, 6},
+  {9, 9, 6, -13, -13, 6},
+  {8, 8, 5, -13, -13, 5},
+  {8, 8, 5, -12, -12, 5},
+  {7, 7, 5, -12, -12, 5},
+  {7, 7, 5, -11, -11, 5},
+  {7, 7, 4, -11, -11, 4},
+  {6, 6, 4, -11, -11, 4},
+  {6, 6, 4, -10, -10, 4},
+  {6, 6, 4, -9, -9, 4},
+  {5, 5, 4, -9, -9, 4},
+  {5, 5, 3, -9, -9, 3},
+  {5, 5, 3, -8, -8, 3},
+  {4, 4, 3, -8, -8, 3},
+  {4, 4, 3, -7, -7, 3},
+  {4, 4, 2, -6, -6, 2},
+  {3, 3, 2, -6, -6, 2},
+  {3, 3, 2, -5, -5, 2},
+  {2, 2, 2, -5, -5, 2},
+  {2, 2, 2, -4, -4, 2},
+  {2, 2, 1, -4, -4, 1},
+  {2, 2, 1, -3, -3, 1},
+  {1, 1, 1, -3, -3, 1},
+  {1, 1, 1, -2, -2, 1},
+  {1, 1, 0, -2, -2, 0},
+  {0, 0, 0, -1, -1, 0},
+  {0, 0, 0, 0, 0, 0},
+  {-1, -1, -1, 0, 0, -1},
+  {-1, -1, -1, 1, 1, -1},
+  {-1, -1, -1, 2, 2, -1},
+  {-2, -2, -1, 2, 2, -1},
+  {-2, -2, -1, 3, 3, -1},
+  {-2, -2, -2, 3, 3, -2},
+  {-2, -2, -2, 4, 4, -2},
+  {-3, -3, -2, 4, 4, -2},
+  {-3, -3, -2, 5, 5, -2},
+  {-3, -3, -3, 5, 5, -3},
+  {-3, -3, -3, 6, 6, -3},
+  {-4, -4, -3, 6, 6, -3},
+  {-4, -4, -3, 7, 7, -3},
+  {-4, -4, -4, 8, 8, -4},
+  {-5, -5, -4, 8, 8, -4},
+  {-5, -5, -4, 9, 9, -4},
+  {-5, -5, -4, 10, 10, -4},
+  {-5, -5, -5, 10, 10, -5},
+  {-6, -6, -5, 10, 10, -5},
+  {-6, -6, -5, 11, 11, -5},
+  {-6, -6, -5, 12, 12, -5},
+  {-6, -6, -6, 12, 12, -6},
+  {-7, -7, -6, 13, 13, -6},
+  {-7, -7, -6, 14, 14, -6},
+  {-7, -7, -6, 15, 15, -6},
+  {-7, -7, -7, 15, 15, -7},
+  {-8, -8, -7, 15, 15, -7},
+  {-8, -8, -7, 16, 16, -7},
+  {-8, -8, -7, 17, 17, -7},
+  {-8, -8, -8, 17, 17, -8},
+  {-9, -9, -8, 18, 18, -8},
+  {-9, -9, -8, 19, 19, -8},
+  {-9, -9, -9, 19, 19, -9},
+  {-9, -9, -9, 20, 20, -9},
+  {-10, -10, -9, 21, 21, -9},
+  {-10, -10, -9, 22, 22, -9},
+  {-10, -10, -10, 22, 22, -10},
+  {-10, -10, -10, 23, 23, -10},
+  {-11, -11, -10, 24, 24, -10},
+  {-11, -11, -11, 24, 24, -11},
+  {-11, -11, -11, 25, 25, -11},
+  {-11, -11, -11, 26, 26, -11},
+  {-11, -11, -12, 27, 27, -12},
+  {-12, -12, -12, 27, 27, -12},
+  {-12, -12, -12, 28, 28, -12},
+  {-12, -12, -12, 29, 29, -12},
+  {-12, -12, -13, 29, 29, -13},
+  {-12, -12, -13, 30, 30, -13},
+  {-12, -12, -13, 31, 31, -13},
+  {-13, -13, -13, 31, 31, -13},
+  {-13, -13, -14, 31, 31, -14},
+  {-13, -13, -14, 32, 32, -14},
+  {-13, -13, -14, 33, 33, -14},
+  {-13, -13, -14, 34, 34, -14},
+  {-13, -13, -15, 34, 34, -15},
+  {-13, -13, -15, 35, 35, -15},
+  {-14, -14, -15, 36, 36, -15},
+  {-14, -14, -16, 36, 36, -16},
+  {-14, -14, -16, 37, 37, -16},
+  {-14, -14, -16, 38, 38, -16},
+  {-14, -14, -17, 39, 39, -17},
+  {-14, -14, -17, 40, 40, -17},
+  {-14, -14, -17, 41, 41, -17},
+  {-14, -14, -18, 41, 41, -18},
+  {-14, -14, -18, 42, 42, -18},
+  {-15, -15, -18, 42, 42, -18},
+  {-15, -15, -18, 43, 43, -18},
+  {-15, -15, -19, 43, 43, -19},
+  {-15, -15, -19, 44, 44, -19},
+  {-15, -15, -19, 45, 45, -19},
+  {-15, -15, -19, 46, 46, -19},
+  {-15, -15, -20, 46, 46, -20},
+  {-15, -15, -20, 47, 47, -20},
+  {-15, -15, -20, 48, 48, -20},
+  {-15, -15, -21, 48, 48, -21},
+  {-15, -15, -21, 49, 49, -21},
+  {-15, -15, -21, 50, 50, -21},
+  {-15, -15, -21, 51, 51, -21},
+  {-15, -15, -22, 51, 51, -22},
+  {-15, -15, -22, 52, 52, -22},
+  {-15, -15, -22, 53, 53, -22},
+  {-15, -15, -23, 53, 53, -23},
+  {-15, -15, -23, 54, 54, -23},
+  {-15, -15, -23, 55, 55, -23},
+  {-15, -15, -24, 56, 56, -24},
+  {-15, -15, -24, 57, 57, -24},
+  {-15, -15, -24, 58, 58, -24},
+  {-15, -15, -25, 58, 58, -25},
+  {-15, -15, -25, 59, 59, -25},
+  {-15, -15, -25, 60, 60, -25},
+  {-15, -15, -26, 61, 61, -26},
+  {-15, -15, -26, 62, 62, -26},
+  {-15, -15, -26, 63, 63, -26},
+  {-15, -15, -27, 63, 63, -27},
+  {-15, -15, -27, 64, 64, -27},
+  {-15, -15, -27, 65, 65, -27},
+  {-15, -15, -28, 66, 66, -28},
+  {-15, -15, -28, 67, 67, -28},
+  {-15, -15, -28, 68, 68, -28},
+  {-15, -15, -29, 68, 68, -29},
+  {-15, -15, -29, 69, 69, -29},
+  {-15, -15, -29, 70, 70, -29},
+  {-15, -15, -30, 71, 71, -30},
+  {-15, -15, -30, 72, 72, -30},
+  {-15, -15, -30, 73, 73, -30},
+  {-15, -15, -31, 73, 73, -31},
+  {-15, -15, -31, 74, 74, -31},
+  {-14, -14, -31, 74, 74, -31},
+  {-14, -14, -31, 75, 75, -31},
+  {-14, -14, -31, 76, 76, -31},
+  {-14, -14, -32, 76, 76, -32},
+  {-14, -14, -32, 77, 77, -32},
+  {-14, -14, -32, 78, 78, -32},
+  {-14, -14, -33, 79, 79, -33},
+  {-14, -14, -33, 80, 80, -33},
+  {-14, -14, -33, 81, 81, -33},
+  {-14, -14, -34, 81, 81, -34},
+  {-14, -14, -34, 82, 82, -34},
+  {-13, -13, -34, 82, 82, -34},
+  {-13, -13, -34, 83, 83, -34},
+  {-13, -13, -35, 84, 84, -35},
+  {-13, -13, -35, 85, 85, -35},
+  {-13, -13, -35, 86, 86, -35},
+  {-13, -13, -36, 87, 87, -36},
+  {-13, -13, -36, 88, 88, -36},
+  {-12, -12, -36, 88, 88, -36},
+  {-12, -12, -36, 89, 89, -36},
+  {-12, -12, -37, 89, 89, -37},
+  {-12, -12, -37, 90, 90, -37},
+  {-49, 61, 90, 8, -3, -16},
+  {-49, 60, 89, 7, -3, -16},
+  {-49, 60, 89, 7, -3, -17},
+  {-49, 60, 88, 7, -3, -17},
+  {-48, 60, 88, 7, -3, -17},
+  {-48, 59, 87, 7, -3, -17},
+  {-48, 59, 86, 7, -3, -17},
+  {-48, 58, 86, 7, -3, -18},
+  {-48, 58, 85, 7, -3, -18},
+  {-48, 58, 84, 7, -3, -18},
+  {-47, 58, 84, 7, -3, -18},
+  {-47, 57, 84, 7, -3, -18},
+  {-47, 57, 83, 7, -3, -18},
+  {-47, 57, 82, 7, -3, -19},
+  {-47, 56, 82, 7, -3, -19},
+  {-47, 56, 81, 7, -3, -19},
+  {-47, 56, 80, 7, -3, -19},
+  {-46, 56, 80, 7, -3, -19},
+  {-46, 55, 80, 7, -3, -19},
+  {-46, 55, 79, 7, -3, -19},
+  {-46, 55, 79, 7, -3, -20},
+  {-46, 55, 78, 7, -3, -20},
+  {-46, 54, 78, 7, -3, -20},
+  {-46, 54, 77, 7, -3, -20},
+  {-45, 54, 77, 7, -3, -20},
+  {-45, 53, 76, 6, -3, -20},
+  {-45, 53, 75, 6, -3, -21},
+  {-45, 52, 75, 6, -3, -21},
+  {-45, 52, 74, 6, -3, -21},
+  {-44, 52, 74, 6, -3, -21},
+  {-44, 52, 73, 6, -3, -21},
+  {-44, 51, 73, 6, -3, -21},
+  {-44, 51, 72, 6, -3, -21},
+  {-44, 51, 71, 6, -3, -22},
+  {-44, 50, 71, 6, -3, -22},
+  {-43, 50, 71, 6, -3, -22},
+  {-43, 50, 70, 6, -3, -22},
+  {-43, 49, 69, 6, -3, -22},
+  {-43, 49, 68, 6, -3, -22},
+  {-42, 49, 68, 6, -3, -22},
+  {-42, 48, 68, 6, -3, -22},
+  {-42, 48, 67, 6, -3, -22},
+  {-42, 48, 66, 6, -3, -23},
+  {-42, 47, 66, 6, -3, -23},
+  {-41, 47, 65, 6, -3, -23},
+  {-41, 46, 64, 6, -3, -23},
+  {-41, 46, 64, 5, -3, -23},
+  {-41, 46, 63, 5, -3, -23},
+  {-40, 46, 63, 5, -3, -23},
+  {-40, 45, 63, 5, -3, -23},
+  {-40, 45, 62, 5, -3, -23},
+  {-40, 45, 61, 5, -3, -23},
+  {-40, 44, 61, 5, -3, -23},
+  {-39, 44, 61, 5, -3, -23},
+  {-39, 44, 60, 5, -3, -23},
+  {-39, 43, 59, 5, -3, -23},
+  {-39, 43, 59, 5, -3, -24},
+  {-38, 43, 58, 5, -3, -24},
+  {-38, 42, 58, 5, -3, -24},
+  {-38, 42, 57, 5, -3, -24},
+  {-38, 42, 56, 5, -3, -24},
+  {-37, 41, 56, 5, -3, -24},
+  {-37, 41, 55, 5, -3, -24},
+  {-37, 40, 55, 5, -3, -24},
+  {-37, 40, 54, 5, -3, -24},
+  {-36, 40, 54, 5, -3, -24},
+  {-36, 40, 53, 5, -3, -24},
+  {-36, 39, 53, 5, -3, -24},
+  {-36, 39, 53, 4, -3, -24},
+  {-36, 39, 52, 4, -3, -24},
+  {-35, 39, 52, 4, -3, -24},
+  {-35, 38, 51, 4, -3, -24},
+  {-35, 38, 50, 4, -3, -24},
+  {-34, 37, 50, 4, -3, -24},
+  {-34, 37, 49, 4, -3, -24},
+  {-34, 36, 48, 4, -3, -24},
+  {-33, 36, 48, 4, -3, -24},
+  {-33, 36, 47, 4, -3, -24},
+  {-33, 35, 47, 4, -3, -24},
+  {-33, 35, 46, 4, -3, -24},
+  {-32, 35, 46, 4, -3, -24},
+  {-32, 34, 45, 4, -3, -23},
+  {-32, 34, 44, 4, -3, -23},
+  {-31, 34, 44, 4, -3, -23},
+  {-31, 33, 44, 4, -3, -23},
+  {-31, 33, 43, 4, -3, -23},
+  {-30, 32, 42, 4, -3, -23},
+  {-30, 32, 41, 4, -3, -23},
+  {-30, 32, 41, 3, -3, -23},
+  {-30, 31, 41, 3, -3, -23},
+  {-29, 31, 41, 3, -3, -23},
+  {-29, 31, 40, 3, -3, -23},
+  {-29, 30, 39, 3, -3, -23},
+  {-28, 30, 39, 3, -2, -22},
+  {-28, 30, 38, 3, -2, -22},
+  {-28, 29, 38, 3, -2, -22},
+  {-28, 29, 37, 3, -2, -22},
+  {-27, 29, 37, 3, -2, -22},
+  {-27, 28, 37, 3, -2, -22},
+  {-27, 28, 36, 3, -2, -22},
+  {-26, 28, 36, 3, -2, -22},
+  {-26, 28, 35, 3, -2, -22},
+  {-26, 27, 35, 3, -2, -22},
+  {-26, 27, 35, 3, -2, -21},
+  {-26, 27, 34, 3, -2, -21},
+  {-25, 26, 34, 3, -2, -21},
+  {-25, 26, 33, 3, -2, -21},
+  {-25, 26, 32, 3, -2, -21},
+  {-24, 25, 32, 3, -2, -21},
+  {-24, 25, 31, 3, -2, -20},
+  {-24, 24, 31, 3, -2, -20},
+  {-23, 24, 31, 3, -2, -20},
+  {-23, 24, 30, 3, -2, -20},
+  {-23, 24, 30, 2, -2, -20},
+  {-23, 23, 29, 2, -2, -20},
+  {-22, 23, 29, 2, -2, -20},
+  {-22, 23, 29, 2, -2, -19},
+  {-22, 23, 28, 2, -2, -19},
+  {-22, 22, 28, 2, -2, -19},
+  {-21, 22, 27, 2, -2, -19},
+  {-21, 21, 27, 2, -2, -19},
+  {-21, 21, 26, 2, -2, -19},
+  {-21, 21, 26, 2, -2, -18},
+  {-20, 21, 26, 2, -2, -18},
+  {-20, 20, 25, 2, -2, -18},
+  {-19, 20, 24, 2, -2, -18},
+  {-19, 19, 24, 2, -2, -18},
+  {-19, 19, 24, 2, -2, -17},
+  {-19, 19, 23, 2, -2, -17},
+  {-18, 19, 23, 2, -2, -17},
+  {-18, 18, 23, 2, -2, -17},
+  {-18, 18, 22, 2, -2, -17},
+  {-18, 18, 22, 2, -2, -16},
+  {-17, 18, 22, 2, -2, -16},
+  {-17, 18, 21, 2, -2, -16},
+  {-17, 17, 21, 2, -2, -16},
+  {-17, 17, 20, 2, -2, -16},
+  {-16, 17, 20, 2, -2, -16},
+  {-16, 16, 20, 2, -2, -15},
+  {-16, 16, 19, 2, -2, -15},
+  {-16, 16, 19, 1, -2, -15},
+  {-15, 15, 19, 1, -2, -15},
+  {-15, 15, 18, 1, -2, -15},
+  {-15, 15, 18, 1, -2, -14},
+  {-14, 14, 17, 1, -2, -14},
+  {-14, 14, 17, 1, -1, -14},
+  {-14, 14, 16, 1, -1, -13},
+  {-14, 13, 16, 1, -1, -13},
+  {-13, 13, 16, 1, -1, -13},
+  {-13, 13, 15, 1, -1, -13},
+  {-13, 12, 15, 1, -1, -12},
+  {-12, 12, 15, 1, -1, -12},
+  {-12, 12, 14, 1, -1, -12},
+  {-12, 11, 14, 1, -1, -12},
+  {-11, 11, 13, 1, -1, -11},
+  {-11, 11, 12, 1, -1, -11},
+  {-11, 10, 12, 1, -1, -11},
+  {-10, 10, 12, 1, -1, -11},
+  {-10, 10, 12, 1, -1, -10},
+  {-10, 10, 11, 1, -1, -10},
+  {-10, 9, 11, 1, -1, -10},
+  {-9, 9, 11, 1, -1, -10},
+  {-9, 9, 10, 1, -1, -9},
+  {-9, 8, 10, 1, -1, -9},
+  {-8, 8, 9, 1, -1, -9},
+  {-8, 8, 9, 1, -1, -8},
+  {-8, 7, 9, 1, -1, -8},
+  {-8, 7, 8, 1, -1, -8},
+  {-7, 7, 8, 1, -1, -8},
+  {-7, 7, 8, 1, -1, -7},
+  {-7, 7, 8, 0, -1, -7},
+  {-7, 6, 7, 0, -1, -7},
+  {-6, 6, 7, 0, -1, -7},
+  {-6, 6, 7, 0, -1, -6},
+  {-6, 6, 6, 0, -1, -6},
+  {-6, 5, 6, 0, -1, -6},
+  {-5, 5, 6, 0, -1, -6},
+  {-5, 5, 5, 0, -1, -5},
+  {-5, 4, 5, 0, -1, -5},
+  {-4, 4, 4, 0, -1, -5},
+  {-4, 4, 4, 0, -1, -4},
+  {-4, 3, 4, 0, -1, -4},
+  {-3, 3, 3, 0, -1, -4},
+  {-3, 3, 3, 0, -1, -3},
+  {-3, 2, 3, 0, 0, -3},
+  {-3, 2, 2, 0, 0, -3},
+  {-2, 2, 2, 0, 0, -3},
+  {-2, 2, 2, 0, 0, -2},
+  {-2, 1, 2, 0, 0, -2},
+  {-2, 1, 1, 0, 0, -2},
+  {-1, 1, 1, 0, 0, -1},
+  {-1, 0, 0, 0, 0, -1},
+  {0, 0, 0, 0, 0, 0},
+  {0, -1, -1, 0, 0, 0},
+  {1, -1, -1, 0, 0, 1},
+  {1, -2, -2, 0, 0, 1},
+  {1, -2, -2, 0, 0, 2},
+  {2, -2, -2, 0, 0, 2},
+  {2, -2, -3, 0, 0, 2},
+  {2, -3, -3, 0, 0, 2},
+  {2, -3, -3, 0, 0, 3},
+  {3, -3, -3, -1, 0, 3},
+  {3, -3, -4, -1, 0, 3},
+  {3, -4, -4, -1, 0, 4},
+  {4, -4, -4, -1, 0, 4},
+  {4, -4, -5, -1, 0, 4},
+  {4, -5, -5, -1, 0, 5},
+  {5, -5, -5, -1, 0, 5},
+  {5, -5, -6, -1, 0, 6},
+  {5, -6, -6, -1, 0, 6},
+  {6, -6, -6, -1, 0, 6},
+  {6, -6, -6, -1, 0, 7},
+  {6, -6, -7, -1, 0, 7},
+  {6, -7, -7, -1, 0, 7},
+  {7, -7, -7, -1, 0, 8},
+  {7, -7, -7, -1, 1, 8},
+  {7, -7, -8, -1, 1, 8},
+  {7, -8, -8, -1, 1, 8},
+  {7, -8, -8, -1, 1, 9},
+  {8, -8, -8, -1, 1, 9},
+  {8, -8, -9, -1, 1, 9},
+  {8, -9, -9, -1, 1, 10},
+  {9, -9, -9, -1, 1, 10},
+  {9, -9, -10, -1, 1, 11},
+  {9, -10, -10, -1, 1, 11},
+  {10, -10, -10, -1, 1, 11},
+  {10, -10, -10, -1, 1, 12},
+  {10, -10, -11, -1, 1, 12},
+  {10, -11, -11, -1, 1, 12},
+  {11, -11, -11, -1, 1, 12},
+  {11, -11, -11, -1, 1, 13},
+  {11, -12, -12, -1, 1, 14},
+  {12, -12, -12, -1, 1, 14},
+  {12, -12, -12, -1, 1, 15},
+  {12, -13, -12, -1, 1, 15},
+  {13, -13, -13, -1, 1, 15},
+  {13, -13, -13, -1, 1, 16},
+  {13, -14, -13, -1, 1, 16},
+  {14, -14, -13, -1, 1, 16},
+  {14, -14, -14, -1, 1, 17},
+  {14, -14, -14, -2, 1, 17},
+  {15, -15, -14, -2, 1, 18},
+  {15, -15, -15, -2, 1, 18},
+  {15, -15, -15, -2, 1, 19},
+  {16, -16, -15, -2, 1, 19},
+  {16, -16, -15, -2, 2, 19},
+  {16, -16, -15, -2, 2, 20},
+  {17, -16, -16, -2, 2, 20},
+  {17, -17, -16, -2, 2, 20},
+  {17, -17, -16, -2, 2, 21},
+  {18, -17, -16, -2, 2, 21},
+  {18, -17, -16, -2, 2, 22},
+  {18, -18, -16, -2, 2, 22},
+  {18, -18, -17, -2, 2, 22},
+  {18, -18, -17, -2, 2, 23},
+  {19, -18, -17, -2, 2, 23},
+  {19, -19, -17, -2, 2, 23},
+  {19, -19, -17, -2, 2, 24},
+  {19, -19, -18, -2, 2, 24},
+  {20, -19, -18, -2, 2, 24},
+  {20, -20, -18, -2, 2, 25},
+  {21, -20, -18, -2, 2, 26},
+  {21, -21, -18, -2, 2, 26},
+  {21, -21, -19, -2, 2, 26},
+  {21, -21, -19, -2, 2, 27},
+  {22, -21, -19, -2, 2, 27},
+  {22, -22, -19, -2, 2, 28},
+  {23, -22, -19, -2, 2, 28},
+  {23, -22, -19, -2, 2, 29},
+  {23, -22, -20, -2, 2, 29},
+  {23, -23, -20, -2, 2, 29},
+  {24, -23, -20, -2, 2, 30},
+  {24, -23, -20, -2, 3, 30},
+  {24, -23, -20, -2, 3, 31},
+  {24, -24, -20, -2, 3, 31},
+  {25, -24, -20, -2, 3, 31},
+  {25, -24, -21, -2, 3, 32},
+  {26, -25, -21, -2, 3, 32},
+  {26, -25, -21, -2, 3, 33},
+  {26, -25, -21, -2, 3, 34},
+  {27, -26, -21, -2, 3, 34},
+  {27, -26, -21, -2, 3, 35},
+  {27, -26, -22, -2, 3, 35},
+  {28, -26, -22, -2, 3, 35},
+  {28, -26, -22, -2, 3, 36},
+  {28, -27, -22, -2, 3, 36},
+  {28, -27, -22, -2, 3, 37},
+  {29, -27, -22, -2, 3, 37},
+  {29, -28, -22, -2, 3, 37},
+  {29, -28, -22, -2, 3, 38},
+  {30, -28, -22, -2, 3, 38},
+  {30, -28, -22, -2, 3, 39},
+  {30, -29, -23, -3, 3, 39},
+  {31, -29, -23, -3, 3, 40},
+  {31, -29, -23, -3, 3, 41},
+  {31, -30, -23, -3, 3, 41},
+  {32, -30, -23, -3, 3, 41},
+  {32, -30, -23, -3, 4, 41},
+  {32, -30, -23, -3, 4, 42},
+  {33, -31, -23, -3, 4, 43},
+  {33, -31, -23, -3, 4, 44},
+  {34, -31, -23, -3, 4, 44},
+  {34, -32, -23, -3, 4, 44},
+  {34, -32, -23, -3, 4, 45},
+  {35, -32, -24, -3, 4, 46},
+  {35, -33, -24, -3, 4, 46},
+  {35, -33, -24, -3, 4, 47},
+  {36, -33, -24, -3, 4, 47},
+  {36, -33, -24, -3, 4, 48},
+  {36, -34, -24, -3, 4, 48},
+  {37, -34, -24, -3, 4, 49},
+  {37, -34, -24, -3, 4, 50},
+  {38, -35, -24, -3, 4, 50},
+  {38, -35, -24, -3, 4, 51},
+  {39, -35, -24, -3, 4, 52},
+  {39, -36, -24, -3, 4, 52},
+  {39, -36, -24, -3, 4, 53},
+  {39, -36, -24, -3, 5, 53},
+  {40, -36, -24, -3, 5, 53},
+  {40, -36, -24, -3, 5, 54},
+  {40, -37, -24, -3, 5, 54},
+  {40, -37, -24, -3, 5, 55},
+  {41, -37, -24, -3, 5, 55},
+  {41, -37, -24, -3, 5, 56},
+  {42, -38, -24, -3, 5, 56},
+  {42, -38, -24, -3, 5, 57},
+  {42, -38, -24, -3, 5, 58},
+  {43, -38, -24, -3, 5, 58},
+  {43, -39, -24, -3, 5, 59},
+  {43, -39, -23, -3, 5, 59},
+  {44, -39, -23, -3, 5, 60},
+  {44, -39, -23, -3, 5, 61},
+  {44, -40, -23, -3, 5, 61},
+  {45, -40, -23, -3, 5, 61},
+  {45, -40, -23, -3, 5, 62},
+  {45, -40, -23, -3, 5, 63},
+  {46, -40, -23, -3, 5, 63},
+  {46, -41, -23, -3, 5, 63},
+  {46, -41, -23, -3, 5, 64},
+  {46, -41, -23, -3, 6, 64},
+  {47, -41, -23, -3, 6, 65},
+  {47, -42, -23, -3, 6, 66},
+  {48, -42, -23, -3, 6, 66},
+  {48, -42, -22, -3, 6, 67},
+  {48, -42, -22, -3, 6, 68},
+  {49, -42, -22, -3, 6, 68},
+  {49, -43, -22, -3, 6, 68},
+  {49, -43, -22, -3, 6, 69},
+  {50, -43, -22, -3, 6, 70},
+  {50, -43, -22, -3, 6, 71},
+  {50, -44, -22, -3, 6, 71},
+  {51, -44, -22, -3, 6, 71},
+  {51, -44, -21, -3, 6, 72},
+  {51, -44, -21, -3, 6, 73},
+  {52, -44, -21, -3, 6, 73},
+  {52, -44, -21, -3, 6, 74},
+  {52, -45, -21, -3, 6, 74},
+  {52, -45, -21, -3, 6, 75},
+  {53, -45, -21, -3, 6, 75},
+  {53, -45, -20, -3, 6, 76},
+  {54, -45, -20, -3, 7, 77},
+  {54, -46, -20, -3, 7, 77},
+  {54, -46, -20, -3, 7, 78},
+  {55, -46, -20, -3, 7, 78},
+  {55, -46, -20, -3, 7, 79},
+  {55, -46, -19, -3, 7, 79},
+  {55, -46, -19, -3, 7, 80},
+  {56, -46, -19, -3, 7, 80},
+  {56, -47, -19, -3, 7, 80},
+  {56, -47, -19, -3, 7, 81},
+  {56, -47, -19, -3, 7, 82},
+  {57, -47, -19, -3, 7, 82},
+  {57, -47, -18, -3, 7, 83},
+  {57, -47, -18, -3, 7, 84},
+  {58, -47, -18, -3, 7, 84},
+  {58, -48, -18, -3, 7, 84},
+  {58, -48, -18, -3, 7, 85},
+  {58, -48, -18, -3, 7, 86},
+  {59, -48, -17, -3, 7, 86},
+  {59, -48, -17, -3, 7, 87},
+  {60, -48, -17, -3, 7, 88},
+  {60, -49, -17, -3, 7, 88},
+  {60, -49, -17, -3, 7, 89},
+  {60, -49, -16, -3, 7, 89},
+  {61, -49, -16, -3, 8, 90},
+  {-44, 90, -44, 90, -44, 90},
+  {-44, 89, -44, 89, -44, 89},
+  {-44, 88, -44, 88, -44, 88},
+  {-44, 87, -44, 87, -44, 87},
+  {-44, 86, -44, 86, -44, 86},
+  {-44, 85, -44, 85, -44, 85},
+  {-44, 84, -44, 84, -44, 84},
+  {-44, 83, -44, 83, -44, 83},
+  {-44, 82, -44, 82, -44, 82},
+  {-44, 81, -44, 81, -44, 81},
+  {-44, 80, -44, 80, -44, 80},
+  {-44, 79, -44, 79, -44, 79},
+  {-44, 78, -44, 78, -44, 78},
+  {-44, 77, -44, 77, -44, 77},
+  {-44, 76, -44, 76, -44, 76},
+  {-44, 75, -44, 75, -44, 75},
+  {-44, 74, -44, 74, -44, 74},
+  {-44, 73, -44, 73, -44, 73},
+  {-44, 72, -44, 72, -44, 72},
+  {-44, 71, -44, 71, -44, 71},
+  {-44, 70, -44, 70, -44, 70},
+  {-43, 70, -43, 70, -43, 70},
+  {-43, 69, -43, 69, -43, 69},
+  {-43, 68, -43, 68, -43, 68},
+  {-43, 67, -43, 67, -43, 67},
+  {-43, 66, -43, 66, -43, 66},
+  {-43, 65, -43, 65, -43, 65},
+  {-42, 65, -42, 65, -42, 65},
+  {-42, 64, -42, 64, -42, 64},
+  {-42, 63, -42, 63, -42, 63},
+  {-42, 62, -42, 62, -42, 62},
+  {-42, 61, -42, 61, -42, 61},
+  {-41, 61, -41, 61, -41, 61},
+  {-41, 60, -41, 60, -41, 60},
+  {-41, 59, -41, 59, -41, 59},
+  {-41, 58, -41, 58, -41, 58},
+  {-40, 58, -40, 58, -40, 58},
+  {-40, 57, -40, 57, -40, 57},
+  {-40, 56, -40, 56, -40, 56},
+  {-40, 55, -40, 55, -40, 55},
+  {-39, 55, -39, 55, -39, 55},
+  {-39, 54, -39, 54, -39, 54},
+  {-39, 53, -39, 53, -39, 53},
+  {-38, 52, -38, 52, -38, 52},
+  {-38, 51, -38, 51, -38, 51},
+  {-38, 50, -38, 50, -38, 50},
+  {-37, 50, -37, 50, -37, 50},
+  {-37, 49, -37, 49, -37, 49},
+  {-37, 48, -37, 48, -37, 48},
+  {-36, 48, -36, 48, -36, 48},
+  {-36, 47, -36, 47, -36, 47},
+  {-36, 46, -36, 46, -36, 46},
+  {-35, 46, -35, 46, -35, 46},
+  {-35, 45, -35, 45, -35, 45},
+  {-35, 44, -35, 44, -35, 44},
+  {-34, 44, -34, 44, -34, 44},
+  {-34, 43, -34, 43, -34, 43},
+  {-34, 42, -34, 42, -34, 42},
+  {-33, 42, -33, 42, -33, 42},
+  {-33, 41, -33, 41, -33, 41},
+  {-32, 40, -32, 40, -32, 40},
+  {-32, 39, -32, 39, -32, 39},
+  {-31, 38, -31, 38, -31, 38},
+  {-31, 37, -31, 37, -31, 37},
+  {-30, 37, -30, 37, -30, 37},
+  {-30, 36, -30, 36, -30, 36},
+  {-29, 35, -29, 35, -29, 35},
+  {-29, 34, -29, 34, -29, 34},
+  {-28, 33, -28, 33, -28, 33},
+  {-27, 32, -27, 32, -27, 32},
+  {-27, 31, -27, 31, -27, 31},
+  {-26, 30, -26, 30, -26, 30},
+  {-25, 29, -25, 29, -25, 29},
+  {-25, 28, -25, 28, -25, 28},
+  {-24, 28, -24, 28, -24, 28},
+  {-24, 27, -24, 27, -24, 27},
+  {-23, 26, -23, 26, -23, 26},
+  {-22, 25, -22, 25, -22, 25},
+  {-22, 24, -22, 24, -22, 24},
+  {-21, 24, -21, 24, -21, 24},
+  {-21, 23, -21, 23, -21, 23},
+  {-20, 22, -20, 22, -20, 22},
+  {-20, 21, -20, 21, -20, 21},
+  {-19, 21, -19, 21, -19, 21},
+  {-19, 20, -19, 20, -19, 20},
+  {-18, 20, -18, 20, -18, 20},
+  {-18, 19, -18, 19, -18, 19},
+  {-17, 18, -17, 18, -17, 18},
+  {-16, 17, -16, 17, -16, 17},
+  {-15, 16, -15, 16, -15, 16},
+  {-14, 15, -14, 15, -14, 15},
+  {-14, 14, -14, 14, -14, 14},
+  {-13, 14, -13, 14, -13, 14},
+  {-13, 13, -13, 13, -13, 13},
+  {-12, 13, -12, 13, -12, 13},
+  {-12, 12, -12, 12, -12, 12},
+  {-11, 11, -11, 11, -11, 11},
+  {-10, 10, -10, 10, -10, 10},
+  {-9, 9, -9, 9, -9, 9},
+  {-8, 8, -8, 8, -8, 8},
+  {-8, 7, -8, 7, -8, 7},
+  {-7, 7, -7, 7, -7, 7},
+  {-6, 6, -6, 6, -6, 6},
+  {-6, 5, -6, 5, -6, 5},
+  {-5, 5, -5, 5, -5, 5},
+  {-5, 4, -5, 4, -5, 4},
+  {-4, 4, -4, 4, -4, 4},
+  {-4, 3, -4, 3, -4, 3},
+  {-3, 3, -3, 3, -3, 3},
+  {-3, 2, -3, 2, -3, 2},
+  {-2, 2, -2, 2, -2, 2},
+  {-2, 1, -2, 1, -2, 1},
+  {-1, 1, -1, 1, -1, 1},
+  {-1, 0, -1, 0, -1, 0},
+  {0, 0, 0, 0, 0, 0},
+  {0, -1, 0, -1, 0, -1},
+  {1, -1, 1, -1, 1, -1},
+  {1, -2, 1, -2, 1, -2},
+  {2, -2, 2, -2, 2, -2},
+  {2, -3, 2, -3, 2, -3},
+  {3, -3, 3, -3, 3, -3},
+  {3, -4, 3, -4, 3, -4},
+  {4, -4, 4, -4, 4, -4},
+  {4, -5, 4, -5, 4, -5},
+  {5, -5, 5, -5, 5, -5},
+  {5, -6, 5, -6, 5, -6},
+  {6, -6, 6, -6, 6, -6},
+  {7, -7, 7, -7, 7, -7},
+  {7, -8, 7, -8, 7, -8},
+  {8, -8, 8, -8, 8, -8},
+  {9, -9, 9, -9, 9, -9},
+  {10, -10, 10, -10, 10, -10},
+  {11, -11, 11, -11, 11, -11},
+  {12, -12, 12, -12, 12, -12},
+  {13, -12, 13, -12, 13, -12},
+  {13, -13, 13, -13, 13, -13},
+  {14, -13, 14, -13, 14, -13},
+  {14, -14, 14, -14, 14, -14},
+  {15, -14, 15, -14, 15, -14},
+  {16, -15, 16, -15, 16, -15},
+  {17, -16, 17, -16, 17, -16},
+  {18, -17, 18, -17, 18, -17},
+  {19, -18, 19, -18, 19, -18},
+  {20, -18, 20, -18, 20, -18},
+  {20, -19, 20, -19, 20, -19},
+  {21, -19, 21, -19, 21, -19},
+  {21, -20, 21, -20, 21, -20},
+  {22, -20, 22, -20, 22, -20},
+  {23, -21, 23, -21, 23, -21},
+  {24, -21, 24, -21, 24, -21},
+  {24, -22, 24, -22, 24, -22},
+  {25, -22, 25, -22, 25, -22},
+  {26, -23, 26, -23, 26, -23},
+  {27, -24, 27, -24, 27, -24},
+  {28, -24, 28, -24, 28, -24},
+  {28, -25, 28, -25, 28, -25},
+  {29, -25, 29, -25, 29, -25},
+  {30, -26, 30, -26, 30, -26},
+  {31, -27, 31, -27, 31, -27},
+  {32, -27, 32, -27, 32, -27},
+  {33, -28, 33, -28, 33, -28},
+  {34, -29, 34, -29, 34, -29},
+  {35, -29, 35, -29, 35, -29},
+  {36, -30, 36, -30, 36, -30},
+  {37, -30, 37, -30, 37, -30},
+  {37, -31, 37, -31, 37, -31},
+  {38, -31, 38, -31, 38, -31},
+  {39, -32, 39, -32, 39, -32},
+  {40, -32, 40, -32, 40, -32},
+  {41, -33, 41, -33, 41, -33},
+  {42, -33, 42, -33, 42, -33},
+  {42, -34, 42, -34, 42, -34},
+  {43, -34, 43, -34, 43, -34},
+  {44, -34, 44, -34, 44, -34},
+  {44, -35, 44, -35, 44, -35},
+  {45, -35, 45, -35, 45, -35},
+  {46, -35, 46, -35, 46, -35},
+  {46, -36, 46, -36, 46, -36},
+  {47, -36, 47, -36, 47, -36},
+  {48, -36, 48, -36, 48, -36},
+  {48, -37, 48, -37, 48, -37},
+  {49, -37, 49, -37, 49, -37},
+  {50, -37, 50, -37, 50, -37},
+  {50, -38, 50, -38, 50, -38},
+  {51, -38, 51, -38, 51, -38},
+  {52, -38, 52, -38, 52, -38},
+  {53, -39, 53, -39, 53, -39},
+  {54, -39, 54, -39, 54, -39},
+  {55, -39, 55, -39, 55, -39},
+  {55, -40, 55, -40, 55, -40},
+  {56, -40, 56, -40, 56, -40},
+  {57, -40, 57, -40, 57, -40},
+  {58, -40, 58, -40, 58, -40},
+  {58, -41, 58, -41, 58, -41},
+  {59, -41, 59, -41, 59, -41},
+  {60, -41, 60, -41, 60, -41},
+  {61, -41, 61, -41, 61, -41},
+  {61, -42, 61, -42, 61, -42},
+  {62, -42, 62, -42, 62, -42},
+  {63, -42, 63, -42, 63, -42},
+  {64, -42, 64, -42, 64, -42},
+  {65, -42, 65, -42, 65, -42},
+  {65, -43, 65, -43, 65, -43},
+  {66, -43, 66, -43, 66, -43},
+  {67, -43, 67, -43, 67, -43},
+  {68, -43, 68, -43, 68, -43},
+  {69, -43, 69, -43, 69, -43},
+  {70, -43, 70, -43, 70, -43},
+  {70, -44, 70, -44, 70, -44},
+  {71, -44, 71, -44, 71, -44},
+  {72, -44, 72, -44, 72, -44},
+  {73, -44, 73, -44, 73, -44},
+  {74, -44, 74, -44, 74, -44},
+  {75, -44, 75, -44, 75, -44},
+  {76, -44, 76, -44, 76, -44},
+  {77, -44, 77, -44, 77, -44},
+  {78, -44, 78, -44, 78, -44},
+  {79, -44, 79, -44, 79, -44},
+  {80, -44, 80, -44, 80, -44},
+  {81, -44, 81, -44, 81, -44},
+  {82, -44, 82, -44, 82, -44},
+  {83, -44, 83, -44, 83, -44},
+  {84, -44, 84, -44, 84, -44},
+  {85, -44, 85, -44, 85, -44},
+  {86, -44, 86, -44, 86, -44},
+  {87, -44, 87, -44, 87, -44},
+  {88, -44, 88, -44, 88, -44},
+  {89, -44, 89, -44, 89, -44},
+  {90, -44, 90, -44, 90, -44},
+};
@@ -0,0 +1,198 @@
+/**********************************************************************************
+  stewartGuard.h
+
+  This file contains the class definition, attributes, and methods of the StewartGuard.
+  It is the runtime version of refinePoses() in MATLAB/stewartPlatformCalcs.m. Every pose
+  is checked before it is sent to the legs so a pose stream can never command a leg past
+  Lmin or Lmax. Every control tick the guard:
+      1. Clamps the pose to the workspace box that was swept in MATLAB.
+      2. If a leg is still out of range, searches along the line from the last safe pose
+         to the goal (bisection) for the closest pose where every leg is in range.
+      3. Limits the speed of the pose. When a leg gets close to Lmin or Lmax the servo horn
+         is close to straight up or down (a singular pose where a small horn movement
+         barely changes the leg length), so the speed is lowered near the limits.
+      4. Counts the number of poses that were clamped or slowed down (telemetry).
+ *********************************************************************************/
+#include <Arduino.h>
+
+class StewartGuard {
+  private:
+    static const int numLegs = StewartPlatform::numLegs;
+    StewartPlatform *platform;
+
+    // WORKSPACE BOX (same ranges as the sweeps in stewartPlatformCalcs.m)
+    float poseMin[6];
+    float poseMax[6];
+
+    // SEARCH AND SPEED SETTINGS
+    const int numBisections = 8;            // bisection steps when the goal is out of range
+    const float maxLinSpeed = 4;            // fastest x, y, z speed (inches per second)
+    const float maxRotSpeed = 180 * DEG_TO_RAD; // fastest rotation speed (radians per second)
+    const float slowMargin = 0.3;           // start slowing down when a leg is this close to a limit (in)
+    const float minSpeedScale = 0.2;        // fraction of the max speed used right at a limit
+
+    float lastSafe[6];                      // last pose sent to the legs
+    float lastMargin = 0;                   // leg length margin of the last safe pose (in)
+
+    // TELEMETRY
+    unsigned long numPoses = 0;
+    unsigned long numClamped = 0;           // poses that were out of range
+    unsigned long numRateLimited = 0;       // poses that were slowed down
+
+    /*
+       legMargin - distance from the closest leg to its limit
+            const float pose[6] - pose to check
+            return float - smallest distance to Lmin or Lmax in inches (negative if a leg is out of range)
+    */
+    float legMargin(const float pose[6]) {
+      float legLength[numLegs];
+      platform->invKin(pose, legLength);
+      float margin = platform->Lmax - platform->Lmin;
+      for (int i = 0; i < numLegs; i++) {
+        margin = min(margin, min(legLength[i] - platform->Lmin, platform->Lmax - legLength[i]));
+      }
+      return margin;
+    }
+
+    /*
+       blend - pose part of the way from one pose to another
+            const float from[6] - starting pose
+            const float to[6] - ending pose
+            float fraction - how far along (0-1)
+            float result[6] - resulting pose
+    */
+    void blend(const float from[6], const float to[6], float fraction, float result[6]) {
+      for (int i = 0; i < 6; i++) {
+        result[i] = from[i] + (to[i] - from[i]) * fraction;
+      }
+    }
+
+  public:
+    //************************************************INITIALIZE********************************
+    // Define the guard
+    StewartGuard(StewartPlatform &stewartPlatform) {
+      platform = &stewartPlatform;
+      float boxMin[6] = {-1, -1, platform->homeZ, -70 * DEG_TO_RAD, -45 * DEG_TO_RAD, -90 * DEG_TO_RAD};
+      float boxMax[6] = {1, 1, platform->homeZ + 2 * sqrtf(2.0f), 70 * DEG_TO_RAD, 45 * DEG_TO_RAD, 90 * DEG_TO_RAD};
+      for (int i = 0; i < 6; i++) {
+        poseMin[i] = boxMin[i];
+        poseMax[i] = boxMax[i];
+      }
+      reset();
+    }
+
+    /*
+       reset - start from the home pose (ex. when the servos are first turned on)
+    */
+    void reset() {
+      for (int i = 0; i < 6; i++) {
+        lastSafe[i] = 0;
+      }
+      lastSafe[2] = platform->homeZ + 0.5;
+      lastMargin = legMargin(lastSafe);
+    }
+
+    //************************************************LIMITING********************************
+    /*
+       limitPose - guard a pose before it is sent to the legs. Run this every control tick.
+            const float goal[6] - commanded pose [x, y, z, wx, wy, wz]
+            float dt - time since the last pose (seconds)
+            float safe[6] - resulting pose that is reachable and within the speed limits
+            return boolean - true if the goal was sent unchanged
+    */
+    boolean limitPose(const float goal[6], float dt, float safe[6]) {
+      numPoses++;
+      boolean isClamped = false;
+      float target[6];
+      for (int i = 0; i < 6; i++) {
+        target[i] = constrain(goal[i], poseMin[i], poseMax[i]);
+        if (target[i] != goal[i]) {
+          isClamped = true;
+        }
+      }
+
+      // the last safe pose is reachable, so search the line towards the goal for the last reachable pose
+      if (legMargin(target) < 0) {
+        isClamped = true;
+        float lo = 0;
+        float hi = 1;
+        for (int i = 0; i < numBisections; i++) {
+          float mid = (lo + hi) / 2;
+          float test[6];
+          blend(lastSafe, target, mid, test);
+          if (legMargin(test) >= 0) {
+            lo = mid;
+          } else {
+            hi = mid;
+          }
+        }
+        float reachable[6];
+        blend(lastSafe, target, lo, reachable);
+        for (int i = 0; i < 6; i++) {
+          target[i] = reachable[i];
+        }
+      }
+      if (isClamped) {
+        numClamped++;
+      }
+
+      // slow down when the last pose was close to a leg limit
+      float scale = constrain(lastMargin / slowMargin, minSpeedScale, 1.0f);
+      float maxLinStep = maxLinSpeed * scale * dt;
+      float maxRotStep = maxRotSpeed * scale * dt;
+      float largest = 0;   // largest step compared to its limit
+      for (int i = 0; i < 6; i++) {
+        float maxStep = (i < 3) ? maxLinStep : maxRotStep;
+        largest = max(largest, abs(target[i] - lastSafe[i]) / maxStep);
+      }
+      boolean isRateLimited = largest > 1;
+      if (isRateLimited) {
+        // scale the whole move by the same amount so every axis arrives at the same time
+        float fraction = 1 / largest;
+        blend(lastSafe, target, fraction, safe);
+        numRateLimited++;
+      } else {
+        for (int i = 0; i < 6; i++) {
+          safe[i] = target[i];
+        }
+      }
+
+      // the straight line to the target can leave the workspace so make sure the final pose is still reachable
+      float margin = legMargin(safe);
+      if (margin < 0) {
+        for (int i = 0; i < 6; i++) {
+          safe[i] = lastSafe[i];
+        }
+        margin = lastMargin;
+      }
+      for (int i = 0; i < 6; i++) {
+        lastSafe[i] = safe[i];
+      }
+      lastMargin = margin;
+      return !isClamped && !isRateLimited;
+    }
+
+    //************************************************TELEMETRY********************************
+    /*
+       getNumClamped - number of poses that were out of range
+    */
+    unsigned long getNumClamped() {
+      return numClamped;
+    }
+
+    /*
+       getNumRateLimited - number of poses that were slowed down
+    */
+    unsigned long getNumRateLimited() {
+      return numRateLimited;
+    }
+
+    /*
+       printTelemetry - print the guard counters
+    */
+    void printTelemetry() {
+      Serial.print("Poses = "); Serial.print(numPoses);
+      Serial.print("  clamped = "); Serial.print(numClamped);
+      Serial.print("  rate limited = "); Serial.println(numRateLimited);
+    }
+};
@@ -0,0 +1,361 @@
+/**********************************************************************************
+  stewartPlatform.h
+
+  This file contains the class definition, attributes, and methods of the StewartPlatform.
+  It is the C++ version of the inverse kinematics in MATLAB/stewartPlatformCalcs.m
+  (invKin() and getServoAngles()) and uses the same S and U anchor vectors, rod length
+  and servo horn length as the MATLAB model. Given a 6 DOF pose of the head
+  [x; y; z; wx; wy; wz] (inches and a rotation vector in radians), it calculates the
+  six leg lengths and the six rotary servo angles (0 deg = servo horn horizontal).
+
+  Two versions are included:
+      getServoAngles()      - floating point version for the Teensy FPU
+      getServoAnglesFixed() - fixed point version (Q16.16 inputs, centidegree outputs)
+                              that only uses integer math and small lookup tables
+  Both are written to be fast enough to run every tick of a 200 Hz control loop.
+
+  NOTE: Like the MATLAB model, the rotation matrix is the transpose of the standard
+        Rodrigues formula (this is what rotationVectorToMatrix() returns in MATLAB).
+        The angles do not account for legs that rotate CW or CCW for a positive
+        rotation. This is adjusted when the servos are driven (see NewNeckTest.ino).
+ *********************************************************************************/
+#include <Arduino.h>
+
+class StewartPlatform {
+  private:
+    // Top Angles for S Vectors (degrees)
+    const float angTopMidDeg = 30;   // top angle from x axis to the middle line between connections of legs 1 and 6
+    const float angTopInDeg = 9.39;  // top angle between lines from center to leg 1 and leg 6
+    // Bottom Angles for U Vectors (degrees)
+    const float angBotMidDeg = 30;
+    const float angBotInDeg = 44.72;
+
+    // Fixed point copies of the dimensions (Q16.16 inches)
+    int32_t SQ[6][2];
+    int32_t UQ[6][2];
+    int32_t rodLengthQ;
+    int32_t servoLQ;
+
+    // Fixed point lookup tables
+    static const int sinTableSize = 256;    // number of steps in a quarter wave of sine
+    int32_t sinTable[sinTableSize + 1];     // sin(0..pi/2) in Q16.16
+    static const int asinTableSize = 128;   // number of steps of asin from 0 to 0.5
+    int32_t asinTable[asinTableSize + 1];   // asin(0..0.5) in centidegrees
+
+    //************************************************FIXED POINT HELPERS********************************
+    /*
+       mulQ - multiply two Q16.16 numbers
+    */
+    static int32_t mulQ(int32_t a, int32_t b) {
+      return (int32_t)(((int64_t)a * b) >> 16);
+    }
+
+    /*
+       isqrt64 - integer square root of a 64 bit number (bit by bit method)
+    */
+    static uint32_t isqrt64(uint64_t value) {
+      uint64_t result = 0;
+      uint64_t bit = (uint64_t)1 << 62;
+      while (bit > value) {
+        bit >>= 2;
+      }
+      while (bit != 0) {
+        if (value >= result + bit) {
+          value -= result + bit;
+          result = (result >> 1) + bit;
+        } else {
+          result >>= 1;
+        }
+        bit >>= 2;
+      }
+      return (uint32_t)result;
+    }
+
+    /*
+       sinCosQ - sine and cosine of an angle from 0 to pi using the quarter wave table
+            int32_t angleQ - angle in Q16.16 radians
+            int32_t &sinQ, &cosQ - results in Q16.16
+    */
+    void sinCosQ(int32_t angleQ, int32_t &sinQ, int32_t &cosQ) {
+      const int32_t halfPiQ = 102944;  // pi/2 in Q16.16
+      boolean isSecondQuarter = angleQ > halfPiQ;
+      if (isSecondQuarter) {
+        angleQ = 2 * halfPiQ - angleQ;  // sin(pi - x) = sin(x), cos(pi - x) = -cos(x)
+      }
+      if (angleQ < 0) {
+        angleQ = 0;
+      }
+      sinQ = lookUpSin(angleQ);
+      cosQ = lookUpSin(halfPiQ - angleQ);
+      if (isSecondQuarter) {
+        cosQ = -cosQ;
+      }
+    }
+
+    /*
+       lookUpSin - linearly interpolate the sine table for an angle from 0 to pi/2
+    */
+    int32_t lookUpSin(int32_t angleQ) {
+      const int32_t halfPiQ = 102944;
+      // position in the table with 16 fractional bits
+      int64_t pos = ((int64_t)angleQ * sinTableSize << 16) / halfPiQ;
+      int idx = (int)(pos >> 16);
+      if (idx >= sinTableSize) {
+        return sinTable[sinTableSize];
+      }
+      int32_t frac = (int32_t)(pos & 0xFFFF);
+      return sinTable[idx] + mulQ(sinTable[idx + 1] - sinTable[idx], frac);
+    }
+
+    /*
+       asinCentiDeg - arcsine in centidegrees of a Q16.16 number from -1 to 1.
+                      For values above 0.5 the identity asin(x) = 90 - 2*asin(sqrt((1-x)/2))
+                      is used so the table never has to cover the steep part of the curve.
+    */
+    int32_t asinCentiDeg(int32_t xQ) {
+      boolean isNeg = xQ < 0;
+      if (isNeg) {
+        xQ = -xQ;
+      }
+      if (xQ > 65536) {
+        xQ = 65536;
+      }
+      int32_t result;
+      if (xQ <= 32768) {
+        result = lookUpAsin(xQ);
+      } else {
+        int32_t halfRemQ = (65536 - xQ) >> 1;                      // (1-x)/2 in Q16.16
+        int32_t rootQ = (int32_t)isqrt64((uint64_t)halfRemQ << 16); // sqrt in Q16.16
+        result = 9000 - 2 * lookUpAsin(rootQ);
+      }
+      return isNeg ? -result : result;
+    }
+
+    /*
+       lookUpAsin - linearly interpolate the arcsine table for a Q16.16 number from 0 to 0.5
+    */
+    int32_t lookUpAsin(int32_t xQ) {
+      int32_t pos = xQ * (asinTableSize * 2);    // table index with 16 fractional bits
+      int idx = pos >> 16;
+      if (idx >= asinTableSize) {
+        return asinTable[asinTableSize];
+      }
+      int32_t frac = pos & 0xFFFF;
+      return asinTable[idx] + (int32_t)(((int64_t)(asinTable[idx + 1] - asinTable[idx]) * frac) >> 16);
+    }
+
+  public:
+    static const int numLegs = 6; // number of legs
+
+    // Dimensions in inches (same as the MATLAB model)
+    const float topR = 5.65;
+    const float botR = 6.57;
+    const float rodLength = 4.724;
+    const float servoL = 2;                   // servo horn length
+    const float Lmin = rodLength - 2;         // minimum leg length
+    const float Lmax = rodLength + servoL * sqrt(2.0); // leg length when the servo horn is at 90 deg
+    const float homeZ = 3.075;                // z position where the leg lengths are about the rod length
+
+    // S vectors are from the center of the top platform to the top leg connections.
+    // U vectors are from the center of the bottom platform to the bottom leg connections.
+    // The z component is always 0 so only x and y are stored.
+    float S[6][2];
+    float U[6][2];
+
+    //************************************************INITIALIZE********************************
+    // Define the platform - calculate the anchor vectors and the lookup tables
+    StewartPlatform() {
+      float angTopMidRad = angTopMidDeg * DEG_TO_RAD;
+      float angTopInMidRad = (angTopInDeg / 2) * DEG_TO_RAD;
+      float angBotMidRad = angBotMidDeg * DEG_TO_RAD;
+      float angBotInMidRad = (angBotInDeg / 2) * DEG_TO_RAD;
+
+      // S Vectors
+      setVect(S[0], topR * cos(angTopMidRad + angTopInMidRad), topR * sin(angTopMidRad + angTopInMidRad));
+      setVect(S[1], -topR * cos(angTopMidRad + angTopInMidRad), topR * sin(angTopMidRad + angTopInMidRad));
+      setVect(S[2], -topR * cos(angTopMidRad - angTopInMidRad), topR * sin(angTopMidRad - angTopInMidRad));
+      setVect(S[3], -topR * cos((PI / 2) - angTopInMidRad), -topR * sin((PI / 2) - angTopInMidRad));
+      setVect(S[4], topR * cos((PI / 2) - angTopInMidRad), -topR * sin((PI / 2) - angTopInMidRad));
+      setVect(S[5], topR * cos(angTopMidRad - angTopInMidRad), topR * sin(angTopMidRad - angTopInMidRad));
+
+      // U Vectors
+      setVect(U[0], botR * cos((PI / 2) - angBotInMidRad), botR * sin((PI / 2) - angBotInMidRad));
+      setVect(U[1], -botR * cos((PI / 2) - angBotInMidRad), botR * sin((PI / 2) - angBotInMidRad));
+      setVect(U[2], -botR * cos(angBotMidRad - angBotInMidRad), -botR * sin(angBotMidRad - angBotInMidRad));
+      setVect(U[3], -botR * cos(angBotMidRad + angBotInMidRad), -botR * sin(angBotMidRad + angBotInMidRad));
+      setVect(U[4], botR * cos(angBotMidRad + angBotInMidRad), -botR * sin(angBotMidRad + angBotInMidRad));
+      setVect(U[5], botR * cos(angBotMidRad - angBotInMidRad), -botR * sin(angBotMidRad - angBotInMidRad));
+
+      // Fixed point copies
+      for (int i = 0; i < numLegs; i++) {
+        SQ[i][0] = toQ(S[i][0]);
+        SQ[i][1] = toQ(S[i][1]);
+        UQ[i][0] = toQ(U[i][0]);
+        UQ[i][1] = toQ(U[i][1]);
+      }
+      rodLengthQ = toQ(rodLength);
+      servoLQ = toQ(servoL);
+
+      // Lookup tables
+      for (int i = 0; i <= sinTableSize; i++) {
+        sinTable[i] = toQ(sin((PI / 2) * i / sinTableSize));
+      }
+      for (int i = 0; i <= asinTableSize; i++) {
+        asinTable[i] = (int32_t)lround(asin(0.5 * i / asinTableSize) * RAD_TO_DEG * 100);
+      }
+    }
+
+    /*
+       setVect - store an x and y component in a vector
+    */
+    void setVect(float *vect, float x, float y) {
+      vect[0] = x;
+      vect[1] = y;
+    }
+
+    /*
+       toQ - convert a float to Q16.16 fixed point
+    */
+    static int32_t toQ(float value) {
+      return (int32_t)lround(value * 65536.0);
+    }
+
+    //************************************************FLOATING POINT********************************
+    /*
+       invKin - calculate the leg lengths for a pose (same as invKin() in the MATLAB model)
+            const float pose[6] - [x, y, z, wx, wy, wz] in inches and radians (rotation vector)
+            float legLength[6] - resulting length of each leg in inches
+    */
+    void invKin(const float pose[6], float legLength[6]) {
+      float wx = pose[3];
+      float wy = pose[4];
+      float wz = pose[5];
+      float theta = sqrtf(wx * wx + wy * wy + wz * wz);
+      float kx = 0, ky = 0, kz = 0;   // unit rotation axis
+      float s = 0, c = 1;
+      if (theta > 1e-7f) {
+        kx = wx / theta;
+        ky = wy / theta;
+        kz = wz / theta;
+        s = sinf(theta);
+        c = cosf(theta);
+      }
+      float oneMinusC = 1 - c;
+
+      for (int i = 0; i < numLegs; i++) {
+        float sx = S[i][0];
+        float sy = S[i][1];
+        // R*S with the MATLAB (transposed) rotation: S*c - sin*(k x S) + (1-c)*(k.S)*k
+        float kDotS = (kx * sx + ky * sy) * oneMinusC;
+        float rx = sx * c + s * kz * sy + kDotS * kx;
+        float ry = sy * c - s * kz * sx + kDotS * ky;
+        float rz = -s * (kx * sy - ky * sx) + kDotS * kz;
+        // L = O + R*S - U
+        float lx = pose[0] + rx - U[i][0];
+        float ly = pose[1] + ry - U[i][1];
+        float lz = pose[2] + rz;
+        legLength[i] = sqrtf(lx * lx + ly * ly + lz * lz);
+      }
+    }
+
+    /*
+       legToServoAngle - convert a leg length to the servo horn angle (same as getServoAngles() in the MATLAB model)
+                         The MATLAB law of cosines acos(1 - r^2/(2*servoL^2)) is the same as 2*asin(r/(2*servoL)),
+                         which also gives the sign (negative = servo horn down) without a branch.
+            float legLength - leg length in inches
+            return float - servo angle in degrees with respect to horizontal
+    */
+    float legToServoAngle(float legLength) {
+      float ratio = (legLength - rodLength) / (2 * servoL);
+      ratio = constrain(ratio, -1.0f, 1.0f);
+      return 2 * asinf(ratio) * (float)RAD_TO_DEG;
+    }
+
+    /*
+       servoAngleToLeg - convert a servo horn angle back to the leg length (opposite of legToServoAngle())
+            float angleDeg - servo angle in degrees with respect to horizontal
+            return float - leg length in inches
+    */
+    float servoAngleToLeg(float angleDeg) {
+      return rodLength + 2 * servoL * sinf(angleDeg * (float)DEG_TO_RAD / 2);
+    }
+
+    /*
+       isLegInRange - check a leg length against the minimum and maximum leg lengths (see refinePoses() in MATLAB)
+    */
+    boolean isLegInRange(float legLength) {
+      return (legLength >= Lmin && legLength <= Lmax);
+    }
+
+    /*
+       getServoAngles - calculate the six servo angles for a pose
+            const float pose[6] - [x, y, z, wx, wy, wz] in inches and radians (rotation vector)
+            float angleDeg[6] - resulting servo angles in degrees
+            return boolean - true if every leg is within the leg length limits
+    */
+    boolean getServoAngles(const float pose[6], float angleDeg[6]) {
+      float legLength[numLegs];
+      boolean result = true;
+      invKin(pose, legLength);
+      for (int i = 0; i < numLegs; i++) {
+        angleDeg[i] = legToServoAngle(legLength[i]);
+        if (!isLegInRange(legLength[i])) {
+          result = false;
+        }
+      }
+      return result;
+    }
+
+    //************************************************FIXED POINT********************************
+    /*
+       getServoAnglesFixed - fixed point version of getServoAngles(). Only uses integer math so it can also
+                             be used on boards without an FPU.
+            const int32_t poseQ[6] - [x, y, z, wx, wy, wz] in Q16.16 inches and radians (|rotation| <= pi)
+            int16_t angleCentiDeg[6] - resulting servo angles in hundredths of a degree
+            return boolean - true if every leg is within the leg length limits
+    */
+    boolean getServoAnglesFixed(const int32_t poseQ[6], int16_t angleCentiDeg[6]) {
+      int64_t thetaSq = (int64_t)poseQ[3] * poseQ[3] + (int64_t)poseQ[4] * poseQ[4] + (int64_t)poseQ[5] * poseQ[5];
+      int32_t thetaQ = (int32_t)isqrt64((uint64_t)thetaSq);   // Q32 -> Q16
+      int32_t kx = 0, ky = 0, kz = 0;
+      int32_t s = 0, c = 65536;
+      if (thetaQ > 0) {
+        kx = (int32_t)(((int64_t)poseQ[3] << 16) / thetaQ);
+        ky = (int32_t)(((int64_t)poseQ[4] << 16) / thetaQ);
+        kz = (int32_t)(((int64_t)poseQ[5] << 16) / thetaQ);
+        sinCosQ(thetaQ, s, c);
+      }
+      int32_t oneMinusC = 65536 - c;
+      int32_t LminQ = toQ(Lmin);
+      int32_t LmaxQ = toQ(Lmax);
+      boolean result = true;
+
+      for (int i = 0; i < numLegs; i++) {
+        int32_t sx = SQ[i][0];
+        int32_t sy = SQ[i][1];
+        int32_t kDotS = mulQ(mulQ(kx, sx) + mulQ(ky, sy), oneMinusC);
+        int32_t rx = mulQ(sx, c) + mulQ(mulQ(s, kz), sy) + mulQ(kDotS, kx);
+        int32_t ry = mulQ(sy, c) - mulQ(mulQ(s, kz), sx) + mulQ(kDotS, ky);
+        int32_t rz = -mulQ(s, mulQ(kx, sy) - mulQ(ky, sx)) + mulQ(kDotS, kz);
+        int32_t lx = poseQ[0] + rx - UQ[i][0];
+        int32_t ly = poseQ[1] + ry - UQ[i][1];
+        int32_t lz = poseQ[2] + rz;
+        int32_t legQ = (int32_t)isqrt64((uint64_t)((int64_t)lx * lx + (int64_t)ly * ly + (int64_t)lz * lz));
+        if (legQ < LminQ || legQ > LmaxQ) {
+          result = false;
+        }
+        int32_t ratioQ = (int32_t)(((int64_t)(legQ - rodLengthQ) << 16) / (2 * servoLQ));
+        angleCentiDeg[i] = (int16_t)(2 * asinCentiDeg(ratioQ));
+      }
+      return result;
+    }
+
+    /*
+       poseToQ - convert a floating point pose to the fixed point format used by getServoAnglesFixed()
+    */
+    static void poseToQ(const float pose[6], int32_t poseQ[6]) {
+      for (int i = 0; i < 6; i++) {
+        poseQ[i] = toQ(pose[i]);
+      }
+    }
+};